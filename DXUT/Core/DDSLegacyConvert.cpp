@@ -0,0 +1,42 @@
+//--------------------------------------------------------------------------------------
+// File: DDSLegacyConvert.cpp
+//
+// Chooses the DXGI format legacy masked DDS pixel formats are expanded to
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "dxut.h"
+
+#include "DDSLegacyConvert.h"
+
+using namespace DirectX;
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+bool DirectX::GetDDSLegacyConversion( uint32_t flags, uint32_t bitCount,
+                                      uint32_t rMask, uint32_t gMask, uint32_t bMask, uint32_t aMask,
+                                      DDS_LEGACY_CONVERSION* conv )
+{
+    if( !conv )
+        return false;
+
+    conv->format = DXGI_FORMAT_UNKNOWN;
+    if( !GetDDSLegacyLayout( flags, bitCount, rMask, gMask, bMask, aMask, conv ) )
+        return false;
+
+    static const DXGI_FORMAT s_Formats8[] = { DXGI_FORMAT_R8_UNORM, DXGI_FORMAT_R8G8_UNORM, DXGI_FORMAT_UNKNOWN, DXGI_FORMAT_R8G8B8A8_UNORM };
+    static const DXGI_FORMAT s_Formats16[] = { DXGI_FORMAT_R16_UNORM, DXGI_FORMAT_R16G16_UNORM, DXGI_FORMAT_UNKNOWN, DXGI_FORMAT_R16G16B16A16_UNORM };
+    conv->format = ( conv->dstChannelBits == 16 ) ? s_Formats16[ conv->channelCount - 1 ] : s_Formats8[ conv->channelCount - 1 ];
+    if( flags & DDS_LEGACY_ALPHA )
+        conv->format = DXGI_FORMAT_A8_UNORM;
+
+    return true;
+}
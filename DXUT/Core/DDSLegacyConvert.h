@@ -0,0 +1,38 @@
+//--------------------------------------------------------------------------------------
+// File: DDSLegacyConvert.h
+//
+// Picks the nearest DXGI format for legacy masked DDS pixel formats that have no DXGI
+// equivalent, such as 24-bit RGB, X8B8G8R8, X1R5G5B5, A4L4 or A2R10G10B10.  The kernels
+// in DDSLegacyKernels.h expand the pixels to it on the CPU.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+#include <d3d11_1.h>
+#include <stdint.h>
+
+#include "DDSLegacyKernels.h"
+
+namespace DirectX
+{
+    // A layout with the DXGI format its pixels are converted to
+    struct DDS_LEGACY_CONVERSION : DDS_LEGACY_LAYOUT
+    {
+        DXGI_FORMAT format;         // R8G8B8A8, R16G16B16A16, R8, R8G8, R16, R16G16 or A8 UNORM
+    };
+
+    // DDS_RGB, DDS_LUMINANCE or DDS_ALPHA formats only.  Returns false for layouts with
+    // overlapping or non-contiguous masks, channels wider than 16 bits, or unusual bit counts.
+    // DDSLegacyKernels.h converts the pixels.
+    bool GetDDSLegacyConversion( _In_ uint32_t flags, _In_ uint32_t bitCount,
+                                 _In_ uint32_t rMask, _In_ uint32_t gMask, _In_ uint32_t bMask, _In_ uint32_t aMask,
+                                 _Out_ DDS_LEGACY_CONVERSION* conv );
+}
@@ -0,0 +1,494 @@
+//--------------------------------------------------------------------------------------
+// File: DDSLegacyKernels.h
+//
+// The CPU kernels that expand legacy masked DDS pixels, such as 24-bit RGB, X1R5G5B5,
+// A4L4 or A2R10G10B10, to 8 or 16 bits a channel.  Has no Direct3D or Windows dependency,
+// so the SSSE3 kernels can be checked against the scalar path on any x86 compiler; build
+// with -mssse3 where the compiler does not enable SSSE3 itself.  DDSLegacyConvert.h picks
+// the DXGI format for a layout.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#if defined(_M_IX86) || defined(_M_X64)
+#include <intrin.h>
+#include <tmmintrin.h>
+#define DDS_LEGACY_SSSE3
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#define DDS_LEGACY_SSSE3
+#endif
+
+namespace DirectX
+{
+    const uint32_t DDS_LEGACY_RGB       = 0x00000040;  // DDPF_RGB
+    const uint32_t DDS_LEGACY_LUMINANCE = 0x00020000;  // DDPF_LUMINANCE
+    const uint32_t DDS_LEGACY_ALPHA     = 0x00000002;  // DDPF_ALPHA
+
+    // Below this many pixels per thread, starting a thread costs more than it saves
+    const size_t DDS_LEGACY_PARALLEL_MIN_PIXELS = 256 * 1024;
+
+    //----------------------------------------------------------------------------------
+    // Built from the DDS_PIXELFORMAT masks.  Each destination channel is either read from
+    // a contiguous source mask and widened by bit replication, or filled with a constant.
+    //----------------------------------------------------------------------------------
+    struct DDS_LEGACY_LAYOUT
+    {
+        uint32_t srcBytes;          // 1 to 4
+        uint32_t dstBytes;          // 1 to 8
+        uint32_t dstChannelBits;    // 8 or 16
+        uint32_t channelCount;      // 4 for RGB, 1 or 2 for luminance, 1 for alpha
+
+        struct Channel
+        {
+            uint32_t shift;         // Of the source mask
+            uint32_t bits;          // Of the source mask; 0 for a constant channel
+            uint32_t fill;          // Value of a constant channel
+        } channels[4];
+
+        // Every read channel is a whole source byte and the target is 8 bits per channel,
+        // so the conversion is a byte shuffle
+        bool byteShuffle;
+    };
+
+    namespace DDSLegacy
+    {
+        inline bool SetChannel( uint32_t mask, uint32_t bitCount, uint32_t fill, DDS_LEGACY_LAYOUT::Channel& channel )
+        {
+            channel.shift = 0;
+            channel.bits = 0;
+            channel.fill = fill;
+
+            if( !mask )
+                return true;
+
+            if( bitCount < 32 && ( mask >> bitCount ) )
+                return false;
+
+            uint32_t shift = 0;
+            while( !( ( mask >> shift ) & 1 ) )
+                ++shift;
+
+            uint32_t bits = 0;
+            while( shift + bits < 32 && ( ( mask >> ( shift + bits ) ) & 1 ) )
+                ++bits;
+
+            // Non-contiguous masks are not a DXGI channel
+            if( shift + bits < 32 && ( mask >> ( shift + bits ) ) )
+                return false;
+
+            channel.shift = shift;
+            channel.bits = bits;
+            return true;
+        }
+
+        //------------------------------------------------------------------------------
+        // Widens a bits-wide value to dstBits by repeating its bit pattern, so all zeros
+        // and all ones map exactly and no multiply is needed
+        //------------------------------------------------------------------------------
+        inline uint32_t ExpandBits( uint32_t value, uint32_t bits, uint32_t dstBits )
+        {
+            uint32_t result = 0;
+            for( int s = int( dstBits ) - int( bits ); s > -int( bits ); s -= int( bits ) )
+                result |= ( s >= 0 ) ? ( value << s ) : ( value >> -s );
+            return result;
+        }
+
+        inline uint32_t ReadPixel( const uint8_t* src, uint32_t srcBytes )
+        {
+            uint32_t value = 0;
+            for( uint32_t i = 0; i < srcBytes; ++i )
+                value |= uint32_t( src[i] ) << ( 8 * i );
+            return value;
+        }
+
+#ifdef DDS_LEGACY_SSSE3
+        inline bool HasSSSE3()
+        {
+#ifdef _MSC_VER
+            static int s_nSupport = -1;
+            if( s_nSupport < 0 )
+            {
+                int info[4];
+                __cpuid( info, 1 );
+                s_nSupport = ( info[2] & ( 1 << 9 ) ) ? 1 : 0;
+            }
+            return s_nSupport != 0;
+#else
+            // Built with SSSE3 enabled, so the rest of the code already assumes it
+            return true;
+#endif
+        }
+
+        //------------------------------------------------------------------------------
+        // Kernels take four pixels per step from one unaligned 16 byte load, so they stop
+        // while at least 16 source bytes remain and leave the tail to the scalar path.
+        // Returns the number of pixels converted.
+        //------------------------------------------------------------------------------
+        inline size_t ConvertByteShuffle( const DDS_LEGACY_LAYOUT& conv, const uint8_t* src, uint8_t* dst, size_t pixelCount )
+        {
+            // Source byte for every destination byte of four pixels, with constant channels
+            // zeroed and then ORed in
+            uint8_t control[16];
+            uint8_t fill[16];
+            memset( control, 0x80, sizeof( control ) );
+            memset( fill, 0, sizeof( fill ) );
+            for( uint32_t i = 0; i < 4; ++i )
+            {
+                for( uint32_t c = 0; c < conv.channelCount; ++c )
+                {
+                    uint32_t d = i * conv.dstBytes + c;
+                    if( conv.channels[c].bits )
+                        control[d] = uint8_t( i * conv.srcBytes + conv.channels[c].shift / 8 );
+                    else
+                        fill[d] = uint8_t( conv.channels[c].fill );
+                }
+            }
+
+            const __m128i vControl = _mm_loadu_si128( reinterpret_cast<const __m128i*>( control ) );
+            const __m128i vFill = _mm_loadu_si128( reinterpret_cast<const __m128i*>( fill ) );
+
+            size_t converted = 0;
+            size_t srcLeft = pixelCount * conv.srcBytes;
+            while( pixelCount - converted >= 4 && srcLeft >= 16 )
+            {
+                __m128i v = _mm_loadu_si128( reinterpret_cast<const __m128i*>( src ) );
+                v = _mm_or_si128( _mm_shuffle_epi8( v, vControl ), vFill );
+
+                if( conv.dstBytes == 4 )
+                    _mm_storeu_si128( reinterpret_cast<__m128i*>( dst ), v );
+                else if( conv.dstBytes == 2 )
+                    _mm_storel_epi64( reinterpret_cast<__m128i*>( dst ), v );
+                else
+                {
+                    int packed = _mm_cvtsi128_si32( v );
+                    memcpy( dst, &packed, 4 );
+                }
+
+                src += 4 * conv.srcBytes;
+                dst += 4 * conv.dstBytes;
+                srcLeft -= 4 * conv.srcBytes;
+                converted += 4;
+            }
+
+            return converted;
+        }
+
+        //------------------------------------------------------------------------------
+        // Any mask layout into a target of up to 32 bits per pixel.  Each source pixel is
+        // shuffled into its own 32-bit lane, then every channel is masked out, widened with
+        // the same shifts as ExpandBits and moved to its place.
+        //------------------------------------------------------------------------------
+        inline size_t ConvertMasked( const DDS_LEGACY_LAYOUT& conv, const uint8_t* src, uint8_t* dst, size_t pixelCount )
+        {
+            uint8_t gather[16];
+            uint8_t pack[16];
+            memset( pack, 0x80, sizeof( pack ) );
+            for( uint32_t i = 0; i < 4; ++i )
+            {
+                for( uint32_t k = 0; k < 4; ++k )
+                {
+                    gather[i * 4 + k] = ( k < conv.srcBytes ) ? uint8_t( i * conv.srcBytes + k ) : 0x80;
+                    if( k < conv.dstBytes )
+                        pack[i * conv.dstBytes + k] = uint8_t( i * 4 + k );
+                }
+            }
+
+            // The per channel program: source shift and mask, widening shifts, destination offset
+            struct Program
+            {
+                __m128i shift;
+                __m128i mask;
+                __m128i offset;
+                __m128i terms[16];
+                bool left[16];
+                uint32_t termCount;
+            } programs[4];
+
+            uint32_t programCount = 0;
+            uint32_t fill = 0;
+            for( uint32_t c = 0; c < conv.channelCount; ++c )
+            {
+                const auto& channel = conv.channels[c];
+                if( !channel.bits )
+                {
+                    fill |= channel.fill << ( c * conv.dstChannelBits );
+                    continue;
+                }
+
+                auto& program = programs[ programCount++ ];
+                program.shift = _mm_cvtsi32_si128( int( channel.shift ) );
+                program.mask = _mm_set1_epi32( int( ( uint64_t( 1 ) << channel.bits ) - 1 ) );
+                program.offset = _mm_cvtsi32_si128( int( c * conv.dstChannelBits ) );
+                program.termCount = 0;
+                for( int s = int( conv.dstChannelBits ) - int( channel.bits ); s > -int( channel.bits ); s -= int( channel.bits ) )
+                {
+                    program.left[ program.termCount ] = ( s >= 0 );
+                    program.terms[ program.termCount ] = _mm_cvtsi32_si128( ( s >= 0 ) ? s : -s );
+                    ++program.termCount;
+                }
+            }
+
+            const __m128i vGather = _mm_loadu_si128( reinterpret_cast<const __m128i*>( gather ) );
+            const __m128i vPack = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pack ) );
+            const __m128i vFill = _mm_set1_epi32( int( fill ) );
+
+            size_t converted = 0;
+            size_t srcLeft = pixelCount * conv.srcBytes;
+            while( pixelCount - converted >= 4 && srcLeft >= 16 )
+            {
+                __m128i lanes = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( src ) ), vGather );
+
+                __m128i out = vFill;
+                for( uint32_t p = 0; p < programCount; ++p )
+                {
+                    const auto& program = programs[p];
+                    __m128i value = _mm_and_si128( _mm_srl_epi32( lanes, program.shift ), program.mask );
+
+                    __m128i wide = _mm_setzero_si128();
+                    for( uint32_t t = 0; t < program.termCount; ++t )
+                    {
+                        wide = _mm_or_si128( wide, program.left[t] ? _mm_sll_epi32( value, program.terms[t] )
+                                                                   : _mm_srl_epi32( value, program.terms[t] ) );
+                    }
+
+                    out = _mm_or_si128( out, _mm_sll_epi32( wide, program.offset ) );
+                }
+
+                if( conv.dstBytes == 4 )
+                {
+                    _mm_storeu_si128( reinterpret_cast<__m128i*>( dst ), out );
+                }
+                else
+                {
+                    out = _mm_shuffle_epi8( out, vPack );
+                    if( conv.dstBytes == 2 )
+                        _mm_storel_epi64( reinterpret_cast<__m128i*>( dst ), out );
+                    else
+                    {
+                        int packed = _mm_cvtsi128_si32( out );
+                        memcpy( dst, &packed, 4 );
+                    }
+                }
+
+                src += 4 * conv.srcBytes;
+                dst += 4 * conv.dstBytes;
+                srcLeft -= 4 * conv.srcBytes;
+                converted += 4;
+            }
+
+            return converted;
+        }
+#endif
+    };
+
+    //----------------------------------------------------------------------------------
+    // DDS_LEGACY_RGB, DDS_LEGACY_LUMINANCE or DDS_LEGACY_ALPHA formats only.  Returns
+    // false for layouts with overlapping or non-contiguous masks, channels wider than 16
+    // bits, or unusual bit counts.
+    //----------------------------------------------------------------------------------
+    inline bool GetDDSLegacyLayout( uint32_t flags, uint32_t bitCount,
+                                    uint32_t rMask, uint32_t gMask, uint32_t bMask, uint32_t aMask,
+                                    DDS_LEGACY_LAYOUT* conv )
+    {
+        if( !conv )
+            return false;
+
+        memset( conv, 0, sizeof( DDS_LEGACY_LAYOUT ) );
+
+        if( bitCount != 8 && bitCount != 16 && bitCount != 24 && bitCount != 32 )
+            return false;
+
+        // Destination channels in order, with the value used when a mask is missing
+        uint32_t masks[4] = {};
+        uint32_t fills[4] = {};
+        uint32_t channelCount = 0;
+        if( flags & DDS_LEGACY_RGB )
+        {
+            if( !( rMask | gMask | bMask ) )
+                return false;
+            masks[0] = rMask; masks[1] = gMask; masks[2] = bMask; masks[3] = aMask;
+            fills[3] = 0xffffffff;
+            channelCount = 4;
+        }
+        else if( flags & DDS_LEGACY_LUMINANCE )
+        {
+            if( !rMask )
+                return false;
+            masks[0] = rMask; masks[1] = aMask;
+            channelCount = aMask ? 2 : 1;
+        }
+        else if( flags & DDS_LEGACY_ALPHA )
+        {
+            if( !aMask )
+                return false;
+            masks[0] = aMask;
+            channelCount = 1;
+        }
+        else
+        {
+            return false;
+        }
+
+        if( ( rMask & gMask ) || ( rMask & bMask ) || ( rMask & aMask ) || ( gMask & bMask ) || ( gMask & aMask ) || ( bMask & aMask ) )
+            return false;
+
+        uint32_t maxBits = 0;
+        for( uint32_t c = 0; c < channelCount; ++c )
+        {
+            if( !DDSLegacy::SetChannel( masks[c], bitCount, 0, conv->channels[c] ) )
+                return false;
+            maxBits = std::max<uint32_t>( maxBits, conv->channels[c].bits );
+        }
+
+        if( maxBits > 16 || ( ( flags & DDS_LEGACY_ALPHA ) && maxBits > 8 ) )
+            return false;
+
+        conv->dstChannelBits = ( maxBits > 8 ) ? 16 : 8;
+        for( uint32_t c = 0; c < channelCount; ++c )
+        {
+            if( !conv->channels[c].bits )
+                conv->channels[c].fill = fills[c] & ( ( 1u << conv->dstChannelBits ) - 1 );
+        }
+
+        conv->srcBytes = bitCount / 8;
+        conv->dstBytes = channelCount * conv->dstChannelBits / 8;
+        conv->channelCount = channelCount;
+
+        conv->byteShuffle = ( conv->dstChannelBits == 8 );
+        for( uint32_t c = 0; c < channelCount; ++c )
+        {
+            const auto& channel = conv->channels[c];
+            if( channel.bits && ( channel.bits != 8 || ( channel.shift % 8 ) != 0 ) )
+                conv->byteShuffle = false;
+        }
+
+        return true;
+    }
+
+    //----------------------------------------------------------------------------------
+    // Reference implementation the kernels must match bit for bit
+    //----------------------------------------------------------------------------------
+    inline void ConvertDDSLegacyPixelsScalar( const DDS_LEGACY_LAYOUT& conv, const uint8_t* src, uint8_t* dst, size_t pixelCount )
+    {
+        for( size_t i = 0; i < pixelCount; ++i )
+        {
+            uint32_t pixel = DDSLegacy::ReadPixel( src, conv.srcBytes );
+
+            for( uint32_t c = 0; c < conv.channelCount; ++c )
+            {
+                const auto& channel = conv.channels[c];
+                uint32_t value = channel.fill;
+                if( channel.bits )
+                {
+                    uint32_t mask = uint32_t( ( uint64_t( 1 ) << channel.bits ) - 1 );
+                    value = DDSLegacy::ExpandBits( ( pixel >> channel.shift ) & mask, channel.bits, conv.dstChannelBits );
+                }
+
+                if( conv.dstChannelBits == 16 )
+                {
+                    dst[c * 2] = uint8_t( value );
+                    dst[c * 2 + 1] = uint8_t( value >> 8 );
+                }
+                else
+                {
+                    dst[c] = uint8_t( value );
+                }
+            }
+
+            src += conv.srcBytes;
+            dst += conv.dstBytes;
+        }
+    }
+
+    // True when ConvertDDSLegacyPixels can use the SSSE3 kernels on this CPU
+    inline bool HasDDSLegacyKernels()
+    {
+#ifdef DDS_LEGACY_SSSE3
+        return DDSLegacy::HasSSSE3();
+#else
+        return false;
+#endif
+    }
+
+    //----------------------------------------------------------------------------------
+    // Uses SSSE3 shuffle kernels when the CPU has them and falls back to the scalar path
+    //----------------------------------------------------------------------------------
+    inline void ConvertDDSLegacyPixels( const DDS_LEGACY_LAYOUT& conv, const uint8_t* src, uint8_t* dst, size_t pixelCount )
+    {
+        size_t converted = 0;
+
+#ifdef DDS_LEGACY_SSSE3
+        if( conv.dstBytes <= 4 && DDSLegacy::HasSSSE3() )
+        {
+            converted = conv.byteShuffle ? DDSLegacy::ConvertByteShuffle( conv, src, dst, pixelCount )
+                                         : DDSLegacy::ConvertMasked( conv, src, dst, pixelCount );
+        }
+#endif
+
+        ConvertDDSLegacyPixelsScalar( conv, src + converted * conv.srcBytes, dst + converted * conv.dstBytes, pixelCount - converted );
+    }
+
+    //----------------------------------------------------------------------------------
+    // Legacy surfaces have no row padding, so a whole mip chain is one run of pixels.
+    // Large runs are split across threads; maxThreads of 0 uses one per hardware thread.
+    //----------------------------------------------------------------------------------
+    inline void ConvertDDSLegacyPixelsParallel( const DDS_LEGACY_LAYOUT& conv, const uint8_t* src, uint8_t* dst,
+                                                size_t pixelCount, unsigned int maxThreads = 0 )
+    {
+        if( !maxThreads )
+            maxThreads = std::max<unsigned int>( 1, std::thread::hardware_concurrency() );
+
+        size_t runCount = std::min<size_t>( maxThreads, std::max<size_t>( 1, pixelCount / DDS_LEGACY_PARALLEL_MIN_PIXELS ) );
+        if( runCount <= 1 )
+        {
+            ConvertDDSLegacyPixels( conv, src, dst, pixelCount );
+            return;
+        }
+
+        // Runs are whole kernel steps so only the last one has a scalar tail
+        size_t runPixels = ( ( pixelCount + runCount - 1 ) / runCount + 3 ) & ~size_t( 3 );
+        auto convertRun = [&]( size_t run )
+        {
+            size_t first = run * runPixels;
+            if( first < pixelCount )
+            {
+                ConvertDDSLegacyPixels( conv, src + first * conv.srcBytes, dst + first * conv.dstBytes,
+                                        std::min<size_t>( runPixels, pixelCount - first ) );
+            }
+        };
+
+        std::vector<std::thread> threads;
+        size_t run = 1;
+        try
+        {
+            for( ; run < runCount; ++run )
+                threads.push_back( std::thread( convertRun, run ) );
+        }
+        catch( ... )
+        {
+            // Convert whatever did not get a thread here
+        }
+
+        convertRun( 0 );
+        for( size_t inlineRun = run; inlineRun < runCount; ++inlineRun )
+            convertRun( inlineRun );
+
+        for( auto it = threads.begin(); it != threads.end(); ++it )
+            it->join();
+    }
+}
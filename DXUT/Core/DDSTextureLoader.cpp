@@ -24,6 +24,7 @@
 #include <memory>
 
 #include "DDSTextureLoader.h"
+#include "DDSLegacyConvert.h"
 
 #if defined(_DEBUG) || defined(PROFILE)
 #pragma comment(lib,"dxguid.lib")
@@ -790,6 +791,29 @@ static DXGI_FORMAT GetDXGIFormat( const DDS_PIXELFORMAT& ddpf )
 }
 
 
+//--------------------------------------------------------------------------------------
+// Pixels in every mip of every item, for legacy formats that have no row padding
+//--------------------------------------------------------------------------------------
+static uint64_t CountLegacyPixels( _In_ size_t width,
+                                   _In_ size_t height,
+                                   _In_ size_t depth,
+                                   _In_ size_t mipCount,
+                                   _In_ size_t arraySize )
+{
+    uint64_t count = 0;
+    for( size_t i = 0; i < mipCount; i++ )
+    {
+        count += uint64_t( width ) * height * depth;
+
+        width = std::max<size_t>( width >> 1, 1 );
+        height = std::max<size_t>( height >> 1, 1 );
+        depth = std::max<size_t>( depth >> 1, 1 );
+    }
+
+    return count * arraySize;
+}
+
+
 //--------------------------------------------------------------------------------------
 static DXGI_FORMAT MakeSRGB( _In_ DXGI_FORMAT format )
 {
@@ -1182,6 +1206,8 @@ static HRESULT CreateTextureFromDDS( _In_ ID3D11Device* d3dDevice,
     UINT arraySize = 1;
     DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
     bool isCubeMap = false;
+    bool convertLegacy = false;
+    DDS_LEGACY_CONVERSION legacyConv;
 
     size_t mipCount = header->mipMapCount;
     if (0 == mipCount)
@@ -1261,7 +1287,15 @@ static HRESULT CreateTextureFromDDS( _In_ ID3D11Device* d3dDevice,
 
         if (format == DXGI_FORMAT_UNKNOWN)
         {
-           return HRESULT_FROM_WIN32( ERROR_NOT_SUPPORTED );
+            // Masked layouts with no DXGI equivalent are expanded to the nearest one
+            const DDS_PIXELFORMAT& ddpf = header->ddspf;
+            if (!GetDDSLegacyConversion( ddpf.flags, ddpf.RGBBitCount, ddpf.RBitMask, ddpf.GBitMask, ddpf.BBitMask, ddpf.ABitMask, &legacyConv ))
+            {
+                return HRESULT_FROM_WIN32( ERROR_NOT_SUPPORTED );
+            }
+
+            format = legacyConv.format;
+            convertLegacy = true;
         }
 
         if (header->flags & DDS_HEADER_FLAGS_VOLUME)
@@ -1340,6 +1374,30 @@ static HRESULT CreateTextureFromDDS( _In_ ID3D11Device* d3dDevice,
         return HRESULT_FROM_WIN32( ERROR_NOT_SUPPORTED );
     }
 
+    std::unique_ptr<uint8_t[]> legacyData;
+    if ( convertLegacy )
+    {
+        uint64_t pixelCount = CountLegacyPixels( width, height, depth, mipCount, arraySize );
+        if ( pixelCount > bitSize / legacyConv.srcBytes )
+        {
+            return HRESULT_FROM_WIN32( ERROR_HANDLE_EOF );
+        }
+        if ( pixelCount > SIZE_MAX / legacyConv.dstBytes )
+        {
+            return E_OUTOFMEMORY;
+        }
+
+        legacyData.reset( new (std::nothrow) uint8_t[ size_t( pixelCount ) * legacyConv.dstBytes ] );
+        if ( !legacyData )
+        {
+            return E_OUTOFMEMORY;
+        }
+
+        ConvertDDSLegacyPixelsParallel( legacyConv, bitData, legacyData.get(), size_t( pixelCount ) );
+        bitData = legacyData.get();
+        bitSize = size_t( pixelCount ) * legacyConv.dstBytes;
+    }
+
     bool autogen = false;
     if ( mipCount == 1 && d3dContext != 0 && textureView != 0 ) // Must have context and shader-view to auto generate mipmaps
     {
@@ -16,6 +16,11 @@
 #include <dxgidebug.h>
 #endif
 
+#include <atomic>
+#include <intrin.h>
+#include <string>
+#include <unordered_map>
+
 #define DXUT_MIN_WINDOW_SIZE_X 200
 #define DXUT_MIN_WINDOW_SIZE_Y 200
 #define DXUT_COUNTER_STAT_LENGTH 2048
@@ -28,6 +33,46 @@ CRITICAL_SECTION    g_cs;
 bool                g_bThreadSafe = true;
 
 
+//--------------------------------------------------------------------------------------
+// Frame counters.  Call counts and GUI time are added with interlocked ops so render pass
+// workers can count too; the rest is only touched from the render thread.
+//--------------------------------------------------------------------------------------
+DXUT_FRAME_COUNTERS g_FrameCounters = {};
+LONGLONG            g_FrameGUITicks = 0;        // GUI time inside the current frame's render callback
+
+double DXUTQPCToSeconds( _In_ LONGLONG ticks )
+{
+    return DXUTTimestampToSeconds( ticks );
+}
+
+// Heap allocations are counted by a debug CRT hook that chains to any hook already set
+#if defined(DEBUG) || defined(_DEBUG)
+volatile LONG64     g_nHeapAllocations = 0;
+_CRT_ALLOC_HOOK     g_pfnPreviousAllocHook = nullptr;
+bool                g_bAllocHookInstalled = false;
+
+int __cdecl DXUTAllocHook( int allocType, void* pUserData, size_t size, int blockType, long requestNumber,
+                           const unsigned char* filename, int lineNumber )
+{
+    if( allocType == _HOOK_ALLOC || allocType == _HOOK_REALLOC )
+        InterlockedIncrement64( &g_nHeapAllocations );
+
+    if( g_pfnPreviousAllocHook )
+        return g_pfnPreviousAllocHook( allocType, pUserData, size, blockType, requestNumber, filename, lineNumber );
+    return TRUE;
+}
+#endif
+
+UINT64 DXUTGetHeapAllocationCount()
+{
+#if defined(DEBUG) || defined(_DEBUG)
+    return UINT64( g_nHeapAllocations );
+#else
+    return 0;
+#endif
+}
+
+
 //--------------------------------------------------------------------------------------
 // Automatically enters & leaves the CS upon object creation/deletion
 //--------------------------------------------------------------------------------------
@@ -52,6 +97,87 @@ public:
 #define GETP_SETP_ACCESSOR( x, y ) SETP_ACCESSOR( x, y ) GETP_ACCESSOR( x, y )
 
 
+//--------------------------------------------------------------------------------------
+// Sequence lock over the frequently read state.  Writers are already serialized by g_cs
+// and bump the sequence to odd while they write; readers copy what they need without any
+// lock and retry if the sequence was odd or changed underneath them.  The copy is made
+// with relaxed volatile loads, since the writer may be storing to the same bytes, and
+// anything torn that way is thrown away by the sequence check.
+//--------------------------------------------------------------------------------------
+class DXUTSnapshot
+{
+public:
+    DXUTSnapshot() : m_sequence( 0 ) { ZeroMemory( &m_data, sizeof( m_data ) ); }
+
+    // Call with g_cs held, or from the only thread touching the state
+    inline DXUT_FRAME_SNAPSHOT& BeginWrite()
+    {
+        m_sequence.store( m_sequence.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_release );
+        return m_data;
+    }
+
+    inline void EndWrite()
+    {
+        m_sequence.store( m_sequence.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+    }
+
+    inline void Read( _Out_ DXUT_FRAME_SNAPSHOT* pSnapshot ) const
+    {
+        ReadBytes( pSnapshot, &m_data, sizeof( DXUT_FRAME_SNAPSHOT ) );
+    }
+
+    // Reads one member, so a getter does not copy the whole snapshot
+    template<typename T>
+    inline T ReadField( _In_ T DXUT_FRAME_SNAPSHOT::* pMember ) const
+    {
+        T value;
+        ReadBytes( &value, &( m_data.*pMember ), sizeof( T ) );
+        return value;
+    }
+
+private:
+    void ReadBytes( _Out_writes_bytes_(nBytes) void* pDest, _In_reads_bytes_(nBytes) const void* pSrc, _In_ size_t nBytes ) const
+    {
+        for(;;)
+        {
+            UINT nBefore = m_sequence.load( std::memory_order_acquire );
+            if( nBefore & 1 )
+            {
+                YieldProcessor();
+                continue;
+            }
+
+            // Every member is either a bool or a multiple of 4 bytes, aligned to its size
+            auto pSrcWords = reinterpret_cast<const volatile __int32*>( pSrc );
+            auto pDestWords = reinterpret_cast<__int32*>( pDest );
+            size_t nWords = nBytes / 4;
+            for( size_t i = 0; i < nWords; ++i )
+                pDestWords[i] = __iso_volatile_load32( pSrcWords + i );
+            auto pSrcTail = reinterpret_cast<const volatile __int8*>( pSrcWords + nWords );
+            auto pDestTail = reinterpret_cast<__int8*>( pDestWords + nWords );
+            for( size_t i = 0; i < ( nBytes & 3 ); ++i )
+                pDestTail[i] = __iso_volatile_load8( pSrcTail + i );
+
+            std::atomic_thread_fence( std::memory_order_acquire );
+            if( m_sequence.load( std::memory_order_relaxed ) == nBefore )
+                return;
+        }
+    }
+
+    std::atomic<UINT> m_sequence;
+    DXUT_FRAME_SNAPSHOT m_data;
+};
+
+//--------------------------------------------------------------------------------------
+// Accessors for state mirrored into the snapshot.  Sets still take the lock and update
+// m_state, gets read the snapshot and never block.
+//--------------------------------------------------------------------------------------
+#define SET_SNAPSHOT_ACCESSOR( x, y )       inline void Set##y( x t )   { DXUTLock l; m_state.m_##y = t; m_snapshot.BeginWrite().y = t; m_snapshot.EndWrite(); };
+#define GET_SNAPSHOT_ACCESSOR( x, y )       inline x Get##y()           { return m_snapshot.ReadField( &DXUT_FRAME_SNAPSHOT::y ); };
+#define GET_SET_SNAPSHOT_ACCESSOR( x, y )   SET_SNAPSHOT_ACCESSOR( x, y ) GET_SNAPSHOT_ACCESSOR( x, y )
+
+
 //--------------------------------------------------------------------------------------
 // Stores timer callback info
 //--------------------------------------------------------------------------------------
@@ -60,12 +186,117 @@ struct DXUT_TIMER
     LPDXUTCALLBACKTIMER pCallbackTimer;
     void* pCallbackUserContext;
     float fTimeoutInSecs;
-    float fCountdown;
-    bool bEnabled;
+    double fDeadline;       // DXUTGetTime() after which the timer fires next
     UINT nID;
 };
 
 
+//--------------------------------------------------------------------------------------
+// Min-heap of timers ordered by deadline.  Each timer's heap slot is indexed by ID so
+// killing a timer removes it in O(log n), and a frame where nothing is due only looks
+// at the top of the heap.
+//--------------------------------------------------------------------------------------
+class DXUTTimerQueue
+{
+public:
+    DXUTTimerQueue() : m_fLastTime( 0 ) {}
+
+    bool IsEmpty() const { return m_Heap.empty(); }
+    const DXUT_TIMER& Top() const { return m_Heap.front(); }
+
+    void Insert( _In_ const DXUT_TIMER& timer )
+    {
+        m_Heap.push_back( timer );
+        m_Slots[ timer.nID ] = m_Heap.size() - 1;
+        SiftUp( m_Heap.size() - 1 );
+    }
+
+    bool Remove( _In_ UINT nID )
+    {
+        auto it = m_Slots.find( nID );
+        if( it == m_Slots.end() )
+            return false;
+
+        size_t i = it->second;
+        m_Slots.erase( it );
+
+        size_t last = m_Heap.size() - 1;
+        if( i != last )
+        {
+            m_Heap[ i ] = m_Heap[ last ];
+            m_Slots[ m_Heap[ i ].nID ] = i;
+        }
+        m_Heap.pop_back();
+
+        if( i < m_Heap.size() )
+            SiftDown( SiftUp( i ) );
+        return true;
+    }
+
+    void RescheduleTop( _In_ double fDeadline )
+    {
+        m_Heap.front().fDeadline = fDeadline;
+        SiftDown( 0 );
+    }
+
+    // The global timer is reset on resume from suspend, so time can go backwards.  Moving
+    // every deadline by the same amount keeps the heap order.
+    void AdvanceTo( _In_ double fTime )
+    {
+        if( fTime < m_fLastTime )
+        {
+            double fDelta = fTime - m_fLastTime;
+            for( auto it = m_Heap.begin(); it != m_Heap.end(); ++it )
+                it->fDeadline += fDelta;
+        }
+        m_fLastTime = fTime;
+    }
+
+private:
+    size_t SiftUp( _In_ size_t i )
+    {
+        while( i > 0 )
+        {
+            size_t parent = ( i - 1 ) / 2;
+            if( m_Heap[ parent ].fDeadline <= m_Heap[ i ].fDeadline )
+                break;
+            Swap( i, parent );
+            i = parent;
+        }
+        return i;
+    }
+
+    void SiftDown( _In_ size_t i )
+    {
+        for(;;)
+        {
+            size_t smallest = i;
+            size_t left = 2 * i + 1;
+            size_t right = left + 1;
+            if( left < m_Heap.size() && m_Heap[ left ].fDeadline < m_Heap[ smallest ].fDeadline )
+                smallest = left;
+            if( right < m_Heap.size() && m_Heap[ right ].fDeadline < m_Heap[ smallest ].fDeadline )
+                smallest = right;
+            if( smallest == i )
+                return;
+            Swap( i, smallest );
+            i = smallest;
+        }
+    }
+
+    void Swap( _In_ size_t a, _In_ size_t b )
+    {
+        std::swap( m_Heap[ a ], m_Heap[ b ] );
+        m_Slots[ m_Heap[ a ].nID ] = a;
+        m_Slots[ m_Heap[ b ].nID ] = b;
+    }
+
+    std::vector<DXUT_TIMER> m_Heap;
+    std::unordered_map<UINT, size_t> m_Slots;   // Timer ID to index in m_Heap
+    double m_fLastTime;
+};
+
+
 //--------------------------------------------------------------------------------------
 // Stores DXUT state and data access is done with thread safety (if g_bThreadSafe==true)
 //--------------------------------------------------------------------------------------
@@ -81,6 +312,7 @@ protected:
         UINT                    m_DXGIOutputArraySize;    // Number of elements in m_D3D11OutputArray
         IDXGISwapChain*         m_DXGISwapChain;          // the D3D11 swapchain
         DXGI_SURFACE_DESC       m_BackBufferSurfaceDescDXGI; // D3D11 back buffer surface description
+        DWORD                   m_BackBufferSurfaceDescThread; // thread that last wrote m_BackBufferSurfaceDescDXGI
         bool                    m_RenderingOccluded;       // Rendering is occluded by another window
         bool                    m_DoNotStoreBufferSize;    // Do not store the buffer size on WM_SIZE messages
 
@@ -180,12 +412,17 @@ protected:
         bool  m_DeviceLost;                 // if true, then the device is lost and needs to be reset
         bool  m_NotifyOnMouseMove;          // if true, include WM_MOUSEMOVE in mousecallback
         bool  m_Automation;                 // if true, automation is enabled
+        bool  m_Headless;                   // if true, run the frame loop on WARP with a hidden window and no Present
         bool  m_InSizeMove;                 // if true, app is inside a WM_ENTERSIZEMOVE
         UINT  m_TimerLastID;                // last ID of the DXUT timer
         bool  m_MessageWhenD3D11NotAvailable; 
         
         D3D_FEATURE_LEVEL  m_OverrideForceFeatureLevel; // if != -1, then overrid to use a featurelevel
         WCHAR m_ScreenShotName[256];        // command line screen shot name
+        int   m_BenchmarkFrames;            // if != 0, then measure this many frames after the warm up and quit
+        int   m_BenchmarkWarmupFrames;      // frames rendered before measuring starts
+        WCHAR m_BenchmarkReport[MAX_PATH];  // file the benchmark report is written to
+        bool  m_BenchmarkNoAlloc;           // if true, then a measured frame that allocates from the heap fails the benchmark
         bool m_SaveScreenShot;              // command line save screen shot
         bool m_ExitAfterScreenShot;         // command line exit after screen shot
         
@@ -240,7 +477,7 @@ protected:
         bool m_LastKeys[256];                            // array of last key state
         bool m_MouseButtons[5];                          // array of mouse states
 
-        std::vector<DXUT_TIMER>*  m_TimerList;           // list of DXUT_TIMER structs
+        DXUTTimerQueue*  m_TimerQueue;                   // pending DXUT_TIMER structs
         WCHAR m_StaticFrameStats[256];                   // static part of frames stats 
         WCHAR m_FPSStats[64];                            // fps stats
         WCHAR m_FrameStats[256];                         // frame stats (fps, width, etc)
@@ -249,6 +486,7 @@ protected:
     };
 
     STATE m_state;
+    DXUTSnapshot m_snapshot;
 
 public:
     DXUTState()  { Create(); }
@@ -269,6 +507,8 @@ public:
         m_state.m_OverrideAdapterOrdinal = -1;
         m_state.m_OverrideOutput = -1;
         m_state.m_OverrideForceVsync = -1;
+        m_state.m_BenchmarkWarmupFrames = 60;
+        wcscpy_s( m_state.m_BenchmarkReport, MAX_PATH, L"benchmark.json" );
         m_state.m_AutoChangeAdapter = true;
         m_state.m_ShowMsgBoxOnError = true;
         m_state.m_AllowShortcutKeysWhenWindowed = true;
@@ -280,15 +520,37 @@ public:
         m_state.m_IsInGammaCorrectMode = true;
         m_state.m_FPS = 1.0f;
         m_state.m_MessageWhenD3D11NotAvailable = true;
+
+        DXUT_FRAME_SNAPSHOT& snapshot = m_snapshot.BeginWrite();
+        ZeroMemory( &snapshot, sizeof( DXUT_FRAME_SNAPSHOT ) );
+        snapshot.Active = true;
+        m_snapshot.EndWrite();
     }
 
     void Destroy()
     {
-        SAFE_DELETE( m_state.m_TimerList );
+        SAFE_DELETE( m_state.m_TimerQueue );
         DXUTShutdown();
         DeleteCriticalSection( &g_cs );
     }
 
+    // The three times are published together so a snapshot never mixes two frames
+    void SetFrameTime( double fTime, double fAbsTime, float fElapsedTime )
+    {
+        DXUTLock l;
+        m_state.m_Time = fTime;
+        m_state.m_AbsoluteTime = fAbsTime;
+        m_state.m_ElapsedTime = fElapsedTime;
+
+        DXUT_FRAME_SNAPSHOT& snapshot = m_snapshot.BeginWrite();
+        snapshot.Time = fTime;
+        snapshot.AbsoluteTime = fAbsTime;
+        snapshot.ElapsedTime = fElapsedTime;
+        m_snapshot.EndWrite();
+    }
+
+    void GetFrameSnapshot( _Out_ DXUT_FRAME_SNAPSHOT* pSnapshot ) const { m_snapshot.Read( pSnapshot ); }
+
     // Macros to define access functions for thread safe access into m_state 
     GET_SET_ACCESSOR( DXUTDeviceSettings*, CurrentDeviceSettings );
 
@@ -297,17 +559,34 @@ public:
     GET_SET_ACCESSOR( IDXGIAdapter1*, DXGIAdapter );
     GET_SET_ACCESSOR( IDXGIOutput**, DXGIOutputArray );
     GET_SET_ACCESSOR( UINT, DXGIOutputArraySize );
-    GET_SET_ACCESSOR( IDXGISwapChain*, DXGISwapChain );
-    GETP_SETP_ACCESSOR( DXGI_SURFACE_DESC, BackBufferSurfaceDescDXGI );
-    GET_SET_ACCESSOR( bool, RenderingOccluded );
+    GET_SET_SNAPSHOT_ACCESSOR( IDXGISwapChain*, DXGISwapChain );
+
+    // The surface desc is handed out by pointer, so only the thread that writes it, the one
+    // running the frame loop, may read it this way.  Other threads read the snapshot's copy.
+    inline void SetBackBufferSurfaceDescDXGI( DXGI_SURFACE_DESC* t )
+    {
+        DXUTLock l;
+        m_state.m_BackBufferSurfaceDescDXGI = *t;
+        m_state.m_BackBufferSurfaceDescThread = GetCurrentThreadId();
+        m_snapshot.BeginWrite().BackBufferSurfaceDescDXGI = *t;
+        m_snapshot.EndWrite();
+    }
+    inline DXGI_SURFACE_DESC* GetBackBufferSurfaceDescDXGI()
+    {
+        assert( !m_state.m_BackBufferSurfaceDescThread || m_state.m_BackBufferSurfaceDescThread == GetCurrentThreadId() );
+        return &m_state.m_BackBufferSurfaceDescDXGI;
+    }
+    inline DXGI_SURFACE_DESC ReadBackBufferSurfaceDescDXGI() { return m_snapshot.ReadField( &DXUT_FRAME_SNAPSHOT::BackBufferSurfaceDescDXGI ); }
+
+    GET_SET_SNAPSHOT_ACCESSOR( bool, RenderingOccluded );
     GET_SET_ACCESSOR( bool, DoNotStoreBufferSize );
 
-    GET_SET_ACCESSOR( ID3D11Device*, D3D11Device );
-    GET_SET_ACCESSOR( ID3D11DeviceContext*, D3D11DeviceContext );
+    GET_SET_SNAPSHOT_ACCESSOR( ID3D11Device*, D3D11Device );
+    GET_SET_SNAPSHOT_ACCESSOR( ID3D11DeviceContext*, D3D11DeviceContext );
     GET_SET_ACCESSOR( D3D_FEATURE_LEVEL, D3D11FeatureLevel );
     GET_SET_ACCESSOR( ID3D11Texture2D*, D3D11DepthStencil );
-    GET_SET_ACCESSOR( ID3D11DepthStencilView*, D3D11DepthStencilView );   
-    GET_SET_ACCESSOR( ID3D11RenderTargetView*, D3D11RenderTargetView );
+    GET_SET_SNAPSHOT_ACCESSOR( ID3D11DepthStencilView*, D3D11DepthStencilView );   
+    GET_SET_SNAPSHOT_ACCESSOR( ID3D11RenderTargetView*, D3D11RenderTargetView );
     GET_SET_ACCESSOR( ID3D11RasterizerState*, D3D11RasterizerState );
 
     GET_SET_ACCESSOR( ID3D11Device1*, D3D11Device1 );
@@ -341,9 +620,9 @@ public:
     GET_SET_ACCESSOR( bool, MinimizedWhileFullscreen );
     GET_SET_ACCESSOR( bool, IgnoreSizeChange );   
 
-    GET_SET_ACCESSOR( double, Time );
-    GET_SET_ACCESSOR( double, AbsoluteTime );
-    GET_SET_ACCESSOR( float, ElapsedTime );
+    GET_SET_SNAPSHOT_ACCESSOR( double, Time );
+    GET_SET_SNAPSHOT_ACCESSOR( double, AbsoluteTime );
+    GET_SET_SNAPSHOT_ACCESSOR( float, ElapsedTime );
 
     GET_SET_ACCESSOR( HINSTANCE, HInstance );
     GET_SET_ACCESSOR( double, LastStatsUpdateTime );   
@@ -383,14 +662,15 @@ public:
     GET_SET_ACCESSOR( bool, InsideMainloop );
     GET_SET_ACCESSOR( bool, DeviceObjectsCreated );
     GET_SET_ACCESSOR( bool, DeviceObjectsReset );
-    GET_SET_ACCESSOR( bool, Active );
+    GET_SET_SNAPSHOT_ACCESSOR( bool, Active );
     GET_SET_ACCESSOR( bool, RenderingPaused );
     GET_SET_ACCESSOR( bool, TimePaused );
-    GET_SET_ACCESSOR( int, PauseRenderingCount );
-    GET_SET_ACCESSOR( int, PauseTimeCount );
+    GET_SET_SNAPSHOT_ACCESSOR( int, PauseRenderingCount );
+    GET_SET_SNAPSHOT_ACCESSOR( int, PauseTimeCount );
     GET_SET_ACCESSOR( bool, DeviceLost );
     GET_SET_ACCESSOR( bool, NotifyOnMouseMove );
     GET_SET_ACCESSOR( bool, Automation );
+    GET_SET_ACCESSOR( bool, Headless );
     GET_SET_ACCESSOR( bool, InSizeMove );
     GET_SET_ACCESSOR( UINT, TimerLastID );
     GET_SET_ACCESSOR( bool, MessageWhenD3D11NotAvailable );
@@ -398,6 +678,10 @@ public:
 
     GET_SET_ACCESSOR( D3D_FEATURE_LEVEL, OverrideForceFeatureLevel );
     GET_ACCESSOR( WCHAR*, ScreenShotName );
+    GET_SET_ACCESSOR( int, BenchmarkFrames );
+    GET_SET_ACCESSOR( int, BenchmarkWarmupFrames );
+    GET_ACCESSOR( WCHAR*, BenchmarkReport );
+    GET_SET_ACCESSOR( bool, BenchmarkNoAlloc );
     GET_SET_ACCESSOR( bool, SaveScreenShot );
     GET_SET_ACCESSOR( bool, ExitAfterScreenShot );
     
@@ -447,7 +731,7 @@ public:
     GET_SET_ACCESSOR( void*, D3D11SwapChainReleasingFuncUserContext );
     GET_SET_ACCESSOR( void*, D3D11FrameRenderFuncUserContext );
 
-    GET_SET_ACCESSOR( std::vector<DXUT_TIMER>*, TimerList );
+    GET_SET_ACCESSOR( DXUTTimerQueue*, TimerQueue );
     GET_ACCESSOR( bool*, Keys );
     GET_ACCESSOR( bool*, LastKeys );
     GET_ACCESSOR( bool*, MouseButtons );
@@ -598,9 +882,18 @@ LPCWSTR WINAPI DXUTGetDeviceStats()                        { return GetDXUTState
 bool WINAPI DXUTIsRenderingPaused()                        { return GetDXUTState().GetPauseRenderingCount() > 0; }
 bool WINAPI DXUTIsTimePaused()                             { return GetDXUTState().GetPauseTimeCount() > 0; }
 bool WINAPI DXUTIsActive()                                 { return GetDXUTState().GetActive(); }
+
+_Use_decl_annotations_
+void WINAPI DXUTGetFrameSnapshot( DXUT_FRAME_SNAPSHOT* pSnapshot )
+{
+    if( pSnapshot )
+        GetDXUTState().GetFrameSnapshot( pSnapshot );
+}
+
 int WINAPI DXUTGetExitCode()                               { return GetDXUTState().GetExitCode(); }
 bool WINAPI DXUTGetShowMsgBoxOnError()                     { return GetDXUTState().GetShowMsgBoxOnError(); }
 bool WINAPI DXUTGetAutomation()                            { return GetDXUTState().GetAutomation(); }
+bool WINAPI DXUTIsHeadless()                               { return GetDXUTState().GetHeadless(); }
 bool WINAPI DXUTIsWindowed()                               { return DXUTGetIsWindowedFromDS( GetDXUTState().GetCurrentDeviceSettings() ); }
 bool WINAPI DXUTIsInGammaCorrectMode()                     { return GetDXUTState().GetIsInGammaCorrectMode(); }
 IDXGIFactory1* WINAPI DXUTGetDXGIFactory()                 { DXUTDelayLoadDXGI(); return GetDXUTState().GetDXGIFactory(); }
@@ -665,6 +958,11 @@ void DXUTGetCallbackD3D11DeviceAcceptable( _In_ LPDXUTCALLBACKISD3D11DEVICEACCEP
 //          -noerrormsgboxes        prevents the display of message boxes generated by the framework so the application can be run without user interaction
 //          -nostats                prevents the display of the stats
 //          -automation             a hint to other components that automation is active 
+//          -headless               runs on WARP with a hidden window and skips Present, for CPU benchmarks on machines without a GPU
+//          -benchmark:#            measures # frames (500 if omitted) at constant frame time without vsync, writes a report and quits
+//          -benchmarkwarmup:#      frames rendered before a benchmark starts measuring (60 if omitted)
+//          -benchmarkreport:file   file the benchmark report is written to (benchmark.json if omitted)
+//          -benchmarknoalloc       exits with code 1 if a measured frame allocated from the heap (debug builds only)
 //--------------------------------------------------------------------------------------
 _Use_decl_annotations_
 HRESULT WINAPI DXUTInit( bool bParseCommandLine, 
@@ -701,6 +999,14 @@ HRESULT WINAPI DXUTInit( bool bParseCommandLine,
 
     GetDXUTState().SetShowMsgBoxOnError( bShowMsgBoxOnError );
 
+#if defined(DEBUG) || defined(_DEBUG)
+    if( !g_bAllocHookInstalled )
+    {
+        g_pfnPreviousAllocHook = _CrtSetAllocHook( DXUTAllocHook );
+        g_bAllocHookInstalled = true;
+    }
+#endif
+
     if( bParseCommandLine )
         DXUTParseCommandLine( GetCommandLine() );
     if( strExtraCommandLineParams )
@@ -918,6 +1224,55 @@ void DXUTParseCommandLine(WCHAR* strCommandLine,
                 GetDXUTState().SetAutomation( true );
                 continue;
             }
+
+            if( DXUTIsNextArg( strCmdLine, L"headless" ) )
+            {
+                DXUTSetHeadless( true );
+                continue;
+            }
+
+            if( DXUTIsNextArg( strCmdLine, L"benchmark" ) )
+            {
+                int nFrames = 500;
+                if( DXUTGetCmdParam( strCmdLine, strFlag, MAX_PATH ) )
+                    nFrames = std::max( _wtoi( strFlag ), 1 );
+                GetDXUTState().SetBenchmarkFrames( nFrames );
+
+                // Simulated time must not depend on how fast the frames run
+                if( !GetDXUTState().GetOverrideConstantFrameTime() )
+                {
+                    GetDXUTState().SetOverrideConstantFrameTime( true );
+                    GetDXUTState().SetOverrideConstantTimePerFrame( 1.0f / 60.0f );
+                    DXUTSetConstantFrameTime( true, 1.0f / 60.0f );
+                }
+                if( GetDXUTState().GetOverrideForceVsync() == -1 )
+                    GetDXUTState().SetOverrideForceVsync( 0 );
+                continue;
+            }
+
+            if( DXUTIsNextArg( strCmdLine, L"benchmarkwarmup" ) )
+            {
+                if( DXUTGetCmdParam( strCmdLine, strFlag, MAX_PATH ) )
+                {
+                    GetDXUTState().SetBenchmarkWarmupFrames( std::max( _wtoi( strFlag ), 0 ) );
+                    continue;
+                }
+            }
+
+            if( DXUTIsNextArg( strCmdLine, L"benchmarknoalloc" ) )
+            {
+                GetDXUTState().SetBenchmarkNoAlloc( true );
+                continue;
+            }
+
+            if( DXUTIsNextArg( strCmdLine, L"benchmarkreport" ) )
+            {
+                if( DXUTGetCmdParam( strCmdLine, strFlag, MAX_PATH ) )
+                {
+                    wcscpy_s( GetDXUTState().GetBenchmarkReport(), MAX_PATH, strFlag );
+                    continue;
+                }
+            }
         }
 
         // Unrecognized flag
@@ -2166,7 +2521,7 @@ HRESULT DXUTChangeDevice( DXUTDeviceSettings* pNewDeviceSettings,
    // }
 
     // Make the window visible
-    if( !IsWindowVisible( DXUTGetHWND() ) )
+    if( !IsWindowVisible( DXUTGetHWND() ) && !GetDXUTState().GetHeadless() )
         ShowWindow( DXUTGetHWND(), SW_SHOW );
 
     // Ensure that the display doesn't power down when fullscreen but does when windowed
@@ -2249,7 +2604,7 @@ void DXUTUpdateDeviceSettingsWithOverrides( _Inout_ DXUTDeviceSettings* pDeviceS
         pDeviceSettings->d3d11.DriverType = D3D_DRIVER_TYPE_REFERENCE;
     }
 
-    if( GetDXUTState().GetOverrideForceWARP() )
+    if( GetDXUTState().GetOverrideForceWARP() || GetDXUTState().GetHeadless() )
     {
         pDeviceSettings->d3d11.DriverType = D3D_DRIVER_TYPE_WARP;
         pDeviceSettings->d3d11.sd.Windowed = TRUE;
@@ -2263,6 +2618,11 @@ void DXUTUpdateDeviceSettingsWithOverrides( _Inout_ DXUTDeviceSettings* pDeviceS
     {
         pDeviceSettings->d3d11.SyncInterval = 1;
     }
+
+    if( GetDXUTState().GetHeadless() )
+    {
+        pDeviceSettings->d3d11.SyncInterval = 0;
+    }
   
     if (GetDXUTState().GetOverrideForceFeatureLevel() != 0)
     {
@@ -2278,10 +2638,12 @@ HRESULT WINAPI DXUTSetupD3D11Views( _In_ ID3D11DeviceContext* pd3dDeviceContext
 {
     HRESULT hr = S_OK;
 
-    // Setup the viewport to match the backbuffer
+    // Setup the viewport to match the backbuffer.  Passes call this on worker threads for
+    // their deferred contexts, so the desc comes from the snapshot.
+    DXGI_SURFACE_DESC backBufferDesc = GetDXUTState().ReadBackBufferSurfaceDescDXGI();
     D3D11_VIEWPORT vp;
-    vp.Width = (FLOAT)DXUTGetDXGIBackBufferSurfaceDesc()->Width;
-    vp.Height = (FLOAT)DXUTGetDXGIBackBufferSurfaceDesc()->Height;
+    vp.Width = (FLOAT)backBufferDesc.Width;
+    vp.Height = (FLOAT)backBufferDesc.Height;
     vp.MinDepth = 0;
     vp.MaxDepth = 1;
     vp.TopLeftX = 0;
@@ -2788,6 +3150,214 @@ HRESULT DXUTReset3DEnvironment11()
 }
 
 
+//--------------------------------------------------------------------------------------
+// Benchmark mode.  Frames after the warm up are timed, and once the requested number
+// have run a JSON report with per-section percentiles is written.
+//--------------------------------------------------------------------------------------
+namespace
+{
+
+struct DXUTBenchmarkSample
+{
+    double FrameMove;
+    double Render;      // Render callback, less the GUI
+    double GUI;
+    double Present;
+    double Total;
+    UINT64 HeapAllocations;
+};
+
+std::vector<DXUTBenchmarkSample> g_BenchmarkSamples;
+DXUT_FRAME_COUNTERS g_BenchmarkStartCounters;
+
+void DXUTAppendJsonString( _Inout_ std::string& str, _In_z_ LPCWSTR strValue )
+{
+    str += '"';
+
+    // Convert straight onto the end of the report, whatever the length
+    size_t nStart = str.length();
+    int nBytes = WideCharToMultiByte( CP_UTF8, 0, strValue, -1, nullptr, 0, nullptr, nullptr );
+    if( nBytes > 1 )
+    {
+        str.resize( nStart + nBytes );
+        if( !WideCharToMultiByte( CP_UTF8, 0, strValue, -1, &str[nStart], nBytes, nullptr, nullptr ) )
+            nBytes = 1;
+        str.resize( nStart + nBytes - 1 );
+    }
+
+    // Escape quotes and backslashes and drop control characters.  Most strings have none,
+    // so the converted text is usually left where it is
+    auto needsEscape = []( char c ) { return c == '"' || c == '\\' || static_cast<unsigned char>( c ) < ' '; };
+    if( std::any_of( str.cbegin() + nStart, str.cend(), needsEscape ) )
+    {
+        std::string strRaw( str, nStart );
+        str.resize( nStart );
+        for( auto it = strRaw.cbegin(); it != strRaw.cend(); ++it )
+        {
+            if( *it == '"' || *it == '\\' )
+                str += '\\';
+            if( static_cast<unsigned char>( *it ) >= ' ' )
+                str += *it;
+        }
+    }
+
+    str += '"';
+}
+
+void DXUTAppendJsonSection( _Inout_ std::string& str, _In_z_ const char* strName, _In_ double DXUTBenchmarkSample::* pMember, _In_ bool bLast )
+{
+    std::vector<double> values;
+    values.reserve( g_BenchmarkSamples.size() );
+    double fSum = 0;
+    for( auto it = g_BenchmarkSamples.cbegin(); it != g_BenchmarkSamples.cend(); ++it )
+    {
+        values.push_back( ( *it ).*pMember * 1000.0 );
+        fSum += values.back();
+    }
+    std::sort( values.begin(), values.end() );
+
+    // Nearest rank
+    auto percentile = [&]( double p ) -> double
+    {
+        size_t rank = size_t( ceil( p * double( values.size() ) ) );
+        return values[ std::min( std::max<size_t>( rank, 1 ), values.size() ) - 1 ];
+    };
+
+    char strLine[512];
+    sprintf_s( strLine, 512, "    \"%s\": { \"mean\": %.4f, \"min\": %.4f, \"p50\": %.4f, \"p90\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f }%s\n",
+               strName, fSum / double( values.size() ), values.front(), percentile( 0.50 ), percentile( 0.90 ),
+               percentile( 0.95 ), percentile( 0.99 ), values.back(), bLast ? "" : "," );
+    str += strLine;
+}
+
+HRESULT DXUTWriteBenchmarkReport()
+{
+    if( g_BenchmarkSamples.empty() )
+        return E_FAIL;
+
+    double fFrames = double( g_BenchmarkSamples.size() );
+    char strLine[512];
+    std::string str = "{\n";
+
+    WCHAR strExePath[MAX_PATH] = { 0 };
+    GetModuleFileName( nullptr, strExePath, MAX_PATH );
+    str += "  \"application\": ";
+    DXUTAppendJsonString( str, DXUTGetWindowTitle() );
+    str += ",\n  \"executable\": ";
+    DXUTAppendJsonString( str, strExePath );
+    str += ",\n  \"device\": ";
+    DXUTAppendJsonString( str, GetDXUTState().GetDeviceStats() );
+
+    SYSTEMTIME st;
+    GetSystemTime( &st );
+    auto pBackBufferDesc = DXUTGetDXGIBackBufferSurfaceDesc();
+#if defined(DEBUG) || defined(_DEBUG)
+    const char* strBuild = "debug";
+#else
+    const char* strBuild = "release";
+#endif
+    sprintf_s( strLine, 512, ",\n  \"timestamp\": \"%04u-%02u-%02uT%02u:%02u:%02uZ\",\n  \"build\": \"%s\",\n  \"compiler\": %d,\n",
+               st.wYear, st.wMonth, st.wDay, st.wHour, st.wMinute, st.wSecond, strBuild, _MSC_VER );
+    str += strLine;
+    sprintf_s( strLine, 512, "  \"headless\": %s,\n  \"backBuffer\": [ %u, %u ],\n  \"warmupFrames\": %d,\n  \"frames\": %u,\n  \"timePerFrame\": %.6f,\n",
+               GetDXUTState().GetHeadless() ? "true" : "false",
+               pBackBufferDesc->Width, pBackBufferDesc->Height,
+               GetDXUTState().GetBenchmarkWarmupFrames(), UINT( g_BenchmarkSamples.size() ),
+               GetDXUTState().GetTimePerFrame() );
+    str += strLine;
+
+    str += "  \"milliseconds\": {\n";
+    DXUTAppendJsonSection( str, "frameMove", &DXUTBenchmarkSample::FrameMove, false );
+    DXUTAppendJsonSection( str, "render", &DXUTBenchmarkSample::Render, false );
+    DXUTAppendJsonSection( str, "gui", &DXUTBenchmarkSample::GUI, false );
+    DXUTAppendJsonSection( str, "present", &DXUTBenchmarkSample::Present, false );
+    DXUTAppendJsonSection( str, "total", &DXUTBenchmarkSample::Total, true );
+    str += "  },\n";
+
+    const UINT64* pCalls = g_FrameCounters.APICalls;
+    const UINT64* pStartCalls = g_BenchmarkStartCounters.APICalls;
+    sprintf_s( strLine, 512, "  \"apiCallsPerFrame\": { \"draw\": %.2f, \"bind\": %.2f, \"update\": %.2f, \"clear\": %.2f, \"present\": %.2f }",
+               double( pCalls[DXUT_API_DRAW] - pStartCalls[DXUT_API_DRAW] ) / fFrames,
+               double( pCalls[DXUT_API_BIND] - pStartCalls[DXUT_API_BIND] ) / fFrames,
+               double( pCalls[DXUT_API_UPDATE] - pStartCalls[DXUT_API_UPDATE] ) / fFrames,
+               double( pCalls[DXUT_API_CLEAR] - pStartCalls[DXUT_API_CLEAR] ) / fFrames,
+               double( pCalls[DXUT_API_PRESENT] - pStartCalls[DXUT_API_PRESENT] ) / fFrames );
+    str += strLine;
+
+#if defined(DEBUG) || defined(_DEBUG)
+    UINT64 nAllocations = 0, nMaxAllocations = 0, nAllocatingFrames = 0;
+    for( auto it = g_BenchmarkSamples.cbegin(); it != g_BenchmarkSamples.cend(); ++it )
+    {
+        nAllocations += it->HeapAllocations;
+        nMaxAllocations = std::max( nMaxAllocations, it->HeapAllocations );
+        if( it->HeapAllocations )
+            ++nAllocatingFrames;
+    }
+    sprintf_s( strLine, 512, ",\n  \"heapAllocationsPerFrame\": { \"mean\": %.2f, \"max\": %llu, \"framesAllocating\": %llu }",
+               double( nAllocations ) / fFrames, nMaxAllocations, nAllocatingFrames );
+    str += strLine;
+#endif
+    str += "\n}\n";
+
+    HANDLE hFile = CreateFileW( GetDXUTState().GetBenchmarkReport(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr );
+    if( hFile == INVALID_HANDLE_VALUE )
+        return HRESULT_FROM_WIN32( GetLastError() );
+
+    DWORD dwWritten = 0;
+    BOOL bWritten = WriteFile( hFile, str.c_str(), DWORD( str.length() ), &dwWritten, nullptr );
+    CloseHandle( hFile );
+
+    return ( bWritten && dwWritten == str.length() ) ? S_OK : E_FAIL;
+}
+
+// Returns true once the run is complete, with the code the app should exit with
+bool DXUTBenchmarkFrame( _In_ int nFrame, _In_ const DXUTBenchmarkSample& sample, _Out_ int* pnExitCode )
+{
+    *pnExitCode = 0;
+
+    int nWarmup = GetDXUTState().GetBenchmarkWarmupFrames();
+    int nFrames = GetDXUTState().GetBenchmarkFrames();
+
+    if( nFrame == nWarmup + 1 )
+    {
+        g_BenchmarkSamples.clear();
+        g_BenchmarkSamples.reserve( nFrames );
+    }
+
+    if( nFrame <= nWarmup )
+        return false;
+
+    g_BenchmarkSamples.push_back( sample );
+    if( nFrame < nWarmup + nFrames )
+        return false;
+
+    HRESULT hr = DXUTWriteBenchmarkReport();
+    if( FAILED( hr ) )
+        DXUTOutputDebugString( L"DXUT: failed to write benchmark report %ls (%08X)\n", GetDXUTState().GetBenchmarkReport(), hr );
+
+#if defined(DEBUG) || defined(_DEBUG)
+    if( GetDXUTState().GetBenchmarkNoAlloc() )
+    {
+        auto itAllocating = std::find_if( g_BenchmarkSamples.cbegin(), g_BenchmarkSamples.cend(),
+                                          []( const DXUTBenchmarkSample& s ) { return s.HeapAllocations != 0; } );
+        if( itAllocating != g_BenchmarkSamples.cend() )
+        {
+            DXUTOutputDebugString( L"DXUT: measured frame %d made %llu heap allocations\n",
+                                   nWarmup + 1 + int( itAllocating - g_BenchmarkSamples.cbegin() ), itAllocating->HeapAllocations );
+            *pnExitCode = 1;
+        }
+    }
+#else
+    if( GetDXUTState().GetBenchmarkNoAlloc() )
+        DXUTOutputDebugString( L"DXUT: -benchmarknoalloc needs a debug build to count heap allocations\n" );
+#endif
+
+    return true;
+}
+
+};
+
+
 //--------------------------------------------------------------------------------------
 // Render the 3D environment by:
 //      - Checking if the device is lost and trying to reset it if it is
@@ -2811,12 +3381,30 @@ void WINAPI DXUTRender3DEnvironment()
     if( !pSwapChain )
         return;
 
-    if( DXUTIsRenderingPaused() || !DXUTIsActive() || GetDXUTState().GetRenderingOccluded() )
+    bool bHeadless = GetDXUTState().GetHeadless();
+
+    // The headless window is never shown, so it never becomes active
+    if( DXUTIsRenderingPaused() || ( !DXUTIsActive() && !bHeadless ) || GetDXUTState().GetRenderingOccluded() )
     {
         // Window is minimized/paused/occluded/or not exclusive so yield CPU time to other processes
         Sleep( 50 );
     }
 
+    // CPU time of each part of the frame, in QPC ticks
+    LARGE_INTEGER qpcFrameStart;
+    QueryPerformanceCounter( &qpcFrameStart );
+    LONGLONG frameMoveTicks = 0, renderTicks = 0, presentTicks = 0;
+    g_FrameGUITicks = 0;
+
+    // Everything taken from the frame arena last frame is dead now
+    DXUTResetFrameArena();
+    UINT64 nFrameStartAllocations = DXUTGetHeapAllocationCount();
+
+    // Calls made by the first measured frame count towards the benchmark
+    if( GetDXUTState().GetBenchmarkFrames() != 0 &&
+        GetDXUTState().GetCurrentFrameNumber() == GetDXUTState().GetBenchmarkWarmupFrames() )
+        g_BenchmarkStartCounters = g_FrameCounters;
+
     // Get the app's time, in seconds. Skip rendering if no time elapsed
     double fTime, fAbsTime; float fElapsedTime;
     DXUTGetGlobalTimer()->GetTimeValues( &fTime, &fAbsTime, &fElapsedTime );
@@ -2828,9 +3416,7 @@ void WINAPI DXUTRender3DEnvironment()
         fTime = DXUTGetTime() + fElapsedTime;
     }
 
-    GetDXUTState().SetTime( fTime );
-    GetDXUTState().SetAbsoluteTime( fAbsTime );
-    GetDXUTState().SetElapsedTime( fElapsedTime );
+    GetDXUTState().SetFrameTime( fTime, fAbsTime, fElapsedTime );
 
     // Update the FPS stats
     DXUTUpdateFrameStats();
@@ -2841,7 +3427,13 @@ void WINAPI DXUTRender3DEnvironment()
     LPDXUTCALLBACKFRAMEMOVE pCallbackFrameMove = GetDXUTState().GetFrameMoveFunc();
     if( pCallbackFrameMove )
     {
+        LARGE_INTEGER qpcStart, qpcEnd;
+        QueryPerformanceCounter( &qpcStart );
         pCallbackFrameMove( fTime, fElapsedTime, GetDXUTState().GetFrameMoveFuncUserContext() );
+        QueryPerformanceCounter( &qpcEnd );
+        frameMoveTicks = qpcEnd.QuadPart - qpcStart.QuadPart;
+        g_FrameCounters.FrameMoveSeconds += DXUTQPCToSeconds( frameMoveTicks );
+
         pd3dDevice = DXUTGetD3D11Device();
         if( !pd3dDevice ) // Handle DXUTShutdown from inside callback
             return;
@@ -2853,8 +3445,13 @@ void WINAPI DXUTRender3DEnvironment()
         LPDXUTCALLBACKD3D11FRAMERENDER pCallbackFrameRender = GetDXUTState().GetD3D11FrameRenderFunc();
         if( pCallbackFrameRender && !GetDXUTState().GetRenderingOccluded() )
         {
+            LARGE_INTEGER qpcStart, qpcEnd;
+            QueryPerformanceCounter( &qpcStart );
             pCallbackFrameRender( pd3dDevice, pd3dImmediateContext, fTime, fElapsedTime,
                                   GetDXUTState().GetD3D11FrameRenderFuncUserContext() );
+            QueryPerformanceCounter( &qpcEnd );
+            renderTicks = qpcEnd.QuadPart - qpcStart.QuadPart;
+            g_FrameCounters.FrameRenderSeconds += DXUTQPCToSeconds( renderTicks );
             
             pd3dDevice = DXUTGetD3D11Device();
             if( !pd3dDevice ) // Handle DXUTShutdown from inside callback
@@ -2893,8 +3490,22 @@ void WINAPI DXUTRender3DEnvironment()
         dwFlags = GetDXUTState().GetCurrentDeviceSettings()->d3d11.PresentFlags;
     UINT SyncInterval = GetDXUTState().GetCurrentDeviceSettings()->d3d11.SyncInterval;
 
-    // Show the frame on the primary surface.
-    hr = pSwapChain->Present( SyncInterval, dwFlags );
+    // Show the frame on the primary surface.  Headless frames are never shown, and skipping
+    // Present keeps the WARP blit out of the measured frame cost.
+    if( bHeadless )
+    {
+        hr = S_OK;
+    }
+    else
+    {
+        LARGE_INTEGER qpcStart, qpcEnd;
+        QueryPerformanceCounter( &qpcStart );
+        hr = pSwapChain->Present( SyncInterval, dwFlags );
+        QueryPerformanceCounter( &qpcEnd );
+        presentTicks = qpcEnd.QuadPart - qpcStart.QuadPart;
+        DXUTCountAPICalls( DXUT_API_PRESENT );
+    }
+
     if( DXGI_STATUS_OCCLUDED == hr )
     {
         // There is a window covering our entire rendering area.
@@ -2954,6 +3565,32 @@ void WINAPI DXUTRender3DEnvironment()
     int nFrame = GetDXUTState().GetCurrentFrameNumber();
     nFrame++;
     GetDXUTState().SetCurrentFrameNumber( nFrame );
+    g_FrameCounters.Frames++;
+
+    UINT64 nFrameAllocations = DXUTGetHeapAllocationCount() - nFrameStartAllocations;
+    g_FrameCounters.HeapAllocations += nFrameAllocations;
+
+    if( GetDXUTState().GetBenchmarkFrames() != 0 )
+    {
+        LARGE_INTEGER qpcFrameEnd;
+        QueryPerformanceCounter( &qpcFrameEnd );
+
+        // GUI rendering happens inside the render callback, so split it out
+        DXUTBenchmarkSample sample;
+        sample.FrameMove = DXUTQPCToSeconds( frameMoveTicks );
+        sample.Render = DXUTQPCToSeconds( std::max<LONGLONG>( renderTicks - g_FrameGUITicks, 0 ) );
+        sample.GUI = DXUTQPCToSeconds( g_FrameGUITicks );
+        sample.Present = DXUTQPCToSeconds( presentTicks );
+        sample.Total = DXUTQPCToSeconds( qpcFrameEnd.QuadPart - qpcFrameStart.QuadPart );
+        sample.HeapAllocations = nFrameAllocations;
+
+        int nExitCode;
+        if( DXUTBenchmarkFrame( nFrame, sample, &nExitCode ) )
+        {
+            DXUTShutdown( nExitCode );
+            return;
+        }
+    }
 
     // Check to see if the app should shutdown due to cmdline
     if( GetDXUTState().GetOverrideQuitAfterFrame() != 0 )
@@ -3124,8 +3761,8 @@ void DXUTCleanup3DEnvironment( _In_ bool bReleaseSettings )
             GetDXUTState().SetCurrentDeviceSettings( nullptr );
         }
 
-        auto pBackBufferSurfaceDesc = GetDXUTState().GetBackBufferSurfaceDescDXGI();
-        ZeroMemory( pBackBufferSurfaceDesc, sizeof( DXGI_SURFACE_DESC ) );
+        DXGI_SURFACE_DESC backBufferSurfaceDesc = {};
+        GetDXUTState().SetBackBufferSurfaceDescDXGI( &backBufferSurfaceDesc );
 
         GetDXUTState().SetDeviceCreated( false );
     }
@@ -3300,25 +3937,27 @@ HRESULT WINAPI DXUTSetTimer( LPDXUTCALLBACKTIMER pCallbackTimer, float fTimeoutI
     if( !pCallbackTimer )
         return DXUT_ERR_MSGBOX( L"DXUTSetTimer", E_INVALIDARG );
 
+    auto pTimerQueue = GetDXUTState().GetTimerQueue();
+    if( !pTimerQueue )
+    {
+        pTimerQueue = new (std::nothrow) DXUTTimerQueue;
+        if( !pTimerQueue )
+            return E_OUTOFMEMORY;
+        GetDXUTState().SetTimerQueue( pTimerQueue );
+    }
+
+    double fTime = DXUTGetTime();
+    pTimerQueue->AdvanceTo( fTime );
+
     DXUT_TIMER DXUTTimer;
     DXUTTimer.pCallbackTimer = pCallbackTimer;
     DXUTTimer.pCallbackUserContext = pCallbackUserContext;
-    DXUTTimer.fTimeoutInSecs = fTimeoutInSecs;
-    DXUTTimer.fCountdown = fTimeoutInSecs;
-    DXUTTimer.bEnabled = true;
+    DXUTTimer.fTimeoutInSecs = std::max<float>( fTimeoutInSecs, 0.0f );
+    DXUTTimer.fDeadline = fTime + DXUTTimer.fTimeoutInSecs;
     DXUTTimer.nID = GetDXUTState().GetTimerLastID() + 1;
     GetDXUTState().SetTimerLastID( DXUTTimer.nID );
 
-    auto pTimerList = GetDXUTState().GetTimerList();
-    if( !pTimerList )
-    {
-        pTimerList = new (std::nothrow) std::vector<DXUT_TIMER>;
-        if( !pTimerList )
-            return E_OUTOFMEMORY;
-        GetDXUTState().SetTimerList( pTimerList );
-    }
-
-    pTimerList->push_back( DXUTTimer );
+    pTimerQueue->Insert( DXUTTimer );
 
     if( pnIDEvent )
         *pnIDEvent = DXUTTimer.nID;
@@ -3332,27 +3971,18 @@ HRESULT WINAPI DXUTSetTimer( LPDXUTCALLBACKTIMER pCallbackTimer, float fTimeoutI
 //--------------------------------------------------------------------------------------
 HRESULT WINAPI DXUTKillTimer( _In_ UINT nIDEvent )
 {
-    auto pTimerList = GetDXUTState().GetTimerList();
-    if( !pTimerList )
+    auto pTimerQueue = GetDXUTState().GetTimerQueue();
+    if( !pTimerQueue )
         return S_FALSE;
 
-    bool bFound = false;
-
-    for( auto it = pTimerList->begin(); it != pTimerList->end(); ++it )
+    if( !pTimerQueue->Remove( nIDEvent ) )
     {
-        DXUT_TIMER DXUTTimer = *it;
-        if( DXUTTimer.nID == nIDEvent )
-        {
-            DXUTTimer.bEnabled = false;
-            *it = DXUTTimer;
-            bFound = true;
-            break;
-        }
+        // Killing a timer twice is harmless, an ID never handed out is not
+        if( !nIDEvent || nIDEvent > GetDXUTState().GetTimerLastID() )
+            return DXUT_ERR_MSGBOX( L"DXUTKillTimer", E_INVALIDARG );
+        return S_FALSE;
     }
 
-    if( !bFound )
-        return DXUT_ERR_MSGBOX( L"DXUTKillTimer", E_INVALIDARG );
-
     return S_OK;
 }
 
@@ -3362,30 +3992,21 @@ HRESULT WINAPI DXUTKillTimer( _In_ UINT nIDEvent )
 //--------------------------------------------------------------------------------------
 void DXUTHandleTimers()
 {
-    float fElapsedTime = DXUTGetElapsedTime();
-
-    auto pTimerList = GetDXUTState().GetTimerList();
-    if( !pTimerList )
+    auto pTimerQueue = GetDXUTState().GetTimerQueue();
+    if( !pTimerQueue )
         return;
 
-    // Walk through the list of timer callbacks
-    for( auto it = pTimerList->begin(); it != pTimerList->end(); ++it )
+    double fTime = DXUTGetTime();
+    pTimerQueue->AdvanceTo( fTime );
+
+    // Fire every timer that expired this frame
+    while( !pTimerQueue->IsEmpty() && pTimerQueue->Top().fDeadline < fTime )
     {
-        DXUT_TIMER DXUTTimer = *it;
-        if( DXUTTimer.bEnabled )
-        {
-            DXUTTimer.fCountdown -= fElapsedTime;
+        DXUT_TIMER DXUTTimer = pTimerQueue->Top();
 
-            // Call the callback if count down expired
-            if( DXUTTimer.fCountdown < 0 )
-            {
-                DXUTTimer.pCallbackTimer( DXUTTimer.nID, DXUTTimer.pCallbackUserContext );
-                // The callback my have changed the timer.
-                DXUTTimer = *it;
-                DXUTTimer.fCountdown = DXUTTimer.fTimeoutInSecs;
-            }
-            *it = DXUTTimer;
-        }
+        // Reschedule first so the callback is free to kill the timer or start new ones
+        pTimerQueue->RescheduleTop( fTime + DXUTTimer.fTimeoutInSecs );
+        DXUTTimer.pCallbackTimer( DXUTTimer.nID, DXUTTimer.pCallbackUserContext );
     }
 }
 
@@ -3998,18 +4619,18 @@ void DXUTUpdateBackBufferDesc()
     assert( pSwapChain );
     _Analysis_assume_( pSwapChain );
     hr = pSwapChain->GetBuffer( 0, IID_PPV_ARGS(&pBackBuffer) );
-    auto pBBufferSurfaceDesc = GetDXUTState().GetBackBufferSurfaceDescDXGI();
-    ZeroMemory( pBBufferSurfaceDesc, sizeof( DXGI_SURFACE_DESC ) );
+    DXGI_SURFACE_DESC bBufferSurfaceDesc = {};
     if( SUCCEEDED( hr ) )
     {
         D3D11_TEXTURE2D_DESC TexDesc;
         pBackBuffer->GetDesc( &TexDesc );
-        pBBufferSurfaceDesc->Width = ( UINT )TexDesc.Width;
-        pBBufferSurfaceDesc->Height = ( UINT )TexDesc.Height;
-        pBBufferSurfaceDesc->Format = TexDesc.Format;
-        pBBufferSurfaceDesc->SampleDesc = TexDesc.SampleDesc;
+        bBufferSurfaceDesc.Width = ( UINT )TexDesc.Width;
+        bBufferSurfaceDesc.Height = ( UINT )TexDesc.Height;
+        bBufferSurfaceDesc.Format = TexDesc.Format;
+        bBufferSurfaceDesc.SampleDesc = TexDesc.SampleDesc;
         SAFE_RELEASE( pBackBuffer );
     }
+    GetDXUTState().SetBackBufferSurfaceDescDXGI( &bBufferSurfaceDesc );
 }
 
 
@@ -4301,11 +4922,64 @@ void WINAPI DXUTResetFrameworkState()
 }
 
 
+//--------------------------------------------------------------------------------------
+// Headless summary lines go to stdout as well as the debugger, so a harness that runs
+// the app with its output redirected gets them in release builds too
+//--------------------------------------------------------------------------------------
+namespace
+{
+
+void DXUTReportHeadless( _In_z_ _Printf_format_string_ const char* strFormat, ... )
+{
+    char strLine[512];
+
+    va_list args;
+    va_start( args, strFormat );
+    int nLength = vsprintf_s( strLine, 512, strFormat, args );
+    va_end( args );
+    if( nLength <= 0 )
+        return;
+
+    OutputDebugStringA( strLine );
+
+    HANDLE hStdOut = GetStdHandle( STD_OUTPUT_HANDLE );
+    if( hStdOut && hStdOut != INVALID_HANDLE_VALUE )
+    {
+        DWORD dwWritten = 0;
+        WriteFile( hStdOut, strLine, DWORD( nLength ), &dwWritten, nullptr );
+    }
+}
+
+};
+
+
 //--------------------------------------------------------------------------------------
 // Closes down the window.  When the window closes, it will cleanup everything
 //--------------------------------------------------------------------------------------
 void WINAPI DXUTShutdown( _In_ int nExitCode )
 {
+    // Headless runs are benchmarks, so leave the numbers where a harness can pick them up
+    static bool s_bReportedCounters = false;
+    if( GetDXUTState().GetHeadless() && !s_bReportedCounters && g_FrameCounters.Frames > 0 )
+    {
+        s_bReportedCounters = true;
+
+        double fFrames = double( g_FrameCounters.Frames );
+        DXUTReportHeadless( "DXUT headless: %llu frames, %.4f ms frame move, %.4f ms frame render per frame\n",
+                            g_FrameCounters.Frames,
+                            g_FrameCounters.FrameMoveSeconds * 1000.0 / fFrames,
+                            g_FrameCounters.FrameRenderSeconds * 1000.0 / fFrames );
+        DXUTReportHeadless( "DXUT headless: %.2f draws, %.2f binds, %.2f updates, %.2f clears per frame\n",
+                            double( g_FrameCounters.APICalls[DXUT_API_DRAW] ) / fFrames,
+                            double( g_FrameCounters.APICalls[DXUT_API_BIND] ) / fFrames,
+                            double( g_FrameCounters.APICalls[DXUT_API_UPDATE] ) / fFrames,
+                            double( g_FrameCounters.APICalls[DXUT_API_CLEAR] ) / fFrames );
+#if defined(DEBUG) || defined(_DEBUG)
+        DXUTReportHeadless( "DXUT headless: %.2f heap allocations per frame\n",
+                            double( g_FrameCounters.HeapAllocations ) / fFrames );
+#endif
+    }
+
     HWND hWnd = DXUTGetHWND();
     if( hWnd )
         SendMessage( hWnd, WM_CLOSE, 0, 0 );
@@ -4331,6 +5005,47 @@ void WINAPI DXUTShutdown( _In_ int nExitCode )
 }
 
 
+//--------------------------------------------------------------------------------------
+// Headless mode.  Must be set before the device is created.  Error message boxes are
+// turned off since nobody is there to dismiss them.
+//--------------------------------------------------------------------------------------
+void WINAPI DXUTSetHeadless( _In_ bool bHeadless )
+{
+    GetDXUTState().SetHeadless( bHeadless );
+    if( bHeadless )
+        GetDXUTState().SetShowMsgBoxOnError( false );
+}
+
+
+//--------------------------------------------------------------------------------------
+// Frame counters
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void WINAPI DXUTCountAPICalls( DXUT_API_COUNTER counter, UINT nCalls )
+{
+    if( counter < DXUT_API_COUNTER_COUNT )
+        InterlockedExchangeAdd64( reinterpret_cast<volatile LONGLONG*>( &g_FrameCounters.APICalls[ counter ] ), LONGLONG( nCalls ) );
+}
+
+_Use_decl_annotations_
+void WINAPI DXUTAddFrameGUITime( LONGLONG qpcTicks )
+{
+    InterlockedExchangeAdd64( &g_FrameGUITicks, qpcTicks );
+}
+
+_Use_decl_annotations_
+void WINAPI DXUTGetFrameCounters( DXUT_FRAME_COUNTERS* pCounters )
+{
+    if( pCounters )
+        *pCounters = g_FrameCounters;
+}
+
+void WINAPI DXUTResetFrameCounters()
+{
+    ZeroMemory( &g_FrameCounters, sizeof( g_FrameCounters ) );
+}
+
+
 //--------------------------------------------------------------------------------------
 // Tells DXUT whether to operate in gamma correct mode
 //--------------------------------------------------------------------------------------
@@ -50,6 +50,7 @@
 #pragma comment( lib, "d3dcompiler.lib" )
 #pragma comment( lib, "ole32.lib" )
 #pragma comment( lib, "uuid.lib" )
+#pragma comment( lib, "winmm.lib" )
 #endif
 
 #pragma warning( disable : 4481 )
@@ -167,6 +168,48 @@ struct DXUTDeviceSettings
     DXUTD3D11DeviceSettings d3d11;
 };
 
+// Direct3D calls counted by DXUT, CDXUTSDKMesh and the GUI
+enum DXUT_API_COUNTER
+{
+    DXUT_API_DRAW = 0,      // Draw and DrawIndexed
+    DXUT_API_BIND,          // Input assembler, shader, resource and state binding
+    DXUT_API_UPDATE,        // Map and UpdateSubresource
+    DXUT_API_CLEAR,
+    DXUT_API_PRESENT,
+    DXUT_API_COUNTER_COUNT
+};
+
+struct DXUT_FRAME_COUNTERS
+{
+    UINT64 Frames;
+    double FrameMoveSeconds;    // CPU time spent in the frame move callback
+    double FrameRenderSeconds;  // CPU time spent in the frame render callback
+    UINT64 APICalls[DXUT_API_COUNTER_COUNT];
+    UINT64 HeapAllocations;     // CRT allocations on any thread during frames; debug builds only
+};
+
+
+//--------------------------------------------------------------------------------------
+// Consistent copy of the frequently read framework state.  Reading it never takes the
+// framework lock, so worker threads can poll it every frame.
+//--------------------------------------------------------------------------------------
+struct DXUT_FRAME_SNAPSHOT
+{
+    double Time;
+    double AbsoluteTime;
+    float ElapsedTime;
+    ID3D11Device* D3D11Device;                      // Not addref'd
+    ID3D11DeviceContext* D3D11DeviceContext;
+    IDXGISwapChain* DXGISwapChain;
+    ID3D11RenderTargetView* D3D11RenderTargetView;
+    ID3D11DepthStencilView* D3D11DepthStencilView;
+    DXGI_SURFACE_DESC BackBufferSurfaceDescDXGI;
+    int PauseRenderingCount;
+    int PauseTimeCount;
+    bool RenderingOccluded;
+    bool Active;
+};
+
 
 //--------------------------------------------------------------------------------------
 // Error codes
@@ -273,6 +316,14 @@ void    WINAPI DXUTResetFrameworkState();
 void    WINAPI DXUTShutdown( _In_ int nExitCode = 0 );
 void    WINAPI DXUTSetIsInGammaCorrectMode( _In_ bool bGammaCorrect );
 bool    WINAPI DXUTGetMSAASwapChainCreated();
+void    WINAPI DXUTSetHeadless( _In_ bool bHeadless ); // Before device creation: WARP device, hidden window, no Present
+
+// Frame counters, for measuring CPU frame cost.  Counting is safe from render pass workers;
+// get and reset from the render thread only.
+void    WINAPI DXUTCountAPICalls( _In_ DXUT_API_COUNTER counter, _In_ UINT nCalls = 1 );
+void    WINAPI DXUTAddFrameGUITime( _In_ LONGLONG qpcTicks ); // GUI time inside the render callback, split out by -benchmark
+void    WINAPI DXUTGetFrameCounters( _Out_ DXUT_FRAME_COUNTERS* pCounters );
+void    WINAPI DXUTResetFrameCounters();
 
 
 //--------------------------------------------------------------------------------------
@@ -282,7 +333,7 @@ bool    WINAPI DXUTGetMSAASwapChainCreated();
 // Direct3D 11.x (These do not addref unlike typical Get* APIs)
 IDXGIFactory1*           WINAPI DXUTGetDXGIFactory(); 
 IDXGISwapChain*          WINAPI DXUTGetDXGISwapChain();
-const DXGI_SURFACE_DESC* WINAPI DXUTGetDXGIBackBufferSurfaceDesc();
+const DXGI_SURFACE_DESC* WINAPI DXUTGetDXGIBackBufferSurfaceDesc(); // Render thread only; other threads use DXUTGetFrameSnapshot
 HRESULT                  WINAPI DXUTSetupD3D11Views( _In_ ID3D11DeviceContext* pd3dDeviceContext ); // Supports immediate or deferred context
 D3D_FEATURE_LEVEL        WINAPI DXUTGetD3D11DeviceFeatureLevel(); // Returns the D3D11 devices current feature level
 ID3D11RenderTargetView*  WINAPI DXUTGetD3D11RenderTargetView();
@@ -329,9 +380,11 @@ bool      WINAPI DXUTIsVsyncEnabled();
 bool      WINAPI DXUTIsRenderingPaused();
 bool      WINAPI DXUTIsTimePaused();
 bool      WINAPI DXUTIsActive();
+void      WINAPI DXUTGetFrameSnapshot( _Out_ DXUT_FRAME_SNAPSHOT* pSnapshot ); // Lock free, callable from any thread
 int       WINAPI DXUTGetExitCode();
 bool      WINAPI DXUTGetShowMsgBoxOnError();
 bool      WINAPI DXUTGetAutomation();  // Returns true if -automation parameter is used to launch the app
+bool      WINAPI DXUTIsHeadless();     // Returns true if -headless is used or DXUTSetHeadless was called
 bool      WINAPI DXUTIsKeyDown( _In_ BYTE vKey ); // Pass a virtual-key code, ex. VK_F1, 'A', VK_RETURN, VK_LSHIFT, etc
 bool      WINAPI DXUTWasKeyPressed( _In_ BYTE vKey );  // Like DXUTIsKeyDown() but return true only if the key was just pressed
 bool      WINAPI DXUTIsMouseButtonDown( _In_ BYTE vButton ); // Pass a virtual-key code: VK_LBUTTON, VK_RBUTTON, VK_MBUTTON, VK_XBUTTON1, VK_XBUTTON2
@@ -341,5 +394,6 @@ void      WINAPI DXUTDestroyState(); // Optional method to destroy DXUT's memory
 //--------------------------------------------------------------------------------------
 // DXUT core layer includes
 //--------------------------------------------------------------------------------------
+#include "DXUTFrameArena.h"
 #include "DXUTmisc.h"
 #include "DXUTDevice11.h"
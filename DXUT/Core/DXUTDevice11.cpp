@@ -13,6 +13,10 @@
 // http://go.microsoft.com/fwlink/?LinkId=320437
 //--------------------------------------------------------------------------------------
 #include "DXUT.h"
+#include "DXUTEnumerationCache.h"
+
+#include <string>
+#include <thread>
 
 //--------------------------------------------------------------------------------------
 // Forward declarations
@@ -22,6 +26,7 @@ extern void DXUTGetCallbackD3D11DeviceAcceptable( LPDXUTCALLBACKISD3D11DEVICEACC
 static int __cdecl SortModesCallback( const void* arg1, const void* arg2 );
 
 CD3D11Enumeration*  g_pDXUTD3D11Enumeration = nullptr;
+std::wstring        g_strDXUTEnumerationCacheFile;
 
 HRESULT WINAPI DXUTCreateD3D11Enumeration()
 {
@@ -47,6 +52,60 @@ DXUTMemoryHelperD3D11Enum() { DXUTCreateD3D11Enumeration(); }
 };
 
 
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT WINAPI DXUTSetD3D11EnumerationCacheFile( LPCWSTR szFileName )
+{
+    if( szFileName && !*szFileName )
+        return E_INVALIDARG;
+
+    g_strDXUTEnumerationCacheFile = szFileName ? szFileName : L"";
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+// The enumeration cache file format is in DXUTEnumerationCache.h.  Its records are copied
+// field by field from the DXGI and D3D11 structures they describe.
+//--------------------------------------------------------------------------------------
+namespace
+{
+
+// Includes the terminator, so consecutive strings hash differently when split differently
+inline UINT64 HashEnumString( _In_ UINT64 hash, _In_z_ LPCWSTR str )
+{
+    return DXUTHashEnumCacheBytes( hash, str, ( wcslen( str ) + 1 ) * sizeof( WCHAR ) );
+}
+
+DXUT_ENUM_CACHE_MODE ToCacheMode( _In_ const DXGI_MODE_DESC& desc )
+{
+    DXUT_ENUM_CACHE_MODE mode;
+    mode.Width = desc.Width;
+    mode.Height = desc.Height;
+    mode.RefreshNumerator = desc.RefreshRate.Numerator;
+    mode.RefreshDenominator = desc.RefreshRate.Denominator;
+    mode.Format = UINT( desc.Format );
+    mode.ScanlineOrdering = UINT( desc.ScanlineOrdering );
+    mode.Scaling = UINT( desc.Scaling );
+    return mode;
+}
+
+DXGI_MODE_DESC FromCacheMode( _In_ const DXUT_ENUM_CACHE_MODE& mode )
+{
+    DXGI_MODE_DESC desc;
+    desc.Width = mode.Width;
+    desc.Height = mode.Height;
+    desc.RefreshRate.Numerator = mode.RefreshNumerator;
+    desc.RefreshRate.Denominator = mode.RefreshDenominator;
+    desc.Format = DXGI_FORMAT( mode.Format );
+    desc.ScanlineOrdering = DXGI_MODE_SCANLINE_ORDER( mode.ScanlineOrdering );
+    desc.Scaling = DXGI_MODE_SCALING( mode.Scaling );
+    return desc;
+}
+
+};
+
+
 //--------------------------------------------------------------------------------------
 _Use_decl_annotations_
 CD3D11Enumeration* WINAPI DXUTGetD3D11Enumeration( bool bForceEnumerate, bool bEnumerateAllAdapterFormats, D3D_FEATURE_LEVEL forceFL )
@@ -76,8 +135,12 @@ CD3D11Enumeration::CD3D11Enumeration() :
     m_bEnumerateAllAdapterFormats(false),
     m_forceFL(D3D_FEATURE_LEVEL(0)),
     m_warpFL(D3D_FEATURE_LEVEL_10_1),
-    m_refFL(D3D_FEATURE_LEVEL_11_0)
+    m_refFL(D3D_FEATURE_LEVEL_11_0),
+    m_minFL(D3D_FEATURE_LEVEL(0)),
+    m_bGammaCorrect(true),
+    m_pFactory(nullptr)
 {
+    ZeroMemory( &m_Stats, sizeof(m_Stats) );
     ResetPossibleDepthStencilFormats();
 }
 
@@ -86,6 +149,17 @@ CD3D11Enumeration::CD3D11Enumeration() :
 CD3D11Enumeration::~CD3D11Enumeration()
 {
     ClearAdapterInfoList();
+    SAFE_RELEASE( m_pFactory );
+}
+
+
+//--------------------------------------------------------------------------------------
+void CD3D11Enumeration::SetDXGIFactory( _In_opt_ IDXGIFactory1* pFactory )
+{
+    if( pFactory )
+        pFactory->AddRef();
+    SAFE_RELEASE( m_pFactory );
+    m_pFactory = pFactory;
 }
 
 
@@ -100,6 +174,10 @@ CD3D11Enumeration::~CD3D11Enumeration()
 // app to change the BehaviorFlags.  The BehaviorFlags defaults non-pure HWVP 
 // if supported otherwise it will default to SWVP, however the app can change this 
 // through the ConfirmDevice callback.
+//
+// Adapters missing from the enumeration cache are probed on their own threads, along with
+// the WARP and REF feature levels.  The combos, and so the app's callback, are still built
+// on the calling thread in adapter order.
 //--------------------------------------------------------------------------------------
 _Use_decl_annotations_
 HRESULT CD3D11Enumeration::Enumerate( LPDXUTCALLBACKISD3D11DEVICEACCEPTABLE IsD3D11DeviceAcceptableFunc,
@@ -107,16 +185,25 @@ HRESULT CD3D11Enumeration::Enumerate( LPDXUTCALLBACKISD3D11DEVICEACCEPTABLE IsD3
 {
     CDXUTPerfEventGenerator eventGenerator( DXUT_PERFEVENTCOLOR, L"DXUT D3D11 Enumeration" );
     HRESULT hr;
-    auto pFactory = DXUTGetDXGIFactory();
+    auto pFactory = m_pFactory ? m_pFactory : DXUTGetDXGIFactory();
     if( !pFactory )
         return E_FAIL;
 
+    LONGLONG llStart = DXUTGetTimestamp();
+    ZeroMemory( &m_Stats, sizeof(m_Stats) );
+
     m_bHasEnumerated = true;
     m_IsD3D11DeviceAcceptableFunc = IsD3D11DeviceAcceptableFunc;
     m_pIsD3D11DeviceAcceptableFuncUserContext = pIsD3D11DeviceAcceptableFuncUserContext;
+    m_minFL = DXUTGetDeviceSettings().MinimumFeatureLevel;
+    m_bGammaCorrect = DXUTIsInGammaCorrectMode();
+
+    // Loads d3d11.dll here rather than racing to do it on the probe threads
+    DXUT_EnsureD3D11APIs();
 
     ClearAdapterInfoList();
 
+    std::vector<AdapterProbe> probes;
     for( int index = 0; ; ++index )
     {
         IDXGIAdapter* pAdapter = nullptr;
@@ -144,29 +231,113 @@ HRESULT CD3D11Enumeration::Enumerate( LPDXUTCALLBACKISD3D11DEVICEACCEPTABLE IsD3
         if( !pAdapterInfo )
         {
             SAFE_RELEASE( pAdapter );
+            for( auto it = probes.begin(); it != probes.end(); ++it )
+                delete it->pAdapterInfo;
             return E_OUTOFMEMORY;
         }
         pAdapterInfo->AdapterOrdinal = index;
         pAdapter->GetDesc( &pAdapterInfo->AdapterDesc );
         pAdapterInfo->m_pAdapter = pAdapter;
 
-        // Enumerate the device driver types on the adapter.
-        hr = EnumerateDevices( pAdapterInfo );
-        if( FAILED( hr ) )
+        hr = EnumerateOutputs( pAdapterInfo );
+        if( FAILED( hr ) || pAdapterInfo->outputInfoList.empty() )
         {
             delete pAdapterInfo;
             continue;
         }
 
-        hr = EnumerateOutputs( pAdapterInfo );
-        if( FAILED( hr ) || pAdapterInfo->outputInfoList.empty() )
+        AdapterProbe probe;
+        probe.pAdapterInfo = pAdapterInfo;
+        probe.CacheKey = ComputeCacheKey( pAdapterInfo );
+        probe.bFromCache = false;
+        probe.hr = S_OK;
+        probe.DevicesSeconds = 0;
+        probe.DisplayModesSeconds = 0;
+        probes.push_back( probe );
+    }
+
+    LONGLONG llAdapters = DXUTGetTimestamp();
+    m_Stats.AdaptersSeconds = DXUTTimestampToSeconds( llAdapters - llStart );
+
+    const std::wstring strCacheFile = g_strDXUTEnumerationCacheFile;
+    if( !strCacheFile.empty() && !probes.empty() )
+        LoadCache( strCacheFile.c_str(), probes );
+
+    LONGLONG llCacheRead = DXUTGetTimestamp();
+    m_Stats.CacheSeconds = DXUTTimestampToSeconds( llCacheRead - llAdapters );
+
+    // Probe the misses and the software rasterizers in parallel.  Nothing a probe touches is
+    // shared with another probe.
+    std::vector<std::thread> threads;
+    for( auto it = probes.begin(); it != probes.end(); ++it )
+    {
+        if( it->bFromCache )
+        {
+            ++m_Stats.CacheHits;
+            continue;
+        }
+
+        ++m_Stats.CacheMisses;
+        auto pProbe = &( *it );
+        try
+        {
+            threads.push_back( std::thread( [this, pProbe]() { ProbeAdapter( *pProbe ); } ) );
+        }
+        catch( ... )
+        {
+            ProbeAdapter( *pProbe );
+        }
+    }
+
+    ProbeSoftwareFeatureLevels();
+
+    for( auto it = threads.begin(); it != threads.end(); ++it )
+        it->join();
+    threads.clear();
+
+    LONGLONG llProbes = DXUTGetTimestamp();
+    for( auto it = probes.cbegin(); it != probes.cend(); ++it )
+    {
+        m_Stats.DevicesSeconds += it->DevicesSeconds;
+        m_Stats.DisplayModesSeconds += it->DisplayModesSeconds;
+    }
+
+    // Written before empty outputs are dropped so the cached output list lines up with DXGI's
+    if( !strCacheFile.empty() && m_Stats.CacheMisses > 0 )
+    {
+        hr = SaveCache( strCacheFile.c_str(), probes );
+        if( FAILED( hr ) )
+            DXUTOutputDebugString( L"DXUT: failed to write enumeration cache %ls (%08X)\n", strCacheFile.c_str(), hr );
+    }
+
+    LONGLONG llCacheWrite = DXUTGetTimestamp();
+    m_Stats.CacheSeconds += DXUTTimestampToSeconds( llCacheWrite - llProbes );
+
+    for( auto it = probes.begin(); it != probes.end(); ++it )
+    {
+        auto pAdapterInfo = it->pAdapterInfo;
+
+        // If an output has no valid display mode, do not save it.
+        auto& outputs = pAdapterInfo->outputInfoList;
+        for( auto oit = outputs.begin(); oit != outputs.end(); )
+        {
+            if( (*oit)->displayModeList.empty() )
+            {
+                delete *oit;
+                oit = outputs.erase( oit );
+            }
+            else
+                ++oit;
+        }
+
+        if( FAILED( it->hr ) || outputs.empty() )
         {
             delete pAdapterInfo;
             continue;
         }
 
         // Get info for each devicecombo on this device
-        if( FAILED( hr = EnumerateDeviceCombos( pAdapterInfo ) ) )
+        if( FAILED( hr = EnumerateDeviceCombos( pAdapterInfo, it->MultiSampleLevels ) ) )
         {
             delete pAdapterInfo;
             continue;
@@ -185,10 +356,11 @@ HRESULT CD3D11Enumeration::Enumerate( LPDXUTCALLBACKISD3D11DEVICEACCEPTABLE IsD3
         }
         pAdapterInfo->bAdapterUnavailable = true;
 
-        hr = EnumerateDevices( pAdapterInfo );
+        std::vector<MultiSampleLevel> multiSampleLevels;
+        hr = EnumerateDevices( pAdapterInfo, multiSampleLevels );
 
         // Get info for each devicecombo on this device
-        if( FAILED( hr = EnumerateDeviceCombosNoAdapter(  pAdapterInfo ) ) )
+        if( FAILED( hr = EnumerateDeviceCombosNoAdapter( pAdapterInfo, multiSampleLevels ) ) )
         {
             delete pAdapterInfo;
         }
@@ -232,6 +404,49 @@ HRESULT CD3D11Enumeration::Enumerate( LPDXUTCALLBACKISD3D11DEVICEACCEPTABLE IsD3
         }
     }
 
+    LONGLONG llEnd = DXUTGetTimestamp();
+    m_Stats.CombosSeconds = DXUTTimestampToSeconds( llEnd - llCacheWrite );
+    m_Stats.TotalSeconds = DXUTTimestampToSeconds( llEnd - llStart );
+
+    DXUTOutputDebugString( L"DXUT: enumeration took %.1f ms (adapters %.1f, cache %.1f, devices %.1f, modes %.1f, combos %.1f), %u cached, %u probed\n",
+                           m_Stats.TotalSeconds * 1000.0, m_Stats.AdaptersSeconds * 1000.0, m_Stats.CacheSeconds * 1000.0,
+                           m_Stats.DevicesSeconds * 1000.0, m_Stats.DisplayModesSeconds * 1000.0, m_Stats.CombosSeconds * 1000.0,
+                           m_Stats.CacheHits, m_Stats.CacheMisses );
+
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Runs on a probe thread for adapters that were not in the cache
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void CD3D11Enumeration::ProbeAdapter( AdapterProbe& probe )
+{
+    LONGLONG llStart = DXUTGetTimestamp();
+
+    // Enumerate the device driver types on the adapter.
+    probe.hr = EnumerateDevices( probe.pAdapterInfo, probe.MultiSampleLevels );
+
+    LONGLONG llDevices = DXUTGetTimestamp();
+    probe.DevicesSeconds = DXUTTimestampToSeconds( llDevices - llStart );
+
+    if( SUCCEEDED( probe.hr ) )
+    {
+        auto& outputs = probe.pAdapterInfo->outputInfoList;
+        for( auto it = outputs.begin(); it != outputs.end(); ++it )
+            EnumerateDisplayModes( *it );
+    }
+
+    probe.DisplayModesSeconds = DXUTTimestampToSeconds( DXUTGetTimestamp() - llDevices );
+}
+
+
+//--------------------------------------------------------------------------------------
+void CD3D11Enumeration::ProbeSoftwareFeatureLevels()
+{
+    HRESULT hr;
+
     // Check WARP max feature level
     {
         static const D3D_FEATURE_LEVEL fLvlWarp[] =
@@ -293,6 +508,216 @@ HRESULT CD3D11Enumeration::Enumerate( LPDXUTCALLBACKISD3D11DEVICEACCEPTABLE IsD3
         else
             m_refFL = D3D_FEATURE_LEVEL_11_0;
     }
+}
+
+
+//--------------------------------------------------------------------------------------
+// Covers everything the cached results depend on: the adapter and its user mode driver
+// version, the outputs attached to it, and the settings that shape the enumeration
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+UINT64 CD3D11Enumeration::ComputeCacheKey( const CD3D11EnumAdapterInfo* pAdapterInfo ) const
+{
+#ifdef USE_DIRECT3D11_3
+    const UINT bDirect3D11_3 = 1;
+#else
+    const UINT bDirect3D11_3 = 0;
+#endif
+    const UINT settings[] =
+    {
+        DXUT_ENUM_CACHE_VERSION, D3D11_SDK_VERSION, bDirect3D11_3,
+        UINT( m_minFL ), UINT( m_forceFL ), UINT( m_bGammaCorrect ), UINT( m_bEnumerateAllAdapterFormats )
+    };
+
+    UINT64 hash = DXUTHashEnumCacheBytes( DXUT_ENUM_CACHE_HASH_SEED, settings, sizeof( settings ) );
+
+    const DXGI_ADAPTER_DESC& desc = pAdapterInfo->AdapterDesc;
+    const UINT ids[] = { desc.VendorId, desc.DeviceId, desc.SubSysId, desc.Revision };
+    hash = DXUTHashEnumCacheBytes( hash, ids, sizeof( ids ) );
+    hash = HashEnumString( hash, desc.Description );
+
+    LARGE_INTEGER umdVersion = {};
+    if( FAILED( pAdapterInfo->m_pAdapter->CheckInterfaceSupport( __uuidof( IDXGIDevice ), &umdVersion ) ) )
+        umdVersion.QuadPart = 0;
+    hash = DXUTHashEnumCacheBytes( hash, &umdVersion, sizeof( umdVersion ) );
+
+    UINT nOutputs = UINT( pAdapterInfo->outputInfoList.size() );
+    hash = DXUTHashEnumCacheBytes( hash, &nOutputs, sizeof( nOutputs ) );
+    for( auto it = pAdapterInfo->outputInfoList.cbegin(); it != pAdapterInfo->outputInfoList.cend(); ++it )
+    {
+        const DXGI_OUTPUT_DESC& outputDesc = (*it)->Desc;
+        hash = HashEnumString( hash, outputDesc.DeviceName );
+        hash = DXUTHashEnumCacheBytes( hash, &outputDesc.DesktopCoordinates, sizeof( outputDesc.DesktopCoordinates ) );
+        const UINT output[] = { UINT( outputDesc.AttachedToDesktop ), UINT( outputDesc.Rotation ) };
+        hash = DXUTHashEnumCacheBytes( hash, output, sizeof( output ) );
+    }
+
+    return hash;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Fills in every probe whose key is in the cache file.  A missing or unreadable file is a
+// miss for every adapter, and a truncated one keeps the records read before the damage.
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void CD3D11Enumeration::LoadCache( LPCWSTR szFileName, std::vector<AdapterProbe>& probes )
+{
+    HANDLE hFile = CreateFileW( szFileName, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+                                FILE_FLAG_SEQUENTIAL_SCAN, nullptr );
+    if( hFile == INVALID_HANDLE_VALUE )
+        return;
+
+    LARGE_INTEGER FileSize = { 0 };
+    if( !GetFileSizeEx( hFile, &FileSize ) || FileSize.HighPart > 0 || FileSize.LowPart < sizeof( DXUT_ENUM_CACHE_HEADER ) )
+    {
+        CloseHandle( hFile );
+        return;
+    }
+
+    std::unique_ptr<BYTE[]> data( new (std::nothrow) BYTE[ FileSize.LowPart ] );
+    DWORD BytesRead = 0;
+    BOOL bRead = data ? ReadFile( hFile, data.get(), FileSize.LowPart, &BytesRead, nullptr ) : FALSE;
+    CloseHandle( hFile );
+
+    if( !bRead || BytesRead != FileSize.LowPart )
+        return;
+
+    // A damaged file still hands back the adapters read before the damage
+    std::vector<DXUT_ENUM_CACHE_ADAPTER> cached;
+    DXUTReadEnumerationCache( data.get(), BytesRead, cached );
+
+    for( auto cit = cached.begin(); cit != cached.end(); ++cit )
+    {
+        for( auto it = probes.begin(); it != probes.end(); ++it )
+        {
+            auto pAdapterInfo = it->pAdapterInfo;
+            if( it->bFromCache || it->CacheKey != cit->Key || pAdapterInfo->outputInfoList.size() != cit->OutputModes.size() )
+                continue;
+
+            std::vector<CD3D11EnumDeviceInfo*> deviceInfoList;
+            for( auto dit = cit->Devices.cbegin(); dit != cit->Devices.cend(); ++dit )
+            {
+                auto pDeviceInfo = new (std::nothrow) CD3D11EnumDeviceInfo;
+                if( !pDeviceInfo )
+                    break;
+
+                pDeviceInfo->AdapterOrdinal = pAdapterInfo->AdapterOrdinal;
+                pDeviceInfo->DeviceType = D3D_DRIVER_TYPE( dit->DeviceType );
+                pDeviceInfo->SelectedLevel = D3D_FEATURE_LEVEL( dit->SelectedLevel );
+                pDeviceInfo->MaxLevel = D3D_FEATURE_LEVEL( dit->MaxLevel );
+                pDeviceInfo->ComputeShaders_Plus_RawAndStructuredBuffers_Via_Shader_4_x = BOOL( dit->ComputeShaders_Plus_RawAndStructuredBuffers_Via_Shader_4_x );
+                deviceInfoList.push_back( pDeviceInfo );
+            }
+
+            if( deviceInfoList.size() != cit->Devices.size() )
+            {
+                // Out of memory, so probe this adapter instead
+                for( auto dit = deviceInfoList.begin(); dit != deviceInfoList.end(); ++dit )
+                    delete *dit;
+                break;
+            }
+
+            for( size_t iOutput = 0; iOutput < cit->OutputModes.size(); ++iOutput )
+            {
+                const std::vector<DXUT_ENUM_CACHE_MODE>& modes = cit->OutputModes[ iOutput ];
+                auto& displayModeList = pAdapterInfo->outputInfoList[ iOutput ]->displayModeList;
+                displayModeList.clear();
+                displayModeList.reserve( modes.size() );
+                for( auto mit = modes.cbegin(); mit != modes.cend(); ++mit )
+                    displayModeList.push_back( FromCacheMode( *mit ) );
+            }
+
+            it->MultiSampleLevels.clear();
+            it->MultiSampleLevels.reserve( cit->MultiSampleLevels.size() );
+            for( auto lit = cit->MultiSampleLevels.cbegin(); lit != cit->MultiSampleLevels.cend(); ++lit )
+            {
+                MultiSampleLevel level;
+                level.DeviceType = D3D_DRIVER_TYPE( lit->DeviceType );
+                level.Format = DXGI_FORMAT( lit->Format );
+                level.Count = lit->Count;
+                level.Quality = lit->Quality;
+                it->MultiSampleLevels.push_back( level );
+            }
+
+            pAdapterInfo->deviceInfoList.swap( deviceInfoList );
+            it->bFromCache = true;
+            break;
+        }
+    }
+}
+
+
+//--------------------------------------------------------------------------------------
+// Writes to a temporary file and renames it over the cache, so another process starting
+// at the same time never reads a partial file
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CD3D11Enumeration::SaveCache( LPCWSTR szFileName, const std::vector<AdapterProbe>& probes ) const
+{
+    std::vector<DXUT_ENUM_CACHE_ADAPTER> adapters;
+    for( auto it = probes.cbegin(); it != probes.cend(); ++it )
+    {
+        if( FAILED( it->hr ) )
+            continue;
+
+        auto pAdapterInfo = it->pAdapterInfo;
+
+        adapters.push_back( DXUT_ENUM_CACHE_ADAPTER() );
+        DXUT_ENUM_CACHE_ADAPTER& adapter = adapters.back();
+        adapter.Key = it->CacheKey;
+
+        adapter.OutputModes.resize( pAdapterInfo->outputInfoList.size() );
+        for( size_t iOutput = 0; iOutput < pAdapterInfo->outputInfoList.size(); ++iOutput )
+        {
+            const auto& displayModeList = pAdapterInfo->outputInfoList[ iOutput ]->displayModeList;
+            adapter.OutputModes[ iOutput ].reserve( displayModeList.size() );
+            for( auto mit = displayModeList.cbegin(); mit != displayModeList.cend(); ++mit )
+                adapter.OutputModes[ iOutput ].push_back( ToCacheMode( *mit ) );
+        }
+
+        for( auto dit = pAdapterInfo->deviceInfoList.cbegin(); dit != pAdapterInfo->deviceInfoList.cend(); ++dit )
+        {
+            DXUT_ENUM_CACHE_DEVICE device;
+            device.DeviceType = UINT( (*dit)->DeviceType );
+            device.SelectedLevel = UINT( (*dit)->SelectedLevel );
+            device.MaxLevel = UINT( (*dit)->MaxLevel );
+            device.ComputeShaders_Plus_RawAndStructuredBuffers_Via_Shader_4_x = UINT( (*dit)->ComputeShaders_Plus_RawAndStructuredBuffers_Via_Shader_4_x );
+            adapter.Devices.push_back( device );
+        }
+
+        for( auto lit = it->MultiSampleLevels.cbegin(); lit != it->MultiSampleLevels.cend(); ++lit )
+        {
+            DXUT_ENUM_CACHE_SAMPLE_LEVEL level;
+            level.DeviceType = UINT( lit->DeviceType );
+            level.Format = UINT( lit->Format );
+            level.Count = lit->Count;
+            level.Quality = lit->Quality;
+            adapter.MultiSampleLevels.push_back( level );
+        }
+    }
+
+    std::vector<uint8_t> data;
+    DXUTWriteEnumerationCache( adapters, data );
+
+    WCHAR strSuffix[32];
+    swprintf_s( strSuffix, 32, L".%lx.tmp", GetCurrentProcessId() );
+    std::wstring strTemp = std::wstring( szFileName ) + strSuffix;
+
+    HANDLE hFile = CreateFileW( strTemp.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr );
+    if( hFile == INVALID_HANDLE_VALUE )
+        return HRESULT_FROM_WIN32( GetLastError() );
+
+    DWORD BytesWritten = 0;
+    BOOL bWritten = WriteFile( hFile, data.data(), DWORD( data.size() ), &BytesWritten, nullptr );
+    CloseHandle( hFile );
+
+    if( !bWritten || BytesWritten != data.size()
+        || !MoveFileExW( strTemp.c_str(), szFileName, MOVEFILE_REPLACE_EXISTING ) )
+    {
+        DeleteFileW( strTemp.c_str() );
+        return E_FAIL;
+    }
 
     return S_OK;
 }
@@ -328,14 +753,7 @@ HRESULT CD3D11Enumeration::EnumerateOutputs( _In_ CD3D11EnumAdapterInfo* pAdapte
             pOutputInfo->m_pOutput = pOutput;
             pOutput->GetDesc( &pOutputInfo->Desc );
 
-            EnumerateDisplayModes( pOutputInfo );
-            if( pOutputInfo->displayModeList.empty() )
-            {
-                // If this output has no valid display mode, do not save it.
-                delete pOutputInfo;
-                continue;
-            }
-
+            // Display modes are listed by ProbeAdapter or read from the cache
             pAdapterInfo->outputInfoList.push_back( pOutputInfo );
         }
     }
@@ -358,7 +776,7 @@ HRESULT CD3D11Enumeration::EnumerateDisplayModes( _In_ CD3D11EnumOutputInfo* pOu
 
     // Swap perferred modes for apps running in linear space
     DXGI_FORMAT RemoteMode = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
-    if( !DXUTIsInGammaCorrectMode() )
+    if( !m_bGammaCorrect )
     {
         allowedAdapterFormatArray[0] = DXGI_FORMAT_R8G8B8A8_UNORM;
         allowedAdapterFormatArray[1] = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
@@ -471,10 +889,10 @@ HRESULT CD3D11Enumeration::EnumerateDisplayModes( _In_ CD3D11EnumOutputInfo* pOu
 
 
 //--------------------------------------------------------------------------------------
-HRESULT CD3D11Enumeration::EnumerateDevices( _In_ CD3D11EnumAdapterInfo* pAdapterInfo )
+_Use_decl_annotations_
+HRESULT CD3D11Enumeration::EnumerateDevices( CD3D11EnumAdapterInfo* pAdapterInfo, std::vector<MultiSampleLevel>& multiSampleLevels )
 {
     HRESULT hr;
-    auto deviceSettings = DXUTGetDeviceSettings();
     const D3D_DRIVER_TYPE devTypeArray[] =
     {
         D3D_DRIVER_TYPE_HARDWARE,
@@ -561,7 +979,7 @@ HRESULT CD3D11Enumeration::EnumerateDevices( _In_ CD3D11EnumAdapterInfo* pAdapte
             delete pDeviceInfo;
             continue;
         }
-        else if ( pDeviceInfo->MaxLevel < deviceSettings.MinimumFeatureLevel )
+        else if ( pDeviceInfo->MaxLevel < m_minFL )
         {
             delete pDeviceInfo;
             SAFE_RELEASE( pd3dDevice );
@@ -619,6 +1037,10 @@ HRESULT CD3D11Enumeration::EnumerateDevices( _In_ CD3D11EnumAdapterInfo* pAdapte
             memset( &ho, 0, sizeof(ho) );
 
         pDeviceInfo->ComputeShaders_Plus_RawAndStructuredBuffers_Via_Shader_4_x = ho.ComputeShaders_Plus_RawAndStructuredBuffers_Via_Shader_4_x; 
+
+        // The device is already at the selected feature level, so it also answers for every combo
+        GetMultiSampleLevels( pd3dDevice, pDeviceInfo->DeviceType, multiSampleLevels );
+
         SAFE_RELEASE( pd3dDeviceContext );             
         SAFE_RELEASE( pd3dDevice );
         pAdapterInfo->deviceInfoList.push_back( pDeviceInfo );
@@ -628,7 +1050,8 @@ HRESULT CD3D11Enumeration::EnumerateDevices( _In_ CD3D11EnumAdapterInfo* pAdapte
 }
 
 
-HRESULT CD3D11Enumeration::EnumerateDeviceCombosNoAdapter( _In_ CD3D11EnumAdapterInfo* pAdapterInfo )
+_Use_decl_annotations_
+HRESULT CD3D11Enumeration::EnumerateDeviceCombosNoAdapter( CD3D11EnumAdapterInfo* pAdapterInfo, const std::vector<MultiSampleLevel>& multiSampleLevels )
 {
     // Iterate through each combination of device driver type, output,
     // adapter format, and backbuffer format to build the adapter's device combo list.
@@ -646,7 +1069,7 @@ HRESULT CD3D11Enumeration::EnumerateDeviceCombosNoAdapter( _In_ CD3D11EnumAdapte
         };
 
         // Swap perferred modes for apps running in linear space
-        if( !DXUTIsInGammaCorrectMode() )
+        if( !m_bGammaCorrect )
         {
             BufferFormatArray[0] = DXGI_FORMAT_R8G8B8A8_UNORM;
             BufferFormatArray[1] = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
@@ -688,7 +1111,7 @@ HRESULT CD3D11Enumeration::EnumerateDeviceCombosNoAdapter( _In_ CD3D11EnumAdapte
             pDeviceCombo->pDeviceInfo = (*dit);
             pDeviceCombo->pOutputInfo = nullptr;
 
-            BuildMultiSampleQualityList( BufferFormat, pDeviceCombo );
+            BuildMultiSampleQualityList( multiSampleLevels, BufferFormat, pDeviceCombo );
 
             pAdapterInfo->deviceSettingsComboList.push_back( pDeviceCombo );
         }
@@ -700,7 +1123,7 @@ HRESULT CD3D11Enumeration::EnumerateDeviceCombosNoAdapter( _In_ CD3D11EnumAdapte
 
 //--------------------------------------------------------------------------------------
 _Use_decl_annotations_
-HRESULT CD3D11Enumeration::EnumerateDeviceCombos( CD3D11EnumAdapterInfo* pAdapterInfo )
+HRESULT CD3D11Enumeration::EnumerateDeviceCombos( CD3D11EnumAdapterInfo* pAdapterInfo, const std::vector<MultiSampleLevel>& multiSampleLevels )
 {
     // Iterate through each combination of device driver type, output,
     // adapter format, and backbuffer format to build the adapter's device combo list.
@@ -723,7 +1146,7 @@ HRESULT CD3D11Enumeration::EnumerateDeviceCombos( CD3D11EnumAdapterInfo* pAdapte
             };
 
             // Swap perferred modes for apps running in linear space
-            if( !DXUTIsInGammaCorrectMode() )
+            if( !m_bGammaCorrect )
             {
                 backBufferFormatArray[0] = DXGI_FORMAT_R8G8B8A8_UNORM;
                 backBufferFormatArray[1] = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
@@ -776,7 +1199,7 @@ HRESULT CD3D11Enumeration::EnumerateDeviceCombos( CD3D11EnumAdapterInfo* pAdapte
                     pDeviceCombo->pDeviceInfo = pDeviceInfo;
                     pDeviceCombo->pOutputInfo = pOutputInfo;
 
-                    BuildMultiSampleQualityList( backBufferFormat, pDeviceCombo );
+                    BuildMultiSampleQualityList( multiSampleLevels, backBufferFormat, pDeviceCombo );
 
                     pAdapterInfo->deviceSettingsComboList.push_back( pDeviceCombo );
                 }
@@ -822,52 +1245,53 @@ void CD3D11Enumeration::SetEnumerateAllAdapterFormats( _In_ bool bEnumerateAllAd
 
 //--------------------------------------------------------------------------------------
 _Use_decl_annotations_
-void CD3D11Enumeration::BuildMultiSampleQualityList( DXGI_FORMAT fmt, CD3D11EnumDeviceSettingsCombo* pDeviceCombo )
+void CD3D11Enumeration::GetMultiSampleLevels( ID3D11Device* pd3dDevice, D3D_DRIVER_TYPE DeviceType,
+                                              std::vector<MultiSampleLevel>& multiSampleLevels )
 {
-    ID3D11Device* pd3dDevice = nullptr;
-    ID3D11DeviceContext* pd3dDeviceContext = nullptr;
-    IDXGIAdapter* pAdapter = nullptr;
-    
-    D3D_FEATURE_LEVEL *FeatureLevels = &(pDeviceCombo->pDeviceInfo->SelectedLevel);
-    D3D_FEATURE_LEVEL returnedFeatureLevel;
-
-    UINT NumFeatureLevels = 1;
-
-    HRESULT hr = DXUT_Dynamic_D3D11CreateDevice( pAdapter, 
-                                                pDeviceCombo->DeviceType,
-                                                ( HMODULE )0,
-                                                0,
-                                                FeatureLevels,
-                                                NumFeatureLevels,
-                                                D3D11_SDK_VERSION,
-                                                &pd3dDevice,
-                                                &returnedFeatureLevel,
-                                                &pd3dDeviceContext )  ;
-
-    if( FAILED( hr))  return;
-
-    if (returnedFeatureLevel != pDeviceCombo->pDeviceInfo->SelectedLevel) return;
-
-    for( int i = 1; i <= D3D11_MAX_MULTISAMPLE_SAMPLE_COUNT; ++i )
+    static const DXGI_FORMAT BackBufferFormatArray[] =
     {
-        UINT Quality;
-        if( SUCCEEDED( pd3dDevice->CheckMultisampleQualityLevels( fmt, i, &Quality ) ) && Quality > 0 )
+        DXGI_FORMAT_R8G8B8A8_UNORM_SRGB,
+        DXGI_FORMAT_R8G8B8A8_UNORM,
+        DXGI_FORMAT_R16G16B16A16_FLOAT,
+        DXGI_FORMAT_R10G10B10A2_UNORM
+    };
+
+    for( UINT iFormat = 0; iFormat < _countof( BackBufferFormatArray ); ++iFormat )
+    {
+        for( UINT i = 1; i <= D3D11_MAX_MULTISAMPLE_SAMPLE_COUNT; ++i )
         {
             //From D3D10 docs: When multisampling a texture, the number of quality levels available for an adapter is dependent on the texture 
             //format used and the number of samples requested. The maximum sample count is defined by 
             //D3D10_MAX_MULTISAMPLE_SAMPLE_COUNT in d3d10.h. If the returned value of pNumQualityLevels is 0, 
             //the format and sample count combination is not supported for the installed adapter.
-
-            if (Quality != 0) {
-                pDeviceCombo->multiSampleCountList.push_back( i );
-                pDeviceCombo->multiSampleQualityList.push_back( Quality );
+            UINT Quality;
+            if( SUCCEEDED( pd3dDevice->CheckMultisampleQualityLevels( BackBufferFormatArray[iFormat], i, &Quality ) ) && Quality > 0 )
+            {
+                MultiSampleLevel level;
+                level.DeviceType = DeviceType;
+                level.Format = BackBufferFormatArray[iFormat];
+                level.Count = i;
+                level.Quality = Quality;
+                multiSampleLevels.push_back( level );
             }
         }
     }
+}
+
 
-    SAFE_RELEASE( pAdapter );
-    SAFE_RELEASE( pd3dDevice );
-    SAFE_RELEASE (pd3dDeviceContext);
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void CD3D11Enumeration::BuildMultiSampleQualityList( const std::vector<MultiSampleLevel>& multiSampleLevels, DXGI_FORMAT fmt,
+                                                     CD3D11EnumDeviceSettingsCombo* pDeviceCombo )
+{
+    for( auto it = multiSampleLevels.cbegin(); it != multiSampleLevels.cend(); ++it )
+    {
+        if( it->DeviceType == pDeviceCombo->DeviceType && it->Format == fmt )
+        {
+            pDeviceCombo->multiSampleCountList.push_back( it->Count );
+            pDeviceCombo->multiSampleQualityList.push_back( it->Quality );
+        }
+    }
 }
 
 
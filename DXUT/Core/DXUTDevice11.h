@@ -31,6 +31,27 @@ HRESULT WINAPI DXUTCreateD3D11Enumeration();
 void WINAPI DXUTDestroyD3D11Enumeration();
 
 
+//--------------------------------------------------------------------------------------
+// Enumeration cache.  What enumeration learns by creating devices and listing display modes
+// is stored per adapter, keyed on the adapter, its driver version, its outputs and the
+// enumeration settings, so later runs skip that work.  Off until a file is set; passing
+// nullptr turns it off again.  Set it before the device is created.
+//--------------------------------------------------------------------------------------
+HRESULT WINAPI DXUTSetD3D11EnumerationCacheFile( _In_opt_z_ LPCWSTR szFileName );
+
+struct DXUT_ENUMERATION_STATS
+{
+    double TotalSeconds;
+    double AdaptersSeconds;         // Listing adapters and outputs
+    double CacheSeconds;            // Reading and writing the cache file
+    double DevicesSeconds;          // Probe devices and multisample levels, summed over adapters
+    double DisplayModesSeconds;     // GetDisplayModeList, summed over adapters
+    double CombosSeconds;           // Device combos, including the IsDeviceAcceptable callback
+    UINT CacheHits;
+    UINT CacheMisses;
+};
+
+
 
 
 //--------------------------------------------------------------------------------------
@@ -74,6 +95,11 @@ public:
     CD3D11EnumDeviceSettingsCombo*           GetDeviceSettingsCombo( _In_ UINT AdapterOrdinal, _In_ DXGI_FORMAT BackBufferFormat, _In_ BOOL Windowed ) const;
     D3D_FEATURE_LEVEL                        GetWARPFeaturevel() const { return m_warpFL; }
     D3D_FEATURE_LEVEL                        GetREFFeaturevel() const { return m_refFL; }
+    const DXUT_ENUMERATION_STATS&            GetStats() const { return m_Stats; }
+
+    // Enumerates the adapters of pFactory instead of DXUTGetDXGIFactory(), so the cache can be
+    // exercised with a stand-in factory.  nullptr restores the default.
+    void SetDXGIFactory( _In_opt_ IDXGIFactory1* pFactory );
 
     ~CD3D11Enumeration();
 
@@ -96,14 +122,48 @@ private:
 
     std::vector<CD3D11EnumAdapterInfo*> m_AdapterInfoList;
 
+    // Read once per Enumerate so adapters can be probed on other threads
+    D3D_FEATURE_LEVEL m_minFL;
+    bool m_bGammaCorrect;
+
+    IDXGIFactory1* m_pFactory;
+    DXUT_ENUMERATION_STATS m_Stats;
+
+    struct MultiSampleLevel
+    {
+        D3D_DRIVER_TYPE DeviceType;
+        DXGI_FORMAT Format;
+        UINT Count;
+        UINT Quality;
+    };
+
+    // The part of an adapter's enumeration that is cached
+    struct AdapterProbe
+    {
+        CD3D11EnumAdapterInfo* pAdapterInfo;
+        UINT64 CacheKey;
+        bool bFromCache;
+        HRESULT hr;
+        double DevicesSeconds;
+        double DisplayModesSeconds;
+        std::vector<MultiSampleLevel> MultiSampleLevels;
+    };
+
     HRESULT EnumerateOutputs( _In_ CD3D11EnumAdapterInfo *pAdapterInfo );
-    HRESULT EnumerateDevices( _In_ CD3D11EnumAdapterInfo *pAdapterInfo );
-    HRESULT EnumerateDeviceCombos(  _In_ CD3D11EnumAdapterInfo* pAdapterInfo );
-    HRESULT EnumerateDeviceCombosNoAdapter( _In_ CD3D11EnumAdapterInfo* pAdapterInfo );
+    HRESULT EnumerateDevices( _In_ CD3D11EnumAdapterInfo *pAdapterInfo, _Inout_ std::vector<MultiSampleLevel>& multiSampleLevels );
+    HRESULT EnumerateDeviceCombos(  _In_ CD3D11EnumAdapterInfo* pAdapterInfo, _In_ const std::vector<MultiSampleLevel>& multiSampleLevels );
+    HRESULT EnumerateDeviceCombosNoAdapter( _In_ CD3D11EnumAdapterInfo* pAdapterInfo, _In_ const std::vector<MultiSampleLevel>& multiSampleLevels );
     
     HRESULT EnumerateDisplayModes( _In_ CD3D11EnumOutputInfo *pOutputInfo );
-    void BuildMultiSampleQualityList( _In_ DXGI_FORMAT fmt, _In_ CD3D11EnumDeviceSettingsCombo* pDeviceCombo );
+    void GetMultiSampleLevels( _In_ ID3D11Device* pd3dDevice, _In_ D3D_DRIVER_TYPE DeviceType, _Inout_ std::vector<MultiSampleLevel>& multiSampleLevels );
+    void BuildMultiSampleQualityList( _In_ const std::vector<MultiSampleLevel>& multiSampleLevels, _In_ DXGI_FORMAT fmt, _In_ CD3D11EnumDeviceSettingsCombo* pDeviceCombo );
+    void ProbeAdapter( _Inout_ AdapterProbe& probe );
+    void ProbeSoftwareFeatureLevels();
     void ClearAdapterInfoList();
+
+    UINT64 ComputeCacheKey( _In_ const CD3D11EnumAdapterInfo* pAdapterInfo ) const;
+    void LoadCache( _In_z_ LPCWSTR szFileName, _Inout_ std::vector<AdapterProbe>& probes );
+    HRESULT SaveCache( _In_z_ LPCWSTR szFileName, _In_ const std::vector<AdapterProbe>& probes ) const;
 };
 
 CD3D11Enumeration* WINAPI DXUTGetD3D11Enumeration(_In_ bool bForceEnumerate = false, _In_ bool EnumerateAllAdapterFormats = true, _In_ D3D_FEATURE_LEVEL forceFL = ((D3D_FEATURE_LEVEL )0)  );
@@ -0,0 +1,241 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTEnumerationCache.h
+//
+// The file format of the D3D11 enumeration cache, and reading and writing it.  Has no
+// Direct3D or Windows dependency: DXUTDevice11.cpp copies the DXGI and D3D11 structures
+// into these records field by field, so the cache can be tested on any platform.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <utility>
+#include <vector>
+
+//--------------------------------------------------------------------------------------
+// File layout, all counts and sizes in bytes:
+//   DXUT_ENUM_CACHE_HEADER
+//   NumAdapters times:
+//     DXUT_ENUM_CACHE_RECORD
+//     NumOutputs times: uint32_t NumModes, DXUT_ENUM_CACHE_MODE[NumModes]
+//     DXUT_ENUM_CACHE_DEVICE[NumDevices]
+//     DXUT_ENUM_CACHE_SAMPLE_LEVEL[NumMultiSampleLevels]
+//--------------------------------------------------------------------------------------
+#define DXUT_ENUM_CACHE_MAGIC 0x43455844 // "DXEC"
+#define DXUT_ENUM_CACHE_VERSION 1
+#define DXUT_ENUM_CACHE_MAX_COUNT 65536
+
+#pragma pack(push,8)
+
+struct DXUT_ENUM_CACHE_HEADER
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t NumAdapters;
+    uint32_t Reserved;
+};
+
+struct DXUT_ENUM_CACHE_RECORD
+{
+    uint64_t Key;
+    uint32_t NumOutputs;
+    uint32_t NumDevices;
+    uint32_t NumMultiSampleLevels;
+    uint32_t Reserved;
+};
+
+// DXGI_MODE_DESC
+struct DXUT_ENUM_CACHE_MODE
+{
+    uint32_t Width;
+    uint32_t Height;
+    uint32_t RefreshNumerator;
+    uint32_t RefreshDenominator;
+    uint32_t Format;
+    uint32_t ScanlineOrdering;
+    uint32_t Scaling;
+};
+
+// The parts of CD3D11EnumDeviceInfo that are probed
+struct DXUT_ENUM_CACHE_DEVICE
+{
+    uint32_t DeviceType;
+    uint32_t SelectedLevel;
+    uint32_t MaxLevel;
+    uint32_t ComputeShaders_Plus_RawAndStructuredBuffers_Via_Shader_4_x;
+};
+
+// CD3D11Enumeration::MultiSampleLevel
+struct DXUT_ENUM_CACHE_SAMPLE_LEVEL
+{
+    uint32_t DeviceType;
+    uint32_t Format;
+    uint32_t Count;
+    uint32_t Quality;
+};
+
+#pragma pack(pop)
+
+static_assert( sizeof(DXUT_ENUM_CACHE_HEADER) == 16, "DXUT enumeration cache structure size incorrect" );
+static_assert( sizeof(DXUT_ENUM_CACHE_RECORD) == 24, "DXUT enumeration cache structure size incorrect" );
+static_assert( sizeof(DXUT_ENUM_CACHE_MODE) == 28, "DXUT enumeration cache structure size incorrect" );
+static_assert( sizeof(DXUT_ENUM_CACHE_DEVICE) == 16, "DXUT enumeration cache structure size incorrect" );
+static_assert( sizeof(DXUT_ENUM_CACHE_SAMPLE_LEVEL) == 16, "DXUT enumeration cache structure size incorrect" );
+
+// Everything cached for one adapter
+struct DXUT_ENUM_CACHE_ADAPTER
+{
+    uint64_t Key;
+    std::vector<std::vector<DXUT_ENUM_CACHE_MODE>> OutputModes;
+    std::vector<DXUT_ENUM_CACHE_DEVICE> Devices;
+    std::vector<DXUT_ENUM_CACHE_SAMPLE_LEVEL> MultiSampleLevels;
+};
+
+
+//--------------------------------------------------------------------------------------
+// FNV-1a, 64-bit
+//--------------------------------------------------------------------------------------
+const uint64_t DXUT_ENUM_CACHE_HASH_SEED = 14695981039346656037ULL;
+
+inline uint64_t DXUTHashEnumCacheBytes( uint64_t hash, const void* pData, size_t bytes )
+{
+    auto pBytes = reinterpret_cast<const uint8_t*>( pData );
+    for( size_t i = 0; i < bytes; ++i )
+    {
+        hash ^= pBytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Bounds-checked reads from a cache file held in memory
+//--------------------------------------------------------------------------------------
+class CDXUTEnumCacheReader
+{
+public:
+    CDXUTEnumCacheReader( const uint8_t* pData, size_t bytes ) :
+        m_pData( pData ), m_bytes( bytes ), m_offset( 0 ) {}
+
+    template<class T> bool Read( T* p, size_t count = 1 )
+    {
+        if( count > ( m_bytes - m_offset ) / sizeof( T ) )
+            return false;
+        memcpy( p, m_pData + m_offset, count * sizeof( T ) );
+        m_offset += count * sizeof( T );
+        return true;
+    }
+
+private:
+    const uint8_t* m_pData;
+    size_t m_bytes;
+    size_t m_offset;
+};
+
+template<class T> void DXUTAppendEnumCache( std::vector<uint8_t>& data, const T* p, size_t count = 1 )
+{
+    auto pBytes = reinterpret_cast<const uint8_t*>( p );
+    data.insert( data.end(), pBytes, pBytes + count * sizeof( T ) );
+}
+
+
+//--------------------------------------------------------------------------------------
+// Appends the adapters in a cache file to adapters.  A file that isn't a cache of this
+// version adds nothing, and a damaged one keeps the adapters read before the damage.
+// Returns false if anything was wrong with the file.
+//--------------------------------------------------------------------------------------
+inline bool DXUTReadEnumerationCache( const uint8_t* pData, size_t bytes, std::vector<DXUT_ENUM_CACHE_ADAPTER>& adapters )
+{
+    if( !pData )
+        return false;
+
+    CDXUTEnumCacheReader reader( pData, bytes );
+
+    DXUT_ENUM_CACHE_HEADER header;
+    if( !reader.Read( &header ) || header.Magic != DXUT_ENUM_CACHE_MAGIC || header.Version != DXUT_ENUM_CACHE_VERSION )
+        return false;
+
+    for( uint32_t iAdapter = 0; iAdapter < header.NumAdapters; ++iAdapter )
+    {
+        DXUT_ENUM_CACHE_RECORD record;
+        if( !reader.Read( &record ) || record.NumOutputs > DXUT_ENUM_CACHE_MAX_COUNT
+            || record.NumDevices > DXUT_ENUM_CACHE_MAX_COUNT || record.NumMultiSampleLevels > DXUT_ENUM_CACHE_MAX_COUNT )
+            return false;
+
+        DXUT_ENUM_CACHE_ADAPTER adapter;
+        adapter.Key = record.Key;
+        adapter.OutputModes.resize( record.NumOutputs );
+        for( auto it = adapter.OutputModes.begin(); it != adapter.OutputModes.end(); ++it )
+        {
+            uint32_t NumModes;
+            if( !reader.Read( &NumModes ) || NumModes > DXUT_ENUM_CACHE_MAX_COUNT )
+                return false;
+
+            it->resize( NumModes );
+            if( NumModes && !reader.Read( it->data(), NumModes ) )
+                return false;
+        }
+
+        adapter.Devices.resize( record.NumDevices );
+        if( record.NumDevices && !reader.Read( adapter.Devices.data(), adapter.Devices.size() ) )
+            return false;
+
+        adapter.MultiSampleLevels.resize( record.NumMultiSampleLevels );
+        if( record.NumMultiSampleLevels && !reader.Read( adapter.MultiSampleLevels.data(), adapter.MultiSampleLevels.size() ) )
+            return false;
+
+        adapters.push_back( std::move( adapter ) );
+    }
+
+    return true;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Lays out a cache file in data, replacing what it held
+//--------------------------------------------------------------------------------------
+inline void DXUTWriteEnumerationCache( const std::vector<DXUT_ENUM_CACHE_ADAPTER>& adapters, std::vector<uint8_t>& data )
+{
+    data.resize( sizeof( DXUT_ENUM_CACHE_HEADER ) );
+
+    DXUT_ENUM_CACHE_HEADER header;
+    header.Magic = DXUT_ENUM_CACHE_MAGIC;
+    header.Version = DXUT_ENUM_CACHE_VERSION;
+    header.NumAdapters = uint32_t( adapters.size() );
+    header.Reserved = 0;
+    memcpy( data.data(), &header, sizeof( header ) );
+
+    for( auto it = adapters.cbegin(); it != adapters.cend(); ++it )
+    {
+        DXUT_ENUM_CACHE_RECORD record;
+        record.Key = it->Key;
+        record.NumOutputs = uint32_t( it->OutputModes.size() );
+        record.NumDevices = uint32_t( it->Devices.size() );
+        record.NumMultiSampleLevels = uint32_t( it->MultiSampleLevels.size() );
+        record.Reserved = 0;
+        DXUTAppendEnumCache( data, &record );
+
+        for( auto oit = it->OutputModes.cbegin(); oit != it->OutputModes.cend(); ++oit )
+        {
+            uint32_t NumModes = uint32_t( oit->size() );
+            DXUTAppendEnumCache( data, &NumModes );
+            if( NumModes )
+                DXUTAppendEnumCache( data, oit->data(), NumModes );
+        }
+
+        if( !it->Devices.empty() )
+            DXUTAppendEnumCache( data, it->Devices.data(), it->Devices.size() );
+        if( !it->MultiSampleLevels.empty() )
+            DXUTAppendEnumCache( data, it->MultiSampleLevels.data(), it->MultiSampleLevels.size() );
+    }
+}
@@ -0,0 +1,269 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTFrameArena.h
+//
+// Linear scratch memory for data that only lives until the end of the frame, the arrays
+// and formatted text built on it.  Has no Direct3D dependency, so the steady-state frame
+// can be checked for heap allocations on any platform.  DXUTmisc.h declares the global
+// arena DXUT resets every frame.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+#include <assert.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+#include <algorithm>
+#include <vector>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+//--------------------------------------------------------------------------------------
+inline void* DXUTAlignedAlloc( size_t nBytes, size_t nAlignment )
+{
+#ifdef _WIN32
+    return _aligned_malloc( nBytes, nAlignment );
+#else
+    void* p = nullptr;
+    return posix_memalign( &p, std::max<size_t>( nAlignment, sizeof( void* ) ), nBytes ) ? nullptr : p;
+#endif
+}
+
+inline void DXUTAlignedFree( void* p )
+{
+#ifdef _WIN32
+    _aligned_free( p );
+#else
+    free( p );
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------
+// Requests that do not fit are taken from the heap, and the next reset grows the arena to
+// the high water mark, so a steady frame makes no heap allocations once the first frames
+// have run.  Not thread safe.
+//--------------------------------------------------------------------------------------
+class CDXUTFrameArena
+{
+public:
+    CDXUTFrameArena() :
+        m_pBlock( nullptr ), m_nCapacity( 0 ), m_nUsed( 0 ), m_nOverflowBytes( 0 ), m_nHighWater( 0 ), m_nGeneration( 0 )
+    {
+        m_Overflow.reserve( 16 );
+    }
+
+    ~CDXUTFrameArena() { Release(); }
+
+    // Returns nullptr only when the heap is exhausted.  Memory is not initialized.
+    void* Allocate( size_t nBytes, size_t nAlignment = 16 )
+    {
+        assert( nAlignment && !( nAlignment & ( nAlignment - 1 ) ) );
+
+        if( m_pBlock )
+        {
+            size_t nStart = ( reinterpret_cast<size_t>( m_pBlock ) + m_nUsed + nAlignment - 1 ) & ~( nAlignment - 1 );
+            nStart -= reinterpret_cast<size_t>( m_pBlock );
+            if( nStart <= m_nCapacity && nBytes <= m_nCapacity - nStart )
+            {
+                m_nUsed = nStart + nBytes;
+                return m_pBlock + nStart;
+            }
+        }
+
+        // Does not fit this frame; the next reset makes room for it
+        void* pOverflow = DXUTAlignedAlloc( std::max<size_t>( nBytes, 1 ), std::max<size_t>( nAlignment, 16 ) );
+        if( !pOverflow )
+            return nullptr;
+
+        try
+        {
+            m_Overflow.push_back( pOverflow );
+        }
+        catch( ... )
+        {
+            DXUTAlignedFree( pOverflow );
+            return nullptr;
+        }
+
+        m_nOverflowBytes += nBytes + nAlignment;
+        return pOverflow;
+    }
+
+    // Frees everything allocated since the last reset
+    void Reset()
+    {
+        m_nHighWater = std::max<size_t>( m_nHighWater, m_nUsed + m_nOverflowBytes );
+
+        for( auto it = m_Overflow.begin(); it != m_Overflow.end(); ++it )
+            DXUTAlignedFree( *it );
+        m_Overflow.clear();
+
+        if( m_nHighWater > m_nCapacity )
+        {
+            // Round up to 64K so a frame that grows a little does not overflow again
+            size_t nCapacity = ( m_nHighWater + 0xFFFF ) & ~size_t( 0xFFFF );
+            DXUTAlignedFree( m_pBlock );
+            m_pBlock = static_cast<uint8_t*>( DXUTAlignedAlloc( nCapacity, 16 ) );
+            m_nCapacity = m_pBlock ? nCapacity : 0;
+        }
+
+        m_nUsed = 0;
+        m_nOverflowBytes = 0;
+        ++m_nGeneration;
+    }
+
+    // Frees the memory as well
+    void Release()
+    {
+        Reset();
+
+        DXUTAlignedFree( m_pBlock );
+        m_pBlock = nullptr;
+        m_nCapacity = 0;
+        m_nHighWater = 0;
+    }
+
+    // Uninitialized scratch for count elements of a trivially copyable type
+    template<typename T> T* Allocate( size_t count )
+    {
+        return static_cast<T*>( Allocate( count * sizeof( T ), __alignof( T ) ) );
+    }
+
+    // Bumped by every reset, so frame arrays can tell their memory is gone
+    uint32_t GetGeneration() const { return m_nGeneration; }
+    size_t GetCapacity() const { return m_nCapacity; }
+    size_t GetHighWater() const { return m_nHighWater; }
+
+private:
+    CDXUTFrameArena( const CDXUTFrameArena& );
+    CDXUTFrameArena& operator=( const CDXUTFrameArena& );
+
+    uint8_t* m_pBlock;
+    size_t m_nCapacity;
+    size_t m_nUsed;
+    std::vector<void*> m_Overflow;  // heap blocks taken since the last reset
+    size_t m_nOverflowBytes;
+    size_t m_nHighWater;            // most bytes needed by one frame
+    uint32_t m_nGeneration;
+};
+
+
+//--------------------------------------------------------------------------------------
+// Growable array of a trivially copyable type backed by a frame arena.  It comes back
+// empty after the arena resets, and keeps its capacity across clear() within a frame.
+//--------------------------------------------------------------------------------------
+template<typename T> class CDXUTFrameArray
+{
+public:
+    explicit CDXUTFrameArray( CDXUTFrameArena& arena ) :
+        m_pArena( &arena ), m_pData( nullptr ), m_nSize( 0 ), m_nCapacity( 0 ), m_nGeneration( uint32_t( -1 ) ) {}
+
+    bool push_back( const T& value )
+    {
+        if( !reserve( m_nSize + 1 ) )
+            return false;
+        m_pData[ m_nSize++ ] = value;
+        return true;
+    }
+
+    bool reserve( size_t nCount )
+    {
+        if( m_nGeneration != m_pArena->GetGeneration() )
+        {
+            m_pData = nullptr;
+            m_nSize = m_nCapacity = 0;
+            m_nGeneration = m_pArena->GetGeneration();
+        }
+        if( nCount <= m_nCapacity )
+            return true;
+
+        size_t nNewCapacity = std::max<size_t>( std::max<size_t>( m_nCapacity * 2, nCount ), 64 );
+        auto pNewData = m_pArena->Allocate<T>( nNewCapacity );
+        if( !pNewData )
+            return false;
+        if( m_nSize )
+            memcpy( pNewData, m_pData, m_nSize * sizeof( T ) );
+        m_pData = pNewData;
+        m_nCapacity = nNewCapacity;
+        return true;
+    }
+
+    void clear() { m_nSize = 0; }
+    bool empty() const { return m_nSize == 0 || m_nGeneration != m_pArena->GetGeneration(); }
+    size_t size() const { return empty() ? 0 : m_nSize; }
+    T* data() { return m_pData; }
+    T& operator[]( size_t i ) { return m_pData[ i ]; }
+
+private:
+    CDXUTFrameArray( const CDXUTFrameArray& );
+    CDXUTFrameArray& operator=( const CDXUTFrameArray& );
+
+    CDXUTFrameArena* m_pArena;
+    T* m_pData;
+    size_t m_nSize;
+    size_t m_nCapacity;
+    uint32_t m_nGeneration;
+};
+
+
+//--------------------------------------------------------------------------------------
+// Formats into arena scratch sized for the message, so a line is neither truncated nor
+// copied through a fixed stack buffer.  Returns an empty string if the format fails.
+//--------------------------------------------------------------------------------------
+inline const wchar_t* DXUTFormatFrameTextV( CDXUTFrameArena& arena, const wchar_t* strFormat, va_list args )
+{
+    // Each pass consumes its own copy, so args is still at the first argument for the next
+    va_list argsCopy;
+
+#ifdef _WIN32
+    va_copy( argsCopy, args );
+    int nChars = _vscwprintf( strFormat, argsCopy );
+    va_end( argsCopy );
+
+    wchar_t* strBuffer = ( nChars >= 0 ) ? arena.Allocate<wchar_t>( size_t( nChars ) + 1 ) : nullptr;
+    if( !strBuffer )
+        return L"";
+
+    vswprintf_s( strBuffer, size_t( nChars ) + 1, strFormat, args );
+    return strBuffer;
+#else
+    // vswprintf cannot size its output, so retry in larger scratch until the text fits.
+    // The space of the failed tries counts toward the high water, so it is only taken
+    // from the heap in the first frames.
+    for( size_t nSize = 256; nSize <= 0x100000; nSize *= 2 )
+    {
+        wchar_t* strBuffer = arena.Allocate<wchar_t>( nSize );
+        if( !strBuffer )
+            break;
+
+        va_copy( argsCopy, args );
+        int nChars = vswprintf( strBuffer, nSize, strFormat, argsCopy );
+        va_end( argsCopy );
+        if( nChars >= 0 )
+            return strBuffer;
+    }
+    return L"";
+#endif
+}
+
+inline const wchar_t* DXUTFormatFrameText( CDXUTFrameArena& arena, const wchar_t* strFormat, ... )
+{
+    va_list args;
+    va_start( args, strFormat );
+    const wchar_t* strText = DXUTFormatFrameTextV( arena, strFormat, args );
+    va_end( args );
+    return strText;
+}
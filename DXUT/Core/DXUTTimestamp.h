@@ -0,0 +1,78 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTTimestamp.h
+//
+// Timestamps that never go backwards on the calling thread.  QueryPerformanceCounter on
+// Windows and std::chrono::steady_clock elsewhere are read raw, and each thread keeps its
+// last value, so a counter that is a few ticks off between cores cannot make a thread see
+// time run backwards after it migrates.  Nothing is shared between threads.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+#include <stdint.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <chrono>
+#endif
+
+// VS2012 and VS2013 have no thread_local
+#if defined(_MSC_VER) && ( _MSC_VER < 1900 )
+#define DXUT_THREAD_LOCAL __declspec(thread)
+#else
+#define DXUT_THREAD_LOCAL thread_local
+#endif
+
+//--------------------------------------------------------------------------------------
+inline int64_t DXUTReadRawTimestamp()
+{
+#ifdef _WIN32
+    LARGE_INTEGER qwTime;
+    QueryPerformanceCounter( &qwTime );
+    return qwTime.QuadPart;
+#else
+    return int64_t( std::chrono::steady_clock::now().time_since_epoch().count() );
+#endif
+}
+
+// Ticks per second of DXUTReadRawTimestamp
+inline int64_t DXUTRawTimestampFrequency()
+{
+#ifdef _WIN32
+    static LARGE_INTEGER s_Frequency = {};
+    if( !s_Frequency.QuadPart )
+        QueryPerformanceFrequency( &s_Frequency );
+    return s_Frequency.QuadPart;
+#else
+    return int64_t( std::chrono::steady_clock::period::den / std::chrono::steady_clock::period::num );
+#endif
+}
+
+//--------------------------------------------------------------------------------------
+// Returns llRaw, or the calling thread's last result if llRaw is behind it.  Taking the
+// raw reading as a parameter lets a test feed it readings that step backwards.
+//--------------------------------------------------------------------------------------
+inline int64_t DXUTClampTimestamp( int64_t llRaw )
+{
+    static DXUT_THREAD_LOCAL int64_t s_llLast = 0;
+
+    if( llRaw < s_llLast )
+        return s_llLast;
+
+    s_llLast = llRaw;
+    return llRaw;
+}
+
+inline int64_t DXUTReadMonotonicTimestamp()
+{
+    return DXUTClampTimestamp( DXUTReadRawTimestamp() );
+}
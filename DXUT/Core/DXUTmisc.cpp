@@ -16,10 +16,32 @@
 #include <xinput.h>
 
 #include "ScreenGrab.h"
+#include "DXUTTimestamp.h"
 
 
 #define DXUT_GAMEPAD_TRIGGER_THRESHOLD      30
 
+//--------------------------------------------------------------------------------------
+// QueryPerformanceCounter is backed by the invariant TSC or the platform clock and stays
+// consistent when a thread moves between cores, so the timers need no affinity pinning.
+// DXUTTimestamp.h also clamps each thread's readings to its last one, for a HAL that is
+// off by a few ticks between cores.
+//--------------------------------------------------------------------------------------
+LONGLONG WINAPI DXUTGetTimestamp()
+{
+    return DXUTReadMonotonicTimestamp();
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+double WINAPI DXUTTimestampToSeconds( LONGLONG llTicks )
+{
+    return double( llTicks ) / double( DXUTRawTimestampFrequency() );
+}
+
+
+//--------------------------------------------------------------------------------------
 CDXUTTimer* WINAPI DXUTGetGlobalTimer()
 {
     // Using an accessor function gives control of the construction order
@@ -62,7 +84,7 @@ void CDXUTTimer::Start()
 {
     // Get the current time
     LARGE_INTEGER qwTime = { 0 };
-    QueryPerformanceCounter( &qwTime );
+    qwTime.QuadPart = DXUTGetTimestamp();
 
     if( m_bTimerStopped )
         m_llBaseTime += qwTime.QuadPart - m_llStopTime;
@@ -78,7 +100,7 @@ void CDXUTTimer::Stop()
     if( !m_bTimerStopped )
     {
         LARGE_INTEGER qwTime = { 0 };
-        QueryPerformanceCounter( &qwTime );
+        qwTime.QuadPart = DXUTGetTimestamp();
         m_llStopTime = qwTime.QuadPart;
         m_llLastElapsedTime = qwTime.QuadPart;
         m_bTimerStopped = TRUE;
@@ -97,7 +119,7 @@ void CDXUTTimer::Advance()
 double CDXUTTimer::GetAbsoluteTime() const
 {
     LARGE_INTEGER qwTime = { 0 };
-    QueryPerformanceCounter( &qwTime );
+    qwTime.QuadPart = DXUTGetTimestamp();
 
     double fTime = qwTime.QuadPart / ( double )m_llQPFTicksPerSec;
 
@@ -128,12 +150,8 @@ void CDXUTTimer::GetTimeValues( double* pfTime, double* pfAbsoluteTime, float* p
     m_llLastElapsedTime = qwTime.QuadPart;
 
     // Clamp the timer to non-negative values to ensure the timer is accurate.
-    // fElapsedTime can be outside this range if processor goes into a 
-    // power save mode or we somehow get shuffled to another processor.  
-    // However, the main thread should call SetThreadAffinityMask to ensure that 
-    // we don't get shuffled to another processor.  Other worker threads should NOT call 
-    // SetThreadAffinityMask, but use a shared copy of the timer data gathered from 
-    // the main thread.
+    // DXUTGetTimestamp is monotonic per thread, but the timer may be shared by
+    // several threads or restarted while stopped.
     if( fElapsedTime < 0.0f )
         fElapsedTime = 0.0f;
 
@@ -168,14 +186,15 @@ LARGE_INTEGER CDXUTTimer::GetAdjustedCurrentTime() const
     if( m_llStopTime != 0 )
         qwTime.QuadPart = m_llStopTime;
     else
-        QueryPerformanceCounter( &qwTime );
+        qwTime.QuadPart = DXUTGetTimestamp();
     return qwTime;
 }
 
 //--------------------------------------------------------------------------------------
 // Limit the current thread to one processor (the current one). This ensures that timing code 
 // runs on only one processor, and will not suffer any ill effects from power management.
-// See "Game Timing and Multicore Processors" for more details
+// See "Game Timing and Multicore Processors" for more details.  The timers no longer depend
+// on this, it is only kept for apps that want the old behavior on broken HALs.
 //--------------------------------------------------------------------------------------
 void CDXUTTimer::LimitThreadAffinityToCurrentProc()
 {
@@ -205,6 +224,22 @@ void CDXUTTimer::LimitThreadAffinityToCurrentProc()
 }
 
 
+//--------------------------------------------------------------------------------------
+CDXUTFrameArena& WINAPI DXUTGetFrameArena()
+{
+    // Using an accessor function gives control of the construction order
+    static CDXUTFrameArena arena;
+    return arena;
+}
+
+
+//--------------------------------------------------------------------------------------
+void WINAPI DXUTResetFrameArena()
+{
+    DXUTGetFrameArena().Reset();
+}
+
+
 //--------------------------------------------------------------------------------------
 // Returns the string for the given DXGI_FORMAT.
 //--------------------------------------------------------------------------------------
@@ -931,19 +966,18 @@ typedef DWORD ( WINAPI* LPXINPUTGETCAPABILITIES )( DWORD dwUserIndex, DWORD dwFl
                                                    XINPUT_CAPABILITIES* pCapabilities );
 typedef void ( WINAPI* LPXINPUTENABLE )( BOOL bEnable );
 
+static bool s_bXInputLoaded = false;
+static LPXINPUTGETSTATE s_pXInputGetState = nullptr;
+static LPXINPUTGETCAPABILITIES s_pXInputGetCapabilities = nullptr;
+
 //--------------------------------------------------------------------------------------
-// Does extra processing on XInput data to make it slightly more convenient to use
+// Loads XInput once.  DXUTGetGamepadState calls this itself, but a thread that polls
+// gamepads alongside the render thread has it called first, so the pointers are never
+// written while another thread reads them.
 //--------------------------------------------------------------------------------------
-_Use_decl_annotations_
-HRESULT DXUTGetGamepadState( DWORD dwPort, DXUT_GAMEPAD* pGamePad, bool bThumbstickDeadZone,
-                             bool bSnapThumbstickToCardinals )
+HRESULT DXUTInitXInput()
 {
-    if( dwPort >= DXUT_MAX_CONTROLLERS || !pGamePad )
-        return E_FAIL;
-
-    static LPXINPUTGETSTATE s_pXInputGetState = nullptr;
-    static LPXINPUTGETCAPABILITIES s_pXInputGetCapabilities = nullptr;
-    if( !s_pXInputGetState || !s_pXInputGetCapabilities )
+    if( !s_bXInputLoaded )
     {
         HINSTANCE hInst = LoadLibraryEx( XINPUT_DLL, nullptr, 0x00000800 /* LOAD_LIBRARY_SEARCH_SYSTEM32 */ );
         if( hInst )
@@ -951,8 +985,24 @@ HRESULT DXUTGetGamepadState( DWORD dwPort, DXUT_GAMEPAD* pGamePad, bool bThumbst
             s_pXInputGetState = reinterpret_cast<LPXINPUTGETSTATE>( reinterpret_cast<void*>( GetProcAddress( hInst, "XInputGetState" ) ) );
             s_pXInputGetCapabilities = reinterpret_cast<LPXINPUTGETCAPABILITIES>( reinterpret_cast<void*>( GetProcAddress( hInst, "XInputGetCapabilities" ) ) );
         }
+        s_bXInputLoaded = true;
     }
-    if( !s_pXInputGetState )
+
+    return s_pXInputGetState ? S_OK : E_FAIL;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Does extra processing on XInput data to make it slightly more convenient to use
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DXUTGetGamepadState( DWORD dwPort, DXUT_GAMEPAD* pGamePad, bool bThumbstickDeadZone,
+                             bool bSnapThumbstickToCardinals )
+{
+    if( dwPort >= DXUT_MAX_CONTROLLERS || !pGamePad )
+        return E_FAIL;
+
+    if( FAILED( DXUTInitXInput() ) )
         return E_FAIL;
 
     XINPUT_STATE InputState;
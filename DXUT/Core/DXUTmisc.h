@@ -62,6 +62,7 @@ struct DXUT_GAMEPAD
     bool bLastRightTrigger;
 };
 
+HRESULT DXUTInitXInput();
 HRESULT DXUTGetGamepadState( _In_ DWORD dwPort, _In_ DXUT_GAMEPAD* pGamePad, _In_ bool bThumbstickDeadZone = true,
                              _In_ bool bSnapThumbstickToCardinals = true );
 HRESULT DXUTStopRumbleOnAllControllers();
@@ -93,8 +94,8 @@ public:
     void            GetTimeValues( _Out_ double* pfTime, _Out_ double* pfAbsoluteTime, _Out_ float* pfElapsedTime ); // get all time values at once
     bool            IsStopped() const { return m_bTimerStopped; } // returns true if timer stopped
 
-    // Limit the current thread to one processor (the current one). This ensures that timing code runs
-    // on only one processor, and will not suffer any ill effects from power management.
+    // Limit the current thread to one processor (the current one). Opt-in only, the timer reads
+    // a clock that is consistent across processors and never calls this itself.
     void            LimitThreadAffinityToCurrentProc();
 
 protected:
@@ -111,6 +112,25 @@ protected:
 
 CDXUTTimer*                 WINAPI DXUTGetGlobalTimer();
 
+// Raw QueryPerformanceCounter ticks, never decreasing on the calling thread.  Cheap enough
+// for per-thread profiler markers; no affinity pinning is needed.
+LONGLONG                    WINAPI DXUTGetTimestamp();
+double                      WINAPI DXUTTimestampToSeconds( _In_ LONGLONG llTicks );
+
+
+//--------------------------------------------------------------------------------------
+// The frame arena (DXUTFrameArena.h) DXUT resets at the start of every frame.  Apps running
+// their own loop call DXUTResetFrameArena themselves.  Render thread only.
+//--------------------------------------------------------------------------------------
+CDXUTFrameArena&            WINAPI DXUTGetFrameArena();
+void                        WINAPI DXUTResetFrameArena();
+
+// Uninitialized frame scratch for count elements of a trivially copyable type
+template<typename T> T* DXUTFrameAlloc( _In_ size_t count )
+{
+    return DXUTGetFrameArena().Allocate<T>( count );
+}
+
 
 //--------------------------------------------------------------------------------------
 // Returns the string for the given DXGI_FORMAT.
@@ -260,6 +280,174 @@ CDXUTPerfEventGenerator( _In_ DWORD color, _In_z_ LPCWSTR pstrMessage )
 };
 
 
+//--------------------------------------------------------------------------------------
+// Forwards the common Direct3D 11 context calls and counts each one under its
+// DXUT_API_COUNTER as it is made, so the frame counters cannot drift from the code.  The
+// tally is added to the frame counters once, when the wrapper goes out of scope.  Calls
+// the wrapper does not forward go through Get() and are not counted.
+//--------------------------------------------------------------------------------------
+class CDXUTCountedContext
+{
+public:
+    explicit CDXUTCountedContext( _In_ ID3D11DeviceContext* pContext ) : m_pContext( pContext )
+    {
+        ZeroMemory( m_nCalls, sizeof( m_nCalls ) );
+    }
+    ~CDXUTCountedContext()
+    {
+        for( UINT i = 0; i < DXUT_API_COUNTER_COUNT; ++i )
+        {
+            if( m_nCalls[i] )
+                DXUTCountAPICalls( DXUT_API_COUNTER( i ), m_nCalls[i] );
+        }
+    }
+
+    ID3D11DeviceContext* Get() const { return m_pContext; }
+
+    // Draws
+    void Draw( _In_ UINT VertexCount, _In_ UINT StartVertexLocation )
+    {
+        m_pContext->Draw( VertexCount, StartVertexLocation );
+        ++m_nCalls[DXUT_API_DRAW];
+    }
+    void DrawIndexed( _In_ UINT IndexCount, _In_ UINT StartIndexLocation, _In_ INT BaseVertexLocation )
+    {
+        m_pContext->DrawIndexed( IndexCount, StartIndexLocation, BaseVertexLocation );
+        ++m_nCalls[DXUT_API_DRAW];
+    }
+
+    // Input assembler
+    void IASetInputLayout( _In_opt_ ID3D11InputLayout* pInputLayout )
+    {
+        m_pContext->IASetInputLayout( pInputLayout );
+        ++m_nCalls[DXUT_API_BIND];
+    }
+    void IASetVertexBuffers( _In_ UINT StartSlot, _In_ UINT NumBuffers, _In_reads_opt_(NumBuffers) ID3D11Buffer* const* ppVertexBuffers,
+                             _In_reads_opt_(NumBuffers) const UINT* pStrides, _In_reads_opt_(NumBuffers) const UINT* pOffsets )
+    {
+        m_pContext->IASetVertexBuffers( StartSlot, NumBuffers, ppVertexBuffers, pStrides, pOffsets );
+        ++m_nCalls[DXUT_API_BIND];
+    }
+    void IASetIndexBuffer( _In_opt_ ID3D11Buffer* pIndexBuffer, _In_ DXGI_FORMAT Format, _In_ UINT Offset )
+    {
+        m_pContext->IASetIndexBuffer( pIndexBuffer, Format, Offset );
+        ++m_nCalls[DXUT_API_BIND];
+    }
+    void IASetPrimitiveTopology( _In_ D3D11_PRIMITIVE_TOPOLOGY Topology )
+    {
+        m_pContext->IASetPrimitiveTopology( Topology );
+        ++m_nCalls[DXUT_API_BIND];
+    }
+
+    // Shaders and their resources
+    void VSSetShader( _In_opt_ ID3D11VertexShader* pShader, _In_reads_opt_(NumClassInstances) ID3D11ClassInstance* const* ppClassInstances = nullptr,
+                      _In_ UINT NumClassInstances = 0 )
+    {
+        m_pContext->VSSetShader( pShader, ppClassInstances, NumClassInstances );
+        ++m_nCalls[DXUT_API_BIND];
+    }
+    void HSSetShader( _In_opt_ ID3D11HullShader* pShader, _In_reads_opt_(NumClassInstances) ID3D11ClassInstance* const* ppClassInstances = nullptr,
+                      _In_ UINT NumClassInstances = 0 )
+    {
+        m_pContext->HSSetShader( pShader, ppClassInstances, NumClassInstances );
+        ++m_nCalls[DXUT_API_BIND];
+    }
+    void DSSetShader( _In_opt_ ID3D11DomainShader* pShader, _In_reads_opt_(NumClassInstances) ID3D11ClassInstance* const* ppClassInstances = nullptr,
+                      _In_ UINT NumClassInstances = 0 )
+    {
+        m_pContext->DSSetShader( pShader, ppClassInstances, NumClassInstances );
+        ++m_nCalls[DXUT_API_BIND];
+    }
+    void GSSetShader( _In_opt_ ID3D11GeometryShader* pShader, _In_reads_opt_(NumClassInstances) ID3D11ClassInstance* const* ppClassInstances = nullptr,
+                      _In_ UINT NumClassInstances = 0 )
+    {
+        m_pContext->GSSetShader( pShader, ppClassInstances, NumClassInstances );
+        ++m_nCalls[DXUT_API_BIND];
+    }
+    void PSSetShader( _In_opt_ ID3D11PixelShader* pShader, _In_reads_opt_(NumClassInstances) ID3D11ClassInstance* const* ppClassInstances = nullptr,
+                      _In_ UINT NumClassInstances = 0 )
+    {
+        m_pContext->PSSetShader( pShader, ppClassInstances, NumClassInstances );
+        ++m_nCalls[DXUT_API_BIND];
+    }
+    void VSSetConstantBuffers( _In_ UINT StartSlot, _In_ UINT NumBuffers, _In_reads_opt_(NumBuffers) ID3D11Buffer* const* ppConstantBuffers )
+    {
+        m_pContext->VSSetConstantBuffers( StartSlot, NumBuffers, ppConstantBuffers );
+        ++m_nCalls[DXUT_API_BIND];
+    }
+    void PSSetConstantBuffers( _In_ UINT StartSlot, _In_ UINT NumBuffers, _In_reads_opt_(NumBuffers) ID3D11Buffer* const* ppConstantBuffers )
+    {
+        m_pContext->PSSetConstantBuffers( StartSlot, NumBuffers, ppConstantBuffers );
+        ++m_nCalls[DXUT_API_BIND];
+    }
+    void PSSetShaderResources( _In_ UINT StartSlot, _In_ UINT NumViews, _In_reads_opt_(NumViews) ID3D11ShaderResourceView* const* ppShaderResourceViews )
+    {
+        m_pContext->PSSetShaderResources( StartSlot, NumViews, ppShaderResourceViews );
+        ++m_nCalls[DXUT_API_BIND];
+    }
+    void PSSetSamplers( _In_ UINT StartSlot, _In_ UINT NumSamplers, _In_reads_opt_(NumSamplers) ID3D11SamplerState* const* ppSamplers )
+    {
+        m_pContext->PSSetSamplers( StartSlot, NumSamplers, ppSamplers );
+        ++m_nCalls[DXUT_API_BIND];
+    }
+
+    // Fixed function state
+    void RSSetState( _In_opt_ ID3D11RasterizerState* pRasterizerState )
+    {
+        m_pContext->RSSetState( pRasterizerState );
+        ++m_nCalls[DXUT_API_BIND];
+    }
+    void OMSetBlendState( _In_opt_ ID3D11BlendState* pBlendState, _In_opt_ const FLOAT BlendFactor[4], _In_ UINT SampleMask )
+    {
+        m_pContext->OMSetBlendState( pBlendState, BlendFactor, SampleMask );
+        ++m_nCalls[DXUT_API_BIND];
+    }
+    void OMSetDepthStencilState( _In_opt_ ID3D11DepthStencilState* pDepthStencilState, _In_ UINT StencilRef )
+    {
+        m_pContext->OMSetDepthStencilState( pDepthStencilState, StencilRef );
+        ++m_nCalls[DXUT_API_BIND];
+    }
+
+    // Updates; Unmap is part of the Map it closes
+    HRESULT Map( _In_ ID3D11Resource* pResource, _In_ UINT Subresource, _In_ D3D11_MAP MapType, _In_ UINT MapFlags,
+                 _Out_opt_ D3D11_MAPPED_SUBRESOURCE* pMappedResource )
+    {
+        ++m_nCalls[DXUT_API_UPDATE];
+        return m_pContext->Map( pResource, Subresource, MapType, MapFlags, pMappedResource );
+    }
+    void Unmap( _In_ ID3D11Resource* pResource, _In_ UINT Subresource )
+    {
+        m_pContext->Unmap( pResource, Subresource );
+    }
+    void UpdateSubresource( _In_ ID3D11Resource* pDstResource, _In_ UINT DstSubresource, _In_opt_ const D3D11_BOX* pDstBox,
+                            _In_ const void* pSrcData, _In_ UINT SrcRowPitch, _In_ UINT SrcDepthPitch )
+    {
+        m_pContext->UpdateSubresource( pDstResource, DstSubresource, pDstBox, pSrcData, SrcRowPitch, SrcDepthPitch );
+        ++m_nCalls[DXUT_API_UPDATE];
+    }
+
+    // Clears
+    void ClearRenderTargetView( _In_ ID3D11RenderTargetView* pRenderTargetView, _In_ const FLOAT ColorRGBA[4] )
+    {
+        m_pContext->ClearRenderTargetView( pRenderTargetView, ColorRGBA );
+        ++m_nCalls[DXUT_API_CLEAR];
+    }
+    void ClearDepthStencilView( _In_ ID3D11DepthStencilView* pDepthStencilView, _In_ UINT ClearFlags, _In_ FLOAT Depth,
+                                _In_ UINT8 Stencil )
+    {
+        m_pContext->ClearDepthStencilView( pDepthStencilView, ClearFlags, Depth, Stencil );
+        ++m_nCalls[DXUT_API_CLEAR];
+    }
+
+private:
+    CDXUTCountedContext( const CDXUTCountedContext& );
+    CDXUTCountedContext& operator=( const CDXUTCountedContext& );
+
+    ID3D11DeviceContext* m_pContext;
+    UINT m_nCalls[DXUT_API_COUNTER_COUNT];
+};
+
+
 //--------------------------------------------------------------------------------------
 // Multimon handling to support OSes with or without multimon API support.  
 // Purposely avoiding the use of multimon.h so DXUT.lib doesn't require 
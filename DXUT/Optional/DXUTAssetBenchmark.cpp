@@ -0,0 +1,1392 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTAssetBenchmark.cpp
+//
+// Asset loader benchmark on a generated corpus
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUT.h"
+#include "DXUTAssetBenchmark.h"
+#include "DXUTarchive.h"
+#include "SDKmesh.h"
+#include "SDKmisc.h"
+#include "DDSTextureLoader.h"
+#include "DDSLegacyConvert.h"
+#include "DXUTSkinningPalette.h"
+#include "WICTextureLoader.h"
+
+#include <psapi.h>
+#include <string>
+
+#pragma comment( lib, "psapi.lib" )
+
+using namespace DirectX;
+
+//--------------------------------------------------------------------------------------
+namespace
+{
+
+//--------------------------------------------------------------------------------------
+// DDS file structures, as read by DDSTextureLoader
+//--------------------------------------------------------------------------------------
+const UINT BENCH_DDS_MAGIC = 0x20534444; // "DDS "
+
+#pragma pack(push,1)
+
+struct BenchDDSPixelFormat
+{
+    UINT size;
+    UINT flags;
+    UINT fourCC;
+    UINT RGBBitCount;
+    UINT RBitMask;
+    UINT GBitMask;
+    UINT BBitMask;
+    UINT ABitMask;
+};
+
+struct BenchDDSHeader
+{
+    UINT size;
+    UINT flags;
+    UINT height;
+    UINT width;
+    UINT pitchOrLinearSize;
+    UINT depth;
+    UINT mipMapCount;
+    UINT reserved1[11];
+    BenchDDSPixelFormat ddspf;
+    UINT caps;
+    UINT caps2;
+    UINT caps3;
+    UINT caps4;
+    UINT reserved2;
+};
+
+struct BenchDDSHeaderDXT10
+{
+    DXGI_FORMAT dxgiFormat;
+    UINT resourceDimension;
+    UINT miscFlag;
+    UINT arraySize;
+    UINT miscFlags2;
+};
+
+#pragma pack(pop)
+
+static_assert( sizeof(BenchDDSHeader) == 124, "DDS header size mismatch" );
+static_assert( sizeof(BenchDDSHeaderDXT10) == 20, "DDS DX10 extended header size mismatch" );
+
+#define BENCH_DDSD_REQUIRED   0x00001007  // DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT
+#define BENCH_DDSD_MIPMAPS    0x00020000  // DDSD_MIPMAPCOUNT
+#define BENCH_DDSD_DEPTH      0x00800000  // DDSD_DEPTH
+#define BENCH_DDSCAPS         0x00401008  // DDSCAPS_COMPLEX | DDSCAPS_TEXTURE | DDSCAPS_MIPMAP
+#define BENCH_DDSCAPS2_CUBE   0x0000FE00  // DDSCAPS2_CUBEMAP with all six faces
+#define BENCH_DDSCAPS2_VOLUME 0x00200000  // DDSCAPS2_VOLUME
+#define BENCH_DDPF_FOURCC     0x00000004
+#define BENCH_DDPF_RGBA       0x00000041  // DDPF_RGB | DDPF_ALPHAPIXELS
+#define BENCH_DDPF_RGB        0x00000040  // DDPF_RGB
+#define BENCH_DDPF_LUMINANCE  0x00020001  // DDPF_LUMINANCE | DDPF_ALPHAPIXELS
+
+// Masked layouts the loader has to convert
+struct BenchLegacyLayout
+{
+    const char* strName;
+    UINT flags;
+    UINT bitCount;
+    UINT masks[4];
+};
+
+const BenchLegacyLayout g_BenchLegacyLayouts[] =
+{
+    { "r8g8b8",   BENCH_DDPF_RGB,       24, { 0x00ff0000, 0x0000ff00, 0x000000ff, 0x00000000 } },
+    { "x1r5g5b5", BENCH_DDPF_RGB,       16, { 0x00007c00, 0x000003e0, 0x0000001f, 0x00000000 } },
+    { "a4l4",     BENCH_DDPF_LUMINANCE,  8, { 0x0000000f, 0x00000000, 0x00000000, 0x000000f0 } },
+};
+
+
+//--------------------------------------------------------------------------------------
+// Corpus generation.  The contents are deterministic, so every run loads the same bytes.
+//--------------------------------------------------------------------------------------
+struct BenchRandom
+{
+    UINT State;
+
+    BenchRandom() : State( 0x2545F491 ) {}
+
+    UINT Next()
+    {
+        State = State * 1664525u + 1013904223u;
+        return State;
+    }
+
+    void Fill( _Out_writes_bytes_(bytes) BYTE* pData, _In_ size_t bytes )
+    {
+        for( size_t i = 0; i < bytes; ++i )
+            pData[i] = BYTE( Next() >> 24 );
+    }
+};
+
+template<typename T> T* BenchAt( _Inout_ std::vector<BYTE>& file, _In_ UINT64 offset )
+{
+    return reinterpret_cast<T*>( &file[ size_t( offset ) ] );
+}
+
+inline UINT64 BenchAlign16( _In_ UINT64 offset )
+{
+    return ( offset + 15 ) & ~UINT64( 15 );
+}
+
+UINT CountBenchMips( _In_ UINT width, _In_ UINT height, _In_ UINT depth )
+{
+    UINT nMips = 1;
+    while( width > 1 || height > 1 || depth > 1 )
+    {
+        width = std::max<UINT>( width >> 1, 1 );
+        height = std::max<UINT>( height >> 1, 1 );
+        depth = std::max<UINT>( depth >> 1, 1 );
+        ++nMips;
+    }
+    return nMips;
+}
+
+size_t BenchSurfaceBytes( _In_ DXGI_FORMAT format, _In_ UINT width, _In_ UINT height )
+{
+    size_t blocksWide = std::max<size_t>( ( width + 3 ) / 4, 1 );
+    size_t blocksHigh = std::max<size_t>( ( height + 3 ) / 4, 1 );
+
+    switch( format )
+    {
+    case DXGI_FORMAT_BC1_UNORM:
+        return blocksWide * blocksHigh * 8;
+    case DXGI_FORMAT_BC3_UNORM:
+        return blocksWide * blocksHigh * 16;
+    default:
+        return size_t( width ) * height * 4;
+    }
+}
+
+// Full mip chain.  Legacy headers only describe BC1, BC3 and R8G8B8A8, and no arrays.
+void BuildBenchDDS( _Out_ std::vector<BYTE>& file, _In_ DXGI_FORMAT format,
+                    _In_ UINT width, _In_ UINT height, _In_ UINT depth, _In_ UINT arraySize,
+                    _In_ bool bCube, _In_ bool bDX10, _Inout_ BenchRandom& rng )
+{
+    UINT nMips = CountBenchMips( width, height, depth );
+
+    BenchDDSHeader header;
+    ZeroMemory( &header, sizeof( header ) );
+    header.size = sizeof( BenchDDSHeader );
+    header.flags = BENCH_DDSD_REQUIRED | BENCH_DDSD_MIPMAPS | ( ( depth > 1 ) ? BENCH_DDSD_DEPTH : 0 );
+    header.width = width;
+    header.height = height;
+    header.depth = ( depth > 1 ) ? depth : 0;
+    header.mipMapCount = nMips;
+    header.ddspf.size = sizeof( BenchDDSPixelFormat );
+    header.caps = BENCH_DDSCAPS;
+    header.caps2 = bCube ? BENCH_DDSCAPS2_CUBE : ( ( depth > 1 ) ? BENCH_DDSCAPS2_VOLUME : 0 );
+
+    BenchDDSHeaderDXT10 ext;
+    ZeroMemory( &ext, sizeof( ext ) );
+    if( bDX10 )
+    {
+        header.ddspf.flags = BENCH_DDPF_FOURCC;
+        header.ddspf.fourCC = MAKEFOURCC( 'D', 'X', '1', '0' );
+        ext.dxgiFormat = format;
+        ext.resourceDimension = ( depth > 1 ) ? D3D11_RESOURCE_DIMENSION_TEXTURE3D : D3D11_RESOURCE_DIMENSION_TEXTURE2D;
+        ext.miscFlag = bCube ? D3D11_RESOURCE_MISC_TEXTURECUBE : 0;
+        ext.arraySize = arraySize;
+    }
+    else if( format == DXGI_FORMAT_BC1_UNORM || format == DXGI_FORMAT_BC3_UNORM )
+    {
+        header.ddspf.flags = BENCH_DDPF_FOURCC;
+        header.ddspf.fourCC = ( format == DXGI_FORMAT_BC1_UNORM ) ? MAKEFOURCC( 'D', 'X', 'T', '1' ) : MAKEFOURCC( 'D', 'X', 'T', '5' );
+    }
+    else
+    {
+        header.ddspf.flags = BENCH_DDPF_RGBA;
+        header.ddspf.RGBBitCount = 32;
+        header.ddspf.RBitMask = 0x000000ff;
+        header.ddspf.GBitMask = 0x0000ff00;
+        header.ddspf.BBitMask = 0x00ff0000;
+        header.ddspf.ABitMask = 0xff000000;
+    }
+
+    // Items, then mips, then depth slices, as the loader walks them
+    size_t itemBytes = 0;
+    for( UINT iMip = 0; iMip < nMips; ++iMip )
+    {
+        itemBytes += BenchSurfaceBytes( format, std::max<UINT>( width >> iMip, 1 ), std::max<UINT>( height >> iMip, 1 ) )
+                     * std::max<UINT>( depth >> iMip, 1 );
+    }
+    size_t dataBytes = itemBytes * arraySize * ( bCube ? 6 : 1 );
+
+    size_t headerBytes = sizeof( UINT ) + sizeof( BenchDDSHeader ) + ( bDX10 ? sizeof( BenchDDSHeaderDXT10 ) : 0 );
+    file.resize( headerBytes + dataBytes );
+
+    BYTE* pDest = &file[0];
+    memcpy( pDest, &BENCH_DDS_MAGIC, sizeof( UINT ) );
+    pDest += sizeof( UINT );
+    memcpy( pDest, &header, sizeof( header ) );
+    pDest += sizeof( header );
+    if( bDX10 )
+    {
+        memcpy( pDest, &ext, sizeof( ext ) );
+        pDest += sizeof( ext );
+    }
+
+    // Random bytes are valid block compressed data
+    rng.Fill( pDest, dataBytes );
+}
+
+// Square 2D texture with a full mip chain in one of the legacy masked layouts
+void BuildBenchLegacyDDS( _Out_ std::vector<BYTE>& file, _In_ const BenchLegacyLayout& layout,
+                          _In_ UINT size, _Inout_ BenchRandom& rng )
+{
+    UINT nMips = CountBenchMips( size, size, 1 );
+
+    BenchDDSHeader header;
+    ZeroMemory( &header, sizeof( header ) );
+    header.size = sizeof( BenchDDSHeader );
+    header.flags = BENCH_DDSD_REQUIRED | BENCH_DDSD_MIPMAPS;
+    header.width = size;
+    header.height = size;
+    header.mipMapCount = nMips;
+    header.ddspf.size = sizeof( BenchDDSPixelFormat );
+    header.ddspf.flags = layout.flags;
+    header.ddspf.RGBBitCount = layout.bitCount;
+    header.ddspf.RBitMask = layout.masks[0];
+    header.ddspf.GBitMask = layout.masks[1];
+    header.ddspf.BBitMask = layout.masks[2];
+    header.ddspf.ABitMask = layout.masks[3];
+    header.caps = BENCH_DDSCAPS;
+
+    size_t dataBytes = 0;
+    for( UINT iMip = 0; iMip < nMips; ++iMip )
+    {
+        UINT mipSize = std::max<UINT>( size >> iMip, 1 );
+        dataBytes += size_t( mipSize ) * mipSize * ( layout.bitCount / 8 );
+    }
+
+    size_t headerBytes = sizeof( UINT ) + sizeof( BenchDDSHeader );
+    file.resize( headerBytes + dataBytes );
+    memcpy( &file[0], &BENCH_DDS_MAGIC, sizeof( UINT ) );
+    memcpy( &file[ sizeof( UINT ) ], &header, sizeof( header ) );
+    rng.Fill( &file[ headerBytes ], dataBytes );
+}
+
+// 32 bpp bottom-up BMP
+void BuildBenchBMP( _Out_ std::vector<BYTE>& file, _In_ UINT size, _Inout_ BenchRandom& rng )
+{
+    size_t pixelBytes = size_t( size ) * size * 4;
+
+    BITMAPFILEHEADER fileHeader;
+    ZeroMemory( &fileHeader, sizeof( fileHeader ) );
+    fileHeader.bfType = 0x4D42; // "BM"
+    fileHeader.bfOffBits = sizeof( BITMAPFILEHEADER ) + sizeof( BITMAPINFOHEADER );
+    fileHeader.bfSize = DWORD( fileHeader.bfOffBits + pixelBytes );
+
+    BITMAPINFOHEADER infoHeader;
+    ZeroMemory( &infoHeader, sizeof( infoHeader ) );
+    infoHeader.biSize = sizeof( BITMAPINFOHEADER );
+    infoHeader.biWidth = LONG( size );
+    infoHeader.biHeight = LONG( size );
+    infoHeader.biPlanes = 1;
+    infoHeader.biBitCount = 32;
+    infoHeader.biCompression = BI_RGB;
+    infoHeader.biSizeImage = DWORD( pixelBytes );
+
+    file.resize( fileHeader.bfOffBits + pixelBytes );
+    memcpy( &file[0], &fileHeader, sizeof( fileHeader ) );
+    memcpy( &file[ sizeof( fileHeader ) ], &infoHeader, sizeof( infoHeader ) );
+    rng.Fill( &file[ fileHeader.bfOffBits ], pixelBytes );
+}
+
+void GetBenchFrameName( _Out_writes_(MAX_FRAME_NAME) char* strName, _In_ UINT iFrame )
+{
+    sprintf_s( strName, MAX_FRAME_NAME, "frame_%04u", iFrame );
+}
+
+// A grid of about nVertices vertices split into nSubsets, drawn from the deepest frame of
+// a chain of nFrames
+void BuildBenchSDKMesh( _Out_ std::vector<BYTE>& file, _In_ UINT nVertices, _In_ UINT nSubsets, _In_ UINT nFrames )
+{
+    struct Vertex
+    {
+        XMFLOAT3 Position;
+        XMFLOAT3 Normal;
+        XMFLOAT2 TexCoord;
+    };
+
+    UINT nSide = std::max<UINT>( UINT( sqrt( double( nVertices ) ) ), 2 );
+    nVertices = nSide * nSide;
+    UINT nTriangles = ( nSide - 1 ) * ( nSide - 1 ) * 2;
+    nSubsets = std::min<UINT>( std::max<UINT>( nSubsets, 1 ), nTriangles );
+    nFrames = std::max<UINT>( nFrames, 1 );
+    bool b16Bit = ( nVertices <= 0xFFFF );
+    UINT64 indexBytes = b16Bit ? sizeof( WORD ) : sizeof( UINT );
+
+    // Headers and the non buffer data, then the buffer data
+    UINT64 offVBHeader = sizeof( SDKMESH_HEADER );
+    UINT64 offIBHeader = offVBHeader + sizeof( SDKMESH_VERTEX_BUFFER_HEADER );
+    UINT64 offMesh = offIBHeader + sizeof( SDKMESH_INDEX_BUFFER_HEADER );
+    UINT64 offSubsets = offMesh + sizeof( SDKMESH_MESH );
+    UINT64 offFrames = offSubsets + nSubsets * sizeof( SDKMESH_SUBSET );
+    UINT64 offMaterials = offFrames + nFrames * sizeof( SDKMESH_FRAME );
+    UINT64 offSubsetList = offMaterials + sizeof( SDKMESH_MATERIAL );
+    UINT64 offInfluences = offSubsetList + nSubsets * sizeof( UINT );
+    UINT64 offVertices = BenchAlign16( offInfluences );
+    UINT64 vertexBytes = UINT64( nVertices ) * sizeof( Vertex );
+    UINT64 offIndices = BenchAlign16( offVertices + vertexBytes );
+    UINT64 fileBytes = offIndices + UINT64( nTriangles ) * 3 * indexBytes;
+
+    file.assign( size_t( fileBytes ), 0 );
+
+    auto pHeader = BenchAt<SDKMESH_HEADER>( file, 0 );
+    pHeader->Version = SDKMESH_FILE_VERSION;
+    pHeader->HeaderSize = sizeof( SDKMESH_HEADER );
+    pHeader->NonBufferDataSize = offVertices - sizeof( SDKMESH_HEADER );
+    pHeader->BufferDataSize = fileBytes - offVertices;
+    pHeader->NumVertexBuffers = 1;
+    pHeader->NumIndexBuffers = 1;
+    pHeader->NumMeshes = 1;
+    pHeader->NumTotalSubsets = nSubsets;
+    pHeader->NumFrames = nFrames;
+    pHeader->NumMaterials = 1;
+    pHeader->VertexStreamHeadersOffset = offVBHeader;
+    pHeader->IndexStreamHeadersOffset = offIBHeader;
+    pHeader->MeshDataOffset = offMesh;
+    pHeader->SubsetDataOffset = offSubsets;
+    pHeader->FrameDataOffset = offFrames;
+    pHeader->MaterialDataOffset = offMaterials;
+
+    auto pVB = BenchAt<SDKMESH_VERTEX_BUFFER_HEADER>( file, offVBHeader );
+    pVB->NumVertices = nVertices;
+    pVB->SizeBytes = vertexBytes;
+    pVB->StrideBytes = sizeof( Vertex );
+    const D3DVERTEXELEMENT9 declEnd = D3DDECL_END();
+    for( UINT i = 0; i < MAX_VERTEX_ELEMENTS; ++i )
+        pVB->Decl[i] = declEnd;
+    const D3DVERTEXELEMENT9 decl[] =
+    {
+        { 0, 0, D3DDECLTYPE_FLOAT3, D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_POSITION, 0 },
+        { 0, 12, D3DDECLTYPE_FLOAT3, D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_NORMAL, 0 },
+        { 0, 24, D3DDECLTYPE_FLOAT2, D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_TEXCOORD, 0 },
+    };
+    memcpy( pVB->Decl, decl, sizeof( decl ) );
+    pVB->DataOffset = offVertices;
+
+    auto pIB = BenchAt<SDKMESH_INDEX_BUFFER_HEADER>( file, offIBHeader );
+    pIB->NumIndices = UINT64( nTriangles ) * 3;
+    pIB->SizeBytes = pIB->NumIndices * indexBytes;
+    pIB->IndexType = b16Bit ? IT_16BIT : IT_32BIT;
+    pIB->DataOffset = offIndices;
+
+    auto pMesh = BenchAt<SDKMESH_MESH>( file, offMesh );
+    strcpy_s( pMesh->Name, MAX_MESH_NAME, "grid" );
+    pMesh->NumVertexBuffers = 1;
+    pMesh->NumSubsets = nSubsets;
+    pMesh->SubsetOffset = offSubsetList;
+    pMesh->FrameInfluenceOffset = offInfluences;
+
+    UINT nTrianglesPerSubset = nTriangles / nSubsets;
+    for( UINT i = 0; i < nSubsets; ++i )
+    {
+        auto pSubset = BenchAt<SDKMESH_SUBSET>( file, offSubsets + i * sizeof( SDKMESH_SUBSET ) );
+        sprintf_s( pSubset->Name, MAX_SUBSET_NAME, "subset_%u", i );
+        pSubset->PrimitiveType = PT_TRIANGLE_LIST;
+        pSubset->IndexStart = UINT64( i ) * nTrianglesPerSubset * 3;
+        pSubset->IndexCount = UINT64( ( i + 1 < nSubsets ) ? nTrianglesPerSubset : nTriangles - i * nTrianglesPerSubset ) * 3;
+        pSubset->VertexCount = nVertices;
+
+        BenchAt<UINT>( file, offSubsetList )[i] = i;
+    }
+
+    XMFLOAT4X4 offset;
+    XMStoreFloat4x4( &offset, XMMatrixTranslation( 0.0f, 0.01f, 0.0f ) );
+    for( UINT i = 0; i < nFrames; ++i )
+    {
+        auto pFrame = BenchAt<SDKMESH_FRAME>( file, offFrames + i * sizeof( SDKMESH_FRAME ) );
+        GetBenchFrameName( pFrame->Name, i );
+        pFrame->Mesh = ( i + 1 == nFrames ) ? 0 : INVALID_MESH;
+        pFrame->ParentFrame = i ? i - 1 : INVALID_FRAME;
+        pFrame->ChildFrame = ( i + 1 < nFrames ) ? i + 1 : INVALID_FRAME;
+        pFrame->SiblingFrame = INVALID_FRAME;
+        pFrame->Matrix = offset;
+        pFrame->AnimationDataIndex = INVALID_ANIMATION_DATA;
+    }
+
+    auto pMaterial = BenchAt<SDKMESH_MATERIAL>( file, offMaterials );
+    strcpy_s( pMaterial->Name, MAX_MATERIAL_NAME, "material" );
+    pMaterial->Diffuse = XMFLOAT4( 1.0f, 1.0f, 1.0f, 1.0f );
+    pMaterial->Ambient = XMFLOAT4( 0.2f, 0.2f, 0.2f, 1.0f );
+    pMaterial->Specular = XMFLOAT4( 1.0f, 1.0f, 1.0f, 1.0f );
+    pMaterial->Power = 16.0f;
+
+    auto pVertices = BenchAt<Vertex>( file, offVertices );
+    float fScale = 1.0f / float( nSide - 1 );
+    for( UINT z = 0; z < nSide; ++z )
+    {
+        for( UINT x = 0; x < nSide; ++x )
+        {
+            Vertex& v = pVertices[ z * nSide + x ];
+            v.Position = XMFLOAT3( float( x ) * fScale - 0.5f, 0.0f, float( z ) * fScale - 0.5f );
+            v.Normal = XMFLOAT3( 0.0f, 1.0f, 0.0f );
+            v.TexCoord = XMFLOAT2( float( x ) * fScale, float( z ) * fScale );
+        }
+    }
+
+    UINT iIndex = 0;
+    for( UINT z = 0; z + 1 < nSide; ++z )
+    {
+        for( UINT x = 0; x + 1 < nSide; ++x )
+        {
+            UINT i0 = z * nSide + x;
+            const UINT quad[] = { i0, i0 + nSide, i0 + 1, i0 + 1, i0 + nSide, i0 + nSide + 1 };
+            for( UINT i = 0; i < 6; ++i, ++iIndex )
+            {
+                if( b16Bit )
+                    BenchAt<WORD>( file, offIndices )[ iIndex ] = WORD( quad[i] );
+                else
+                    BenchAt<UINT>( file, offIndices )[ iIndex ] = quad[i];
+            }
+        }
+    }
+}
+
+// Key sets for every frame of the matching BuildBenchSDKMesh chain
+void BuildBenchSDKMeshAnimation( _Out_ std::vector<BYTE>& file, _In_ UINT nFrames, _In_ UINT nKeys )
+{
+    nFrames = std::max<UINT>( nFrames, 1 );
+    nKeys = std::max<UINT>( nKeys, 1 );
+
+    UINT64 frameDataBytes = UINT64( nFrames ) * sizeof( SDKANIMATION_FRAME_DATA );
+    UINT64 keyBytes = UINT64( nKeys ) * sizeof( SDKANIMATION_DATA );
+    file.assign( size_t( sizeof( SDKANIMATION_FILE_HEADER ) + frameDataBytes + keyBytes * nFrames ), 0 );
+
+    auto pHeader = BenchAt<SDKANIMATION_FILE_HEADER>( file, 0 );
+    pHeader->Version = SDKMESH_FILE_VERSION;
+    pHeader->FrameTransformType = FTT_RELATIVE;
+    pHeader->NumFrames = nFrames;
+    pHeader->NumAnimationKeys = nKeys;
+    pHeader->AnimationFPS = 30;
+    pHeader->AnimationDataSize = frameDataBytes + keyBytes * nFrames;
+    pHeader->AnimationDataOffset = sizeof( SDKANIMATION_FILE_HEADER );
+
+    // Key offsets are relative to the end of the file header
+    for( UINT i = 0; i < nFrames; ++i )
+    {
+        auto pFrameData = BenchAt<SDKANIMATION_FRAME_DATA>( file, sizeof( SDKANIMATION_FILE_HEADER ) + i * sizeof( SDKANIMATION_FRAME_DATA ) );
+        GetBenchFrameName( pFrameData->FrameName, i );
+        pFrameData->DataOffset = frameDataBytes + i * keyBytes;
+
+        auto pKeys = BenchAt<SDKANIMATION_DATA>( file, sizeof( SDKANIMATION_FILE_HEADER ) + pFrameData->DataOffset );
+        for( UINT iKey = 0; iKey < nKeys; ++iKey )
+        {
+            pKeys[iKey].Translation = XMFLOAT3( 0.0f, 0.01f, 0.0f );
+            XMStoreFloat4( &pKeys[iKey].Orientation, XMQuaternionRotationRollPitchYaw( 0.0f, XM_2PI * float( iKey ) / float( nKeys ), 0.0f ) );
+            pKeys[iKey].Scaling = XMFLOAT3( 1.0f, 1.0f, 1.0f );
+        }
+    }
+}
+
+HRESULT WriteBenchFile( _In_z_ LPCWSTR szFile, _In_ const std::vector<BYTE>& file )
+{
+    HANDLE hFile = CreateFileW( szFile, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr );
+    if( hFile == INVALID_HANDLE_VALUE )
+        return HRESULT_FROM_WIN32( GetLastError() );
+
+    DWORD dwWritten = 0;
+    BOOL bWritten = WriteFile( hFile, &file[0], DWORD( file.size() ), &dwWritten, nullptr );
+    CloseHandle( hFile );
+
+    return ( bWritten && dwWritten == file.size() ) ? S_OK : E_FAIL;
+}
+
+HRESULT CreateBenchDirectory( _In_z_ LPCWSTR szDirectory )
+{
+    if( CreateDirectoryW( szDirectory, nullptr ) || GetLastError() == ERROR_ALREADY_EXISTS )
+        return S_OK;
+    return HRESULT_FROM_WIN32( GetLastError() );
+}
+
+
+//--------------------------------------------------------------------------------------
+// Measurement
+//--------------------------------------------------------------------------------------
+#if defined(DEBUG) || defined(_DEBUG)
+volatile LONG64 g_nBenchAllocations = 0;
+_CRT_ALLOC_HOOK g_pfnBenchPreviousAllocHook = nullptr;
+
+int __cdecl BenchAllocHook( int allocType, void* pUserData, size_t size, int blockType, long requestNumber,
+                            const unsigned char* filename, int lineNumber )
+{
+    if( allocType == _HOOK_ALLOC || allocType == _HOOK_REALLOC )
+        InterlockedIncrement64( &g_nBenchAllocations );
+
+    if( g_pfnBenchPreviousAllocHook )
+        return g_pfnBenchPreviousAllocHook( allocType, pUserData, size, blockType, requestNumber, filename, lineNumber );
+    return TRUE;
+}
+#endif
+
+inline UINT64 GetBenchAllocations()
+{
+#if defined(DEBUG) || defined(_DEBUG)
+    return UINT64( g_nBenchAllocations );
+#else
+    return 0;
+#endif
+}
+
+struct BenchResult
+{
+    double Seconds;
+    UINT64 Allocations;
+    UINT Failures;
+    SIZE_T PeakWorkingSet;      // Of the process, at the end of the last pass
+};
+
+// Accumulates the time and allocations of one loader call
+class BenchTimer
+{
+public:
+    BenchTimer() : m_llStart( DXUTGetTimestamp() ), m_nAllocations( GetBenchAllocations() ) {}
+
+    void Stop( _Inout_ BenchResult& result ) const
+    {
+        result.Seconds += DXUTTimestampToSeconds( DXUTGetTimestamp() - m_llStart );
+        result.Allocations += GetBenchAllocations() - m_nAllocations;
+    }
+
+private:
+    LONGLONG m_llStart;
+    UINT64 m_nAllocations;
+};
+
+enum BENCH_LOADER
+{
+    BENCH_LOADER_DDS = 0,
+    BENCH_LOADER_WIC,
+    BENCH_LOADER_RESOURCE_CACHE,
+    BENCH_LOADER_SDKMESH,
+    BENCH_LOADER_ANIMATION,
+    BENCH_LOADER_ARCHIVE,       // Textures and meshes by name, from the phase's mounted archive
+};
+
+struct BenchPhase
+{
+    const char* strName;
+    BENCH_LOADER Loader;
+    std::vector<std::wstring> Files;
+    std::wstring strArchive;    // Mounted for the phase; Files are then names inside it
+    UINT64 Bytes;
+    BenchResult Cold;
+    BenchResult Warm;           // Summed over the warm passes
+
+    BenchPhase( _In_z_ const char* name, _In_ BENCH_LOADER loader ) :
+        strName( name ),
+        Loader( loader ),
+        Bytes( 0 )
+    {
+        ZeroMemory( &Cold, sizeof( Cold ) );
+        ZeroMemory( &Warm, sizeof( Warm ) );
+    }
+};
+
+HRESULT AddBenchFile( _Inout_ BenchPhase& phase, _In_ const std::wstring& strFile, _In_ const std::vector<BYTE>& file )
+{
+    HRESULT hr = WriteBenchFile( strFile.c_str(), file );
+    if( FAILED( hr ) )
+        return hr;
+
+    phase.Files.push_back( strFile );
+    phase.Bytes += file.size();
+    return S_OK;
+}
+
+// Also writes the file below the directory that is packed into the archives, and gives the
+// archive phase its name relative to that directory
+HRESULT AddBenchPackedFile( _Inout_ BenchPhase& phase, _In_ const std::wstring& strPackDir, _In_z_ LPCWSTR szName,
+                            _In_ const std::vector<BYTE>& file )
+{
+    HRESULT hr = WriteBenchFile( ( strPackDir + L"\\" + szName ).c_str(), file );
+    if( FAILED( hr ) )
+        return hr;
+
+    phase.Files.push_back( szName );
+    phase.Bytes += file.size();
+    return S_OK;
+}
+
+// The mesh a .sdkmesh_anim file animates, matching the names given by the corpus builder
+std::wstring GetBenchAnimatedMesh( _In_ const std::wstring& strAnimation )
+{
+    return strAnimation.substr( 0, strAnimation.length() - 5 );
+}
+
+HRESULT LoadBenchFile( _In_ const BenchPhase& phase, _In_ size_t iFile,
+                       _In_ ID3D11Device* pd3dDevice, _In_ ID3D11DeviceContext* pd3dImmediateContext,
+                       _Inout_ BenchResult& result )
+{
+    HRESULT hr = E_FAIL;
+    LPCWSTR szFile = phase.Files[iFile].c_str();
+    ID3D11ShaderResourceView* pSRV = nullptr;
+
+    switch( phase.Loader )
+    {
+    case BENCH_LOADER_DDS:
+        {
+            BenchTimer timer;
+            hr = CreateDDSTextureFromFileEx( pd3dDevice, szFile, 0, D3D11_USAGE_DEFAULT, D3D11_BIND_SHADER_RESOURCE, 0, 0,
+                                             false, nullptr, &pSRV );
+            timer.Stop( result );
+        }
+        break;
+
+    case BENCH_LOADER_WIC:
+        {
+            BenchTimer timer;
+            hr = CreateWICTextureFromFileEx( pd3dDevice, szFile, 0, D3D11_USAGE_DEFAULT, D3D11_BIND_SHADER_RESOURCE, 0, 0,
+                                             false, nullptr, &pSRV );
+            timer.Stop( result );
+        }
+        break;
+
+    case BENCH_LOADER_RESOURCE_CACHE:
+        {
+            BenchTimer timer;
+            hr = DXUTGetGlobalResourceCache().CreateTextureFromFile( pd3dDevice, pd3dImmediateContext, szFile, &pSRV );
+            timer.Stop( result );
+        }
+        break;
+
+    case BENCH_LOADER_SDKMESH:
+        {
+            CDXUTSDKMesh mesh;
+            {
+                BenchTimer timer;
+                hr = mesh.Create( pd3dDevice, szFile );
+                timer.Stop( result );
+            }
+            mesh.Destroy();
+        }
+        break;
+
+    case BENCH_LOADER_ANIMATION:
+        {
+            // Only the animation load is timed; its frames are matched to the mesh by name
+            CDXUTSDKMesh mesh;
+            hr = mesh.Create( nullptr, GetBenchAnimatedMesh( phase.Files[iFile] ).c_str() );
+            if( SUCCEEDED( hr ) )
+            {
+                BenchTimer timer;
+                hr = mesh.LoadAnimation( szFile );
+                timer.Stop( result );
+            }
+            mesh.Destroy();
+        }
+        break;
+
+    case BENCH_LOADER_ARCHIVE:
+        {
+            WCHAR ext[_MAX_EXT];
+            _wsplitpath_s( szFile, nullptr, 0, nullptr, 0, nullptr, 0, ext, _MAX_EXT );
+            if( !_wcsicmp( ext, L".sdkmesh" ) )
+            {
+                CDXUTSDKMesh mesh;
+                {
+                    BenchTimer timer;
+                    hr = mesh.Create( pd3dDevice, szFile );
+                    timer.Stop( result );
+                }
+                mesh.Destroy();
+            }
+            else
+            {
+                BenchTimer timer;
+                hr = DXUTCreateShaderResourceViewFromFile( pd3dDevice, szFile, &pSRV );
+                timer.Stop( result );
+            }
+        }
+        break;
+    }
+
+    SAFE_RELEASE( pSRV );
+    return hr;
+}
+
+void RunBenchPass( _In_ const BenchPhase& phase, _In_ ID3D11Device* pd3dDevice, _In_ ID3D11DeviceContext* pd3dImmediateContext,
+                   _Inout_ BenchResult& result )
+{
+    for( size_t i = 0; i < phase.Files.size(); ++i )
+    {
+        if( FAILED( LoadBenchFile( phase, i, pd3dDevice, pd3dImmediateContext, result ) ) )
+            ++result.Failures;
+    }
+
+    // Let the runtime destroy the released resources before the next pass
+    pd3dImmediateContext->Flush();
+
+    PROCESS_MEMORY_COUNTERS counters;
+    ZeroMemory( &counters, sizeof( counters ) );
+    counters.cb = sizeof( counters );
+    if( GetProcessMemoryInfo( GetCurrentProcess(), &counters, sizeof( counters ) ) )
+        result.PeakWorkingSet = counters.PeakWorkingSetSize;
+}
+
+// Opening a file without buffering has the file system flush and purge its cached pages,
+// unless another handle has it mapped, so the next read goes to the disk
+void PurgeBenchFile( _In_ const std::wstring& strFile )
+{
+    HANDLE hFile = CreateFileW( strFile.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_FLAG_NO_BUFFERING, nullptr );
+    if( hFile != INVALID_HANDLE_VALUE )
+        CloseHandle( hFile );
+}
+
+void PurgeBenchFiles( _In_ const BenchPhase& phase )
+{
+    if( !phase.strArchive.empty() )
+    {
+        PurgeBenchFile( phase.strArchive );
+        return;
+    }
+
+    for( auto it = phase.Files.cbegin(); it != phase.Files.cend(); ++it )
+    {
+        PurgeBenchFile( *it );
+        if( phase.Loader == BENCH_LOADER_ANIMATION )
+            PurgeBenchFile( GetBenchAnimatedMesh( *it ) );
+    }
+}
+
+
+//--------------------------------------------------------------------------------------
+// The legacy conversion kernels alone, one image of each layout, against the scalar
+// reference
+//--------------------------------------------------------------------------------------
+struct BenchConversion
+{
+    const char* strName;
+    UINT64 Bytes;               // Source bytes per run
+    double ScalarSeconds;
+    double KernelSeconds;
+    double ParallelSeconds;
+    bool bMatchesScalar;
+};
+
+template<typename F> double TimeBenchIterations( _In_ UINT nIterations, _In_ F run )
+{
+    LONGLONG llStart = DXUTGetTimestamp();
+    for( UINT i = 0; i < nIterations; ++i )
+        run();
+    return DXUTTimestampToSeconds( DXUTGetTimestamp() - llStart ) / double( nIterations );
+}
+
+void RunConversionBench( _In_ UINT size, _In_ UINT nIterations, _Out_ std::vector<BenchConversion>& results )
+{
+    results.clear();
+    if( !size )
+        return;
+
+    nIterations = std::max<UINT>( nIterations, 1 );
+    size_t nPixels = size_t( size ) * size;
+    BenchRandom rng;
+
+    for( size_t i = 0; i < _countof( g_BenchLegacyLayouts ); ++i )
+    {
+        const BenchLegacyLayout& layout = g_BenchLegacyLayouts[i];
+        DDS_LEGACY_CONVERSION conv;
+        if( !GetDDSLegacyConversion( layout.flags, layout.bitCount, layout.masks[0], layout.masks[1], layout.masks[2],
+                                     layout.masks[3], &conv ) )
+            continue;
+
+        std::vector<BYTE> src( nPixels * conv.srcBytes );
+        std::vector<BYTE> reference( nPixels * conv.dstBytes );
+        std::vector<BYTE> dst( nPixels * conv.dstBytes );
+        rng.Fill( &src[0], src.size() );
+
+        BenchConversion result;
+        result.strName = layout.strName;
+        result.Bytes = src.size();
+
+        result.ScalarSeconds = TimeBenchIterations( nIterations, [&]() { ConvertDDSLegacyPixelsScalar( conv, &src[0], &reference[0], nPixels ); } );
+        result.KernelSeconds = TimeBenchIterations( nIterations, [&]() { ConvertDDSLegacyPixels( conv, &src[0], &dst[0], nPixels ); } );
+        result.bMatchesScalar = ( dst == reference );
+
+        std::fill( dst.begin(), dst.end(), BYTE( 0 ) );
+        result.ParallelSeconds = TimeBenchIterations( nIterations, [&]() { ConvertDDSLegacyPixelsParallel( conv, &src[0], &dst[0], nPixels ); } );
+        result.bMatchesScalar = result.bMatchesScalar && ( dst == reference );
+
+        results.push_back( result );
+    }
+}
+
+
+//--------------------------------------------------------------------------------------
+// Skinning palettes of every mesh in one file: the GetMeshInfluenceMatrix loop an app
+// would write, against GetMeshInfluencePalette in each format, then both uploaded
+//--------------------------------------------------------------------------------------
+struct BenchPaletteFormat
+{
+    const char* strName;
+    SDKMESH_PALETTE_FORMAT Format;
+    double PaletteSeconds;
+    double UploadSeconds;       // Written straight into the mapped palette buffer
+};
+
+struct BenchSkinning
+{
+    UINT Bones;                 // Over all the meshes
+    double TransformSeconds;    // TransformMesh, which both patterns read from
+    double PerInfluenceSeconds;
+    double PerInfluenceUploadSeconds;   // The same into an array, then copied into the mapped buffer
+    bool bMatchesPerInfluence;  // The float4x4 palette against the per-influence matrices
+    std::vector<BenchPaletteFormat> Formats;
+};
+
+HRESULT RunSkinningBench( _In_ ID3D11Device* pd3dDevice, _In_ ID3D11DeviceContext* pd3dImmediateContext,
+                          _In_z_ LPCWSTR szMesh, _In_ UINT nIterations, _Out_ BenchSkinning& result )
+{
+    result.Bones = 0;
+    result.TransformSeconds = 0;
+    result.PerInfluenceSeconds = 0;
+    result.PerInfluenceUploadSeconds = 0;
+    result.bMatchesPerInfluence = true;
+    result.Formats.clear();
+
+    HRESULT hr;
+    CDXUTSDKMesh mesh;
+    V_RETURN( mesh.Create( pd3dDevice, szMesh ) );
+    mesh.TransformBindPose( XMMatrixIdentity() );
+
+    nIterations = std::max<UINT>( nIterations, 1 );
+    UINT nMeshes = mesh.GetNumMeshes();
+    UINT nMaxBones = 0;
+    for( UINT iMesh = 0; iMesh < nMeshes; ++iMesh )
+    {
+        result.Bones += mesh.GetNumInfluences( iMesh );
+        nMaxBones = std::max<UINT>( nMaxBones, mesh.GetNumInfluences( iMesh ) );
+    }
+    if( !nMaxBones )
+        return S_OK;
+
+    result.TransformSeconds = TimeBenchIterations( nIterations, [&]() { mesh.TransformMesh( XMMatrixIdentity(), 0.0 ); } );
+
+    std::vector<XMFLOAT4X4> matrices( nMaxBones );
+    auto perInfluence = [&]( UINT iMesh )
+    {
+        for( UINT i = 0; i < mesh.GetNumInfluences( iMesh ); ++i )
+            XMStoreFloat4x4( &matrices[i], XMMatrixTranspose( mesh.GetMeshInfluenceMatrix( iMesh, i ) ) );
+    };
+    result.PerInfluenceSeconds = TimeBenchIterations( nIterations, [&]()
+    {
+        for( UINT iMesh = 0; iMesh < nMeshes; ++iMesh )
+            perInfluence( iMesh );
+    } );
+
+    std::vector<BYTE> palette( size_t( nMaxBones ) * CDXUTSDKMesh::GetPaletteStride( SDKMESH_PALETTE_FLOAT4X4 ) );
+    for( UINT iMesh = 0; iMesh < nMeshes; ++iMesh )
+    {
+        perInfluence( iMesh );
+        V_RETURN( mesh.GetMeshInfluencePalette( iMesh, SDKMESH_PALETTE_FLOAT4X4, &palette[0], palette.size() ) );
+        if( memcmp( &palette[0], &matrices[0], mesh.GetNumInfluences( iMesh ) * sizeof( XMFLOAT4X4 ) ) )
+            result.bMatchesPerInfluence = false;
+    }
+
+    const BenchPaletteFormat formats[] =
+    {
+        { "float4x4", SDKMESH_PALETTE_FLOAT4X4, 0, 0 },
+        { "float4x3", SDKMESH_PALETTE_FLOAT3X4, 0, 0 },
+        { "dualQuaternion", SDKMESH_PALETTE_DUAL_QUATERNION, 0, 0 },
+    };
+    for( size_t iFormat = 0; iFormat < _countof( formats ); ++iFormat )
+    {
+        BenchPaletteFormat format = formats[iFormat];
+        format.PaletteSeconds = TimeBenchIterations( nIterations, [&]()
+        {
+            for( UINT iMesh = 0; iMesh < nMeshes; ++iMesh )
+                mesh.GetMeshInfluencePalette( iMesh, format.Format, &palette[0], palette.size() );
+        } );
+
+        // Structured, so any bone count fits
+        CDXUTSkinningPaletteBuffer buffer;
+        V_RETURN( buffer.OnD3D11CreateDevice( pd3dDevice, nMaxBones, format.Format, true ) );
+        format.UploadSeconds = TimeBenchIterations( nIterations, [&]()
+        {
+            for( UINT iMesh = 0; iMesh < nMeshes; ++iMesh )
+                buffer.Update( pd3dImmediateContext, mesh, iMesh );
+        } );
+
+        if( format.Format == SDKMESH_PALETTE_FLOAT4X4 )
+        {
+            result.PerInfluenceUploadSeconds = TimeBenchIterations( nIterations, [&]()
+            {
+                for( UINT iMesh = 0; iMesh < nMeshes; ++iMesh )
+                {
+                    perInfluence( iMesh );
+
+                    D3D11_MAPPED_SUBRESOURCE mapped;
+                    if( SUCCEEDED( pd3dImmediateContext->Map( buffer.GetBuffer(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped ) ) )
+                    {
+                        memcpy( mapped.pData, &matrices[0], mesh.GetNumInfluences( iMesh ) * sizeof( XMFLOAT4X4 ) );
+                        pd3dImmediateContext->Unmap( buffer.GetBuffer(), 0 );
+                    }
+                }
+            } );
+        }
+
+        result.Formats.push_back( format );
+    }
+
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Report
+//--------------------------------------------------------------------------------------
+void AppendBenchJsonString( _Inout_ std::string& str, _In_z_ LPCWSTR strValue )
+{
+    char strUTF8[512];
+    if( !WideCharToMultiByte( CP_UTF8, 0, strValue, -1, strUTF8, 512, nullptr, nullptr ) )
+        strUTF8[0] = 0;
+
+    str += '"';
+    for( const char* p = strUTF8; *p; ++p )
+    {
+        if( *p == '"' || *p == '\\' )
+            str += '\\';
+        if( static_cast<unsigned char>( *p ) >= ' ' )
+            str += *p;
+    }
+    str += '"';
+}
+
+void AppendBenchResult( _Inout_ std::string& str, _In_z_ const char* strName, _In_ const BenchPhase& phase,
+                        _In_ const BenchResult& result, _In_ UINT nPasses, _In_ bool bLast )
+{
+    double fSeconds = result.Seconds / double( nPasses );
+    double fFiles = double( phase.Files.size() );
+
+    char strAllocations[64];
+#if defined(DEBUG) || defined(_DEBUG)
+    sprintf_s( strAllocations, 64, "%.2f", double( result.Allocations ) / ( fFiles * double( nPasses ) ) );
+#else
+    strcpy_s( strAllocations, 64, "null" );
+#endif
+
+    char strLine[512];
+    sprintf_s( strLine, 512, "      \"%s\": { \"seconds\": %.6f, \"megabytesPerSecond\": %.2f, \"filesPerSecond\": %.2f, \"allocationsPerFile\": %s, \"failures\": %u, \"peakWorkingSetBytes\": %llu }%s\n",
+               strName, fSeconds,
+               ( fSeconds > 0 ) ? double( phase.Bytes ) / ( 1024.0 * 1024.0 ) / fSeconds : 0.0,
+               ( fSeconds > 0 ) ? fFiles / fSeconds : 0.0,
+               strAllocations, result.Failures, UINT64( result.PeakWorkingSet ), bLast ? "" : "," );
+    str += strLine;
+}
+
+inline double BenchMegabytesPerSecond( _In_ UINT64 bytes, _In_ double fSeconds )
+{
+    return ( fSeconds > 0 ) ? double( bytes ) / ( 1024.0 * 1024.0 ) / fSeconds : 0.0;
+}
+
+inline double BenchMicroseconds( _In_ double fSeconds )
+{
+    return fSeconds * 1000000.0;
+}
+
+HRESULT WriteBenchReport( _In_z_ LPCWSTR szReportFile, _In_ const DXUT_ASSET_BENCHMARK_DESC& desc,
+                          _In_ const std::vector<BenchPhase>& phases, _In_ const std::vector<BenchConversion>& conversions,
+                          _In_opt_ const BenchSkinning* pSkinning )
+{
+    char strLine[1024];
+    std::string str = "{\n  \"device\": ";
+    AppendBenchJsonString( str, DXUTGetDeviceStats() );
+
+#if defined(DEBUG) || defined(_DEBUG)
+    const char* strBuild = "debug";
+#else
+    const char* strBuild = "release";
+#endif
+    sprintf_s( strLine, 1024, ",\n  \"headless\": %s,\n  \"build\": \"%s\",\n  \"warmIterations\": %u,\n",
+               DXUTIsHeadless() ? "true" : "false", strBuild, desc.WarmIterations );
+    str += strLine;
+
+    sprintf_s( strLine, 1024, "  \"corpus\": { \"smallTextures\": [ %u, %u ], \"arrayTextures\": [ %u, %u, %u ], \"legacyTextures\": [ %u, %u ], \"cubeMaps\": [ %u, %u ], \"volumeTextures\": [ %u, %u ], \"images\": [ %u, %u ], \"meshes\": [ %u, %u, %u, %u, %u ] },\n",
+               desc.NumSmallTextures, desc.SmallTextureSize,
+               desc.NumArrayTextures, desc.ArrayTextureSize, desc.ArraySize,
+               desc.NumLegacyTextures, desc.LegacyTextureSize,
+               desc.NumCubeMaps, desc.CubeMapSize,
+               desc.NumVolumeTextures, desc.VolumeTextureSize,
+               desc.NumImages, desc.ImageSize,
+               desc.NumMeshes, desc.MeshVertices, desc.MeshSubsets, desc.FrameDepth, desc.AnimationKeys );
+    str += strLine;
+
+    str += "  \"phases\": [\n";
+    for( size_t i = 0; i < phases.size(); ++i )
+    {
+        const BenchPhase& phase = phases[i];
+        sprintf_s( strLine, 1024, "    { \"name\": \"%s\", \"files\": %u, \"bytes\": %llu,\n",
+                   phase.strName, UINT( phase.Files.size() ), phase.Bytes );
+        str += strLine;
+        AppendBenchResult( str, "cold", phase, phase.Cold, 1, desc.WarmIterations == 0 );
+        if( desc.WarmIterations )
+            AppendBenchResult( str, "warm", phase, phase.Warm, desc.WarmIterations, true );
+        str += ( i + 1 < phases.size() ) ? "    },\n" : "    }\n";
+    }
+    str += "  ],\n  \"conversion\": [\n";
+    for( size_t i = 0; i < conversions.size(); ++i )
+    {
+        const BenchConversion& conversion = conversions[i];
+        sprintf_s( strLine, 1024, "    { \"layout\": \"%s\", \"bytes\": %llu, \"scalarMegabytesPerSecond\": %.2f, \"kernelMegabytesPerSecond\": %.2f, \"parallelMegabytesPerSecond\": %.2f, \"matchesScalar\": %s }%s\n",
+                   conversion.strName, conversion.Bytes,
+                   BenchMegabytesPerSecond( conversion.Bytes, conversion.ScalarSeconds ),
+                   BenchMegabytesPerSecond( conversion.Bytes, conversion.KernelSeconds ),
+                   BenchMegabytesPerSecond( conversion.Bytes, conversion.ParallelSeconds ),
+                   conversion.bMatchesScalar ? "true" : "false", ( i + 1 < conversions.size() ) ? "," : "" );
+        str += strLine;
+    }
+    str += "  ],\n  \"skinning\": ";
+
+    // Times are per iteration, over every mesh in the file
+    if( pSkinning )
+    {
+        str += "{ \"mesh\": ";
+        AppendBenchJsonString( str, desc.SkinningMesh );
+        sprintf_s( strLine, 1024, ", \"bones\": %u, \"iterations\": %u, \"transformMeshMicroseconds\": %.3f, \"perInfluenceMicroseconds\": %.3f, \"perInfluenceUploadMicroseconds\": %.3f, \"matchesPerInfluence\": %s,\n    \"formats\": [\n",
+                   pSkinning->Bones, desc.SkinningIterations,
+                   BenchMicroseconds( pSkinning->TransformSeconds ),
+                   BenchMicroseconds( pSkinning->PerInfluenceSeconds ),
+                   BenchMicroseconds( pSkinning->PerInfluenceUploadSeconds ),
+                   pSkinning->bMatchesPerInfluence ? "true" : "false" );
+        str += strLine;
+        for( size_t i = 0; i < pSkinning->Formats.size(); ++i )
+        {
+            const BenchPaletteFormat& format = pSkinning->Formats[i];
+            sprintf_s( strLine, 1024, "      { \"format\": \"%s\", \"bytesPerBone\": %u, \"paletteMicroseconds\": %.3f, \"uploadMicroseconds\": %.3f }%s\n",
+                       format.strName, CDXUTSDKMesh::GetPaletteStride( format.Format ),
+                       BenchMicroseconds( format.PaletteSeconds ), BenchMicroseconds( format.UploadSeconds ),
+                       ( i + 1 < pSkinning->Formats.size() ) ? "," : "" );
+            str += strLine;
+        }
+        str += "    ] }\n}\n";
+    }
+    else
+    {
+        str += "null\n}\n";
+    }
+
+    HANDLE hFile = CreateFileW( szReportFile, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr );
+    if( hFile == INVALID_HANDLE_VALUE )
+        return HRESULT_FROM_WIN32( GetLastError() );
+
+    DWORD dwWritten = 0;
+    BOOL bWritten = WriteFile( hFile, str.c_str(), DWORD( str.length() ), &dwWritten, nullptr );
+    CloseHandle( hFile );
+
+    return ( bWritten && dwWritten == str.length() ) ? S_OK : E_FAIL;
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void WINAPI DXUTGetDefaultAssetBenchmarkDesc( DXUT_ASSET_BENCHMARK_DESC* pDesc, UINT nScale )
+{
+    if( !pDesc )
+        return;
+
+    nScale = std::max<UINT>( nScale, 1 );
+
+    pDesc->NumSmallTextures = 256 * nScale;
+    pDesc->SmallTextureSize = 64;
+    pDesc->NumArrayTextures = 2 * nScale;
+    pDesc->ArrayTextureSize = 1024;
+    pDesc->ArraySize = 16;
+    pDesc->NumLegacyTextures = 6 * nScale;
+    pDesc->LegacyTextureSize = 1024;
+    pDesc->NumCubeMaps = 8 * nScale;
+    pDesc->CubeMapSize = 256;
+    pDesc->NumVolumeTextures = 8 * nScale;
+    pDesc->VolumeTextureSize = 128;
+    pDesc->NumImages = 64 * nScale;
+    pDesc->ImageSize = 256;
+    pDesc->NumMeshes = 16 * nScale;
+    pDesc->MeshVertices = 16384;
+    pDesc->MeshSubsets = 8;
+    pDesc->FrameDepth = 256;
+    pDesc->AnimationKeys = 120;
+    pDesc->SkinningMesh = L"Tiny\\tiny.sdkmesh";
+    pDesc->SkinningIterations = 1000;
+    pDesc->WarmIterations = 3;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+bool WINAPI DXUTGetAssetBenchmarkArgs( WCHAR* strReport, size_t cchReport, UINT* pnScale )
+{
+    if( strReport && cchReport )
+        *strReport = 0;
+    if( pnScale )
+        *pnScale = 1;
+
+    int nArgs = 0;
+    LPWSTR* pArgs = CommandLineToArgvW( GetCommandLineW(), &nArgs );
+    if( !pArgs )
+        return false;
+
+    // Same syntax as the DXUT flags: -flag or /flag, with :param
+    bool bFound = false;
+    for( int iArg = 1; iArg < nArgs; ++iArg )
+    {
+        LPCWSTR strArg = pArgs[iArg];
+        if( *strArg != L'-' && *strArg != L'/' )
+            continue;
+        ++strArg;
+
+        LPCWSTR strParam = wcschr( strArg, L':' );
+        size_t nName = strParam ? size_t( strParam - strArg ) : wcslen( strArg );
+        if( strParam )
+            ++strParam;
+
+        if( nName == 14 && _wcsnicmp( strArg, L"assetbenchmark", nName ) == 0 )
+        {
+            bFound = true;
+            if( strReport && cchReport )
+                wcscpy_s( strReport, cchReport, ( strParam && *strParam ) ? strParam : L"assetbenchmark.json" );
+        }
+        else if( nName == 19 && _wcsnicmp( strArg, L"assetbenchmarkscale", nName ) == 0 && strParam )
+        {
+            if( pnScale )
+                *pnScale = UINT( std::max( _wtoi( strParam ), 1 ) );
+        }
+    }
+
+    LocalFree( pArgs );
+    return bFound;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT WINAPI DXUTRunAssetBenchmark( ID3D11Device* pd3dDevice, ID3D11DeviceContext* pd3dImmediateContext,
+                                      const DXUT_ASSET_BENCHMARK_DESC* pDesc, LPCWSTR szCorpusDir, LPCWSTR szReportFile )
+{
+    if( !pd3dDevice || !pd3dImmediateContext || !pDesc || !szCorpusDir || !szReportFile )
+        return E_INVALIDARG;
+
+    HRESULT hr;
+    const DXUT_ASSET_BENCHMARK_DESC& desc = *pDesc;
+    std::wstring strDir = szCorpusDir;
+    V_RETURN( CreateBenchDirectory( strDir.c_str() ) );
+    V_RETURN( CreateBenchDirectory( ( strDir + L"\\Textures" ).c_str() ) );
+    V_RETURN( CreateBenchDirectory( ( strDir + L"\\Images" ).c_str() ) );
+    V_RETURN( CreateBenchDirectory( ( strDir + L"\\Meshes" ).c_str() ) );
+
+    // Copies of the small textures and the meshes are packed into archives, stored and
+    // compressed, to compare with loading them as loose files
+    std::wstring strPackDir = strDir + L"\\Packed";
+    V_RETURN( CreateBenchDirectory( strPackDir.c_str() ) );
+    V_RETURN( CreateBenchDirectory( ( strPackDir + L"\\Textures" ).c_str() ) );
+    V_RETURN( CreateBenchDirectory( ( strPackDir + L"\\Meshes" ).c_str() ) );
+
+    // Largest files last, so the peak working set of the earlier phases stays visible
+    std::vector<BenchPhase> phases;
+    phases.push_back( BenchPhase( "ddsSmall", BENCH_LOADER_DDS ) );
+    phases.push_back( BenchPhase( "wic", BENCH_LOADER_WIC ) );
+    phases.push_back( BenchPhase( "resourceCache", BENCH_LOADER_RESOURCE_CACHE ) );
+    phases.push_back( BenchPhase( "ddsVolume", BENCH_LOADER_DDS ) );
+    phases.push_back( BenchPhase( "ddsCube", BENCH_LOADER_DDS ) );
+    phases.push_back( BenchPhase( "ddsLegacy", BENCH_LOADER_DDS ) );
+    phases.push_back( BenchPhase( "sdkmesh", BENCH_LOADER_SDKMESH ) );
+    phases.push_back( BenchPhase( "sdkmeshAnimation", BENCH_LOADER_ANIMATION ) );
+    phases.push_back( BenchPhase( "archiveStored", BENCH_LOADER_ARCHIVE ) );
+    phases.push_back( BenchPhase( "archiveLZ4", BENCH_LOADER_ARCHIVE ) );
+    phases.push_back( BenchPhase( "ddsArray", BENCH_LOADER_DDS ) );
+    BenchPhase& small = phases[0];
+    BenchPhase& images = phases[1];
+    BenchPhase& cache = phases[2];
+    BenchPhase& volumes = phases[3];
+    BenchPhase& cubes = phases[4];
+    BenchPhase& legacy = phases[5];
+    BenchPhase& meshes = phases[6];
+    BenchPhase& animations = phases[7];
+    BenchPhase& stored = phases[8];
+    BenchPhase& compressed = phases[9];
+    BenchPhase& arrays = phases[10];
+
+    LONGLONG llStart = DXUTGetTimestamp();
+
+    BenchRandom rng;
+    std::vector<BYTE> file;
+    WCHAR strFile[MAX_PATH];
+    for( UINT i = 0; i < desc.NumSmallTextures; ++i )
+    {
+        bool bBC = ( i & 1 ) != 0;
+        BuildBenchDDS( file, bBC ? DXGI_FORMAT_BC1_UNORM : DXGI_FORMAT_R8G8B8A8_UNORM,
+                       desc.SmallTextureSize, desc.SmallTextureSize, 1, 1, false, false, rng );
+        swprintf_s( strFile, MAX_PATH, L"%ls\\Textures\\small_%04u.dds", szCorpusDir, i );
+        V_RETURN( AddBenchFile( small, strFile, file ) );
+        swprintf_s( strFile, MAX_PATH, L"Textures\\small_%04u.dds", i );
+        V_RETURN( AddBenchPackedFile( stored, strPackDir, strFile, file ) );
+    }
+
+    for( UINT i = 0; i < desc.NumArrayTextures; ++i )
+    {
+        BuildBenchDDS( file, DXGI_FORMAT_BC3_UNORM, desc.ArrayTextureSize, desc.ArrayTextureSize, 1,
+                       std::max<UINT>( desc.ArraySize, 1 ), false, true, rng );
+        swprintf_s( strFile, MAX_PATH, L"%ls\\Textures\\array_%04u.dds", szCorpusDir, i );
+        V_RETURN( AddBenchFile( arrays, strFile, file ) );
+    }
+
+    for( UINT i = 0; i < desc.NumCubeMaps; ++i )
+    {
+        BuildBenchDDS( file, DXGI_FORMAT_R8G8B8A8_UNORM, desc.CubeMapSize, desc.CubeMapSize, 1, 1, true, false, rng );
+        swprintf_s( strFile, MAX_PATH, L"%ls\\Textures\\cube_%04u.dds", szCorpusDir, i );
+        V_RETURN( AddBenchFile( cubes, strFile, file ) );
+    }
+
+    for( UINT i = 0; i < desc.NumLegacyTextures; ++i )
+    {
+        BuildBenchLegacyDDS( file, g_BenchLegacyLayouts[ i % _countof( g_BenchLegacyLayouts ) ], desc.LegacyTextureSize, rng );
+        swprintf_s( strFile, MAX_PATH, L"%ls\\Textures\\legacy_%04u.dds", szCorpusDir, i );
+        V_RETURN( AddBenchFile( legacy, strFile, file ) );
+    }
+
+    for( UINT i = 0; i < desc.NumVolumeTextures; ++i )
+    {
+        BuildBenchDDS( file, DXGI_FORMAT_BC1_UNORM, desc.VolumeTextureSize, desc.VolumeTextureSize, desc.VolumeTextureSize,
+                       1, false, true, rng );
+        swprintf_s( strFile, MAX_PATH, L"%ls\\Textures\\volume_%04u.dds", szCorpusDir, i );
+        V_RETURN( AddBenchFile( volumes, strFile, file ) );
+    }
+
+    for( UINT i = 0; i < desc.NumImages; ++i )
+    {
+        BuildBenchBMP( file, desc.ImageSize, rng );
+        swprintf_s( strFile, MAX_PATH, L"%ls\\Images\\image_%04u.bmp", szCorpusDir, i );
+        V_RETURN( AddBenchFile( images, strFile, file ) );
+    }
+
+    for( UINT i = 0; i < desc.NumMeshes; ++i )
+    {
+        BuildBenchSDKMesh( file, desc.MeshVertices, desc.MeshSubsets, desc.FrameDepth );
+        swprintf_s( strFile, MAX_PATH, L"%ls\\Meshes\\mesh_%04u.sdkmesh", szCorpusDir, i );
+        V_RETURN( AddBenchFile( meshes, strFile, file ) );
+        swprintf_s( strFile, MAX_PATH, L"Meshes\\mesh_%04u.sdkmesh", i );
+        V_RETURN( AddBenchPackedFile( stored, strPackDir, strFile, file ) );
+
+        BuildBenchSDKMeshAnimation( file, desc.FrameDepth, desc.AnimationKeys );
+        swprintf_s( strFile, MAX_PATH, L"%ls\\Meshes\\mesh_%04u.sdkmesh_anim", szCorpusDir, i );
+        V_RETURN( AddBenchFile( animations, strFile, file ) );
+    }
+
+    // The resource cache sees both texture loaders, every file once per pass
+    cache.Files = small.Files;
+    cache.Files.insert( cache.Files.end(), images.Files.cbegin(), images.Files.cend() );
+    cache.Bytes = small.Bytes + images.Bytes;
+
+    if( !stored.Files.empty() )
+    {
+        stored.strArchive = strDir + L"\\packed_stored.dxar";
+        V_RETURN( DXUTCreateArchive( stored.strArchive.c_str(), strPackDir.c_str(), 0 ) );
+
+        compressed.Files = stored.Files;
+        compressed.Bytes = stored.Bytes;
+        compressed.strArchive = strDir + L"\\packed_lz4.dxar";
+        V_RETURN( DXUTCreateArchive( compressed.strArchive.c_str(), strPackDir.c_str(), DXUT_ARCHIVE_COMPRESS ) );
+    }
+
+    double fGenerateSeconds = DXUTTimestampToSeconds( DXUTGetTimestamp() - llStart );
+
+#if defined(DEBUG) || defined(_DEBUG)
+    g_pfnBenchPreviousAllocHook = _CrtSetAllocHook( BenchAllocHook );
+#endif
+
+    for( auto it = phases.begin(); it != phases.end(); ++it )
+    {
+        if( it->Files.empty() )
+            continue;
+
+        PurgeBenchFiles( *it );
+        if( it->Loader == BENCH_LOADER_RESOURCE_CACHE )
+            DXUTGetGlobalResourceCache().OnDestroyDevice();
+
+        // Only the phase's own archive is searched, so its loads cannot fall back to
+        // another archive or to the loose copies
+        if( !it->strArchive.empty() )
+        {
+            DXUTUnmountArchives();
+            hr = DXUTMountArchive( it->strArchive.c_str() );
+            if( FAILED( hr ) )
+            {
+                it->Cold.Failures = UINT( it->Files.size() );
+                continue;
+            }
+        }
+
+        RunBenchPass( *it, pd3dDevice, pd3dImmediateContext, it->Cold );
+        for( UINT i = 0; i < desc.WarmIterations; ++i )
+            RunBenchPass( *it, pd3dDevice, pd3dImmediateContext, it->Warm );
+
+        if( !it->strArchive.empty() )
+            DXUTUnmountArchives();
+
+        DXUTOutputDebugString( L"DXUT: asset benchmark %hs, %u files, cold %.3f ms, warm %.3f ms, %u failures\n",
+                               it->strName, UINT( it->Files.size() ), it->Cold.Seconds * 1000.0,
+                               desc.WarmIterations ? it->Warm.Seconds * 1000.0 / double( desc.WarmIterations ) : 0.0,
+                               it->Cold.Failures + it->Warm.Failures );
+    }
+
+#if defined(DEBUG) || defined(_DEBUG)
+    _CrtSetAllocHook( g_pfnBenchPreviousAllocHook );
+    g_pfnBenchPreviousAllocHook = nullptr;
+#endif
+
+    BenchSkinning skinning;
+    bool bSkinning = false;
+    if( desc.SkinningMesh && desc.SkinningIterations )
+    {
+        hr = RunSkinningBench( pd3dDevice, pd3dImmediateContext, desc.SkinningMesh, desc.SkinningIterations, skinning );
+        if( FAILED( hr ) )
+        {
+            DXUTOutputDebugString( L"DXUT: skinning benchmark could not load %ls (%08X)\n", desc.SkinningMesh, hr );
+        }
+        else
+        {
+            bSkinning = true;
+            DXUTOutputDebugString( L"DXUT: skinning %ls, %u bones, per influence %.3f us, palette %.3f us%ls\n",
+                                   desc.SkinningMesh, skinning.Bones, BenchMicroseconds( skinning.PerInfluenceSeconds ),
+                                   skinning.Formats.empty() ? 0.0 : BenchMicroseconds( skinning.Formats[0].PaletteSeconds ),
+                                   skinning.bMatchesPerInfluence ? L"" : L", DOES NOT MATCH THE PER-INFLUENCE MATRICES" );
+        }
+    }
+
+    DXUTGetGlobalResourceCache().OnDestroyDevice();
+
+    std::vector<BenchConversion> conversions;
+    RunConversionBench( desc.LegacyTextureSize, desc.WarmIterations + 1, conversions );
+    for( auto it = conversions.cbegin(); it != conversions.cend(); ++it )
+    {
+        DXUTOutputDebugString( L"DXUT: legacy conversion %hs, scalar %.3f ms, kernel %.3f ms, parallel %.3f ms%ls\n",
+                               it->strName, it->ScalarSeconds * 1000.0, it->KernelSeconds * 1000.0, it->ParallelSeconds * 1000.0,
+                               it->bMatchesScalar ? L"" : L", DOES NOT MATCH THE SCALAR REFERENCE" );
+    }
+
+    // Drop the empty groups from the report
+    phases.erase( std::remove_if( phases.begin(), phases.end(), []( const BenchPhase& phase ) { return phase.Files.empty(); } ),
+                  phases.end() );
+
+    DXUTOutputDebugString( L"DXUT: asset benchmark corpus generated in %.3f s\n", fGenerateSeconds );
+
+    return WriteBenchReport( szReportFile, desc, phases, conversions, bSkinning ? &skinning : nullptr );
+}
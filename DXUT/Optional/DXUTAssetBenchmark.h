@@ -0,0 +1,96 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTAssetBenchmark.h
+//
+// Generates a corpus of DDS, BMP, SDKmesh and SDKmesh animation files and times the DXUT
+// loaders on it, cold and warm, writing a JSON report with throughput, peak working set
+// and CRT allocation counts per loader and file shape.  The small textures and meshes are
+// also packed into a stored and a compressed archive and timed loading from each.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+//--------------------------------------------------------------------------------------
+// Corpus shape.  Each group of files is timed as its own phase, so a regression in one
+// shape is not hidden by the others.  A count of zero skips the group.
+//--------------------------------------------------------------------------------------
+struct DXUT_ASSET_BENCHMARK_DESC
+{
+    // Many small files: full mip chains, alternating legacy R8G8B8A8 and DXT1 headers
+    UINT NumSmallTextures;
+    UINT SmallTextureSize;
+
+    // Huge arrays: BC3 2D arrays with mips, through the DX10 header
+    UINT NumArrayTextures;
+    UINT ArrayTextureSize;
+    UINT ArraySize;
+
+    // Legacy masked layouts with no DXGI format, which load through the CPU conversion:
+    // 24-bit RGB, X1R5G5B5 and A4L4 in turn, with mips.  Also sizes the conversion kernel
+    // throughput test.
+    UINT NumLegacyTextures;
+    UINT LegacyTextureSize;
+
+    // Cube maps: R8G8B8A8 with mips, legacy header
+    UINT NumCubeMaps;
+    UINT CubeMapSize;
+
+    // 3D volumes: BC1 with mips, through the DX10 header
+    UINT NumVolumeTextures;
+    UINT VolumeTextureSize;
+
+    // WIC: 32 bpp BMPs
+    UINT NumImages;
+    UINT ImageSize;
+
+    // SDKmesh: a grid mesh under a chain of FrameDepth frames, plus an animation file
+    // with a key set for every frame
+    UINT NumMeshes;
+    UINT MeshVertices;
+    UINT MeshSubsets;
+    UINT FrameDepth;
+    UINT AnimationKeys;
+
+    // Skinning palettes: a skinned mesh found through the media search, timed building
+    // its palettes per influence and in one pass.  A null mesh skips the test.
+    LPCWSTR SkinningMesh;
+    UINT SkinningIterations;
+
+    // Warm passes after the cold one; warm results are the mean
+    UINT WarmIterations;
+};
+
+// Defaults sized for a WARP device, with every file count multiplied by nScale
+void WINAPI DXUTGetDefaultAssetBenchmarkDesc( _Out_ DXUT_ASSET_BENCHMARK_DESC* pDesc, _In_ UINT nScale = 1 );
+
+// Reads the benchmark flags from the process command line:
+//      -assetbenchmark:file    times the asset loaders and writes a report to file (assetbenchmark.json if omitted)
+//      -assetbenchmarkscale:#  multiplies the number of files the benchmark generates (1 if omitted)
+// Returns false if -assetbenchmark was not given.
+bool WINAPI DXUTGetAssetBenchmarkArgs( _Out_writes_z_(cchReport) WCHAR* strReport, _In_ size_t cchReport, _Out_ UINT* pnScale );
+
+//--------------------------------------------------------------------------------------
+// Writes the corpus under szCorpusDir, which must be relative to the working directory so
+// the media search finds the meshes, then times the loaders and writes szReportFile.
+//
+// The cold pass runs after each file is opened unbuffered, which has the file system
+// drop its cached pages, and with the global resource cache emptied, so it measures cache
+// misses; the warm passes measure resource cache hits.  The global resource cache is left
+// empty on return.  Allocation counts come from the debug CRT and are only reported in
+// debug builds.  The legacy conversion kernels are also timed on their own against the
+// scalar reference, and the report says whether their output matched it.  So are the
+// skinning palettes of desc.SkinningMesh, which is loaded outside the corpus.
+//
+// The archive phases mount their archive alone, so any archive mounted by the caller is
+// unmounted on return.
+//--------------------------------------------------------------------------------------
+HRESULT WINAPI DXUTRunAssetBenchmark( _In_ ID3D11Device* pd3dDevice, _In_ ID3D11DeviceContext* pd3dImmediateContext,
+                                      _In_ const DXUT_ASSET_BENCHMARK_DESC* pDesc,
+                                      _In_z_ LPCWSTR szCorpusDir, _In_z_ LPCWSTR szReportFile );
@@ -0,0 +1,290 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTCameraBatch.h
+//
+// Builds the matrices of many views at once, such as the panes of a multi-view editor or
+// the faces of a set of cube map probes.  Inputs are kept structure-of-arrays so Update
+// computes four views per SIMD register instead of one view per FrameMove.  Needs only
+// DirectXMath, so the math can be tested and timed without Windows.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+
+#include <DirectXMath.h>
+
+struct DXUT_CAMERA_BATCH_RESULT
+{
+    DirectX::XMFLOAT4X4 mView;
+    DirectX::XMFLOAT4X4 mProj;
+    DirectX::XMFLOAT4X4 mViewProj;
+    DirectX::XMFLOAT4 Planes[6];            // Left, right, bottom, top, near, far; normalized, facing inward
+};
+
+class CDXUTCameraBatch
+{
+public:
+    CDXUTCameraBatch() : m_nViews( 0 ) {}
+
+    // Return the index of the (first) view added
+    uint32_t AddView( DirectX::FXMVECTOR vEyePt, DirectX::FXMVECTOR vLookatPt, DirectX::FXMVECTOR vUp,
+                      float fFOV, float fAspect, float fNearPlane, float fFarPlane );
+    uint32_t AddCubeMapViews( DirectX::FXMVECTOR vEyePt, float fNearPlane, float fFarPlane ); // Six views, D3D11_TEXTURECUBE_FACE order
+    void RemoveAllViews();
+
+    void SetViewParams( uint32_t iView, DirectX::FXMVECTOR vEyePt, DirectX::FXMVECTOR vLookatPt, DirectX::FXMVECTOR vUp );
+    void SetProjParams( uint32_t iView, float fFOV, float fAspect, float fNearPlane, float fFarPlane );
+
+    // Recomputes the results of every view
+    void Update();
+
+    uint32_t GetNumViews() const { return m_nViews; }
+    const DXUT_CAMERA_BATCH_RESULT& GetResult( uint32_t iView ) const { return m_Results[iView]; }
+
+private:
+    enum BATCH_INPUT
+    {
+        EYE_X = 0, EYE_Y, EYE_Z,
+        LOOKAT_X, LOOKAT_Y, LOOKAT_Z,
+        UP_X, UP_Y, UP_Z,
+        FOV, ASPECT, NEAR_PLANE, FAR_PLANE,
+        NUM_INPUTS
+    };
+
+    std::vector<float> m_Inputs[NUM_INPUTS];            // One array per input, padded to a multiple of four views
+    std::vector<DXUT_CAMERA_BATCH_RESULT> m_Results;
+    uint32_t m_nViews;
+};
+
+
+//--------------------------------------------------------------------------------------
+// Transposes four structure-of-arrays vectors back to one XMFLOAT4 per view
+//--------------------------------------------------------------------------------------
+inline void DXUTStoreCameraBatchTransposed( DirectX::FXMVECTOR a, DirectX::FXMVECTOR b, DirectX::FXMVECTOR c,
+                                            DirectX::GXMVECTOR d, uint8_t* pDest, size_t stride, uint32_t nViews )
+{
+    DirectX::XMMATRIX m = DirectX::XMMatrixTranspose( DirectX::XMMATRIX( a, b, c, d ) );
+    for( uint32_t k = 0; k < nViews; ++k )
+        DirectX::XMStoreFloat4( reinterpret_cast<DirectX::XMFLOAT4*>( pDest + k * stride ), m.r[k] );
+}
+
+inline void DXUTNormalizeCameraBatchPlanes( DirectX::XMVECTOR& a, DirectX::XMVECTOR& b, DirectX::XMVECTOR& c, DirectX::XMVECTOR& d )
+{
+    using namespace DirectX;
+
+    XMVECTOR invLength = XMVectorReciprocalSqrt( XMVectorMultiplyAdd( a, a, XMVectorMultiplyAdd( b, b, XMVectorMultiply( c, c ) ) ) );
+    a *= invLength;
+    b *= invLength;
+    c *= invLength;
+    d *= invLength;
+}
+
+
+//--------------------------------------------------------------------------------------
+inline uint32_t CDXUTCameraBatch::AddView( DirectX::FXMVECTOR vEyePt, DirectX::FXMVECTOR vLookatPt, DirectX::FXMVECTOR vUp,
+                                           float fFOV, float fAspect, float fNearPlane, float fFarPlane )
+{
+    uint32_t iView = m_nViews++;
+
+    // Pad with a valid view so the unused lanes never produce NaNs
+    if( ( iView & 3 ) == 0 )
+    {
+        static const float s_Padding[NUM_INPUTS] = { 0, 0, 0,  0, 0, 1,  0, 1, 0,  DirectX::XM_PIDIV4, 1, 1, 2 };
+        for( uint32_t i = 0; i < NUM_INPUTS; ++i )
+            m_Inputs[i].resize( iView + 4, s_Padding[i] );
+        m_Results.resize( iView + 4 );
+    }
+
+    SetViewParams( iView, vEyePt, vLookatPt, vUp );
+    SetProjParams( iView, fFOV, fAspect, fNearPlane, fFarPlane );
+    return iView;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Same orientations as DXUTGetCubeMapViewMatrix
+//--------------------------------------------------------------------------------------
+inline uint32_t CDXUTCameraBatch::AddCubeMapViews( DirectX::FXMVECTOR vEyePt, float fNearPlane, float fFarPlane )
+{
+    using namespace DirectX;
+
+    static const XMVECTORF32 s_vLookDir[6] =
+    {
+        { 1.0f, 0.0f, 0.0f, 0.0f },
+        { -1.0f, 0.0f, 0.0f, 0.0f },
+        { 0.0f, 1.0f, 0.0f, 0.0f },
+        { 0.0f, -1.0f, 0.0f, 0.0f },
+        { 0.0f, 0.0f, 1.0f, 0.0f },
+        { 0.0f, 0.0f, -1.0f, 0.0f },
+    };
+
+    static const XMVECTORF32 s_vUpDir[6] =
+    {
+        { 0.0f, 1.0f, 0.0f, 0.0f },
+        { 0.0f, 1.0f, 0.0f, 0.0f },
+        { 0.0f, 0.0f, -1.0f, 0.0f },
+        { 0.0f, 0.0f, 1.0f, 0.0f },
+        { 0.0f, 1.0f, 0.0f, 0.0f },
+        { 0.0f, 1.0f, 0.0f, 0.0f },
+    };
+
+    uint32_t iFirst = m_nViews;
+    for( uint32_t iFace = 0; iFace < 6; ++iFace )
+        AddView( vEyePt, vEyePt + s_vLookDir[iFace], s_vUpDir[iFace], XM_PIDIV2, 1.0f, fNearPlane, fFarPlane );
+    return iFirst;
+}
+
+
+//--------------------------------------------------------------------------------------
+inline void CDXUTCameraBatch::RemoveAllViews()
+{
+    for( uint32_t i = 0; i < NUM_INPUTS; ++i )
+        m_Inputs[i].clear();
+    m_Results.clear();
+    m_nViews = 0;
+}
+
+
+//--------------------------------------------------------------------------------------
+inline void CDXUTCameraBatch::SetViewParams( uint32_t iView, DirectX::FXMVECTOR vEyePt, DirectX::FXMVECTOR vLookatPt, DirectX::FXMVECTOR vUp )
+{
+    using namespace DirectX;
+
+    assert( iView < m_nViews );
+
+    m_Inputs[EYE_X][iView] = XMVectorGetX( vEyePt );
+    m_Inputs[EYE_Y][iView] = XMVectorGetY( vEyePt );
+    m_Inputs[EYE_Z][iView] = XMVectorGetZ( vEyePt );
+    m_Inputs[LOOKAT_X][iView] = XMVectorGetX( vLookatPt );
+    m_Inputs[LOOKAT_Y][iView] = XMVectorGetY( vLookatPt );
+    m_Inputs[LOOKAT_Z][iView] = XMVectorGetZ( vLookatPt );
+    m_Inputs[UP_X][iView] = XMVectorGetX( vUp );
+    m_Inputs[UP_Y][iView] = XMVectorGetY( vUp );
+    m_Inputs[UP_Z][iView] = XMVectorGetZ( vUp );
+}
+
+
+//--------------------------------------------------------------------------------------
+inline void CDXUTCameraBatch::SetProjParams( uint32_t iView, float fFOV, float fAspect, float fNearPlane, float fFarPlane )
+{
+    assert( iView < m_nViews );
+
+    m_Inputs[FOV][iView] = fFOV;
+    m_Inputs[ASPECT][iView] = fAspect;
+    m_Inputs[NEAR_PLANE][iView] = fNearPlane;
+    m_Inputs[FAR_PLANE][iView] = fFarPlane;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Same results as XMMatrixLookAtLH, XMMatrixPerspectiveFovLH and their product, with each
+// vector holding one matrix element for four views
+//--------------------------------------------------------------------------------------
+inline void CDXUTCameraBatch::Update()
+{
+    using namespace DirectX;
+
+    const size_t stride = sizeof( DXUT_CAMERA_BATCH_RESULT );
+
+    for( uint32_t i = 0; i < m_nViews; i += 4 )
+    {
+        XMVECTOR in[NUM_INPUTS];
+        for( uint32_t j = 0; j < NUM_INPUTS; ++j )
+            in[j] = XMLoadFloat4( reinterpret_cast<const XMFLOAT4*>( &m_Inputs[j][i] ) );
+
+        // View axes
+        XMVECTOR zX = in[LOOKAT_X] - in[EYE_X];
+        XMVECTOR zY = in[LOOKAT_Y] - in[EYE_Y];
+        XMVECTOR zZ = in[LOOKAT_Z] - in[EYE_Z];
+        XMVECTOR invLength = XMVectorReciprocalSqrt( XMVectorMultiplyAdd( zX, zX, XMVectorMultiplyAdd( zY, zY, XMVectorMultiply( zZ, zZ ) ) ) );
+        zX *= invLength;
+        zY *= invLength;
+        zZ *= invLength;
+
+        XMVECTOR xX = XMVectorNegativeMultiplySubtract( in[UP_Z], zY, XMVectorMultiply( in[UP_Y], zZ ) );
+        XMVECTOR xY = XMVectorNegativeMultiplySubtract( in[UP_X], zZ, XMVectorMultiply( in[UP_Z], zX ) );
+        XMVECTOR xZ = XMVectorNegativeMultiplySubtract( in[UP_Y], zX, XMVectorMultiply( in[UP_X], zY ) );
+        invLength = XMVectorReciprocalSqrt( XMVectorMultiplyAdd( xX, xX, XMVectorMultiplyAdd( xY, xY, XMVectorMultiply( xZ, xZ ) ) ) );
+        xX *= invLength;
+        xY *= invLength;
+        xZ *= invLength;
+
+        XMVECTOR yX = XMVectorNegativeMultiplySubtract( zZ, xY, XMVectorMultiply( zY, xZ ) );
+        XMVECTOR yY = XMVectorNegativeMultiplySubtract( zX, xZ, XMVectorMultiply( zZ, xX ) );
+        XMVECTOR yZ = XMVectorNegativeMultiplySubtract( zY, xX, XMVectorMultiply( zX, xY ) );
+
+        XMVECTOR tX = -XMVectorMultiplyAdd( xX, in[EYE_X], XMVectorMultiplyAdd( xY, in[EYE_Y], XMVectorMultiply( xZ, in[EYE_Z] ) ) );
+        XMVECTOR tY = -XMVectorMultiplyAdd( yX, in[EYE_X], XMVectorMultiplyAdd( yY, in[EYE_Y], XMVectorMultiply( yZ, in[EYE_Z] ) ) );
+        XMVECTOR tZ = -XMVectorMultiplyAdd( zX, in[EYE_X], XMVectorMultiplyAdd( zY, in[EYE_Y], XMVectorMultiply( zZ, in[EYE_Z] ) ) );
+
+        // Projection terms
+        XMVECTOR sinFov, cosFov;
+        XMVectorSinCos( &sinFov, &cosFov, XMVectorScale( in[FOV], 0.5f ) );
+        XMVECTOR yScale = XMVectorDivide( cosFov, sinFov );
+        XMVECTOR xScale = XMVectorDivide( yScale, in[ASPECT] );
+        XMVECTOR range = XMVectorDivide( in[FAR_PLANE], in[FAR_PLANE] - in[NEAR_PLANE] );
+        XMVECTOR rangeNear = -XMVectorMultiply( range, in[NEAR_PLANE] );
+
+        // View-projection columns, the projection only scales and offsets
+        XMVECTOR vp00 = xX * xScale, vp01 = yX * yScale, vp02 = zX * range;
+        XMVECTOR vp10 = xY * xScale, vp11 = yY * yScale, vp12 = zY * range;
+        XMVECTOR vp20 = xZ * xScale, vp21 = yZ * yScale, vp22 = zZ * range;
+        XMVECTOR vp30 = tX * xScale, vp31 = tY * yScale, vp32 = XMVectorMultiplyAdd( tZ, range, rangeNear );
+
+        const XMVECTOR zero = XMVectorZero();
+        const XMVECTOR one = XMVectorSplatOne();
+        uint32_t nViews = std::min<uint32_t>( 4, m_nViews - i );
+        uint8_t* pResult = reinterpret_cast<uint8_t*>( &m_Results[i] );
+
+        DXUTStoreCameraBatchTransposed( xX, yX, zX, zero, pResult + offsetof( DXUT_CAMERA_BATCH_RESULT, mView.m[0] ), stride, nViews );
+        DXUTStoreCameraBatchTransposed( xY, yY, zY, zero, pResult + offsetof( DXUT_CAMERA_BATCH_RESULT, mView.m[1] ), stride, nViews );
+        DXUTStoreCameraBatchTransposed( xZ, yZ, zZ, zero, pResult + offsetof( DXUT_CAMERA_BATCH_RESULT, mView.m[2] ), stride, nViews );
+        DXUTStoreCameraBatchTransposed( tX, tY, tZ, one, pResult + offsetof( DXUT_CAMERA_BATCH_RESULT, mView.m[3] ), stride, nViews );
+
+        DXUTStoreCameraBatchTransposed( xScale, zero, zero, zero, pResult + offsetof( DXUT_CAMERA_BATCH_RESULT, mProj.m[0] ), stride, nViews );
+        DXUTStoreCameraBatchTransposed( zero, yScale, zero, zero, pResult + offsetof( DXUT_CAMERA_BATCH_RESULT, mProj.m[1] ), stride, nViews );
+        DXUTStoreCameraBatchTransposed( zero, zero, range, one, pResult + offsetof( DXUT_CAMERA_BATCH_RESULT, mProj.m[2] ), stride, nViews );
+        DXUTStoreCameraBatchTransposed( zero, zero, rangeNear, zero, pResult + offsetof( DXUT_CAMERA_BATCH_RESULT, mProj.m[3] ), stride, nViews );
+
+        DXUTStoreCameraBatchTransposed( vp00, vp01, vp02, zX, pResult + offsetof( DXUT_CAMERA_BATCH_RESULT, mViewProj.m[0] ), stride, nViews );
+        DXUTStoreCameraBatchTransposed( vp10, vp11, vp12, zY, pResult + offsetof( DXUT_CAMERA_BATCH_RESULT, mViewProj.m[1] ), stride, nViews );
+        DXUTStoreCameraBatchTransposed( vp20, vp21, vp22, zZ, pResult + offsetof( DXUT_CAMERA_BATCH_RESULT, mViewProj.m[2] ), stride, nViews );
+        DXUTStoreCameraBatchTransposed( vp30, vp31, vp32, tZ, pResult + offsetof( DXUT_CAMERA_BATCH_RESULT, mViewProj.m[3] ), stride, nViews );
+
+        // Frustum planes from the view-projection columns (Gribb and Hartmann)
+        const XMVECTOR col3[4] = { zX, zY, zZ, tZ };
+        const XMVECTOR col0[4] = { vp00, vp10, vp20, vp30 };
+        const XMVECTOR col1[4] = { vp01, vp11, vp21, vp31 };
+        const XMVECTOR col2[4] = { vp02, vp12, vp22, vp32 };
+
+        XMVECTOR planes[6][4];
+        for( uint32_t j = 0; j < 4; ++j )
+        {
+            planes[0][j] = col3[j] + col0[j];
+            planes[1][j] = col3[j] - col0[j];
+            planes[2][j] = col3[j] + col1[j];
+            planes[3][j] = col3[j] - col1[j];
+            planes[4][j] = col2[j];
+            planes[5][j] = col3[j] - col2[j];
+        }
+
+        for( uint32_t p = 0; p < 6; ++p )
+        {
+            DXUTNormalizeCameraBatchPlanes( planes[p][0], planes[p][1], planes[p][2], planes[p][3] );
+            DXUTStoreCameraBatchTransposed( planes[p][0], planes[p][1], planes[p][2], planes[p][3],
+                                            pResult + offsetof( DXUT_CAMERA_BATCH_RESULT, Planes ) + p * sizeof( XMFLOAT4 ), stride, nViews );
+        }
+    }
+}
@@ -0,0 +1,243 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTGapBuffer.h
+//
+// The gap buffer behind CUniBuffer.  Edits at the caret only move the characters between
+// the old and new edit position, and readers see the text as the two spans either side
+// of the gap, so drawing it every frame copies nothing.  Has no Windows dependency.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+#include <string.h>
+#include <wchar.h>
+#include <new>
+
+//--------------------------------------------------------------------------------------
+// The buffer holds the text before the gap, the gap, the text after it, then a nul that
+// nothing ever overwrites.  Character n of the text is at n before the gap and at n plus
+// the gap size after it, so the nul is at the text size either way.
+//--------------------------------------------------------------------------------------
+class CDXUTGapBuffer
+{
+public:
+    explicit CDXUTGapBuffer( int nMaxSize ) :
+        m_pBuffer( nullptr ), m_nBufferSize( 0 ), m_nMaxSize( nMaxSize ), m_nTextSize( 0 ), m_nGapStart( 0 ) {}
+    ~CDXUTGapBuffer() { delete[] m_pBuffer; }
+
+    int GetBufferSize() const { return m_nBufferSize; }
+    int GetTextSize() const { return m_nTextSize; }
+    int GetGapStart() const { return m_nGapStart; }
+
+    wchar_t operator[]( int n ) const { return m_pBuffer[ Offset( n ) ]; }
+    wchar_t& At( int n ) { return m_pBuffer[ Offset( n ) ]; }
+
+    //----------------------------------------------------------------------------------
+    // Grows to twice nNewSize, or doubles for -1, up to the maximum size.  The gap is at
+    // the end of the text afterwards, so it takes up all the new space.
+    //----------------------------------------------------------------------------------
+    bool SetBufferSize( int nNewSize )
+    {
+        // If the current size is already the maximum allowed,
+        // we can't possibly allocate more.
+        if( m_nBufferSize >= m_nMaxSize )
+            return false;
+
+        int nAllocateSize = ( nNewSize == -1 || nNewSize < m_nBufferSize * 2 ) ? ( m_nBufferSize ? m_nBufferSize * 2 : 256 )
+                                                                              : nNewSize * 2;
+        if( nAllocateSize > m_nMaxSize )
+            nAllocateSize = m_nMaxSize;
+
+        auto pNewBuffer = new (std::nothrow) wchar_t[ nAllocateSize ];
+        if( !pNewBuffer )
+            return false;
+
+        memset( pNewBuffer, 0, sizeof( wchar_t ) * nAllocateSize );
+
+        if( m_pBuffer )
+        {
+            memcpy( pNewBuffer, m_pBuffer, m_nGapStart * sizeof( wchar_t ) );
+            memcpy( pNewBuffer + m_nGapStart, m_pBuffer + m_nGapStart + GetGapSize(),
+                    ( m_nTextSize - m_nGapStart ) * sizeof( wchar_t ) );
+            delete[] m_pBuffer;
+        }
+
+        m_pBuffer = pNewBuffer;
+        m_nBufferSize = nAllocateSize;
+        m_nGapStart = m_nTextSize;
+        return true;
+    }
+
+    void Clear()
+    {
+        m_nTextSize = 0;
+        m_nGapStart = 0;
+        if( m_pBuffer )
+            *m_pBuffer = L'\0';
+    }
+
+    // The new characters fill the front of the gap
+    bool InsertString( int nIndex, const wchar_t* pStr, int nCount )
+    {
+        if( nIndex < 0 || nIndex > m_nTextSize || nCount < 0 )
+            return false;
+
+        if( m_nTextSize + nCount >= m_nMaxSize )
+            return false;
+
+        if( m_nTextSize + nCount >= m_nBufferSize )
+        {
+            if( !SetBufferSize( m_nTextSize + nCount + 1 ) )
+                return false;  // out of memory
+        }
+
+        MoveGap( nIndex );
+        memcpy( m_pBuffer + nIndex, pStr, nCount * sizeof( wchar_t ) );
+        m_nGapStart += nCount;
+        m_nTextSize += nCount;
+        return true;
+    }
+
+    // Removing the characters just after the gap widens it
+    bool RemoveString( int nIndex, int nCount )
+    {
+        if( !m_nTextSize || nIndex < 0 || nCount <= 0 || nIndex + nCount > m_nTextSize )
+            return false;
+
+        MoveGap( nIndex );
+        m_nTextSize -= nCount;
+        return true;
+    }
+
+    bool SetText( const wchar_t* wszText )
+    {
+        size_t nRequired = wcslen( wszText ) + 1;
+        if( nRequired >= size_t( m_nMaxSize ) )
+            return false;
+
+        while( size_t( m_nBufferSize ) < nRequired )
+        {
+            if( !SetBufferSize( -1 ) )
+                return false;
+        }
+
+        memcpy( m_pBuffer, wszText, nRequired * sizeof( wchar_t ) );
+        m_nTextSize = int( nRequired - 1 );
+        m_nGapStart = m_nTextSize;
+        return true;
+    }
+
+    //----------------------------------------------------------------------------------
+    // The text from nFirst on, as the span before the gap and the span after it.  Either
+    // may be empty.  Nothing is copied or moved.
+    //----------------------------------------------------------------------------------
+    void GetSpans( int nFirst, const wchar_t** ppFirst, int* pnFirst, const wchar_t** ppSecond, int* pnSecond ) const
+    {
+        if( nFirst < 0 )
+            nFirst = 0;
+        if( nFirst > m_nTextSize )
+            nFirst = m_nTextSize;
+
+        if( !m_pBuffer )
+        {
+            *ppFirst = *ppSecond = nullptr;
+            *pnFirst = *pnSecond = 0;
+            return;
+        }
+
+        const wchar_t* pAfterGap = m_pBuffer + m_nGapStart + GetGapSize();
+        if( nFirst < m_nGapStart )
+        {
+            *ppFirst = m_pBuffer + nFirst;
+            *pnFirst = m_nGapStart - nFirst;
+            *ppSecond = pAfterGap;
+            *pnSecond = m_nTextSize - m_nGapStart;
+        }
+        else
+        {
+            *ppFirst = pAfterGap + ( nFirst - m_nGapStart );
+            *pnFirst = m_nTextSize - nFirst;
+            *ppSecond = m_pBuffer + m_nBufferSize - 1;
+            *pnSecond = 0;
+        }
+    }
+
+    //----------------------------------------------------------------------------------
+    // nCount characters from nStart in one piece, where character m_nTextSize is the
+    // nul.  Ranges already on one side of the gap are returned in place.  Otherwise the
+    // gap is moved to nStart, shifting only the characters of the range before it.
+    //----------------------------------------------------------------------------------
+    const wchar_t* GetContiguous( int nStart, int nCount )
+    {
+        if( !m_pBuffer )
+            return nullptr;
+
+        int nEnd = nStart + nCount;
+        if( nEnd <= m_nGapStart )
+            return m_pBuffer + nStart;
+
+        // With the gap at the end its first character can stand in for the nul
+        if( m_nGapStart == m_nTextSize && nEnd == m_nTextSize + 1 )
+        {
+            m_pBuffer[ m_nTextSize ] = L'\0';
+            return m_pBuffer + nStart;
+        }
+
+        if( nStart < m_nGapStart )
+            MoveGap( nStart );
+        return m_pBuffer + nStart + GetGapSize();
+    }
+
+    //----------------------------------------------------------------------------------
+    // The whole text, nul terminated, with the gap moved to the end to get it.  The next
+    // edit at the caret moves the gap back, so per-frame readers use GetSpans instead.
+    //----------------------------------------------------------------------------------
+    const wchar_t* GetBuffer() const
+    {
+        if( !m_pBuffer )
+            return nullptr;
+
+        MoveGap( m_nTextSize );
+        m_pBuffer[ m_nTextSize ] = L'\0';
+        return m_pBuffer;
+    }
+
+private:
+    CDXUTGapBuffer( const CDXUTGapBuffer& );
+    CDXUTGapBuffer& operator=( const CDXUTGapBuffer& );
+
+    int GetGapSize() const { return m_nBufferSize - m_nTextSize - 1; }
+    int Offset( int n ) const { return ( n < m_nGapStart ) ? n : n + GetGapSize(); }
+
+    // Moves the gap so it starts at nIndex.  The text is unchanged, so readers that only
+    // have const access may move it too.
+    void MoveGap( int nIndex ) const
+    {
+        int nGap = GetGapSize();
+        if( nIndex == m_nGapStart || !m_pBuffer )
+            return;
+
+        if( nGap > 0 )
+        {
+            if( nIndex < m_nGapStart )
+                memmove( m_pBuffer + nIndex + nGap, m_pBuffer + nIndex, ( m_nGapStart - nIndex ) * sizeof( wchar_t ) );
+            else
+                memmove( m_pBuffer + m_nGapStart, m_pBuffer + m_nGapStart + nGap, ( nIndex - m_nGapStart ) * sizeof( wchar_t ) );
+        }
+
+        m_nGapStart = nIndex;
+    }
+
+    wchar_t* m_pBuffer;
+    int m_nBufferSize;          // Size of the buffer allocated, in characters
+    int m_nMaxSize;
+    int m_nTextSize;            // Length of the text, excluding the nul terminator
+    mutable int m_nGapStart;    // First character of the gap
+};
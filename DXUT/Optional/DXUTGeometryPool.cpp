@@ -0,0 +1,356 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTGeometryPool.cpp
+//
+// Shared vertex and index buffer pages for many meshes
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUT.h"
+#include "DXUTGeometryPool.h"
+
+namespace
+{
+
+void FinishStats( _Inout_ DXUT_GEOMETRY_POOL_STATS* pStats )
+{
+    UINT64 nFree = pStats->CapacityBytes - pStats->UsedBytes;
+    pStats->Occupancy = pStats->CapacityBytes ? float( double( pStats->UsedBytes ) / double( pStats->CapacityBytes ) ) : 0.0f;
+    pStats->Fragmentation = nFree ? 1.0f - float( double( pStats->LargestFreeBytes ) / double( nFree ) ) : 0.0f;
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+CDXUTGeometryPool::CDXUTGeometryPool() :
+    m_pd3dDevice( nullptr ),
+    m_pd3dImmediateContext( nullptr ),
+    m_nPageBytes( DXUT_GEOMETRY_POOL_DEFAULT_PAGE_BYTES ),
+    m_nGeneration( 0 )
+{
+}
+
+
+//--------------------------------------------------------------------------------------
+CDXUTGeometryPool::~CDXUTGeometryPool()
+{
+    OnD3D11DestroyDevice();
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTGeometryPool::OnD3D11CreateDevice( ID3D11Device* pd3dDevice, ID3D11DeviceContext* pd3dImmediateContext,
+                                                UINT nPageBytes )
+{
+    if( !pd3dDevice || !pd3dImmediateContext || !nPageBytes )
+        return E_INVALIDARG;
+
+    OnD3D11DestroyDevice();
+
+    m_pd3dDevice = pd3dDevice;
+    m_pd3dDevice->AddRef();
+    m_pd3dImmediateContext = pd3dImmediateContext;
+    m_pd3dImmediateContext->AddRef();
+    m_nPageBytes = nPageBytes;
+
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Meshes hold their own references on the pages they use, so the buffers live until
+// those meshes are destroyed too
+//--------------------------------------------------------------------------------------
+void CDXUTGeometryPool::OnD3D11DestroyDevice()
+{
+    for( auto it = m_Pages.begin(); it != m_Pages.end(); ++it )
+        SAFE_RELEASE( it->pBuffer );
+    m_Pages.clear();
+    m_Groups.clear();
+    ++m_nGeneration;
+
+    SAFE_RELEASE( m_pd3dImmediateContext );
+    SAFE_RELEASE( m_pd3dDevice );
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTGeometryPool::AllocateVertices( UINT nStride, UINT nVertices, const void* pData, DXUT_GEOMETRY_ALLOCATION* pAllocation )
+{
+    return Allocate( D3D11_BIND_VERTEX_BUFFER, nStride, DXGI_FORMAT_UNKNOWN, nVertices, pData, pAllocation );
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTGeometryPool::AllocateIndices( DXGI_FORMAT format, UINT nIndices, const void* pData, DXUT_GEOMETRY_ALLOCATION* pAllocation )
+{
+    UINT nStride;
+    switch( format )
+    {
+    case DXGI_FORMAT_R16_UINT:  nStride = 2; break;
+    case DXGI_FORMAT_R32_UINT:  nStride = 4; break;
+    default:
+        ZeroMemory( pAllocation, sizeof( DXUT_GEOMETRY_ALLOCATION ) );
+        return E_INVALIDARG;
+    }
+
+    return Allocate( D3D11_BIND_INDEX_BUFFER, nStride, format, nIndices, pData, pAllocation );
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTGeometryPool::Allocate( UINT BindFlags, UINT nStride, DXGI_FORMAT format, UINT nCount,
+                                     const void* pData, DXUT_GEOMETRY_ALLOCATION* pAllocation )
+{
+    ZeroMemory( pAllocation, sizeof( DXUT_GEOMETRY_ALLOCATION ) );
+
+    if( !nStride || !nCount || UINT64( nStride ) * nCount > UINT_MAX )
+        return E_INVALIDARG;
+
+    if( !m_pd3dDevice )
+        return E_FAIL;
+
+    UINT iGroup = 0;
+    while( iGroup < m_Groups.size()
+           && ( m_Groups[iGroup].BindFlags != BindFlags || m_Groups[iGroup].Stride != nStride || m_Groups[iGroup].Format != format ) )
+        ++iGroup;
+
+    if( iGroup == m_Groups.size() )
+    {
+        Group group;
+        group.BindFlags = BindFlags;
+        group.Stride = nStride;
+        group.Format = format;
+        m_Groups.push_back( group );
+    }
+
+    // Best fit over the group's pages keeps the large ranges whole for large meshes
+    UINT iBestPage = UINT( -1 );
+    size_t iBestRange = 0;
+    UINT nBestCount = UINT_MAX;
+    const Group& group = m_Groups[iGroup];
+    for( auto it = group.Pages.cbegin(); it != group.Pages.cend(); ++it )
+    {
+        const Page& page = m_Pages[*it];
+        for( size_t i = 0; i < page.FreeRanges.size(); ++i )
+        {
+            UINT nRangeCount = page.FreeRanges[i].Count;
+            if( nRangeCount >= nCount && ( iBestPage == UINT( -1 ) || nRangeCount < nBestCount ) )
+            {
+                iBestPage = *it;
+                iBestRange = i;
+                nBestCount = nRangeCount;
+            }
+        }
+    }
+
+    if( iBestPage == UINT( -1 ) )
+    {
+        Page page;
+        page.iGroup = iGroup;
+        page.nElements = std::max<UINT>( m_nPageBytes / nStride, nCount );
+        page.nAllocations = 0;
+        page.pBuffer = nullptr;
+
+        D3D11_BUFFER_DESC bufferDesc;
+        bufferDesc.ByteWidth = page.nElements * nStride;
+        bufferDesc.Usage = D3D11_USAGE_DEFAULT;
+        bufferDesc.BindFlags = BindFlags;
+        bufferDesc.CPUAccessFlags = 0;
+        bufferDesc.MiscFlags = 0;
+        bufferDesc.StructureByteStride = 0;
+
+        HRESULT hr;
+        V_RETURN( m_pd3dDevice->CreateBuffer( &bufferDesc, nullptr, &page.pBuffer ) );
+        DXUT_SetDebugName( page.pBuffer, "CDXUTGeometryPool" );
+
+        Range range;
+        range.Offset = 0;
+        range.Count = page.nElements;
+        page.FreeRanges.push_back( range );
+
+        iBestPage = UINT( m_Pages.size() );
+        iBestRange = 0;
+        m_Pages.push_back( page );
+        m_Groups[iGroup].Pages.push_back( iBestPage );
+    }
+
+    Page& page = m_Pages[iBestPage];
+    Range& range = page.FreeRanges[iBestRange];
+    UINT nOffset = range.Offset;
+    range.Offset += nCount;
+    range.Count -= nCount;
+    if( !range.Count )
+        page.FreeRanges.erase( page.FreeRanges.begin() + iBestRange );
+    ++page.nAllocations;
+
+    if( pData )
+    {
+        D3D11_BOX box;
+        box.left = nOffset * nStride;
+        box.right = ( nOffset + nCount ) * nStride;
+        box.top = 0;
+        box.bottom = 1;
+        box.front = 0;
+        box.back = 1;
+        m_pd3dImmediateContext->UpdateSubresource( page.pBuffer, 0, &box, pData, 0, 0 );
+    }
+
+    pAllocation->pBuffer = page.pBuffer;
+    pAllocation->Page = iBestPage;
+    pAllocation->Offset = nOffset;
+    pAllocation->Count = nCount;
+    pAllocation->Generation = m_nGeneration;
+
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void CDXUTGeometryPool::Free( const DXUT_GEOMETRY_ALLOCATION& allocation )
+{
+    if( !allocation.pBuffer )
+        return;
+
+    // From pages released by OnD3D11DestroyDevice, whose buffer may have been reused
+    bool bStale = ( allocation.Generation != m_nGeneration || allocation.Page >= m_Pages.size()
+                    || m_Pages[allocation.Page].pBuffer != allocation.pBuffer );
+    assert( !bStale );
+    if( bStale )
+        return;
+
+    Page& page = m_Pages[allocation.Page];
+    auto it = page.FreeRanges.begin();
+    while( it != page.FreeRanges.end() && it->Offset < allocation.Offset )
+        ++it;
+
+    // Any overlap with a free range means the allocation was already freed
+    bool bFreed = ( !page.nAllocations || allocation.Offset + allocation.Count > page.nElements
+                    || ( it != page.FreeRanges.end() && it->Offset < allocation.Offset + allocation.Count )
+                    || ( it != page.FreeRanges.begin() && ( it - 1 )->Offset + ( it - 1 )->Count > allocation.Offset ) );
+    assert( !bFreed );
+    if( bFreed )
+        return;
+
+    bool bMergePrev = ( it != page.FreeRanges.begin() && ( it - 1 )->Offset + ( it - 1 )->Count == allocation.Offset );
+    bool bMergeNext = ( it != page.FreeRanges.end() && allocation.Offset + allocation.Count == it->Offset );
+
+    if( bMergePrev && bMergeNext )
+    {
+        ( it - 1 )->Count += allocation.Count + it->Count;
+        page.FreeRanges.erase( it );
+    }
+    else if( bMergePrev )
+    {
+        ( it - 1 )->Count += allocation.Count;
+    }
+    else if( bMergeNext )
+    {
+        it->Offset = allocation.Offset;
+        it->Count += allocation.Count;
+    }
+    else
+    {
+        Range range;
+        range.Offset = allocation.Offset;
+        range.Count = allocation.Count;
+        page.FreeRanges.insert( it, range );
+    }
+
+    --page.nAllocations;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+UINT WINAPI DXUTSetGeometryBuffers( ID3D11DeviceContext* pd3dDeviceContext, UINT NumVertexBuffers,
+                                    ID3D11Buffer* const* ppVB, const UINT* pStrides, const UINT* pOffsets,
+                                    ID3D11Buffer* pIB, DXGI_FORMAT IBFormat, DXUT_GEOMETRY_BIND_CACHE* pCache )
+{
+    UINT nCalls = 0;
+    size_t VBBytes = NumVertexBuffers * sizeof( UINT );
+    if( !pCache->bValid
+        || pCache->NumVertexBuffers != NumVertexBuffers
+        || memcmp( pCache->pVB, ppVB, NumVertexBuffers * sizeof( ID3D11Buffer* ) )
+        || memcmp( pCache->Strides, pStrides, VBBytes )
+        || memcmp( pCache->Offsets, pOffsets, VBBytes ) )
+    {
+        pd3dDeviceContext->IASetVertexBuffers( 0, NumVertexBuffers, ppVB, pStrides, pOffsets );
+        pCache->NumVertexBuffers = NumVertexBuffers;
+        memcpy( pCache->pVB, ppVB, NumVertexBuffers * sizeof( ID3D11Buffer* ) );
+        memcpy( pCache->Strides, pStrides, VBBytes );
+        memcpy( pCache->Offsets, pOffsets, VBBytes );
+        nCalls++;
+    }
+
+    if( !pCache->bValid || pCache->pIB != pIB || pCache->IBFormat != IBFormat )
+    {
+        pd3dDeviceContext->IASetIndexBuffer( pIB, IBFormat, 0 );
+        pCache->pIB = pIB;
+        pCache->IBFormat = IBFormat;
+        nCalls++;
+    }
+
+    pCache->bValid = true;
+    return nCalls;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void CDXUTGeometryPool::AccumulateStats( const Group& group, DXUT_GEOMETRY_POOL_STATS* pStats ) const
+{
+    for( auto it = group.Pages.cbegin(); it != group.Pages.cend(); ++it )
+    {
+        const Page& page = m_Pages[*it];
+        UINT64 nFree = 0;
+        for( auto range = page.FreeRanges.cbegin(); range != page.FreeRanges.cend(); ++range )
+        {
+            UINT64 nBytes = UINT64( range->Count ) * group.Stride;
+            nFree += nBytes;
+            pStats->LargestFreeBytes = std::max<UINT64>( pStats->LargestFreeBytes, nBytes );
+        }
+
+        ++pStats->NumPages;
+        pStats->NumAllocations += page.nAllocations;
+        pStats->NumFreeRanges += UINT( page.FreeRanges.size() );
+        pStats->CapacityBytes += UINT64( page.nElements ) * group.Stride;
+        pStats->UsedBytes += UINT64( page.nElements ) * group.Stride - nFree;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void CDXUTGeometryPool::GetGroupStats( UINT iGroup, DXUT_GEOMETRY_POOL_STATS* pStats ) const
+{
+    ZeroMemory( pStats, sizeof( DXUT_GEOMETRY_POOL_STATS ) );
+    const Group& group = m_Groups[iGroup];
+    pStats->Stride = group.Stride;
+    pStats->Format = group.Format;
+    AccumulateStats( group, pStats );
+    FinishStats( pStats );
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void CDXUTGeometryPool::GetStats( DXUT_GEOMETRY_POOL_STATS* pStats ) const
+{
+    ZeroMemory( pStats, sizeof( DXUT_GEOMETRY_POOL_STATS ) );
+    for( auto it = m_Groups.cbegin(); it != m_Groups.cend(); ++it )
+        AccumulateStats( *it, pStats );
+    FinishStats( pStats );
+}
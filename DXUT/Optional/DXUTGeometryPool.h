@@ -0,0 +1,143 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTGeometryPool.h
+//
+// Sub-allocates vertex and index data for many meshes from a few large buffers, so
+// meshes that share a page can be drawn with base vertex and start index offsets
+// instead of a buffer rebind each.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+#define DXUT_GEOMETRY_POOL_DEFAULT_PAGE_BYTES ( 16 * 1024 * 1024 )
+
+struct DXUT_GEOMETRY_ALLOCATION
+{
+    ID3D11Buffer* pBuffer;      // The page; not AddRef'd for the caller
+    UINT Page;
+    UINT Offset;                // In elements: the base vertex or the start index
+    UINT Count;
+    UINT Generation;            // Of the pool's pages, bumped by OnD3D11DestroyDevice
+};
+
+struct DXUT_GEOMETRY_POOL_STATS
+{
+    UINT Stride;                // Vertex stride or index size in bytes; 0 in the totals
+    DXGI_FORMAT Format;         // Index format, or DXGI_FORMAT_UNKNOWN for vertices and the totals
+    UINT NumPages;
+    UINT NumAllocations;
+    UINT NumFreeRanges;
+    UINT64 CapacityBytes;
+    UINT64 UsedBytes;
+    UINT64 LargestFreeBytes;
+    float Occupancy;            // Used over capacity
+    float Fragmentation;        // 1 less the largest free range over all free space; 0 when it is one range
+};
+
+
+//--------------------------------------------------------------------------------------
+// The input assembler buffers last set on one device context.  Keep one per context and
+// pass it to every CDXUTSDKMesh::Render there, so meshes that share a pool page keep the
+// binding from one mesh to the next.  Invalidate it whenever anything else sets the input
+// assembler buffers on the context, and after destroying meshes or the pool.
+//--------------------------------------------------------------------------------------
+struct DXUT_GEOMETRY_BIND_CACHE
+{
+    bool bValid;
+    UINT NumVertexBuffers;
+    ID3D11Buffer* pVB[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT];
+    UINT Strides[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT];
+    UINT Offsets[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT];
+    ID3D11Buffer* pIB;
+    DXGI_FORMAT IBFormat;
+
+    DXUT_GEOMETRY_BIND_CACHE() : bValid( false ) {}
+    void Invalidate() { bValid = false; }
+};
+
+// Sets the vertex buffers from slot 0 and the index buffer, skipping what pCache shows
+// is already set, and records them in pCache.  Returns the number of calls made.
+UINT WINAPI DXUTSetGeometryBuffers( _In_ ID3D11DeviceContext* pd3dDeviceContext, _In_ UINT NumVertexBuffers,
+                                    _In_reads_(NumVertexBuffers) ID3D11Buffer* const* ppVB,
+                                    _In_reads_(NumVertexBuffers) const UINT* pStrides,
+                                    _In_reads_(NumVertexBuffers) const UINT* pOffsets,
+                                    _In_opt_ ID3D11Buffer* pIB, _In_ DXGI_FORMAT IBFormat,
+                                    _Inout_ DXUT_GEOMETRY_BIND_CACHE* pCache );
+
+
+//--------------------------------------------------------------------------------------
+// Vertices are grouped by stride and indices by format, each group filling pages of
+// nPageBytes; an allocation larger than that gets a page of its own.  Allocations go to
+// the smallest free range that fits, and freed ranges merge with their neighbours.
+// Emptied pages are kept for the next allocations.  Data is uploaded with
+// UpdateSubresource on the immediate context, so allocate from the thread that owns it.
+//--------------------------------------------------------------------------------------
+class CDXUTGeometryPool
+{
+public:
+    CDXUTGeometryPool();
+    ~CDXUTGeometryPool();
+
+    HRESULT OnD3D11CreateDevice( _In_ ID3D11Device* pd3dDevice, _In_ ID3D11DeviceContext* pd3dImmediateContext,
+                                 _In_ UINT nPageBytes = DXUT_GEOMETRY_POOL_DEFAULT_PAGE_BYTES );
+    void OnD3D11DestroyDevice();
+
+    HRESULT AllocateVertices( _In_ UINT nStride, _In_ UINT nVertices, _In_reads_bytes_opt_(nStride * nVertices) const void* pData,
+                              _Out_ DXUT_GEOMETRY_ALLOCATION* pAllocation );
+    HRESULT AllocateIndices( _In_ DXGI_FORMAT format, _In_ UINT nIndices, _In_reads_opt_(nIndices) const void* pData,
+                             _Out_ DXUT_GEOMETRY_ALLOCATION* pAllocation );
+
+    // Free each allocation once, before the OnD3D11DestroyDevice that releases its page.
+    // Debug builds assert on a second free and on a stale allocation; release builds
+    // ignore both.
+    void Free( _In_ const DXUT_GEOMETRY_ALLOCATION& allocation );
+
+    UINT GetNumGroups() const { return UINT( m_Groups.size() ); }
+    void GetGroupStats( _In_ UINT iGroup, _Out_ DXUT_GEOMETRY_POOL_STATS* pStats ) const;
+    void GetStats( _Out_ DXUT_GEOMETRY_POOL_STATS* pStats ) const;
+
+private:
+    CDXUTGeometryPool( const CDXUTGeometryPool& );
+    CDXUTGeometryPool& operator=( const CDXUTGeometryPool& );
+
+    struct Range
+    {
+        UINT Offset;
+        UINT Count;
+    };
+
+    struct Page
+    {
+        ID3D11Buffer* pBuffer;
+        UINT iGroup;
+        UINT nElements;
+        UINT nAllocations;
+        std::vector<Range> FreeRanges;      // Sorted by offset, never adjacent
+    };
+
+    struct Group
+    {
+        UINT BindFlags;
+        UINT Stride;
+        DXGI_FORMAT Format;
+        std::vector<UINT> Pages;
+    };
+
+    HRESULT Allocate( _In_ UINT BindFlags, _In_ UINT nStride, _In_ DXGI_FORMAT format, _In_ UINT nCount,
+                      _In_opt_ const void* pData, _Out_ DXUT_GEOMETRY_ALLOCATION* pAllocation );
+    void AccumulateStats( _In_ const Group& group, _Inout_ DXUT_GEOMETRY_POOL_STATS* pStats ) const;
+
+    ID3D11Device* m_pd3dDevice;
+    ID3D11DeviceContext* m_pd3dImmediateContext;
+    UINT m_nPageBytes;
+    UINT m_nGeneration;
+    std::vector<Group> m_Groups;
+    std::vector<Page> m_Pages;
+};
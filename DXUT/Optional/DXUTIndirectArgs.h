@@ -0,0 +1,228 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTIndirectArgs.h
+//
+// Builds packed DrawIndexedInstancedIndirect arguments for the visible instances of many
+// meshes.  Has no Direct3D or Windows dependency, so the builder can be tested and timed
+// without a device.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+#include <stdint.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+// The layout DrawIndexedInstancedIndirect reads at each argument offset
+struct DXUT_DRAW_INDEXED_INSTANCED_ARGS
+{
+    uint32_t IndexCountPerInstance;
+    uint32_t InstanceCount;
+    uint32_t StartIndexLocation;
+    int32_t BaseVertexLocation;
+    uint32_t StartInstanceLocation;
+};
+
+struct DXUT_INDIRECT_SUBSET
+{
+    uint32_t IndexCount;
+    uint32_t StartIndex;        // Including where the mesh's indices start in their buffer
+    int32_t BaseVertex;         // Likewise for the vertices
+};
+
+struct DXUT_INDIRECT_INSTANCE
+{
+    uint32_t Mesh;              // From AddMesh
+    uint32_t Data;              // Written to the instance stream, such as a transform index
+    uint32_t Visible;           // Zero skips the instance
+};
+
+// Which subset each argument record draws, parallel to the arguments
+struct DXUT_INDIRECT_DRAW
+{
+    uint32_t Mesh;
+    uint32_t Subset;            // Index into every subset added, in the order added
+};
+
+
+//--------------------------------------------------------------------------------------
+// Visible instances are gathered by mesh, in their input order, into one instance data
+// array.  Each subset of a mesh with any visible instance then gets one record drawing
+// all of them, with StartInstanceLocation at the mesh's first entry in the array.
+// Records are ordered by mesh, then by subset.
+//
+// Large inputs are split across threads: each counts its share of the instances per
+// mesh, the counts are summed into offsets, and each scatters its share, so the result
+// does not depend on the thread count.
+//--------------------------------------------------------------------------------------
+class CDXUTIndirectArgBuilder
+{
+public:
+    CDXUTIndirectArgBuilder()
+    {
+        m_MeshFirstSubset.push_back( 0 );
+    }
+
+    // Returns the mesh handle; handles count up from 0 in the order added
+    uint32_t AddMesh( const DXUT_INDIRECT_SUBSET* pSubsets, uint32_t nSubsets )
+    {
+        m_Subsets.insert( m_Subsets.end(), pSubsets, pSubsets + nSubsets );
+        m_MeshFirstSubset.push_back( uint32_t( m_Subsets.size() ) );
+        return uint32_t( m_MeshFirstSubset.size() - 2 );
+    }
+
+    void Clear()
+    {
+        m_Subsets.clear();
+        m_MeshFirstSubset.assign( 1, 0 );
+        m_Args.clear();
+        m_Draws.clear();
+        m_InstanceData.clear();
+    }
+
+    uint32_t GetNumMeshes() const { return uint32_t( m_MeshFirstSubset.size() - 1 ); }
+    uint32_t GetFirstSubset( uint32_t nMesh ) const { return m_MeshFirstSubset[nMesh]; }
+    uint32_t GetNumSubsets( uint32_t nMesh ) const { return m_MeshFirstSubset[nMesh + 1] - m_MeshFirstSubset[nMesh]; }
+
+    //----------------------------------------------------------------------------------
+    // Instances naming a mesh that was not added are skipped.  maxThreads of 0 uses one
+    // per hardware thread.  The output arrays keep their capacity from frame to frame.
+    //----------------------------------------------------------------------------------
+    void Build( const DXUT_INDIRECT_INSTANCE* pInstances, size_t nInstances, unsigned int maxThreads = 0 )
+    {
+        uint32_t nMeshes = GetNumMeshes();
+
+        if( !maxThreads )
+            maxThreads = std::max<unsigned int>( 1, std::thread::hardware_concurrency() );
+        size_t nRuns = std::min<size_t>( maxThreads, std::max<size_t>( 1, nInstances / c_MinInstancesPerRun ) );
+        size_t nRunInstances = ( nInstances + nRuns - 1 ) / std::max<size_t>( nRuns, 1 );
+
+        // Visible instances per run and mesh
+        m_RunCounts.assign( nRuns * nMeshes, 0 );
+        RunParallel( nRuns, [&]( size_t run )
+        {
+            uint32_t* pCounts = m_RunCounts.data() + run * nMeshes;
+            size_t nEnd = std::min( nInstances, ( run + 1 ) * nRunInstances );
+            for( size_t i = run * nRunInstances; i < nEnd; ++i )
+            {
+                if( pInstances[i].Visible && pInstances[i].Mesh < nMeshes )
+                    ++pCounts[pInstances[i].Mesh];
+            }
+        } );
+
+        // Turn the counts into where each run writes each mesh's instances, and lay out
+        // the records of every mesh that has any
+        m_MeshFirstInstance.resize( nMeshes + 1 );
+        m_MeshFirstArg.resize( nMeshes + 1 );
+        uint32_t nTotalInstances = 0;
+        uint32_t nTotalArgs = 0;
+        for( uint32_t iMesh = 0; iMesh < nMeshes; ++iMesh )
+        {
+            m_MeshFirstInstance[iMesh] = nTotalInstances;
+            m_MeshFirstArg[iMesh] = nTotalArgs;
+            for( size_t run = 0; run < nRuns; ++run )
+            {
+                uint32_t& count = m_RunCounts[run * nMeshes + iMesh];
+                uint32_t nRunCount = count;
+                count = nTotalInstances;
+                nTotalInstances += nRunCount;
+            }
+            if( nTotalInstances != m_MeshFirstInstance[iMesh] )
+                nTotalArgs += GetNumSubsets( iMesh );
+        }
+        m_MeshFirstInstance[nMeshes] = nTotalInstances;
+        m_MeshFirstArg[nMeshes] = nTotalArgs;
+
+        m_InstanceData.resize( nTotalInstances );
+        m_Args.resize( nTotalArgs );
+        m_Draws.resize( nTotalArgs );
+
+        RunParallel( nRuns, [&]( size_t run )
+        {
+            uint32_t* pOffsets = m_RunCounts.data() + run * nMeshes;
+            size_t nEnd = std::min( nInstances, ( run + 1 ) * nRunInstances );
+            for( size_t i = run * nRunInstances; i < nEnd; ++i )
+            {
+                if( pInstances[i].Visible && pInstances[i].Mesh < nMeshes )
+                    m_InstanceData[pOffsets[pInstances[i].Mesh]++] = pInstances[i].Data;
+            }
+        } );
+
+        // Records, split by mesh
+        size_t nRunMeshes = ( nMeshes + nRuns - 1 ) / std::max<size_t>( nRuns, 1 );
+        RunParallel( nRuns, [&]( size_t run )
+        {
+            size_t nEnd = std::min<size_t>( nMeshes, ( run + 1 ) * nRunMeshes );
+            for( size_t iMesh = run * nRunMeshes; iMesh < nEnd; ++iMesh )
+            {
+                uint32_t nMeshInstances = m_MeshFirstInstance[iMesh + 1] - m_MeshFirstInstance[iMesh];
+                if( !nMeshInstances )
+                    continue;
+
+                uint32_t iArg = m_MeshFirstArg[iMesh];
+                for( uint32_t iSubset = m_MeshFirstSubset[iMesh]; iSubset < m_MeshFirstSubset[iMesh + 1]; ++iSubset, ++iArg )
+                {
+                    const DXUT_INDIRECT_SUBSET& subset = m_Subsets[iSubset];
+                    DXUT_DRAW_INDEXED_INSTANCED_ARGS& args = m_Args[iArg];
+                    args.IndexCountPerInstance = subset.IndexCount;
+                    args.InstanceCount = nMeshInstances;
+                    args.StartIndexLocation = subset.StartIndex;
+                    args.BaseVertexLocation = subset.BaseVertex;
+                    args.StartInstanceLocation = m_MeshFirstInstance[iMesh];
+
+                    m_Draws[iArg].Mesh = uint32_t( iMesh );
+                    m_Draws[iArg].Subset = iSubset;
+                }
+            }
+        } );
+    }
+
+    const std::vector<DXUT_DRAW_INDEXED_INSTANCED_ARGS>& GetArgs() const { return m_Args; }
+    const std::vector<DXUT_INDIRECT_DRAW>& GetDraws() const { return m_Draws; }
+    const std::vector<uint32_t>& GetInstanceData() const { return m_InstanceData; }
+
+private:
+    // Below this many instances per thread, starting the thread costs more than it saves
+    static const size_t c_MinInstancesPerRun = 16384;
+
+    template<typename Fn> static void RunParallel( size_t nRuns, const Fn& fn )
+    {
+        std::vector<std::thread> threads;
+        size_t run = 1;
+        try
+        {
+            for( ; run < nRuns; ++run )
+                threads.push_back( std::thread( [&fn, run]() { fn( run ); } ) );
+        }
+        catch( ... )
+        {
+            // Run whatever did not get a thread here
+        }
+
+        fn( 0 );
+        for( size_t inlineRun = run; inlineRun < nRuns; ++inlineRun )
+            fn( inlineRun );
+
+        for( auto it = threads.begin(); it != threads.end(); ++it )
+            it->join();
+    }
+
+    std::vector<DXUT_INDIRECT_SUBSET> m_Subsets;
+    std::vector<uint32_t> m_MeshFirstSubset;            // One past the last mesh too
+
+    std::vector<uint32_t> m_RunCounts;                  // Per run and mesh
+    std::vector<uint32_t> m_MeshFirstInstance;
+    std::vector<uint32_t> m_MeshFirstArg;
+
+    std::vector<DXUT_DRAW_INDEXED_INSTANCED_ARGS> m_Args;
+    std::vector<DXUT_INDIRECT_DRAW> m_Draws;
+    std::vector<uint32_t> m_InstanceData;
+};
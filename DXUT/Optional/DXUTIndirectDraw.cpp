@@ -0,0 +1,298 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTIndirectDraw.cpp
+//
+// Indirect instanced drawing of SDKmesh meshes
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUT.h"
+#include "DXUTIndirectDraw.h"
+
+namespace
+{
+
+// Smallest buffer created, in bytes, so the first frames do not grow it one draw at a time
+const UINT INDIRECT_MIN_BUFFER_BYTES = 4096;
+
+};
+
+static_assert( sizeof(DXUT_DRAW_INDEXED_INSTANCED_ARGS) == 20, "Indirect draw argument structure size incorrect" );
+
+
+//--------------------------------------------------------------------------------------
+CDXUTIndirectMeshRenderer::CDXUTIndirectMeshRenderer() :
+    m_pd3dDevice( nullptr ),
+    m_nMaxVertexBuffers( 0 ),
+    m_pArgs( nullptr ),
+    m_nArgsCapacity( 0 ),
+    m_pInstances( nullptr ),
+    m_nInstancesCapacity( 0 )
+{
+    ZeroMemory( &m_Stats, sizeof( m_Stats ) );
+}
+
+
+//--------------------------------------------------------------------------------------
+CDXUTIndirectMeshRenderer::~CDXUTIndirectMeshRenderer()
+{
+    OnD3D11DestroyDevice();
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTIndirectMeshRenderer::OnD3D11CreateDevice( ID3D11Device* pd3dDevice )
+{
+    if( !pd3dDevice )
+        return E_INVALIDARG;
+
+    OnD3D11DestroyDevice();
+
+    m_pd3dDevice = pd3dDevice;
+    m_pd3dDevice->AddRef();
+
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+void CDXUTIndirectMeshRenderer::OnD3D11DestroyDevice()
+{
+    RemoveAll();
+
+    SAFE_RELEASE( m_pArgs );
+    SAFE_RELEASE( m_pInstances );
+    m_nArgsCapacity = 0;
+    m_nInstancesCapacity = 0;
+
+    SAFE_RELEASE( m_pd3dDevice );
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTIndirectMeshRenderer::AddSDKMesh( CDXUTSDKMesh* pMesh, UINT* pFirstHandle )
+{
+    if( pFirstHandle )
+        *pFirstHandle = UINT( m_Meshes.size() );
+
+    if( !pMesh )
+        return E_INVALIDARG;
+
+    // The buffers are not created until the mesh has finished loading
+    if( pMesh->GetOutstandingBufferResources() )
+        return E_FAIL;
+
+    // Gathered before anything is added, so a bad file adds none of its meshes
+    HRESULT hr;
+    std::vector<Mesh> meshes( pMesh->GetNumMeshes() );
+    for( UINT iMesh = 0; iMesh < pMesh->GetNumMeshes(); ++iMesh )
+    {
+        meshes[iMesh].pMesh = pMesh;
+        V_RETURN( pMesh->GetMeshGeometry11( iMesh, false, &meshes[iMesh].Geometry ) );
+    }
+
+    std::vector<DXUT_INDIRECT_SUBSET> subsets;
+    for( UINT iMesh = 0; iMesh < pMesh->GetNumMeshes(); ++iMesh )
+    {
+        const SDKMESH_MESH* pHeader = pMesh->GetMesh( iMesh );
+        const SDKMESH_MESH_GEOMETRY& geometry = meshes[iMesh].Geometry;
+
+        subsets.resize( pHeader->NumSubsets );
+        for( UINT iSubset = 0; iSubset < pHeader->NumSubsets; ++iSubset )
+        {
+            const SDKMESH_SUBSET* pSubset = pMesh->GetSubset( iMesh, iSubset );
+            subsets[iSubset].IndexCount = UINT( pSubset->IndexCount );
+            subsets[iSubset].StartIndex = geometry.BaseIndex + UINT( pSubset->IndexStart );
+            subsets[iSubset].BaseVertex = geometry.BaseVertex + INT( pSubset->VertexStart );
+
+            Subset subset;
+            subset.MaterialID = pSubset->MaterialID;
+            subset.Topology = CDXUTSDKMesh::GetPrimitiveType11( ( SDKMESH_PRIMITIVE_TYPE )pSubset->PrimitiveType );
+            m_Subsets.push_back( subset );
+        }
+
+        m_Builder.AddMesh( subsets.empty() ? nullptr : &subsets[0], UINT( subsets.size() ) );
+        m_Meshes.push_back( meshes[iMesh] );
+        m_nMaxVertexBuffers = std::max<UINT>( m_nMaxVertexBuffers, geometry.NumVertexBuffers );
+    }
+
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+void CDXUTIndirectMeshRenderer::RemoveAll()
+{
+    m_Meshes.clear();
+    m_nMaxVertexBuffers = 0;
+    m_Subsets.clear();
+    m_Builder.Clear();
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTIndirectMeshRenderer::GrowBuffer( UINT nBytes, bool bArgs, ID3D11Buffer** ppBuffer, UINT* pnCapacity )
+{
+    if( *ppBuffer && nBytes <= *pnCapacity )
+        return S_OK;
+
+    UINT64 nCapacity = std::max<UINT64>( std::max<UINT64>( nBytes, UINT64( *pnCapacity ) * 2 ), INDIRECT_MIN_BUFFER_BYTES );
+    if( nCapacity > UINT_MAX )
+        return E_OUTOFMEMORY;
+
+    SAFE_RELEASE( *ppBuffer );
+    *pnCapacity = 0;
+
+    D3D11_BUFFER_DESC bufferDesc;
+    bufferDesc.ByteWidth = UINT( nCapacity );
+    bufferDesc.StructureByteStride = 0;
+    if( bArgs )
+    {
+        bufferDesc.Usage = D3D11_USAGE_DEFAULT;
+        bufferDesc.BindFlags = 0;
+        bufferDesc.CPUAccessFlags = 0;
+        bufferDesc.MiscFlags = D3D11_RESOURCE_MISC_DRAWINDIRECT_ARGS;
+    }
+    else
+    {
+        bufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+        bufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+        bufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        bufferDesc.MiscFlags = 0;
+    }
+
+    HRESULT hr;
+    V_RETURN( m_pd3dDevice->CreateBuffer( &bufferDesc, nullptr, ppBuffer ) );
+    DXUT_SetDebugName( *ppBuffer, bArgs ? "CDXUTIndirectMeshRenderer Args" : "CDXUTIndirectMeshRenderer Instances" );
+
+    *pnCapacity = bufferDesc.ByteWidth;
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTIndirectMeshRenderer::Render( ID3D11DeviceContext* pd3dDeviceContext,
+                                           const DXUT_INDIRECT_INSTANCE* pInstances, UINT nInstances,
+                                           UINT iInstanceSlot,
+                                           UINT iDiffuseSlot, UINT iNormalSlot, UINT iSpecularSlot,
+                                           unsigned int maxThreads, DXUT_GEOMETRY_BIND_CACHE* pBindCache )
+{
+    if( !pd3dDeviceContext || ( nInstances && !pInstances ) || iInstanceSlot >= D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT )
+        return E_INVALIDARG;
+
+    if( !m_pd3dDevice )
+        return E_FAIL;
+
+    // A mesh's streams would replace the instance stream
+    if( iInstanceSlot < m_nMaxVertexBuffers )
+        return DXUT_ERR( L"CDXUTIndirectMeshRenderer::Render: iInstanceSlot overlaps a mesh's vertex streams", E_INVALIDARG );
+
+    LONGLONG llStart = DXUTGetTimestamp();
+    m_Builder.Build( pInstances, nInstances, maxThreads );
+    LONGLONG llBuilt = DXUTGetTimestamp();
+
+    const auto& args = m_Builder.GetArgs();
+    const auto& draws = m_Builder.GetDraws();
+    const auto& instanceData = m_Builder.GetInstanceData();
+
+    m_Stats.NumMeshes = UINT( m_Meshes.size() );
+    m_Stats.NumDraws = UINT( args.size() );
+    m_Stats.NumInstances = UINT( instanceData.size() );
+    m_Stats.BuildSeconds = DXUTTimestampToSeconds( llBuilt - llStart );
+    m_Stats.UploadSeconds = 0;
+
+    if( args.empty() )
+        return S_OK;
+
+    // Both uploads happen once for the whole frame
+    UINT nArgsBytes = UINT( args.size() * sizeof( DXUT_DRAW_INDEXED_INSTANCED_ARGS ) );
+    UINT nInstanceBytes = UINT( instanceData.size() * sizeof( uint32_t ) );
+
+    HRESULT hr;
+    V_RETURN( GrowBuffer( nArgsBytes, true, &m_pArgs, &m_nArgsCapacity ) );
+    V_RETURN( GrowBuffer( nInstanceBytes, false, &m_pInstances, &m_nInstancesCapacity ) );
+
+    D3D11_BOX box;
+    box.left = 0;
+    box.right = nArgsBytes;
+    box.top = 0;
+    box.bottom = 1;
+    box.front = 0;
+    box.back = 1;
+    pd3dDeviceContext->UpdateSubresource( m_pArgs, 0, &box, &args[0], 0, 0 );
+
+    D3D11_MAPPED_SUBRESOURCE mapped;
+    V_RETURN( pd3dDeviceContext->Map( m_pInstances, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped ) );
+    memcpy( mapped.pData, &instanceData[0], nInstanceBytes );
+    pd3dDeviceContext->Unmap( m_pInstances, 0 );
+
+    DXUTCountAPICalls( DXUT_API_UPDATE, 2 );
+    m_Stats.UploadSeconds = DXUTTimestampToSeconds( DXUTGetTimestamp() - llBuilt );
+
+    UINT InstanceStride = sizeof( uint32_t );
+    UINT InstanceOffset = 0;
+    pd3dDeviceContext->IASetVertexBuffers( iInstanceSlot, 1, &m_pInstances, &InstanceStride, &InstanceOffset );
+    UINT nBinds = 1;
+    UINT nDraws = 0;
+
+    // The instance stream replaced whatever the cache had in that slot
+    DXUT_GEOMETRY_BIND_CACHE localCache;
+    if( !pBindCache )
+        pBindCache = &localCache;
+    else if( pBindCache->bValid && pBindCache->NumVertexBuffers > iInstanceSlot )
+        pBindCache->Invalidate();
+
+    const SDKMESH_MATERIAL_BINDING* pLastBinding = nullptr;
+    D3D11_PRIMITIVE_TOPOLOGY LastPrimType = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+
+    for( size_t i = 0; i < draws.size(); ++i )
+    {
+        const Mesh& mesh = m_Meshes[draws[i].Mesh];
+        const Subset& subset = m_Subsets[draws[i].Subset];
+        const SDKMESH_MESH_GEOMETRY& geometry = mesh.Geometry;
+
+        nBinds += DXUTSetGeometryBuffers( pd3dDeviceContext, geometry.NumVertexBuffers, geometry.pVB, geometry.Strides,
+                                          geometry.Offsets, geometry.pIB, geometry.IBFormat, pBindCache );
+
+        if( subset.Topology != LastPrimType )
+        {
+            pd3dDeviceContext->IASetPrimitiveTopology( subset.Topology );
+            LastPrimType = subset.Topology;
+            nBinds++;
+        }
+
+        const SDKMESH_MATERIAL_BINDING* pBinding = mesh.pMesh->GetMaterialBinding( subset.MaterialID );
+        if( pBinding && pBinding != pLastBinding )
+        {
+            nBinds += CDXUTSDKMesh::BindMaterial11( pd3dDeviceContext, *pBinding, iDiffuseSlot, iNormalSlot, iSpecularSlot );
+            pLastBinding = pBinding;
+        }
+
+        pd3dDeviceContext->DrawIndexedInstancedIndirect( m_pArgs, UINT( i * sizeof( DXUT_DRAW_INDEXED_INSTANCED_ARGS ) ) );
+        nDraws++;
+    }
+
+    DXUTCountAPICalls( DXUT_API_BIND, nBinds );
+    DXUTCountAPICalls( DXUT_API_DRAW, nDraws );
+
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void CDXUTIndirectMeshRenderer::GetStats( DXUT_INDIRECT_DRAW_STATS* pStats ) const
+{
+    *pStats = m_Stats;
+    pStats->NumMeshes = UINT( m_Meshes.size() );
+}
@@ -0,0 +1,103 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTIndirectDraw.h
+//
+// Draws many instances of SDKmesh meshes from one packed array of indirect arguments,
+// built in bulk each frame, instead of a DrawIndexed per subset per instance.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+#include "DXUTIndirectArgs.h"
+#include "SDKmesh.h"
+
+struct DXUT_INDIRECT_DRAW_STATS
+{
+    UINT NumMeshes;
+    UINT NumDraws;              // Argument records in the last Render
+    UINT NumInstances;          // Visible instances in the last Render
+    double BuildSeconds;        // Building the arguments and instance data
+    double UploadSeconds;       // Copying both to the GPU
+};
+
+
+//--------------------------------------------------------------------------------------
+// Each mesh of an added SDKmesh gets a handle.  Render takes the frame's instances by
+// handle, merges the visible instances of each mesh into one instanced draw per subset,
+// and uploads the arguments and the instances' Data values once.  Data reaches the
+// shader through a per-instance R32_UINT vertex element in iInstanceSlot, which must come
+// after the streams of every added mesh, or Render fails; SV_InstanceID does not include
+// the start instance, so it cannot index the instance data.
+//
+// Draws are issued in mesh order, binding geometry and materials as CDXUTSDKMesh::Render
+// does, so meshes in a shared geometry pool run without rebinds.  Adjacency index buffers
+// are not drawn.  The meshes keep ownership of their buffers and views and must outlive
+// their handles.
+//--------------------------------------------------------------------------------------
+class CDXUTIndirectMeshRenderer
+{
+public:
+    CDXUTIndirectMeshRenderer();
+    ~CDXUTIndirectMeshRenderer();
+
+    HRESULT OnD3D11CreateDevice( _In_ ID3D11Device* pd3dDevice );
+    void OnD3D11DestroyDevice();
+
+    // Mesh i of the file gets handle *pFirstHandle + i
+    HRESULT AddSDKMesh( _In_ CDXUTSDKMesh* pMesh, _Out_opt_ UINT* pFirstHandle );
+    void RemoveAll();
+
+    // maxThreads is passed to CDXUTIndirectArgBuilder::Build.  pBindCache is the context's
+    // cache, as passed to CDXUTSDKMesh::Render.
+    HRESULT Render( _In_ ID3D11DeviceContext* pd3dDeviceContext,
+                    _In_reads_(nInstances) const DXUT_INDIRECT_INSTANCE* pInstances, _In_ UINT nInstances,
+                    _In_ UINT iInstanceSlot,
+                    _In_ UINT iDiffuseSlot = INVALID_SAMPLER_SLOT,
+                    _In_ UINT iNormalSlot = INVALID_SAMPLER_SLOT,
+                    _In_ UINT iSpecularSlot = INVALID_SAMPLER_SLOT,
+                    _In_ unsigned int maxThreads = 0,
+                    _Inout_opt_ DXUT_GEOMETRY_BIND_CACHE* pBindCache = nullptr );
+
+    UINT GetNumMeshes() const { return UINT( m_Meshes.size() ); }
+    const CDXUTIndirectArgBuilder& GetBuilder() const { return m_Builder; }
+    void GetStats( _Out_ DXUT_INDIRECT_DRAW_STATS* pStats ) const;
+
+private:
+    CDXUTIndirectMeshRenderer( const CDXUTIndirectMeshRenderer& );
+    CDXUTIndirectMeshRenderer& operator=( const CDXUTIndirectMeshRenderer& );
+
+    struct Mesh
+    {
+        CDXUTSDKMesh* pMesh;
+        SDKMESH_MESH_GEOMETRY Geometry;
+    };
+
+    // Parallel to the builder's subsets
+    struct Subset
+    {
+        UINT MaterialID;
+        D3D11_PRIMITIVE_TOPOLOGY Topology;
+    };
+
+    HRESULT GrowBuffer( _In_ UINT nBytes, _In_ bool bArgs, _Inout_ ID3D11Buffer** ppBuffer, _Inout_ UINT* pnCapacity );
+
+    ID3D11Device* m_pd3dDevice;
+    std::vector<Mesh> m_Meshes;
+    UINT m_nMaxVertexBuffers;               // Of any mesh, so the lowest valid instance slot
+    std::vector<Subset> m_Subsets;
+    CDXUTIndirectArgBuilder m_Builder;
+
+    ID3D11Buffer* m_pArgs;                  // DEFAULT, updated with UpdateSubresource
+    UINT m_nArgsCapacity;                   // In bytes
+    ID3D11Buffer* m_pInstances;             // DYNAMIC vertex buffer of the instances' Data
+    UINT m_nInstancesCapacity;
+
+    DXUT_INDIRECT_DRAW_STATS m_Stats;
+};
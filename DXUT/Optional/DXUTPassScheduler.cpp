@@ -0,0 +1,281 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTPassScheduler.cpp
+//
+// Parallel render pass recording on deferred contexts
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUT.h"
+#include "DXUTPassScheduler.h"
+
+//--------------------------------------------------------------------------------------
+CDXUTPassScheduler::CDXUTPassScheduler() :
+    m_pd3dDevice( nullptr ),
+    m_bDriverCommandLists( false ),
+    m_nFrame( 0 ),
+    m_nBusyWorkers( 0 ),
+    m_bQuit( false ),
+    m_nNextPass( 0 )
+{
+}
+
+
+//--------------------------------------------------------------------------------------
+CDXUTPassScheduler::~CDXUTPassScheduler()
+{
+    OnD3D11DestroyDevice();
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTPassScheduler::OnD3D11CreateDevice( ID3D11Device* pd3dDevice, UINT nWorkers )
+{
+    if( !pd3dDevice )
+        return E_INVALIDARG;
+
+    OnD3D11DestroyDevice();
+
+    m_pd3dDevice = pd3dDevice;
+    m_pd3dDevice->AddRef();
+
+    D3D11_FEATURE_DATA_THREADING threading = {};
+    if( SUCCEEDED( m_pd3dDevice->CheckFeatureSupport( D3D11_FEATURE_THREADING, &threading, sizeof( threading ) ) ) )
+        m_bDriverCommandLists = ( threading.DriverCommandLists != FALSE );
+
+    if( !nWorkers )
+        nWorkers = std::max<UINT>( std::thread::hardware_concurrency(), 1 ) - 1;
+
+    // Workers start from the current frame so a Render that runs before they are scheduled
+    // is not missed
+    m_bQuit = false;
+    UINT nFrame = m_nFrame;
+    try
+    {
+        for( UINT i = 0; i < nWorkers; ++i )
+        {
+            UINT iThread = i + 1;
+            m_Workers.push_back( std::thread( [this, iThread, nFrame]() { WorkerThread( iThread, nFrame ); } ) );
+        }
+    }
+    catch( ... )
+    {
+        // Run with the workers that did start
+    }
+
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+void CDXUTPassScheduler::OnD3D11DestroyDevice()
+{
+    StopWorkers();
+
+    for( auto it = m_Passes.begin(); it != m_Passes.end(); ++it )
+    {
+        SAFE_RELEASE( it->pCommandList );
+        SAFE_RELEASE( it->pDeferredContext );
+    }
+
+    SAFE_RELEASE( m_pd3dDevice );
+    m_bDriverCommandLists = false;
+}
+
+
+//--------------------------------------------------------------------------------------
+void CDXUTPassScheduler::StopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock( m_Mutex );
+        m_bQuit = true;
+    }
+    m_WorkReady.notify_all();
+
+    for( auto it = m_Workers.begin(); it != m_Workers.end(); ++it )
+        it->join();
+    m_Workers.clear();
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+UINT CDXUTPassScheduler::AddPass( LPCWSTR szName, LPDXUTCALLBACKRENDERPASS pCallback, void* pUserContext, bool bDeferred )
+{
+    Pass pass;
+    pass.strName = szName ? szName : L"";
+    pass.pCallback = pCallback;
+    pass.pUserContext = pUserContext;
+    pass.bDeferred = bDeferred;
+    pass.bEnabled = ( pCallback != nullptr );
+    pass.pDeferredContext = nullptr;
+    pass.pCommandList = nullptr;
+    pass.hr = S_OK;
+    ZeroMemory( &pass.Stats, sizeof( pass.Stats ) );
+
+    m_Passes.push_back( pass );
+    return UINT( m_Passes.size() - 1 );
+}
+
+
+//--------------------------------------------------------------------------------------
+void CDXUTPassScheduler::RemoveAllPasses()
+{
+    for( auto it = m_Passes.begin(); it != m_Passes.end(); ++it )
+    {
+        SAFE_RELEASE( it->pCommandList );
+        SAFE_RELEASE( it->pDeferredContext );
+    }
+    m_Passes.clear();
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void CDXUTPassScheduler::SetPassEnabled( UINT iPass, bool bEnabled )
+{
+    if( iPass < m_Passes.size() )
+        m_Passes[iPass].bEnabled = bEnabled && m_Passes[iPass].pCallback;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Claims deferred passes until none are left.  Runs on the calling thread and on every
+// worker, so the passes spread over whichever threads are free.
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void CDXUTPassScheduler::RecordPasses( UINT iThread )
+{
+    for(;;)
+    {
+        UINT iPass = m_nNextPass++;
+        if( iPass >= m_Passes.size() )
+            return;
+
+        Pass& pass = m_Passes[iPass];
+        if( !pass.bEnabled || !pass.bDeferred || !pass.pDeferredContext )
+            continue;
+
+        LONGLONG llStart = DXUTGetTimestamp();
+
+        DXUTSetupD3D11Views( pass.pDeferredContext );
+        pass.pCallback( pass.pDeferredContext, pass.pUserContext );
+        pass.hr = pass.pDeferredContext->FinishCommandList( FALSE, &pass.pCommandList );
+
+        pass.Stats.RecordSeconds = DXUTTimestampToSeconds( DXUTGetTimestamp() - llStart );
+        pass.Stats.Thread = iThread;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void CDXUTPassScheduler::WorkerThread( UINT iThread, UINT nFrameSeen )
+{
+    for(;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock( m_Mutex );
+            m_WorkReady.wait( lock, [&]() { return m_bQuit || m_nFrame != nFrameSeen; } );
+            if( m_bQuit )
+                return;
+            nFrameSeen = m_nFrame;
+        }
+
+        RecordPasses( iThread );
+
+        {
+            std::lock_guard<std::mutex> lock( m_Mutex );
+            if( --m_nBusyWorkers == 0 )
+                m_WorkDone.notify_one();
+        }
+    }
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTPassScheduler::Render( ID3D11DeviceContext* pd3dImmediateContext )
+{
+    if( !m_pd3dDevice || !pd3dImmediateContext )
+        return E_FAIL;
+
+    HRESULT hr = S_OK;
+
+    // Deferred contexts are made the first time a pass records and kept for the device
+    for( auto it = m_Passes.begin(); it != m_Passes.end(); ++it )
+    {
+        ZeroMemory( &it->Stats, sizeof( it->Stats ) );
+        it->hr = S_OK;
+        if( it->bEnabled && it->bDeferred && !it->pDeferredContext )
+        {
+            V_RETURN( m_pd3dDevice->CreateDeferredContext( 0, &it->pDeferredContext ) );
+        }
+    }
+
+    // Record on the workers and on this thread
+    m_nNextPass = 0;
+    {
+        std::lock_guard<std::mutex> lock( m_Mutex );
+        m_nBusyWorkers = UINT( m_Workers.size() );
+        ++m_nFrame;
+    }
+    m_WorkReady.notify_all();
+
+    RecordPasses( 0 );
+
+    {
+        std::unique_lock<std::mutex> lock( m_Mutex );
+        m_WorkDone.wait( lock, [&]() { return m_nBusyWorkers == 0; } );
+    }
+
+    // Submit in order.  Executing a command list clears the immediate context state, so the
+    // DXUT views are set again before an immediate pass and once everything is submitted.
+    bool bStateCleared = false;
+    for( auto it = m_Passes.begin(); it != m_Passes.end(); ++it )
+    {
+        if( !it->bEnabled )
+            continue;
+
+        LONGLONG llStart = DXUTGetTimestamp();
+
+        if( it->bDeferred )
+        {
+            if( FAILED( it->hr ) || !it->pCommandList )
+            {
+                if( SUCCEEDED( hr ) )
+                    hr = FAILED( it->hr ) ? it->hr : E_FAIL;
+                continue;
+            }
+
+            pd3dImmediateContext->ExecuteCommandList( it->pCommandList, FALSE );
+            SAFE_RELEASE( it->pCommandList );
+            bStateCleared = true;
+        }
+        else
+        {
+            if( bStateCleared )
+            {
+                DXUTSetupD3D11Views( pd3dImmediateContext );
+                bStateCleared = false;
+            }
+
+            it->pCallback( pd3dImmediateContext, it->pUserContext );
+            it->Stats.RecordSeconds = DXUTTimestampToSeconds( DXUTGetTimestamp() - llStart );
+        }
+
+        it->Stats.ExecuteSeconds = DXUTTimestampToSeconds( DXUTGetTimestamp() - llStart );
+    }
+
+    if( bStateCleared )
+        DXUTSetupD3D11Views( pd3dImmediateContext );
+
+    return hr;
+}
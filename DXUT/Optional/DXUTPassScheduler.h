@@ -0,0 +1,104 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTPassScheduler.h
+//
+// Records independent render passes in parallel on deferred contexts and executes the
+// resulting command lists on the immediate context in submission order.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+struct DXUT_RENDER_PASS_STATS
+{
+    double RecordSeconds;       // Time in the pass callback, including FinishCommandList
+    double ExecuteSeconds;      // Time to submit the pass on the immediate context
+    UINT Thread;                // 0 for the thread calling Render, 1 and up for workers
+};
+
+// Called with a deferred context that already has the DXUT render target, depth stencil
+// and viewport set, or with the immediate context for immediate passes
+typedef void (CALLBACK *LPDXUTCALLBACKRENDERPASS)( _In_ ID3D11DeviceContext* pd3dContext, _In_opt_ void* pUserContext );
+
+
+//--------------------------------------------------------------------------------------
+// Deferred passes record concurrently, so their callbacks must not share mutable CPU
+// state, and may only Map dynamic resources with WRITE_DISCARD or WRITE_NO_OVERWRITE.
+// Each command list is executed without restoring state, so every pass starts from the
+// default pipeline state plus the DXUT views.
+//--------------------------------------------------------------------------------------
+class CDXUTPassScheduler
+{
+public:
+    CDXUTPassScheduler();
+    ~CDXUTPassScheduler();
+
+    // nWorkers of 0 uses one worker per hardware thread, less the thread calling Render
+    HRESULT OnD3D11CreateDevice( _In_ ID3D11Device* pd3dDevice, _In_ UINT nWorkers = 0 );
+    void OnD3D11DestroyDevice();
+
+    // Passes are submitted in the order added.  Immediate passes run on the immediate context
+    // at their place in that order, for work that reads back or cannot be deferred.
+    UINT AddPass( _In_z_ LPCWSTR szName, _In_ LPDXUTCALLBACKRENDERPASS pCallback, _In_opt_ void* pUserContext = nullptr,
+                  _In_ bool bDeferred = true );
+    void RemoveAllPasses();
+    void SetPassEnabled( _In_ UINT iPass, _In_ bool bEnabled );
+
+    // Call from the frame render callback.  Returns the first failure of any pass.
+    HRESULT Render( _In_ ID3D11DeviceContext* pd3dImmediateContext );
+
+    UINT GetNumPasses() const { return UINT( m_Passes.size() ); }
+    LPCWSTR GetPassName( _In_ UINT iPass ) const { return m_Passes[iPass].strName.c_str(); }
+    const DXUT_RENDER_PASS_STATS& GetPassStats( _In_ UINT iPass ) const { return m_Passes[iPass].Stats; }
+    UINT GetNumWorkers() const { return UINT( m_Workers.size() ); }
+
+    // False when the runtime emulates command lists, which still records in parallel but
+    // does more of the work at execute time
+    bool HasDriverCommandLists() const { return m_bDriverCommandLists; }
+
+private:
+    CDXUTPassScheduler( const CDXUTPassScheduler& );
+    CDXUTPassScheduler& operator=( const CDXUTPassScheduler& );
+
+    struct Pass
+    {
+        std::wstring strName;
+        LPDXUTCALLBACKRENDERPASS pCallback;
+        void* pUserContext;
+        bool bDeferred;
+        bool bEnabled;
+        ID3D11DeviceContext* pDeferredContext;
+        ID3D11CommandList* pCommandList;
+        HRESULT hr;
+        DXUT_RENDER_PASS_STATS Stats;
+    };
+
+    void RecordPasses( _In_ UINT iThread );
+    void WorkerThread( _In_ UINT iThread, _In_ UINT nFrameSeen );
+    void StopWorkers();
+
+    ID3D11Device* m_pd3dDevice;
+    bool m_bDriverCommandLists;
+    std::vector<Pass> m_Passes;
+
+    std::vector<std::thread> m_Workers;
+    std::mutex m_Mutex;
+    std::condition_variable m_WorkReady;
+    std::condition_variable m_WorkDone;
+    UINT m_nFrame;                      // Bumped to wake the workers for a frame
+    UINT m_nBusyWorkers;
+    bool m_bQuit;
+    std::atomic<UINT> m_nNextPass;      // Passes are claimed in order by whichever thread is free
+};
@@ -0,0 +1,681 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTShaderCache.cpp
+//
+// Persistent shader bytecode cache and parallel shader builds
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUT.h"
+#include "DXUTShaderCache.h"
+#include "SDKmisc.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+//--------------------------------------------------------------------------------------
+namespace
+{
+
+//--------------------------------------------------------------------------------------
+// D3DCompile is identified by the DLL that provides it, so bytecode from one
+// d3dcompiler_*.dll is not handed out after another one is installed or found first
+//--------------------------------------------------------------------------------------
+UINT64 GetD3DCompilerId()
+{
+    const UINT version = D3D_COMPILER_VERSION;
+    UINT64 id = DXUTHashShaderBytes( DXUT_SHADER_CACHE_HASH_SEED, &version, sizeof( version ) );
+
+    WCHAR strPath[MAX_PATH];
+    HMODULE hModule = GetModuleHandleW( D3DCOMPILER_DLL_W );
+    if( !hModule || !GetModuleFileNameW( hModule, strPath, MAX_PATH ) )
+        return id;
+
+    for( LPCWSTR p = strPath; *p; ++p )
+    {
+        WCHAR ch = towlower( *p );
+        id = DXUTHashShaderBytes( id, &ch, sizeof( ch ) );
+    }
+
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if( GetFileAttributesExW( strPath, GetFileExInfoStandard, &data ) )
+    {
+        const DWORD file[] = { data.nFileSizeHigh, data.nFileSizeLow,
+                               data.ftLastWriteTime.dwHighDateTime, data.ftLastWriteTime.dwLowDateTime };
+        id = DXUTHashShaderBytes( id, file, sizeof( file ) );
+    }
+
+    return id;
+}
+
+struct ShaderCacheState
+{
+    std::mutex Lock;
+    std::wstring strDirectory;
+    UINT64 MaxBytes;
+    UINT64 CacheBytes;          // Scanned when the directory is set, then counted per write
+    bool bTrimming;             // One writer at a time rescans and trims
+    LPDXUTSHADERCOMPILER pCompiler;
+    UINT64 CompilerId;
+    DXUT_SHADER_CACHE_STATS Stats;
+
+    ShaderCacheState() :
+        MaxBytes( DXUT_SHADER_CACHE_DEFAULT_SIZE ),
+        CacheBytes( 0 ),
+        bTrimming( false ),
+        pCompiler( D3DCompile ),
+        CompilerId( GetD3DCompilerId() )
+    {
+        ZeroMemory( &Stats, sizeof( Stats ) );
+    }
+};
+
+ShaderCacheState& GetShaderCacheState()
+{
+    static ShaderCacheState s_state;
+    return s_state;
+}
+
+HRESULT ReadShaderCacheFile( _In_z_ LPCWSTR szFileName, _In_ DWORD dwShareMode,
+                             _Inout_ std::unique_ptr<BYTE[]>& data, _Out_ size_t& bytes )
+{
+    bytes = 0;
+
+    HANDLE hFile = CreateFileW( szFileName, GENERIC_READ, dwShareMode, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr );
+    if( hFile == INVALID_HANDLE_VALUE )
+        return HRESULT_FROM_WIN32( GetLastError() );
+
+    LARGE_INTEGER FileSize = { 0 };
+    if( !GetFileSizeEx( hFile, &FileSize ) || FileSize.HighPart > 0 )
+    {
+        CloseHandle( hFile );
+        return E_FAIL;
+    }
+
+    // Allocate at least a byte so empty includes still get a valid pointer
+    data.reset( new (std::nothrow) BYTE[ FileSize.LowPart ? FileSize.LowPart : 1 ] );
+    if( !data )
+    {
+        CloseHandle( hFile );
+        return E_OUTOFMEMORY;
+    }
+
+    DWORD BytesRead = 0;
+    BOOL bRead = FileSize.LowPart ? ReadFile( hFile, data.get(), FileSize.LowPart, &BytesRead, nullptr ) : TRUE;
+    CloseHandle( hFile );
+
+    if( !bRead || BytesRead < FileSize.LowPart )
+        return E_FAIL;
+
+    bytes = FileSize.LowPart;
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+std::wstring GetShaderCacheEntryPath( _In_ const std::wstring& strDirectory, _In_ UINT64 key )
+{
+    WCHAR strName[32];
+    swprintf_s( strName, 32, L"%016llx.dxsc", key );
+    return strDirectory + strName;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Returns S_OK with the bytecode on a hit, S_FALSE if an included file changed and an
+// error if there is no usable entry
+//--------------------------------------------------------------------------------------
+HRESULT LoadShaderCacheEntry( _In_ const std::wstring& strEntry, _In_ UINT64 key, _Outptr_ ID3DBlob** ppCode,
+                              _Inout_opt_ std::vector<std::wstring>* pIncludes )
+{
+    std::unique_ptr<BYTE[]> data;
+    size_t bytes = 0;
+
+    // Share delete so a concurrent writer can still replace the entry
+    HRESULT hr = ReadShaderCacheFile( strEntry.c_str(), FILE_SHARE_READ | FILE_SHARE_DELETE, data, bytes );
+    if( FAILED( hr ) )
+        return hr;
+
+    auto hashFile = []( const std::wstring& strInclude, UINT64& hash ) -> bool
+    {
+        std::unique_ptr<BYTE[]> includeData;
+        size_t includeBytes = 0;
+        if( FAILED( ReadShaderCacheFile( strInclude.c_str(), FILE_SHARE_READ, includeData, includeBytes ) ) )
+            return false;
+
+        hash = DXUTHashShaderBytes( DXUT_SHADER_CACHE_HASH_SEED, includeData.get(), includeBytes );
+        return true;
+    };
+
+    const BYTE* pBytecode = nullptr;
+    UINT32 bytecodeBytes = 0;
+    switch( DXUTCheckShaderCacheEntry( data.get(), bytes, key, hashFile, pIncludes, &pBytecode, &bytecodeBytes ) )
+    {
+    case DXUT_SHADER_CACHE_HIT:
+        break;
+    case DXUT_SHADER_CACHE_STALE:
+        return S_FALSE;
+    default:
+        return E_FAIL;
+    }
+
+    V_RETURN( D3DCreateBlob( bytecodeBytes, ppCode ) );
+    memcpy( ( *ppCode )->GetBufferPointer(), pBytecode, bytecodeBytes );
+
+    // Mark the entry as recently used for the size policy
+    HANDLE hFile = CreateFileW( strEntry.c_str(), FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+    if( hFile != INVALID_HANDLE_VALUE )
+    {
+        FILETIME now;
+        GetSystemTimeAsFileTime( &now );
+        SetFileTime( hFile, nullptr, nullptr, &now );
+        CloseHandle( hFile );
+    }
+
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Writes to a temporary file and renames it over the entry, so readers and other
+// processes never see a partial entry
+//--------------------------------------------------------------------------------------
+HRESULT WriteShaderCacheEntry( _In_ const std::wstring& strEntry, _In_ UINT64 key,
+                               _In_ const std::vector<DXUT_SHADER_CACHE_DEPENDENCY>& includes, _In_ ID3DBlob* pCode,
+                               _Out_ UINT64& bytesWritten, _Out_ UINT64& bytesReplaced )
+{
+    bytesWritten = 0;
+    bytesReplaced = 0;
+
+    std::vector<BYTE> data;
+    DXUTBuildShaderCacheEntry( key, includes, pCode->GetBufferPointer(), pCode->GetBufferSize(), data );
+
+    WCHAR strSuffix[32];
+    swprintf_s( strSuffix, 32, L".%lx.%lx.tmp", GetCurrentProcessId(), GetCurrentThreadId() );
+    std::wstring strTemp = strEntry + strSuffix;
+
+    HANDLE hFile = CreateFileW( strTemp.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr );
+    if( hFile == INVALID_HANDLE_VALUE )
+        return HRESULT_FROM_WIN32( GetLastError() );
+
+    DWORD BytesWritten = 0;
+    BOOL bWritten = WriteFile( hFile, data.data(), DWORD( data.size() ), &BytesWritten, nullptr );
+    CloseHandle( hFile );
+
+    // A stale or corrupt entry being replaced no longer counts toward the cache size
+    WIN32_FILE_ATTRIBUTE_DATA existing;
+    UINT64 existingBytes = 0;
+    if( GetFileAttributesExW( strEntry.c_str(), GetFileExInfoStandard, &existing ) )
+        existingBytes = ( UINT64( existing.nFileSizeHigh ) << 32 ) | existing.nFileSizeLow;
+
+    if( !bWritten || BytesWritten != data.size()
+        || !MoveFileExW( strTemp.c_str(), strEntry.c_str(), MOVEFILE_REPLACE_EXISTING ) )
+    {
+        DeleteFileW( strTemp.c_str() );
+        return E_FAIL;
+    }
+
+    bytesWritten = data.size();
+    bytesReplaced = existingBytes;
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Lists the entries in the cache directory and returns their total size
+//--------------------------------------------------------------------------------------
+struct ShaderCacheFile
+{
+    std::wstring strName;
+    UINT64 Bytes;
+    UINT64 LastUsed;
+};
+
+UINT64 ScanShaderCache( _In_ const std::wstring& strDirectory, _Out_opt_ std::vector<ShaderCacheFile>* pFiles )
+{
+    if( pFiles )
+        pFiles->clear();
+
+    WIN32_FIND_DATAW fd;
+    std::wstring strPattern = strDirectory + L"*.dxsc";
+    HANDLE hFind = FindFirstFileW( strPattern.c_str(), &fd );
+    if( hFind == INVALID_HANDLE_VALUE )
+        return 0;
+
+    UINT64 totalBytes = 0;
+    do
+    {
+        if( fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY )
+            continue;
+
+        ShaderCacheFile file;
+        file.Bytes = ( UINT64( fd.nFileSizeHigh ) << 32 ) | fd.nFileSizeLow;
+        totalBytes += file.Bytes;
+        if( pFiles )
+        {
+            file.strName = fd.cFileName;
+            file.LastUsed = ( UINT64( fd.ftLastWriteTime.dwHighDateTime ) << 32 ) | fd.ftLastWriteTime.dwLowDateTime;
+            pFiles->push_back( file );
+        }
+    } while( FindNextFileW( hFind, &fd ) );
+
+    FindClose( hFind );
+    return totalBytes;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Only called once the tracked size is over maxBytes.  Rescans the directory, since other
+// processes may share it, and if it really is over, removes the least recently used
+// entries until it is down to three quarters of maxBytes, so the next trim is many writes
+// away.  totalBytes receives the size left.
+//--------------------------------------------------------------------------------------
+UINT TrimShaderCache( _In_ const std::wstring& strDirectory, _In_ UINT64 maxBytes, _Out_ UINT64& totalBytes )
+{
+    std::vector<ShaderCacheFile> files;
+    totalBytes = ScanShaderCache( strDirectory, &files );
+    if( totalBytes <= maxBytes )
+        return 0;
+
+    std::sort( files.begin(), files.end(), []( const ShaderCacheFile& a, const ShaderCacheFile& b ) { return a.LastUsed < b.LastUsed; } );
+
+    UINT nEvicted = 0;
+    UINT64 targetBytes = maxBytes - maxBytes / 4;
+    for( auto it = files.cbegin(); it != files.cend() && totalBytes > targetBytes; ++it )
+    {
+        if( DeleteFileW( ( strDirectory + it->strName ).c_str() ) )
+        {
+            totalBytes -= it->Bytes;
+            ++nEvicted;
+        }
+    }
+
+    return nEvicted;
+}
+
+UINT64 GetShaderFileTime( _In_ const std::wstring& strFileName )
+{
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if( !GetFileAttributesExW( strFileName.c_str(), GetFileExInfoStandard, &data ) )
+        return 0;
+
+    return ( UINT64( data.ftLastWriteTime.dwHighDateTime ) << 32 ) | data.ftLastWriteTime.dwLowDateTime;
+}
+
+std::wstring NormalizeShaderPath( _In_ const std::wstring& strPath )
+{
+    std::wstring str( strPath );
+    for( auto it = str.begin(); it != str.end(); ++it )
+        *it = ( *it == L'/' ) ? L'\\' : towlower( *it );
+    return str;
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT WINAPI DXUTSetShaderCacheDirectory( LPCWSTR szDirectory, UINT64 maxBytes )
+{
+    ShaderCacheState& state = GetShaderCacheState();
+
+    if( !szDirectory || !*szDirectory )
+    {
+        std::lock_guard<std::mutex> lock( state.Lock );
+        state.strDirectory.clear();
+        return S_OK;
+    }
+
+    if( !CreateDirectoryW( szDirectory, nullptr ) && GetLastError() != ERROR_ALREADY_EXISTS )
+        return HRESULT_FROM_WIN32( GetLastError() );
+
+    std::wstring strDirectory( szDirectory );
+    if( strDirectory.back() != L'\\' && strDirectory.back() != L'/' )
+        strDirectory += L'\\';
+
+    // The only full scan until the cache outgrows maxBytes
+    UINT64 cacheBytes = ScanShaderCache( strDirectory, nullptr );
+
+    std::lock_guard<std::mutex> lock( state.Lock );
+    state.strDirectory = strDirectory;
+    state.MaxBytes = maxBytes ? maxBytes : DXUT_SHADER_CACHE_DEFAULT_SIZE;
+    state.CacheBytes = cacheBytes;
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+bool WINAPI DXUTIsShaderCacheEnabled()
+{
+    ShaderCacheState& state = GetShaderCacheState();
+    std::lock_guard<std::mutex> lock( state.Lock );
+    return !state.strDirectory.empty();
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void WINAPI DXUTGetShaderCacheStats( DXUT_SHADER_CACHE_STATS* pStats )
+{
+    if( !pStats )
+        return;
+
+    ShaderCacheState& state = GetShaderCacheState();
+    std::lock_guard<std::mutex> lock( state.Lock );
+    *pStats = state.Stats;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void WINAPI DXUTSetShaderCompiler( LPDXUTSHADERCOMPILER pCompiler, UINT64 compilerId )
+{
+    UINT64 id = pCompiler ? compilerId : GetD3DCompilerId();
+
+    ShaderCacheState& state = GetShaderCacheState();
+    std::lock_guard<std::mutex> lock( state.Lock );
+    state.pCompiler = pCompiler ? pCompiler : D3DCompile;
+    state.CompilerId = id;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT WINAPI DXUTCompileShaderCached( LPCWSTR szFileName, const D3D_SHADER_MACRO* pDefines,
+                                        LPCSTR pEntrypoint, LPCSTR pTarget, UINT Flags1, UINT Flags2,
+                                        ID3DBlob** ppCode, ID3DBlob** ppErrorMsgs,
+                                        std::vector<std::wstring>* pIncludes )
+{
+    if( !szFileName || !pEntrypoint || !pTarget || !ppCode )
+        return E_INVALIDARG;
+
+    *ppCode = nullptr;
+    if( ppErrorMsgs )
+        *ppErrorMsgs = nullptr;
+
+    ShaderCacheState& state = GetShaderCacheState();
+
+    std::wstring strDirectory;
+    UINT64 maxBytes;
+    LPDXUTSHADERCOMPILER pCompiler;
+    UINT64 compilerId;
+    {
+        std::lock_guard<std::mutex> lock( state.Lock );
+        strDirectory = state.strDirectory;
+        maxBytes = state.MaxBytes;
+        pCompiler = state.pCompiler;
+        compilerId = state.CompilerId;
+    }
+
+    HRESULT hr;
+    std::unique_ptr<BYTE[]> source;
+    size_t sourceBytes = 0;
+    V_RETURN( ReadShaderCacheFile( szFileName, FILE_SHARE_READ, source, sourceBytes ) );
+
+    UINT64 key = DXUTComputeShaderCacheKey( compilerId, szFileName, source.get(), sourceBytes, pDefines, pEntrypoint, pTarget, Flags1, Flags2 );
+
+    std::wstring strEntry;
+    if( !strDirectory.empty() )
+    {
+        strEntry = GetShaderCacheEntryPath( strDirectory, key );
+
+        hr = LoadShaderCacheEntry( strEntry, key, ppCode, pIncludes );
+
+        std::lock_guard<std::mutex> lock( state.Lock );
+        if( hr == S_OK )
+        {
+            state.Stats.Hits++;
+            return S_OK;
+        }
+        else if( hr == S_FALSE )
+            state.Stats.Stale++;
+        else
+            state.Stats.Misses++;
+    }
+
+    char pSrcName[MAX_PATH];
+    int result = WideCharToMultiByte( CP_ACP, WC_NO_BEST_FIT_CHARS, szFileName, -1, pSrcName, MAX_PATH, nullptr, FALSE );
+    if ( !result )
+        return E_FAIL;
+
+    const CHAR* pstrName = strrchr( pSrcName, '\\' );
+    pstrName = pstrName ? pstrName + 1 : pSrcName;
+
+    CDXUTIncludeHandler includeHandler( szFileName );
+    hr = pCompiler( source.get(), sourceBytes, pstrName, pDefines, &includeHandler,
+                    pEntrypoint, pTarget, Flags1, Flags2, ppCode, ppErrorMsgs );
+    if( SUCCEEDED( hr ) && pIncludes )
+    {
+        for( size_t i = 0; i < includeHandler.GetNumFiles(); ++i )
+            pIncludes->push_back( includeHandler.GetFilePath( i ) );
+    }
+
+    if( FAILED( hr ) || strDirectory.empty() )
+        return hr;
+
+    // Hash the text the compiler was given, not what the files hold now
+    std::vector<DXUT_SHADER_CACHE_DEPENDENCY> includes( includeHandler.GetNumFiles() );
+    for( size_t i = 0; i < includes.size(); ++i )
+    {
+        includes[i].strPath = includeHandler.GetFilePath( i );
+        includes[i].ContentHash = DXUTHashShaderBytes( DXUT_SHADER_CACHE_HASH_SEED, includeHandler.GetFileData( i ), includeHandler.GetFileBytes( i ) );
+    }
+
+    // A failed write only costs a recompile next time
+    UINT64 bytesWritten = 0;
+    UINT64 bytesReplaced = 0;
+    if( SUCCEEDED( WriteShaderCacheEntry( strEntry, key, includes, *ppCode, bytesWritten, bytesReplaced ) ) )
+    {
+        bool bTrim = false;
+        {
+            std::lock_guard<std::mutex> lock( state.Lock );
+            state.Stats.BytesWritten += bytesWritten;
+            if( state.strDirectory == strDirectory )
+            {
+                state.CacheBytes += bytesWritten;
+                state.CacheBytes -= std::min( state.CacheBytes, bytesReplaced );
+                if( state.CacheBytes > maxBytes && !state.bTrimming )
+                    state.bTrimming = bTrim = true;
+            }
+        }
+
+        if( bTrim )
+        {
+            UINT64 cacheBytes = 0;
+            UINT nEvicted = TrimShaderCache( strDirectory, maxBytes, cacheBytes );
+
+            // The rescan also picks up what other processes wrote
+            std::lock_guard<std::mutex> lock( state.Lock );
+            state.Stats.Evictions += nEvicted;
+            if( state.strDirectory == strDirectory )
+                state.CacheBytes = cacheBytes;
+            state.bTrimming = false;
+        }
+    }
+
+    return hr;
+}
+
+
+//======================================================================================
+// CDXUTShaderBuilder
+//======================================================================================
+
+CDXUTShaderBuilder::CDXUTShaderBuilder()
+{
+}
+
+
+//--------------------------------------------------------------------------------------
+CDXUTShaderBuilder::~CDXUTShaderBuilder()
+{
+    RemoveAllJobs();
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+UINT CDXUTShaderBuilder::AddJob( LPCWSTR szFileName, const D3D_SHADER_MACRO* pDefines,
+                                 LPCSTR pEntrypoint, LPCSTR pTarget, UINT Flags1, UINT Flags2 )
+{
+    Job job;
+    job.strFileName = szFileName;
+    for( const D3D_SHADER_MACRO* pDefine = pDefines; pDefine && pDefine->Name; ++pDefine )
+    {
+        job.Defines.push_back( pDefine->Name );
+        job.Defines.push_back( pDefine->Definition ? pDefine->Definition : "" );
+    }
+    job.strEntrypoint = pEntrypoint;
+    job.strTarget = pTarget;
+    job.Flags1 = Flags1;
+    job.Flags2 = Flags2;
+    job.pCode = nullptr;
+    job.hr = S_FALSE;
+    job.bBuilt = false;
+    job.bRebuilt = false;
+
+    m_Jobs.push_back( job );
+    return UINT( m_Jobs.size() - 1 );
+}
+
+
+//--------------------------------------------------------------------------------------
+void CDXUTShaderBuilder::RemoveAllJobs()
+{
+    for( auto it = m_Jobs.begin(); it != m_Jobs.end(); ++it )
+        SAFE_RELEASE( it->pCode );
+
+    m_Jobs.clear();
+    m_FileTimes.clear();
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void CDXUTShaderBuilder::CompileJob( Job& job )
+{
+    job.bRebuilt = true;
+    job.bBuilt = true;
+    job.Dependencies.clear();
+    SAFE_RELEASE( job.pCode );
+
+    WCHAR str[MAX_PATH];
+    job.hr = DXUTFindDXSDKMediaFileCch( str, MAX_PATH, job.strFileName.c_str() );
+    if( FAILED( job.hr ) )
+        return;
+
+    WCHAR strFullPath[MAX_PATH];
+    if( GetFullPathNameW( str, MAX_PATH, strFullPath, nullptr ) )
+        job.Dependencies.push_back( strFullPath );
+
+    std::vector<D3D_SHADER_MACRO> defines;
+    for( size_t i = 0; i + 1 < job.Defines.size(); i += 2 )
+    {
+        D3D_SHADER_MACRO macro = { job.Defines[i].c_str(), job.Defines[i + 1].c_str() };
+        defines.push_back( macro );
+    }
+    D3D_SHADER_MACRO terminator = { nullptr, nullptr };
+    defines.push_back( terminator );
+
+    UINT Flags1 = job.Flags1;
+#if defined( DEBUG ) || defined( _DEBUG )
+    // Match DXUTCompileFromFile
+    Flags1 |= D3DCOMPILE_DEBUG;
+#endif
+
+    ID3DBlob* pErrorBlob = nullptr;
+    job.hr = DXUTCompileShaderCached( str, defines.data(), job.strEntrypoint.c_str(), job.strTarget.c_str(),
+                                      Flags1, job.Flags2, &job.pCode, &pErrorBlob, &job.Dependencies );
+
+    if( pErrorBlob )
+    {
+        OutputDebugStringA( reinterpret_cast<const char*>( pErrorBlob->GetBufferPointer() ) );
+        pErrorBlob->Release();
+    }
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTShaderBuilder::Build( UINT nThreads )
+{
+    // One query per distinct file, however many jobs include it
+    std::unordered_map<std::wstring, UINT64> currentTimes;
+    std::unordered_set<std::wstring> changed;
+    for( auto it = m_FileTimes.cbegin(); it != m_FileTimes.cend(); ++it )
+    {
+        UINT64 time = GetShaderFileTime( it->first );
+        currentTimes[ it->first ] = time;
+        if( time != it->second )
+            changed.insert( it->first );
+    }
+
+    std::vector<UINT> dirty;
+    for( UINT iJob = 0; iJob < UINT( m_Jobs.size() ); ++iJob )
+    {
+        Job& job = m_Jobs[iJob];
+        job.bRebuilt = false;
+
+        bool bDirty = !job.bBuilt || FAILED( job.hr );
+        for( auto it = job.Dependencies.cbegin(); !bDirty && it != job.Dependencies.cend(); ++it )
+            bDirty = changed.count( NormalizeShaderPath( *it ) ) != 0;
+
+        if( bDirty )
+            dirty.push_back( iJob );
+    }
+
+    if( !dirty.empty() )
+    {
+        if( !nThreads )
+            nThreads = std::max<UINT>( 1, std::thread::hardware_concurrency() );
+        nThreads = std::min<UINT>( nThreads, UINT( dirty.size() ) );
+
+        // Workers pull jobs off a shared counter, so a slow permutation doesn't hold up a
+        // fixed slice of the others
+        std::atomic<size_t> next( 0 );
+        auto worker = [&]()
+        {
+            for( size_t i = next++; i < dirty.size(); i = next++ )
+                CompileJob( m_Jobs[ dirty[i] ] );
+        };
+
+        std::vector<std::thread> threads;
+        for( UINT i = 1; i < nThreads; ++i )
+            threads.push_back( std::thread( worker ) );
+
+        worker();
+
+        for( auto it = threads.begin(); it != threads.end(); ++it )
+            it->join();
+    }
+
+    // Record the dependency times the jobs were built against
+    m_FileTimes.clear();
+    HRESULT hr = S_OK;
+    for( auto it = m_Jobs.cbegin(); it != m_Jobs.cend(); ++it )
+    {
+        if( FAILED( it->hr ) && SUCCEEDED( hr ) )
+            hr = it->hr;
+
+        for( auto dep = it->Dependencies.cbegin(); dep != it->Dependencies.cend(); ++dep )
+        {
+            std::wstring strKey = NormalizeShaderPath( *dep );
+            if( m_FileTimes.count( strKey ) )
+                continue;
+
+            auto current = currentTimes.find( strKey );
+            m_FileTimes[ strKey ] = ( current != currentTimes.end() ) ? current->second : GetShaderFileTime( strKey );
+        }
+    }
+
+    return hr;
+}
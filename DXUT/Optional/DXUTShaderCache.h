@@ -0,0 +1,124 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTShaderCache.h
+//
+// Persistent shader bytecode cache for DXUTCompileFromFile.  Entries are keyed on the
+// compiler, the source, the defines, the entry point, the profile and the compile flags,
+// and record the content hash of every file the shader included so that editing a header
+// invalidates every shader built from it.  The key and the entry format are in
+// DXUTShaderCacheKey.h.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include "DXUTShaderCacheKey.h"
+
+#define DXUT_SHADER_CACHE_DEFAULT_SIZE ( 64 * 1024 * 1024 )
+
+struct DXUT_SHADER_CACHE_STATS
+{
+    UINT Hits;
+    UINT Misses;            // No entry, or a corrupt one
+    UINT Stale;             // Entry found but an included file changed
+    UINT Evictions;
+    UINT64 BytesWritten;
+};
+
+// Same signature as D3DCompile, so the compiler can be replaced by a stand-in
+typedef HRESULT (WINAPI *LPDXUTSHADERCOMPILER)( LPCVOID pSrcData, SIZE_T SrcDataSize, LPCSTR pSourceName,
+                                                const D3D_SHADER_MACRO* pDefines, ID3DInclude* pInclude,
+                                                LPCSTR pEntrypoint, LPCSTR pTarget, UINT Flags1, UINT Flags2,
+                                                ID3DBlob** ppCode, ID3DBlob** ppErrorMsgs );
+
+
+//--------------------------------------------------------------------------------------
+// The cache is off until a directory is set.  Passing nullptr turns it off again.  When the
+// cache grows past maxBytes the least recently used entries are removed.  The directory is
+// scanned here and then only when the size counted per write passes maxBytes.
+//--------------------------------------------------------------------------------------
+HRESULT WINAPI DXUTSetShaderCacheDirectory( _In_opt_z_ LPCWSTR szDirectory, _In_ UINT64 maxBytes = DXUT_SHADER_CACHE_DEFAULT_SIZE );
+bool WINAPI DXUTIsShaderCacheEnabled();
+void WINAPI DXUTGetShaderCacheStats( _Out_ DXUT_SHADER_CACHE_STATS* pStats );
+
+// nullptr restores D3DCompile, which is identified in the cache key by the d3dcompiler DLL
+// loaded.  A stand-in compiler is identified by compilerId instead, so change it whenever
+// the stand-in's output changes.
+void WINAPI DXUTSetShaderCompiler( _In_opt_ LPDXUTSHADERCOMPILER pCompiler, _In_ UINT64 compilerId = 0 );
+
+// Compiles szFileName, a path already resolved through the media search, going through the
+// cache.  Includes are resolved relative to the including file, and the full paths of the
+// files included are appended to pIncludes.
+HRESULT WINAPI DXUTCompileShaderCached( _In_z_ LPCWSTR szFileName,
+                                        _In_reads_opt_(_Inexpressible_(pDefines->Name != NULL)) const D3D_SHADER_MACRO* pDefines,
+                                        _In_z_ LPCSTR pEntrypoint, _In_z_ LPCSTR pTarget,
+                                        _In_ UINT Flags1, _In_ UINT Flags2,
+                                        _Outptr_ ID3DBlob** ppCode, _Outptr_opt_result_maybenull_ ID3DBlob** ppErrorMsgs,
+                                        _Inout_opt_ std::vector<std::wstring>* pIncludes = nullptr );
+
+
+//--------------------------------------------------------------------------------------
+// Compiles a set of shader permutations across a pool of worker threads.  The builder keeps
+// the include graph of every job, so after a header is edited Build() recompiles only the
+// jobs that include it, directly or not.  Jobs go through DXUTCompileShaderCached, so they
+// use the bytecode cache and compiler set above.
+//--------------------------------------------------------------------------------------
+class CDXUTShaderBuilder
+{
+public:
+    CDXUTShaderBuilder();
+    ~CDXUTShaderBuilder();
+
+    // Returns the job index.  The file is found through the media search path at build time,
+    // and the defines and names are copied.
+    UINT AddJob( _In_z_ LPCWSTR szFileName,
+                 _In_reads_opt_(_Inexpressible_(pDefines->Name != NULL)) const D3D_SHADER_MACRO* pDefines,
+                 _In_z_ LPCSTR pEntrypoint, _In_z_ LPCSTR pTarget,
+                 _In_ UINT Flags1 = 0, _In_ UINT Flags2 = 0 );
+    void RemoveAllJobs();
+
+    // Compiles jobs never built, jobs that failed and jobs with a changed dependency.  nThreads
+    // of 0 uses one thread per hardware thread.  Returns the first failure, if any.
+    HRESULT Build( _In_ UINT nThreads = 0 );
+
+    UINT GetNumJobs() const { return UINT( m_Jobs.size() ); }
+    ID3DBlob* GetCode( _In_ UINT iJob ) const { return ( iJob < m_Jobs.size() ) ? m_Jobs[iJob].pCode : nullptr; }
+    HRESULT GetResult( _In_ UINT iJob ) const { return ( iJob < m_Jobs.size() ) ? m_Jobs[iJob].hr : E_INVALIDARG; }
+
+    // True if the last Build compiled the job, so shaders made from it must be recreated
+    bool WasRebuilt( _In_ UINT iJob ) const { return ( iJob < m_Jobs.size() ) && m_Jobs[iJob].bRebuilt; }
+
+private:
+    // Not copyable, the blobs are owned
+    CDXUTShaderBuilder( const CDXUTShaderBuilder& );
+    CDXUTShaderBuilder& operator=( const CDXUTShaderBuilder& );
+
+    struct Job
+    {
+        std::wstring strFileName;
+        std::vector<std::string> Defines;   // Name, definition pairs
+        std::string strEntrypoint;
+        std::string strTarget;
+        UINT Flags1;
+        UINT Flags2;
+        ID3DBlob* pCode;
+        HRESULT hr;
+        bool bBuilt;
+        bool bRebuilt;
+        std::vector<std::wstring> Dependencies;     // Resolved source and every include
+    };
+
+    void CompileJob( _Inout_ Job& job );
+
+    std::vector<Job> m_Jobs;
+    std::unordered_map<std::wstring, UINT64> m_FileTimes;  // Last write time of each dependency when built
+};
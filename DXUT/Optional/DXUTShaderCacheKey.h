@@ -0,0 +1,238 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTShaderCacheKey.h
+//
+// Cache keys, the entry file format and the checks that decide whether a cached entry can
+// be used, for the shader bytecode cache.  Has no Direct3D or Windows dependency, so the
+// cache logic can be driven by a stand-in compiler and an in-memory file system.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <wctype.h>
+#include <string>
+#include <vector>
+
+//--------------------------------------------------------------------------------------
+// File layout, one file named <key>.dxsc per entry:
+//   DXUT_SHADER_CACHE_HEADER
+//   DXUT_SHADER_CACHE_INCLUDE + wchar_t path, NumIncludes times
+//   Bytecode
+//--------------------------------------------------------------------------------------
+#define DXUT_SHADER_CACHE_MAGIC 0x43535844 // "DXSC"
+#define DXUT_SHADER_CACHE_VERSION 2
+#define DXUT_SHADER_CACHE_MAX_PATH 260
+
+#pragma pack(push,8)
+
+struct DXUT_SHADER_CACHE_HEADER
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint64_t Key;
+    uint32_t NumIncludes;
+    uint32_t BytecodeBytes;
+};
+
+struct DXUT_SHADER_CACHE_INCLUDE
+{
+    uint64_t ContentHash;
+    uint32_t NameLength;    // In characters, no terminator is stored
+    uint32_t Reserved;
+};
+
+#pragma pack(pop)
+
+static_assert( sizeof(DXUT_SHADER_CACHE_HEADER) == 24, "DXUT shader cache structure size incorrect" );
+static_assert( sizeof(DXUT_SHADER_CACHE_INCLUDE) == 16, "DXUT shader cache structure size incorrect" );
+
+// A file the shader included, and the hash of the contents it was compiled against
+struct DXUT_SHADER_CACHE_DEPENDENCY
+{
+    std::wstring strPath;
+    uint64_t ContentHash;
+};
+
+enum DXUT_SHADER_CACHE_LOOKUP
+{
+    DXUT_SHADER_CACHE_HIT,
+    DXUT_SHADER_CACHE_STALE,        // Entry is sound but an included file changed or is gone
+    DXUT_SHADER_CACHE_MISS,         // Entry is corrupt, or for another key or format version
+};
+
+
+//--------------------------------------------------------------------------------------
+// FNV-1a, 64-bit
+//--------------------------------------------------------------------------------------
+const uint64_t DXUT_SHADER_CACHE_HASH_SEED = 14695981039346656037ULL;
+
+inline uint64_t DXUTHashShaderBytes( uint64_t hash, const void* pData, size_t bytes )
+{
+    auto pBytes = reinterpret_cast<const uint8_t*>( pData );
+    for( size_t i = 0; i < bytes; ++i )
+    {
+        hash ^= pBytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Includes the terminator, so "ab","c" and "a","bc" hash differently
+inline uint64_t DXUTHashShaderString( uint64_t hash, const char* str )
+{
+    if( !str )
+        str = "";
+    return DXUTHashShaderBytes( hash, str, strlen( str ) + 1 );
+}
+
+
+//--------------------------------------------------------------------------------------
+// compilerId identifies the compiler binary, so bytecode built by one compiler is never
+// handed out for another.  TMacro is D3D_SHADER_MACRO or anything with the same Name and
+// Definition members, in a list ended by a null Name.
+//--------------------------------------------------------------------------------------
+template<class TMacro>
+uint64_t DXUTComputeShaderCacheKey( uint64_t compilerId, const wchar_t* szFileName, const void* pSrc, size_t srcBytes,
+                                    const TMacro* pDefines, const char* pEntrypoint, const char* pTarget,
+                                    uint32_t Flags1, uint32_t Flags2 )
+{
+    uint64_t hash = DXUT_SHADER_CACHE_HASH_SEED;
+
+    const uint32_t version[] = { DXUT_SHADER_CACHE_VERSION, Flags1, Flags2 };
+    hash = DXUTHashShaderBytes( hash, version, sizeof( version ) );
+    hash = DXUTHashShaderBytes( hash, &compilerId, sizeof( compilerId ) );
+
+    // Includes resolve relative to the source, so the same text in two places is two entries
+    for( const wchar_t* p = szFileName; *p; ++p )
+    {
+        wchar_t ch = wchar_t( towlower( *p ) );
+        hash = DXUTHashShaderBytes( hash, &ch, sizeof( ch ) );
+    }
+
+    hash = DXUTHashShaderBytes( hash, pSrc, srcBytes );
+
+    uint32_t nDefines = 0;
+    for( const TMacro* pDefine = pDefines; pDefine && pDefine->Name; ++pDefine, ++nDefines )
+    {
+        hash = DXUTHashShaderString( hash, pDefine->Name );
+        hash = DXUTHashShaderString( hash, pDefine->Definition );
+    }
+    hash = DXUTHashShaderBytes( hash, &nDefines, sizeof( nDefines ) );
+
+    hash = DXUTHashShaderString( hash, pEntrypoint );
+    hash = DXUTHashShaderString( hash, pTarget );
+    return hash;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Lays out an entry in data, replacing what it held
+//--------------------------------------------------------------------------------------
+inline void DXUTBuildShaderCacheEntry( uint64_t key, const std::vector<DXUT_SHADER_CACHE_DEPENDENCY>& includes,
+                                       const void* pBytecode, size_t bytecodeBytes, std::vector<uint8_t>& data )
+{
+    data.resize( sizeof( DXUT_SHADER_CACHE_HEADER ) );
+
+    DXUT_SHADER_CACHE_HEADER header;
+    header.Magic = DXUT_SHADER_CACHE_MAGIC;
+    header.Version = DXUT_SHADER_CACHE_VERSION;
+    header.Key = key;
+    header.NumIncludes = uint32_t( includes.size() );
+    header.BytecodeBytes = uint32_t( bytecodeBytes );
+    memcpy( data.data(), &header, sizeof( header ) );
+
+    for( auto it = includes.cbegin(); it != includes.cend(); ++it )
+    {
+        DXUT_SHADER_CACHE_INCLUDE include;
+        include.ContentHash = it->ContentHash;
+        include.NameLength = uint32_t( it->strPath.length() );
+        include.Reserved = 0;
+
+        auto pInclude = reinterpret_cast<const uint8_t*>( &include );
+        data.insert( data.end(), pInclude, pInclude + sizeof( include ) );
+
+        auto pName = reinterpret_cast<const uint8_t*>( it->strPath.c_str() );
+        data.insert( data.end(), pName, pName + it->strPath.length() * sizeof( wchar_t ) );
+    }
+
+    auto pCode = reinterpret_cast<const uint8_t*>( pBytecode );
+    data.insert( data.end(), pCode, pCode + bytecodeBytes );
+}
+
+
+//--------------------------------------------------------------------------------------
+// Checks an entry read back from the cache.  hashFile( const std::wstring& strPath,
+// uint64_t& hash ) hashes the current contents of an included file and returns false if it
+// can't be read.  On a hit ppBytecode points into pData, and the included files are
+// appended to pIncludes; on anything else pIncludes is left as it was.
+//--------------------------------------------------------------------------------------
+template<class THashFile>
+DXUT_SHADER_CACHE_LOOKUP DXUTCheckShaderCacheEntry( const uint8_t* pData, size_t bytes, uint64_t key, THashFile hashFile,
+                                                    std::vector<std::wstring>* pIncludes,
+                                                    const uint8_t** ppBytecode, uint32_t* pBytecodeBytes )
+{
+    *ppBytecode = nullptr;
+    *pBytecodeBytes = 0;
+
+    if( !pData || bytes < sizeof( DXUT_SHADER_CACHE_HEADER ) )
+        return DXUT_SHADER_CACHE_MISS;
+
+    DXUT_SHADER_CACHE_HEADER header;
+    memcpy( &header, pData, sizeof( header ) );
+    if( header.Magic != DXUT_SHADER_CACHE_MAGIC || header.Version != DXUT_SHADER_CACHE_VERSION || header.Key != key )
+        return DXUT_SHADER_CACHE_MISS;
+
+    // Every name is read before any file is hashed, so a corrupt entry is a miss however
+    // its includes compare
+    std::vector<DXUT_SHADER_CACHE_DEPENDENCY> includes;
+    size_t offset = sizeof( DXUT_SHADER_CACHE_HEADER );
+    for( uint32_t i = 0; i < header.NumIncludes; ++i )
+    {
+        if( bytes - offset < sizeof( DXUT_SHADER_CACHE_INCLUDE ) )
+            return DXUT_SHADER_CACHE_MISS;
+
+        DXUT_SHADER_CACHE_INCLUDE include;
+        memcpy( &include, pData + offset, sizeof( include ) );
+        offset += sizeof( DXUT_SHADER_CACHE_INCLUDE );
+
+        if( include.NameLength >= DXUT_SHADER_CACHE_MAX_PATH || ( bytes - offset ) < include.NameLength * sizeof( wchar_t ) )
+            return DXUT_SHADER_CACHE_MISS;
+
+        DXUT_SHADER_CACHE_DEPENDENCY dependency;
+        dependency.strPath.resize( include.NameLength );
+        memcpy( &dependency.strPath[0], pData + offset, include.NameLength * sizeof( wchar_t ) );
+        dependency.ContentHash = include.ContentHash;
+        offset += include.NameLength * sizeof( wchar_t );
+
+        includes.push_back( dependency );
+    }
+
+    if( !header.BytecodeBytes || bytes - offset != header.BytecodeBytes )
+        return DXUT_SHADER_CACHE_MISS;
+
+    for( auto it = includes.cbegin(); it != includes.cend(); ++it )
+    {
+        uint64_t hash = 0;
+        if( !hashFile( it->strPath, hash ) || hash != it->ContentHash )
+            return DXUT_SHADER_CACHE_STALE;
+    }
+
+    if( pIncludes )
+    {
+        for( auto it = includes.cbegin(); it != includes.cend(); ++it )
+            pIncludes->push_back( it->strPath );
+    }
+
+    *ppBytecode = pData + offset;
+    *pBytecodeBytes = header.BytecodeBytes;
+    return DXUT_SHADER_CACHE_HIT;
+}
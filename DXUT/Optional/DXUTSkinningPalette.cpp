@@ -0,0 +1,135 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTSkinningPalette.cpp
+//
+// Double-buffered skinning palette upload
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUT.h"
+#include "DXUTSkinningPalette.h"
+
+//--------------------------------------------------------------------------------------
+CDXUTSkinningPaletteBuffer::CDXUTSkinningPaletteBuffer() :
+    m_iCurrent( 0 ),
+    m_nMaxBones( 0 ),
+    m_Format( SDKMESH_PALETTE_FLOAT4X4 )
+{
+    m_pBuffers[0] = m_pBuffers[1] = nullptr;
+    m_pSRVs[0] = m_pSRVs[1] = nullptr;
+}
+
+
+//--------------------------------------------------------------------------------------
+CDXUTSkinningPaletteBuffer::~CDXUTSkinningPaletteBuffer()
+{
+    OnD3D11DestroyDevice();
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTSkinningPaletteBuffer::OnD3D11CreateDevice( ID3D11Device* pd3dDevice, UINT nMaxBones, SDKMESH_PALETTE_FORMAT format,
+                                                         bool bStructured )
+{
+    UINT nStride = CDXUTSDKMesh::GetPaletteStride( format );
+    if( !pd3dDevice || !nMaxBones || !nStride )
+        return E_INVALIDARG;
+
+    UINT64 nBytes = UINT64( nMaxBones ) * nStride;
+    if( !bStructured && nBytes > D3D11_REQ_CONSTANT_BUFFER_ELEMENT_COUNT * 16 )
+        return E_INVALIDARG;
+    if( nBytes > UINT_MAX )
+        return E_INVALIDARG;
+
+    OnD3D11DestroyDevice();
+
+    D3D11_BUFFER_DESC bufferDesc;
+    bufferDesc.ByteWidth = UINT( nBytes );
+    bufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+    bufferDesc.BindFlags = bStructured ? D3D11_BIND_SHADER_RESOURCE : D3D11_BIND_CONSTANT_BUFFER;
+    bufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    bufferDesc.MiscFlags = bStructured ? D3D11_RESOURCE_MISC_BUFFER_STRUCTURED : 0;
+    bufferDesc.StructureByteStride = bStructured ? nStride : 0;
+
+    HRESULT hr;
+    for( UINT i = 0; i < 2; i++ )
+    {
+        hr = pd3dDevice->CreateBuffer( &bufferDesc, nullptr, &m_pBuffers[i] );
+        if( FAILED( hr ) )
+            break;
+        DXUT_SetDebugName( m_pBuffers[i], "CDXUTSkinningPaletteBuffer" );
+
+        if( bStructured )
+        {
+            D3D11_SHADER_RESOURCE_VIEW_DESC SRVDesc;
+            ZeroMemory( &SRVDesc, sizeof( SRVDesc ) );
+            SRVDesc.Format = DXGI_FORMAT_UNKNOWN;
+            SRVDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+            SRVDesc.Buffer.FirstElement = 0;
+            SRVDesc.Buffer.NumElements = nMaxBones;
+
+            hr = pd3dDevice->CreateShaderResourceView( m_pBuffers[i], &SRVDesc, &m_pSRVs[i] );
+            if( FAILED( hr ) )
+                break;
+            DXUT_SetDebugName( m_pSRVs[i], "CDXUTSkinningPaletteBuffer" );
+        }
+    }
+
+    if( FAILED( hr ) )
+    {
+        OnD3D11DestroyDevice();
+        return DXUT_ERR( L"CDXUTSkinningPaletteBuffer::OnD3D11CreateDevice", hr );
+    }
+
+    m_iCurrent = 0;
+    m_nMaxBones = nMaxBones;
+    m_Format = format;
+
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+void CDXUTSkinningPaletteBuffer::OnD3D11DestroyDevice()
+{
+    for( UINT i = 0; i < 2; i++ )
+    {
+        SAFE_RELEASE( m_pSRVs[i] );
+        SAFE_RELEASE( m_pBuffers[i] );
+    }
+    m_nMaxBones = 0;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTSkinningPaletteBuffer::Update( ID3D11DeviceContext* pd3dDeviceContext, const CDXUTSDKMesh& mesh, UINT iMesh )
+{
+    if( !pd3dDeviceContext || iMesh >= mesh.GetNumMeshes() || mesh.GetNumInfluences( iMesh ) > m_nMaxBones )
+        return E_INVALIDARG;
+
+    if( !m_pBuffers[0] )
+        return E_FAIL;
+
+    UINT iNext = m_iCurrent ^ 1;
+
+    HRESULT hr;
+    D3D11_MAPPED_SUBRESOURCE mapped;
+    V_RETURN( pd3dDeviceContext->Map( m_pBuffers[iNext], 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped ) );
+    hr = mesh.GetMeshInfluencePalette( iMesh, m_Format, mapped.pData, size_t( m_nMaxBones ) * CDXUTSDKMesh::GetPaletteStride( m_Format ) );
+    pd3dDeviceContext->Unmap( m_pBuffers[iNext], 0 );
+    DXUTCountAPICalls( DXUT_API_UPDATE );
+
+    if( FAILED( hr ) )
+        return hr;
+
+    m_iCurrent = iNext;
+    return S_OK;
+}
@@ -0,0 +1,59 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTSkinningPalette.h
+//
+// Uploads an SDKmesh skinning palette straight into a pair of GPU buffers, written in
+// turn, so the previous frame's palette stays available, for example for motion vectors.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+#include "SDKmesh.h"
+
+//--------------------------------------------------------------------------------------
+// Either two constant buffers, holding an array of nMaxBones palette elements, or two
+// structured buffers with shader resource views, one element per bone.  Update maps the
+// buffer not written last with WRITE_DISCARD and has the mesh write its palette into the
+// mapping, so there is no intermediate copy.  A constant buffer holds at most 64KB: 1024
+// bones as float4x4, 1365 as float4x3 and 2048 as dual quaternions.
+//--------------------------------------------------------------------------------------
+class CDXUTSkinningPaletteBuffer
+{
+public:
+    CDXUTSkinningPaletteBuffer();
+    ~CDXUTSkinningPaletteBuffer();
+
+    HRESULT OnD3D11CreateDevice( _In_ ID3D11Device* pd3dDevice, _In_ UINT nMaxBones, _In_ SDKMESH_PALETTE_FORMAT format,
+                                 _In_ bool bStructured );
+    void OnD3D11DestroyDevice();
+
+    // Writes the palette left by the mesh's last TransformMesh.  Fails without touching
+    // either buffer when the mesh has more influences than nMaxBones.
+    HRESULT Update( _In_ ID3D11DeviceContext* pd3dDeviceContext, _In_ const CDXUTSDKMesh& mesh, _In_ UINT iMesh );
+
+    // The palette written by the last Update, and the one before it
+    ID3D11Buffer* GetBuffer() const { return m_pBuffers[m_iCurrent]; }
+    ID3D11Buffer* GetPreviousBuffer() const { return m_pBuffers[m_iCurrent ^ 1]; }
+    ID3D11ShaderResourceView* GetSRV() const { return m_pSRVs[m_iCurrent]; }
+    ID3D11ShaderResourceView* GetPreviousSRV() const { return m_pSRVs[m_iCurrent ^ 1]; }
+
+    SDKMESH_PALETTE_FORMAT GetFormat() const { return m_Format; }
+    UINT GetMaxBones() const { return m_nMaxBones; }
+
+private:
+    CDXUTSkinningPaletteBuffer( const CDXUTSkinningPaletteBuffer& );
+    CDXUTSkinningPaletteBuffer& operator=( const CDXUTSkinningPaletteBuffer& );
+
+    ID3D11Buffer* m_pBuffers[2];
+    ID3D11ShaderResourceView* m_pSRVs[2];   // Structured buffers only
+    UINT m_iCurrent;
+    UINT m_nMaxBones;
+    SDKMESH_PALETTE_FORMAT m_Format;
+};
@@ -0,0 +1,247 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTStreamingPolicy.h
+//
+// Decides which mips of each streamed texture should be resident, given the screen-space
+// size asked for and a global memory budget.  Has no Direct3D or Windows dependency, so
+// the policy can be driven by a simulated device.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+#include <stdint.h>
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <vector>
+
+#define DXUT_STREAMING_MAX_MIPS 16
+
+//--------------------------------------------------------------------------------------
+// Mips are numbered from the most detailed.  Everything from a texture's resident mip to
+// the end of its chain is in memory; the mips from TailMip on never leave.
+//--------------------------------------------------------------------------------------
+struct DXUT_STREAMING_TEXTURE
+{
+    // Set by the owner when the texture is added
+    uint32_t Width;
+    uint32_t Height;
+    uint32_t MipCount;
+    uint32_t TailMip;
+    uint64_t MipBytes[DXUT_STREAMING_MAX_MIPS];
+
+    // Most detailed mip ever wanted; raised by the owner to stop a texture streaming
+    uint32_t MinMip;
+
+    // Largest edge in pixels asked for in the frame LastRequestFrame; 0 until first asked
+    uint32_t RequestedPixels;
+    uint64_t LastRequestFrame;
+
+    // Kept current by the owner.  PendingMip is the target of the upgrade in flight, or
+    // ResidentMip when there is none.
+    uint32_t ResidentMip;
+    uint32_t PendingMip;
+
+    // Written by Schedule
+    uint32_t DesiredMip;
+};
+
+struct DXUT_STREAMING_REQUEST
+{
+    uint32_t Texture;           // Index into the array given to Schedule
+    uint32_t TargetMip;
+    double Priority;            // Requests are sorted by this, highest first
+};
+
+
+//--------------------------------------------------------------------------------------
+class CDXUTStreamingPolicy
+{
+public:
+    CDXUTStreamingPolicy() :
+        m_nBudgetBytes( 0 ),
+        m_nIdleFrames( 30 ),
+        m_nMaxUpgradesInFlight( 4 ),
+        m_nIdealBytes( 0 ),
+        m_nDesiredBytes( 0 ),
+        m_nCommittedBytes( 0 )
+    {
+    }
+
+    // 0 is no budget: every texture gets the mips its screen size asks for
+    void SetBudget( uint64_t nBytes ) { m_nBudgetBytes = nBytes; }
+    uint64_t GetBudget() const { return m_nBudgetBytes; }
+
+    // Textures not asked for in this many frames fall back to their tail
+    void SetIdleFrames( uint64_t nFrames ) { m_nIdleFrames = nFrames; }
+    void SetMaxUpgradesInFlight( uint32_t nUpgrades ) { m_nMaxUpgradesInFlight = std::max<uint32_t>( nUpgrades, 1 ); }
+
+    // From the last Schedule: what the screen sizes ask for, what fits the budget, and
+    // what is resident or in flight once the downgrades and upgrades issued are applied
+    uint64_t GetIdealBytes() const { return m_nIdealBytes; }
+    uint64_t GetDesiredBytes() const { return m_nDesiredBytes; }
+    uint64_t GetCommittedBytes() const { return m_nCommittedBytes; }
+
+    static uint32_t MipSize( const DXUT_STREAMING_TEXTURE& tex, uint32_t nMip )
+    {
+        return std::max<uint32_t>( std::max<uint32_t>( tex.Width, tex.Height ) >> nMip, 1 );
+    }
+
+    // Bytes in memory when nMip is the most detailed mip resident
+    static uint64_t BytesFrom( const DXUT_STREAMING_TEXTURE& tex, uint32_t nMip )
+    {
+        uint64_t nBytes = 0;
+        for( uint32_t iMip = nMip; iMip < tex.MipCount; ++iMip )
+            nBytes += tex.MipBytes[iMip];
+        return nBytes;
+    }
+
+    // The least detailed mip still at least as large as the size asked for
+    uint32_t GetIdealMip( const DXUT_STREAMING_TEXTURE& tex, uint64_t nFrame ) const
+    {
+        if( !tex.RequestedPixels || nFrame - tex.LastRequestFrame > m_nIdleFrames )
+            return tex.TailMip;
+
+        uint32_t nMip = std::min<uint32_t>( tex.MinMip, tex.TailMip );
+        while( nMip < tex.TailMip && MipSize( tex, nMip + 1 ) >= tex.RequestedPixels )
+            ++nMip;
+        return nMip;
+    }
+
+    //----------------------------------------------------------------------------------
+    // Sets every DesiredMip, then fills upgrades and downgrades, each sorted by priority.
+    //
+    // Over budget, mips are dropped one at a time from whichever texture loses least for
+    // the bytes it frees, measured as screen pixels per texel after the drop.  Downgrades
+    // free memory, so they come first, largest first.  The owner applies all of them:
+    // a downgrade below an upgrade in flight cancels that upgrade.  Upgrades go blurriest
+    // first, and are only issued while everything resident or in flight fits the budget
+    // and fewer than the in-flight limit are outstanding.
+    //----------------------------------------------------------------------------------
+    void Schedule( std::vector<DXUT_STREAMING_TEXTURE>& textures, uint64_t nFrame,
+                   std::vector<DXUT_STREAMING_REQUEST>& upgrades, std::vector<DXUT_STREAMING_REQUEST>& downgrades )
+    {
+        upgrades.clear();
+        downgrades.clear();
+
+        uint64_t nDesired = 0;
+        for( size_t i = 0; i < textures.size(); ++i )
+        {
+            DXUT_STREAMING_TEXTURE& tex = textures[i];
+            tex.DesiredMip = GetIdealMip( tex, nFrame );
+            nDesired += BytesFrom( tex, tex.DesiredMip );
+        }
+        m_nIdealBytes = nDesired;
+
+        if( m_nBudgetBytes && nDesired > m_nBudgetBytes )
+        {
+            // Min-heap on the loss per byte of dropping each texture's top desired mip
+            typedef std::pair<double, uint32_t> Candidate;
+            std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> heap;
+            for( size_t i = 0; i < textures.size(); ++i )
+            {
+                if( textures[i].DesiredMip < textures[i].TailMip )
+                    heap.push( Candidate( DropCost( textures[i] ), uint32_t( i ) ) );
+            }
+
+            while( nDesired > m_nBudgetBytes && !heap.empty() )
+            {
+                DXUT_STREAMING_TEXTURE& tex = textures[heap.top().second];
+                uint32_t iTexture = heap.top().second;
+                heap.pop();
+
+                nDesired -= tex.MipBytes[tex.DesiredMip];
+                ++tex.DesiredMip;
+                if( tex.DesiredMip < tex.TailMip )
+                    heap.push( Candidate( DropCost( tex ), iTexture ) );
+            }
+        }
+        m_nDesiredBytes = nDesired;
+
+        uint64_t nCommitted = 0;
+        uint32_t nInFlight = 0;
+        for( size_t i = 0; i < textures.size(); ++i )
+        {
+            const DXUT_STREAMING_TEXTURE& tex = textures[i];
+            uint32_t nTop = std::min<uint32_t>( tex.ResidentMip, tex.PendingMip );
+            if( tex.PendingMip < tex.ResidentMip )
+                ++nInFlight;
+
+            if( nTop < tex.DesiredMip )
+            {
+                DXUT_STREAMING_REQUEST request;
+                request.Texture = uint32_t( i );
+                request.TargetMip = tex.DesiredMip;
+                request.Priority = double( BytesFrom( tex, nTop ) - BytesFrom( tex, tex.DesiredMip ) );
+                downgrades.push_back( request );
+
+                if( tex.PendingMip < tex.ResidentMip )
+                    --nInFlight;
+                nCommitted += BytesFrom( tex, tex.DesiredMip );
+            }
+            else
+            {
+                nCommitted += BytesFrom( tex, nTop );
+
+                // One upgrade at a time per texture; the next starts from where it lands
+                if( tex.DesiredMip < tex.ResidentMip && tex.PendingMip == tex.ResidentMip )
+                {
+                    DXUT_STREAMING_REQUEST request;
+                    request.Texture = uint32_t( i );
+                    request.TargetMip = tex.DesiredMip;
+                    request.Priority = double( tex.RequestedPixels ) / double( MipSize( tex, tex.ResidentMip ) );
+                    upgrades.push_back( request );
+                }
+            }
+        }
+
+        std::sort( downgrades.begin(), downgrades.end(), HigherPriority );
+        std::sort( upgrades.begin(), upgrades.end(), HigherPriority );
+
+        size_t nIssued = 0;
+        for( size_t i = 0; i < upgrades.size() && nInFlight < m_nMaxUpgradesInFlight; ++i )
+        {
+            const DXUT_STREAMING_TEXTURE& tex = textures[upgrades[i].Texture];
+            uint64_t nExtra = BytesFrom( tex, upgrades[i].TargetMip ) - BytesFrom( tex, tex.ResidentMip );
+            if( m_nBudgetBytes && nCommitted + nExtra > m_nBudgetBytes )
+                continue;
+
+            nCommitted += nExtra;
+            ++nInFlight;
+            upgrades[nIssued++] = upgrades[i];
+        }
+        upgrades.resize( nIssued );
+
+        m_nCommittedBytes = nCommitted;
+    }
+
+private:
+    static bool HigherPriority( const DXUT_STREAMING_REQUEST& a, const DXUT_STREAMING_REQUEST& b )
+    {
+        if( a.Priority != b.Priority )
+            return a.Priority > b.Priority;
+        return a.Texture < b.Texture;
+    }
+
+    // Magnification dropping the top desired mip would cause, per byte it frees
+    static double DropCost( const DXUT_STREAMING_TEXTURE& tex )
+    {
+        double fMagnification = double( tex.RequestedPixels ) / double( MipSize( tex, tex.DesiredMip + 1 ) );
+        double fBytes = double( std::max<uint64_t>( tex.MipBytes[tex.DesiredMip], 1 ) );
+        return fMagnification * fMagnification / fBytes;
+    }
+
+    uint64_t m_nBudgetBytes;
+    uint64_t m_nIdleFrames;
+    uint32_t m_nMaxUpgradesInFlight;
+    uint64_t m_nIdealBytes;
+    uint64_t m_nDesiredBytes;
+    uint64_t m_nCommittedBytes;
+};
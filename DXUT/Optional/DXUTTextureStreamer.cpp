@@ -0,0 +1,900 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTTextureStreamer.cpp
+//
+// Budgeted mip streaming for DDS textures
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUT.h"
+#include "DXUTTextureStreamer.h"
+#include "DXUTarchive.h"
+#include "SDKmisc.h"
+
+namespace
+{
+
+// Mips this size or smaller stay resident
+const UINT c_nTailSize = 64;
+
+// Reads are split so each fits a DWORD
+const size_t c_nMaxReadChunk = 64 * 1024 * 1024;
+
+#ifndef MAKEFOURCC
+    #define MAKEFOURCC(ch0, ch1, ch2, ch3)                              \
+                ((uint32_t)(uint8_t)(ch0) | ((uint32_t)(uint8_t)(ch1) << 8) |       \
+                ((uint32_t)(uint8_t)(ch2) << 16) | ((uint32_t)(uint8_t)(ch3) << 24 ))
+#endif /* defined(MAKEFOURCC) */
+
+// The parts of the DDS layout the streamer reads; see DDSTextureLoader.cpp
+const uint32_t DDS_MAGIC = 0x20534444; // "DDS "
+
+#define DDS_FOURCC      0x00000004  // DDPF_FOURCC
+#define DDS_RGB         0x00000040  // DDPF_RGB
+#define DDS_HEADER_FLAGS_VOLUME 0x00800000  // DDSD_DEPTH
+#define DDS_CUBEMAP     0x00000200  // DDSCAPS2_CUBEMAP
+
+#pragma pack(push,1)
+
+struct DDS_PIXELFORMAT
+{
+    uint32_t    size;
+    uint32_t    flags;
+    uint32_t    fourCC;
+    uint32_t    RGBBitCount;
+    uint32_t    RBitMask;
+    uint32_t    GBitMask;
+    uint32_t    BBitMask;
+    uint32_t    ABitMask;
+};
+
+struct DDS_HEADER
+{
+    uint32_t        size;
+    uint32_t        flags;
+    uint32_t        height;
+    uint32_t        width;
+    uint32_t        pitchOrLinearSize;
+    uint32_t        depth;
+    uint32_t        mipMapCount;
+    uint32_t        reserved1[11];
+    DDS_PIXELFORMAT ddspf;
+    uint32_t        caps;
+    uint32_t        caps2;
+    uint32_t        caps3;
+    uint32_t        caps4;
+    uint32_t        reserved2;
+};
+
+struct DDS_HEADER_DXT10
+{
+    DXGI_FORMAT     dxgiFormat;
+    uint32_t        resourceDimension;
+    uint32_t        miscFlag;
+    uint32_t        arraySize;
+    uint32_t        miscFlags2;
+};
+
+#pragma pack(pop)
+
+
+//--------------------------------------------------------------------------------------
+// Formats that can stream: bytes per 4x4 block when block compressed, else per pixel
+//--------------------------------------------------------------------------------------
+bool GetStreamFormatInfo( _In_ DXGI_FORMAT format, _Out_ bool* pbBlock, _Out_ UINT* pnBytes )
+{
+    *pbBlock = false;
+    *pnBytes = 0;
+
+    switch( format )
+    {
+    case DXGI_FORMAT_BC1_UNORM:
+    case DXGI_FORMAT_BC1_UNORM_SRGB:
+    case DXGI_FORMAT_BC4_UNORM:
+    case DXGI_FORMAT_BC4_SNORM:
+        *pbBlock = true;
+        *pnBytes = 8;
+        return true;
+
+    case DXGI_FORMAT_BC2_UNORM:
+    case DXGI_FORMAT_BC2_UNORM_SRGB:
+    case DXGI_FORMAT_BC3_UNORM:
+    case DXGI_FORMAT_BC3_UNORM_SRGB:
+    case DXGI_FORMAT_BC5_UNORM:
+    case DXGI_FORMAT_BC5_SNORM:
+    case DXGI_FORMAT_BC6H_UF16:
+    case DXGI_FORMAT_BC6H_SF16:
+    case DXGI_FORMAT_BC7_UNORM:
+    case DXGI_FORMAT_BC7_UNORM_SRGB:
+        *pbBlock = true;
+        *pnBytes = 16;
+        return true;
+
+    case DXGI_FORMAT_R8G8B8A8_UNORM:
+    case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
+    case DXGI_FORMAT_R8G8B8A8_SNORM:
+    case DXGI_FORMAT_B8G8R8A8_UNORM:
+    case DXGI_FORMAT_B8G8R8A8_UNORM_SRGB:
+    case DXGI_FORMAT_B8G8R8X8_UNORM:
+    case DXGI_FORMAT_B8G8R8X8_UNORM_SRGB:
+    case DXGI_FORMAT_R10G10B10A2_UNORM:
+    case DXGI_FORMAT_R11G11B10_FLOAT:
+    case DXGI_FORMAT_R16G16_FLOAT:
+    case DXGI_FORMAT_R16G16_UNORM:
+    case DXGI_FORMAT_R32_FLOAT:
+        *pnBytes = 4;
+        return true;
+
+    case DXGI_FORMAT_R16G16B16A16_FLOAT:
+    case DXGI_FORMAT_R16G16B16A16_UNORM:
+    case DXGI_FORMAT_R32G32_FLOAT:
+        *pnBytes = 8;
+        return true;
+
+    case DXGI_FORMAT_R32G32B32A32_FLOAT:
+        *pnBytes = 16;
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------
+DXGI_FORMAT MakeSRGB( _In_ DXGI_FORMAT format )
+{
+    switch( format )
+    {
+    case DXGI_FORMAT_R8G8B8A8_UNORM:    return DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
+    case DXGI_FORMAT_BC1_UNORM:         return DXGI_FORMAT_BC1_UNORM_SRGB;
+    case DXGI_FORMAT_BC2_UNORM:         return DXGI_FORMAT_BC2_UNORM_SRGB;
+    case DXGI_FORMAT_BC3_UNORM:         return DXGI_FORMAT_BC3_UNORM_SRGB;
+    case DXGI_FORMAT_B8G8R8A8_UNORM:    return DXGI_FORMAT_B8G8R8A8_UNORM_SRGB;
+    case DXGI_FORMAT_B8G8R8X8_UNORM:    return DXGI_FORMAT_B8G8R8X8_UNORM_SRGB;
+    case DXGI_FORMAT_BC7_UNORM:         return DXGI_FORMAT_BC7_UNORM_SRGB;
+    default:                            return format;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------
+// Only the legacy layouts with a streamable DXGI format
+//--------------------------------------------------------------------------------------
+DXGI_FORMAT GetLegacyStreamFormat( _In_ const DDS_PIXELFORMAT& ddpf )
+{
+    if( ddpf.flags & DDS_FOURCC )
+    {
+        switch( ddpf.fourCC )
+        {
+        case MAKEFOURCC( 'D', 'X', 'T', '1' ):  return DXGI_FORMAT_BC1_UNORM;
+        case MAKEFOURCC( 'D', 'X', 'T', '2' ):
+        case MAKEFOURCC( 'D', 'X', 'T', '3' ):  return DXGI_FORMAT_BC2_UNORM;
+        case MAKEFOURCC( 'D', 'X', 'T', '4' ):
+        case MAKEFOURCC( 'D', 'X', 'T', '5' ):  return DXGI_FORMAT_BC3_UNORM;
+        case MAKEFOURCC( 'A', 'T', 'I', '1' ):
+        case MAKEFOURCC( 'B', 'C', '4', 'U' ):  return DXGI_FORMAT_BC4_UNORM;
+        case MAKEFOURCC( 'B', 'C', '4', 'S' ):  return DXGI_FORMAT_BC4_SNORM;
+        case MAKEFOURCC( 'A', 'T', 'I', '2' ):
+        case MAKEFOURCC( 'B', 'C', '5', 'U' ):  return DXGI_FORMAT_BC5_UNORM;
+        case MAKEFOURCC( 'B', 'C', '5', 'S' ):  return DXGI_FORMAT_BC5_SNORM;
+        }
+    }
+    else if( ( ddpf.flags & DDS_RGB ) && ddpf.RGBBitCount == 32 )
+    {
+        if( ddpf.RBitMask == 0x000000ff && ddpf.GBitMask == 0x0000ff00 && ddpf.BBitMask == 0x00ff0000 && ddpf.ABitMask == 0xff000000 )
+            return DXGI_FORMAT_R8G8B8A8_UNORM;
+        if( ddpf.RBitMask == 0x00ff0000 && ddpf.GBitMask == 0x0000ff00 && ddpf.BBitMask == 0x000000ff && ddpf.ABitMask == 0xff000000 )
+            return DXGI_FORMAT_B8G8R8A8_UNORM;
+        if( ddpf.RBitMask == 0x00ff0000 && ddpf.GBitMask == 0x0000ff00 && ddpf.BBitMask == 0x000000ff && ddpf.ABitMask == 0 )
+            return DXGI_FORMAT_B8G8R8X8_UNORM;
+    }
+
+    return DXGI_FORMAT_UNKNOWN;
+}
+
+
+//--------------------------------------------------------------------------------------
+UINT MipExtent( _In_ UINT nSize, _In_ UINT nMip )
+{
+    return std::max<UINT>( nSize >> nMip, 1 );
+}
+
+
+//--------------------------------------------------------------------------------------
+void GetMipLayout( _In_ DXGI_FORMAT format, _In_ UINT nWidth, _In_ UINT nHeight, _Out_ UINT* pnRowPitch, _Out_ UINT* pnRows )
+{
+    bool bBlock;
+    UINT nBytes;
+    GetStreamFormatInfo( format, &bBlock, &nBytes );
+    if( bBlock )
+    {
+        *pnRowPitch = std::max<UINT>( 1, ( nWidth + 3 ) / 4 ) * nBytes;
+        *pnRows = std::max<UINT>( 1, ( nHeight + 3 ) / 4 );
+    }
+    else
+    {
+        *pnRowPitch = nWidth * nBytes;
+        *pnRows = nHeight;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------
+// Block compressed textures need every top level they are created with to be a whole
+// number of blocks
+//--------------------------------------------------------------------------------------
+bool CanStartAt( _In_ bool bBlock, _In_ const DXUT_STREAMING_TEXTURE& state, _In_ UINT nMip )
+{
+    if( !bBlock )
+        return true;
+
+    UINT nWidth = state.Width >> nMip;
+    UINT nHeight = state.Height >> nMip;
+    return nWidth >= 4 && nHeight >= 4 && !( nWidth % 4 ) && !( nHeight % 4 );
+}
+
+
+//--------------------------------------------------------------------------------------
+// Fills in the layout of a 2D texture that can stream.  Returns false for anything else,
+// which is left to the whole-file loaders to accept or reject.
+//--------------------------------------------------------------------------------------
+bool GetStreamLayout( _In_reads_bytes_(nHeaderBytes) const BYTE* pHeader, _In_ size_t nHeaderBytes,
+                      _In_ UINT64 nFileBytes, _In_ bool bSRGB,
+                      _Out_ DXGI_FORMAT* pFormat, _Inout_ DXUT_STREAMING_TEXTURE& state,
+                      _Out_writes_(DXUT_STREAMING_MAX_MIPS) UINT64* pMipOffsets )
+{
+    *pFormat = DXGI_FORMAT_UNKNOWN;
+
+    if( nHeaderBytes < sizeof( uint32_t ) + sizeof( DDS_HEADER ) )
+        return false;
+
+    if( *reinterpret_cast<const uint32_t*>( pHeader ) != DDS_MAGIC )
+        return false;
+
+    auto header = reinterpret_cast<const DDS_HEADER*>( pHeader + sizeof( uint32_t ) );
+    if( header->size != sizeof( DDS_HEADER ) || header->ddspf.size != sizeof( DDS_PIXELFORMAT ) )
+        return false;
+
+    UINT64 nOffset = sizeof( uint32_t ) + sizeof( DDS_HEADER );
+    DXGI_FORMAT format;
+    if( ( header->ddspf.flags & DDS_FOURCC ) && header->ddspf.fourCC == MAKEFOURCC( 'D', 'X', '1', '0' ) )
+    {
+        if( nHeaderBytes < nOffset + sizeof( DDS_HEADER_DXT10 ) )
+            return false;
+
+        auto d3d10ext = reinterpret_cast<const DDS_HEADER_DXT10*>( pHeader + nOffset );
+        if( d3d10ext->resourceDimension != D3D11_RESOURCE_DIMENSION_TEXTURE2D
+            || d3d10ext->arraySize != 1
+            || ( d3d10ext->miscFlag & D3D11_RESOURCE_MISC_TEXTURECUBE ) )
+            return false;
+
+        format = d3d10ext->dxgiFormat;
+        nOffset += sizeof( DDS_HEADER_DXT10 );
+    }
+    else
+    {
+        if( ( header->flags & DDS_HEADER_FLAGS_VOLUME ) || ( header->caps2 & DDS_CUBEMAP ) )
+            return false;
+
+        format = GetLegacyStreamFormat( header->ddspf );
+    }
+
+    bool bBlock;
+    UINT nBytes;
+    if( !GetStreamFormatInfo( format, &bBlock, &nBytes ) )
+        return false;
+
+    state.Width = header->width;
+    state.Height = header->height;
+    state.MipCount = std::max<UINT>( header->mipMapCount, 1 );
+    if( !state.Width || !state.Height || state.MipCount > DXUT_STREAMING_MAX_MIPS )
+        return false;
+
+    // A chain longer than the texture allows is rejected by the runtime
+    UINT nMaxMips = 1;
+    for( UINT nSize = std::max<UINT>( state.Width, state.Height ); nSize > 1; nSize >>= 1 )
+        ++nMaxMips;
+    if( state.MipCount > nMaxMips )
+        return false;
+
+    for( UINT iMip = 0; iMip < state.MipCount; ++iMip )
+    {
+        UINT nRowPitch, nRows;
+        GetMipLayout( format, MipExtent( state.Width, iMip ), MipExtent( state.Height, iMip ), &nRowPitch, &nRows );
+        pMipOffsets[iMip] = nOffset;
+        state.MipBytes[iMip] = UINT64( nRowPitch ) * nRows;
+        nOffset += state.MipBytes[iMip];
+    }
+
+    if( nOffset > nFileBytes )
+        return false;
+
+    state.TailMip = 0;
+    while( state.TailMip + 1 < state.MipCount
+           && CDXUTStreamingPolicy::MipSize( state, state.TailMip ) > c_nTailSize
+           && CanStartAt( bBlock, state, state.TailMip + 1 ) )
+        ++state.TailMip;
+
+    *pFormat = bSRGB ? MakeSRGB( format ) : format;
+    return true;
+}
+
+
+//--------------------------------------------------------------------------------------
+// From a stored archive entry's mapping when there is one, else from the file
+//--------------------------------------------------------------------------------------
+HRESULT ReadSource( _In_ const std::wstring& strPath, _In_opt_ const CDXUTArchive* pArchive,
+                    _In_opt_ const DXUT_ARCHIVE_ENTRY* pEntry, _In_ UINT64 nOffset,
+                    _Out_writes_bytes_(nBytes) BYTE* pDest, _In_ size_t nBytes )
+{
+    if( pArchive )
+    {
+        // Compressed entries are never streamed, so the view never decodes
+        assert( pEntry && pEntry->Compression == DXUT_ARCHIVE_STORED );
+
+        DXUTArchive_View view;
+        HRESULT hr = pArchive->GetView( pEntry, view );
+        if( FAILED( hr ) )
+            return hr;
+
+        if( nOffset > view.Bytes || nBytes > view.Bytes - nOffset )
+            return E_FAIL;
+
+        memcpy( pDest, view.pData + nOffset, nBytes );
+        return S_OK;
+    }
+
+    HANDLE hFile = CreateFileW( strPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_FLAG_SEQUENTIAL_SCAN, nullptr );
+    if( hFile == INVALID_HANDLE_VALUE )
+        return HRESULT_FROM_WIN32( GetLastError() );
+
+    HRESULT hr = S_OK;
+    LARGE_INTEGER pos;
+    pos.QuadPart = LONGLONG( nOffset );
+    if( !SetFilePointerEx( hFile, pos, nullptr, FILE_BEGIN ) )
+        hr = HRESULT_FROM_WIN32( GetLastError() );
+
+    while( SUCCEEDED( hr ) && nBytes )
+    {
+        DWORD nChunk = DWORD( std::min<size_t>( nBytes, c_nMaxReadChunk ) );
+        DWORD nRead = 0;
+        if( !ReadFile( hFile, pDest, nChunk, &nRead, nullptr ) )
+            hr = HRESULT_FROM_WIN32( GetLastError() );
+        else if( nRead != nChunk )
+            hr = E_FAIL;
+
+        pDest += nRead;
+        nBytes -= nRead;
+    }
+
+    CloseHandle( hFile );
+    return hr;
+}
+
+
+//--------------------------------------------------------------------------------------
+D3D11_TEXTURE2D_DESC GetResidentDesc( _In_ DXGI_FORMAT format, _In_ const DXUT_STREAMING_TEXTURE& state, _In_ UINT nTop )
+{
+    D3D11_TEXTURE2D_DESC desc;
+    desc.Width = MipExtent( state.Width, nTop );
+    desc.Height = MipExtent( state.Height, nTop );
+    desc.MipLevels = state.MipCount - nTop;
+    desc.ArraySize = 1;
+    desc.Format = format;
+    desc.SampleDesc.Count = 1;
+    desc.SampleDesc.Quality = 0;
+    desc.Usage = D3D11_USAGE_DEFAULT;
+    desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+    desc.CPUAccessFlags = 0;
+    desc.MiscFlags = 0;
+    return desc;
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+CDXUTTextureStreamer::CDXUTTextureStreamer() :
+    m_pd3dDevice( nullptr ),
+    m_pd3dImmediateContext( nullptr ),
+    m_nFrame( 0 ),
+    m_bQuit( false )
+{
+    ZeroMemory( &m_Stats, sizeof( m_Stats ) );
+}
+
+
+//--------------------------------------------------------------------------------------
+CDXUTTextureStreamer::~CDXUTTextureStreamer()
+{
+    OnD3D11DestroyDevice();
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTTextureStreamer::OnD3D11CreateDevice( ID3D11Device* pd3dDevice, ID3D11DeviceContext* pd3dImmediateContext,
+                                                   UINT64 nBudgetBytes )
+{
+    if( !pd3dDevice || !pd3dImmediateContext )
+        return E_INVALIDARG;
+
+    OnD3D11DestroyDevice();
+
+    m_pd3dDevice = pd3dDevice;
+    m_pd3dDevice->AddRef();
+    m_pd3dImmediateContext = pd3dImmediateContext;
+    m_pd3dImmediateContext->AddRef();
+    m_Policy.SetBudget( nBudgetBytes );
+
+    m_bQuit = false;
+    try
+    {
+        m_IOThread = std::thread( [this]() { IOThread(); } );
+    }
+    catch( ... )
+    {
+        OnD3D11DestroyDevice();
+        return E_FAIL;
+    }
+
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+void CDXUTTextureStreamer::OnD3D11DestroyDevice()
+{
+    StopIOThread();
+
+    m_Reads.clear();
+    m_Completed.clear();
+
+    for( auto it = m_Textures.begin(); it != m_Textures.end(); ++it )
+    {
+        SAFE_RELEASE( it->pSRV );
+        SAFE_RELEASE( it->pTexture );
+    }
+    m_Textures.clear();
+    m_States.clear();
+
+    SAFE_RELEASE( m_pd3dImmediateContext );
+    SAFE_RELEASE( m_pd3dDevice );
+
+    m_nFrame = 0;
+    ZeroMemory( &m_Stats, sizeof( m_Stats ) );
+}
+
+
+//--------------------------------------------------------------------------------------
+void CDXUTTextureStreamer::StopIOThread()
+{
+    if( m_IOThread.joinable() )
+    {
+        {
+            std::lock_guard<std::mutex> lock( m_Mutex );
+            m_bQuit = true;
+        }
+        m_WorkReady.notify_all();
+        m_IOThread.join();
+    }
+}
+
+
+//--------------------------------------------------------------------------------------
+// Reads run one at a time, in the order issued, so the most urgent arrive first and the
+// disk is not asked to seek between several textures at once
+//--------------------------------------------------------------------------------------
+void CDXUTTextureStreamer::IOThread()
+{
+    for( ;; )
+    {
+        std::unique_ptr<ReadJob> job;
+        {
+            std::unique_lock<std::mutex> lock( m_Mutex );
+            m_WorkReady.wait( lock, [this]() { return m_bQuit || !m_Reads.empty(); } );
+            if( m_bQuit )
+                return;
+
+            job = std::move( m_Reads.front() );
+            m_Reads.pop_front();
+        }
+
+        job->pData.reset( new (std::nothrow) BYTE[ job->nBytes ] );
+        if( !job->pData )
+            job->hr = E_OUTOFMEMORY;
+        else
+            job->hr = ReadSource( job->strPath, job->pArchive.get(), job->pEntry, job->nOffset, job->pData.get(),
+                                  job->nBytes );
+
+        std::lock_guard<std::mutex> lock( m_Mutex );
+        m_Completed.push_back( std::move( job ) );
+    }
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTTextureStreamer::AddTexture( LPCWSTR szFileName, UINT* pHandle, bool bSRGB )
+{
+    if( !szFileName || !pHandle )
+        return E_INVALIDARG;
+
+    *pHandle = 0;
+
+    if( !m_pd3dDevice )
+        return E_FAIL;
+
+    HRESULT hr;
+
+    Texture tex;
+    tex.pEntry = nullptr;
+    tex.Format = DXGI_FORMAT_UNKNOWN;
+    tex.bStreamed = false;
+    ZeroMemory( tex.MipOffset, sizeof( tex.MipOffset ) );
+    tex.WholeBytes = 0;
+    tex.nGeneration = 0;
+    tex.pTexture = nullptr;
+    tex.pSRV = nullptr;
+
+    DXUT_STREAMING_TEXTURE state;
+    ZeroMemory( &state, sizeof( state ) );
+
+    UINT64 nFileBytes = 0;
+    if( SUCCEEDED( DXUTFindArchiveEntry( szFileName, tex.pArchive, &tex.pEntry ) ) )
+    {
+        tex.strPath = szFileName;
+        nFileBytes = tex.pEntry->Bytes;
+    }
+    else
+    {
+        WCHAR str[MAX_PATH];
+        V_RETURN( DXUTFindDXSDKMediaFileCch( str, MAX_PATH, szFileName ) );
+        tex.strPath = str;
+
+        WIN32_FILE_ATTRIBUTE_DATA attributes;
+        if( !GetFileAttributesExW( str, GetFileExInfoStandard, &attributes ) )
+            return HRESULT_FROM_WIN32( GetLastError() );
+        nFileBytes = ( UINT64( attributes.nFileSizeHigh ) << 32 ) | attributes.nFileSizeLow;
+    }
+
+    // Reading part of a compressed entry means decoding all of it, so those load whole
+    if( !tex.pEntry || tex.pEntry->Compression == DXUT_ARCHIVE_STORED )
+    {
+        BYTE header[sizeof( uint32_t ) + sizeof( DDS_HEADER ) + sizeof( DDS_HEADER_DXT10 )];
+        size_t nHeaderBytes = size_t( std::min<UINT64>( nFileBytes, sizeof( header ) ) );
+        V_RETURN( ReadSource( tex.strPath, tex.pArchive.get(), tex.pEntry, 0, header, nHeaderBytes ) );
+
+        tex.bStreamed = GetStreamLayout( header, nHeaderBytes, nFileBytes, bSRGB, &tex.Format, state, tex.MipOffset );
+    }
+    if( tex.bStreamed )
+    {
+        V_RETURN( LoadTail( tex, state ) );
+    }
+    else
+    {
+        // Loaded whole, and counted as one mip the size of the file.  The cache looks up
+        // archive entries by the name given and files by their full path.
+        V_RETURN( DXUTGetGlobalResourceCache().CreateTextureFromFile( m_pd3dDevice, m_pd3dImmediateContext,
+                                                                      tex.pArchive ? szFileName : tex.strPath.c_str(),
+                                                                      &tex.pSRV, bSRGB ) );
+        tex.pArchive.reset();
+        tex.pEntry = nullptr;
+        tex.WholeBytes = nFileBytes;
+
+        ID3D11Resource* pResource = nullptr;
+        ID3D11Texture2D* pTexture2D = nullptr;
+        tex.pSRV->GetResource( &pResource );
+        if( SUCCEEDED( pResource->QueryInterface( __uuidof( ID3D11Texture2D ), reinterpret_cast<void**>( &pTexture2D ) ) ) )
+        {
+            D3D11_TEXTURE2D_DESC desc;
+            pTexture2D->GetDesc( &desc );
+            state.Width = desc.Width;
+            state.Height = desc.Height;
+            SAFE_RELEASE( pTexture2D );
+        }
+        SAFE_RELEASE( pResource );
+
+        state.MipCount = 1;
+        state.MipBytes[0] = nFileBytes;
+    }
+
+    *pHandle = UINT( m_Textures.size() );
+    m_Textures.push_back( tex );
+    m_States.push_back( state );
+
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTTextureStreamer::LoadTail( Texture& tex, DXUT_STREAMING_TEXTURE& state )
+{
+    HRESULT hr;
+
+    size_t nBytes = size_t( CDXUTStreamingPolicy::BytesFrom( state, state.TailMip ) );
+    std::unique_ptr<BYTE[]> pData( new (std::nothrow) BYTE[ nBytes ] );
+    if( !pData )
+        return E_OUTOFMEMORY;
+
+    V_RETURN( ReadSource( tex.strPath, tex.pArchive.get(), tex.pEntry, tex.MipOffset[state.TailMip], pData.get(), nBytes ) );
+
+    D3D11_SUBRESOURCE_DATA initData[DXUT_STREAMING_MAX_MIPS];
+    const BYTE* pSrc = pData.get();
+    for( UINT iMip = state.TailMip; iMip < state.MipCount; ++iMip )
+    {
+        UINT nRowPitch, nRows;
+        GetMipLayout( tex.Format, MipExtent( state.Width, iMip ), MipExtent( state.Height, iMip ), &nRowPitch, &nRows );
+        initData[iMip - state.TailMip].pSysMem = pSrc;
+        initData[iMip - state.TailMip].SysMemPitch = nRowPitch;
+        initData[iMip - state.TailMip].SysMemSlicePitch = nRowPitch * nRows;
+        pSrc += state.MipBytes[iMip];
+    }
+
+    D3D11_TEXTURE2D_DESC desc = GetResidentDesc( tex.Format, state, state.TailMip );
+    V_RETURN( m_pd3dDevice->CreateTexture2D( &desc, initData, &tex.pTexture ) );
+    DXUT_SetDebugName( tex.pTexture, "CDXUTTextureStreamer" );
+
+    hr = m_pd3dDevice->CreateShaderResourceView( tex.pTexture, nullptr, &tex.pSRV );
+    if( FAILED( hr ) )
+    {
+        SAFE_RELEASE( tex.pTexture );
+        return hr;
+    }
+    DXUT_SetDebugName( tex.pSRV, "CDXUTTextureStreamer" );
+
+    state.ResidentMip = state.TailMip;
+    state.PendingMip = state.TailMip;
+    state.DesiredMip = state.TailMip;
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Recreates the texture starting at nNewTop.  Mips already resident are copied over on
+// the GPU; an upgrade passes the mips it read, from nNewTop down to the old top.
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTTextureStreamer::Resize( Texture& tex, DXUT_STREAMING_TEXTURE& state, UINT nNewTop, const BYTE* pNewMips )
+{
+    HRESULT hr;
+
+    D3D11_TEXTURE2D_DESC desc = GetResidentDesc( tex.Format, state, nNewTop );
+    ID3D11Texture2D* pTexture = nullptr;
+    V_RETURN( m_pd3dDevice->CreateTexture2D( &desc, nullptr, &pTexture ) );
+    DXUT_SetDebugName( pTexture, "CDXUTTextureStreamer" );
+
+    ID3D11ShaderResourceView* pSRV = nullptr;
+    hr = m_pd3dDevice->CreateShaderResourceView( pTexture, nullptr, &pSRV );
+    if( FAILED( hr ) )
+    {
+        SAFE_RELEASE( pTexture );
+        return hr;
+    }
+    DXUT_SetDebugName( pSRV, "CDXUTTextureStreamer" );
+
+    for( UINT iMip = std::max<UINT>( nNewTop, state.ResidentMip ); iMip < state.MipCount; ++iMip )
+    {
+        m_pd3dImmediateContext->CopySubresourceRegion( pTexture, iMip - nNewTop, 0, 0, 0,
+                                                       tex.pTexture, iMip - state.ResidentMip, nullptr );
+    }
+
+    if( pNewMips )
+    {
+        const BYTE* pSrc = pNewMips;
+        for( UINT iMip = nNewTop; iMip < state.ResidentMip; ++iMip )
+        {
+            UINT nRowPitch, nRows;
+            GetMipLayout( tex.Format, MipExtent( state.Width, iMip ), MipExtent( state.Height, iMip ), &nRowPitch, &nRows );
+            m_pd3dImmediateContext->UpdateSubresource( pTexture, iMip - nNewTop, nullptr, pSrc, nRowPitch, nRowPitch * nRows );
+            pSrc += state.MipBytes[iMip];
+        }
+    }
+
+    SAFE_RELEASE( tex.pSRV );
+    SAFE_RELEASE( tex.pTexture );
+    tex.pTexture = pTexture;
+    tex.pSRV = pSRV;
+    state.ResidentMip = nNewTop;
+
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void CDXUTTextureStreamer::RequestSize( UINT nHandle, UINT nPixels )
+{
+    DXUT_STREAMING_TEXTURE& state = m_States[nHandle];
+    if( state.LastRequestFrame != m_nFrame )
+        state.RequestedPixels = nPixels;
+    else
+        state.RequestedPixels = std::max<UINT>( state.RequestedPixels, nPixels );
+    state.LastRequestFrame = m_nFrame;
+}
+
+
+//--------------------------------------------------------------------------------------
+HRESULT CDXUTTextureStreamer::Update()
+{
+    if( !m_pd3dDevice )
+        return E_FAIL;
+
+    HRESULT hrResult = S_OK;
+    m_Stats.UpgradesIssued = 0;
+    m_Stats.UpgradesCompleted = 0;
+    m_Stats.Downgrades = 0;
+
+    std::deque<std::unique_ptr<ReadJob>> completed;
+    {
+        std::lock_guard<std::mutex> lock( m_Mutex );
+        completed.swap( m_Completed );
+    }
+
+    for( auto it = completed.begin(); it != completed.end(); ++it )
+    {
+        ReadJob& job = **it;
+        Texture& tex = m_Textures[job.iTexture];
+        DXUT_STREAMING_TEXTURE& state = m_States[job.iTexture];
+        if( job.nGeneration != tex.nGeneration )
+        {
+            ++m_Stats.StaleReads;
+            continue;
+        }
+
+        state.PendingMip = state.ResidentMip;
+
+        HRESULT hr = job.hr;
+        if( SUCCEEDED( hr ) )
+        {
+            m_Stats.TotalBytesRead += job.nBytes;
+            hr = Resize( tex, state, job.TargetMip, job.pData.get() );
+        }
+
+        if( SUCCEEDED( hr ) )
+        {
+            ++m_Stats.UpgradesCompleted;
+        }
+        else
+        {
+            // Keep what is resident rather than retrying every frame
+            ++m_Stats.FailedReads;
+            state.MinMip = state.ResidentMip;
+            hrResult = DXUT_ERR( L"CDXUTTextureStreamer::Update", hr );
+        }
+    }
+
+    m_Policy.Schedule( m_States, m_nFrame, m_Upgrades, m_Downgrades );
+
+    for( auto it = m_Downgrades.cbegin(); it != m_Downgrades.cend(); ++it )
+    {
+        Texture& tex = m_Textures[it->Texture];
+        DXUT_STREAMING_TEXTURE& state = m_States[it->Texture];
+
+        if( state.PendingMip < it->TargetMip )
+        {
+            ++tex.nGeneration;
+            state.PendingMip = state.ResidentMip;
+        }
+
+        if( state.ResidentMip < it->TargetMip )
+        {
+            HRESULT hr = Resize( tex, state, it->TargetMip, nullptr );
+            if( FAILED( hr ) )
+                hrResult = DXUT_ERR( L"CDXUTTextureStreamer::Update", hr );
+            else
+                ++m_Stats.Downgrades;
+        }
+        state.PendingMip = state.ResidentMip;
+    }
+
+    if( !m_Upgrades.empty() || !m_Downgrades.empty() )
+    {
+        std::lock_guard<std::mutex> lock( m_Mutex );
+
+        // Drop queued reads a downgrade cancelled before the thread gets to them
+        for( auto it = m_Reads.begin(); it != m_Reads.end(); )
+        {
+            if( ( *it )->nGeneration != m_Textures[( *it )->iTexture].nGeneration )
+            {
+                ++m_Stats.StaleReads;
+                it = m_Reads.erase( it );
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        for( auto it = m_Upgrades.cbegin(); it != m_Upgrades.cend(); ++it )
+        {
+            Texture& tex = m_Textures[it->Texture];
+            DXUT_STREAMING_TEXTURE& state = m_States[it->Texture];
+
+            std::unique_ptr<ReadJob> job( new (std::nothrow) ReadJob );
+            if( !job )
+            {
+                hrResult = E_OUTOFMEMORY;
+                break;
+            }
+
+            job->iTexture = it->Texture;
+            job->nGeneration = tex.nGeneration;
+            job->TargetMip = it->TargetMip;
+            job->strPath = tex.strPath;
+            job->pArchive = tex.pArchive;
+            job->pEntry = tex.pEntry;
+            job->nOffset = tex.MipOffset[it->TargetMip];
+            job->nBytes = size_t( CDXUTStreamingPolicy::BytesFrom( state, it->TargetMip )
+                                  - CDXUTStreamingPolicy::BytesFrom( state, state.ResidentMip ) );
+            job->hr = S_OK;
+            m_Reads.push_back( std::move( job ) );
+
+            state.PendingMip = it->TargetMip;
+            ++m_Stats.UpgradesIssued;
+        }
+    }
+
+    if( m_Stats.UpgradesIssued )
+        m_WorkReady.notify_one();
+
+    ++m_nFrame;
+    return hrResult;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void CDXUTTextureStreamer::GetTextureStats( UINT nHandle, DXUT_STREAMING_TEXTURE_STATS* pStats ) const
+{
+    const DXUT_STREAMING_TEXTURE& state = m_States[nHandle];
+    pStats->Width = state.Width;
+    pStats->Height = state.Height;
+    pStats->MipCount = state.MipCount;
+    pStats->TailMip = state.TailMip;
+    pStats->ResidentMip = state.ResidentMip;
+    pStats->PendingMip = state.PendingMip;
+    pStats->DesiredMip = state.DesiredMip;
+    pStats->RequestedPixels = state.RequestedPixels;
+    pStats->ResidentBytes = CDXUTStreamingPolicy::BytesFrom( state, state.ResidentMip );
+    pStats->bStreamed = m_Textures[nHandle].bStreamed;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void CDXUTTextureStreamer::GetStats( DXUT_STREAMING_STATS* pStats ) const
+{
+    *pStats = m_Stats;
+    pStats->BudgetBytes = m_Policy.GetBudget();
+    pStats->ResidentBytes = 0;
+    pStats->PendingBytes = 0;
+    pStats->IdealBytes = m_Policy.GetIdealBytes();
+    pStats->DesiredBytes = m_Policy.GetDesiredBytes();
+    pStats->NumTextures = UINT( m_Textures.size() );
+    pStats->NumStreamed = 0;
+    pStats->UpgradesInFlight = 0;
+
+    for( size_t i = 0; i < m_States.size(); ++i )
+    {
+        const DXUT_STREAMING_TEXTURE& state = m_States[i];
+        UINT64 nResident = CDXUTStreamingPolicy::BytesFrom( state, state.ResidentMip );
+        pStats->ResidentBytes += nResident;
+        if( state.PendingMip < state.ResidentMip )
+        {
+            pStats->PendingBytes += CDXUTStreamingPolicy::BytesFrom( state, state.PendingMip ) - nResident;
+            ++pStats->UpgradesInFlight;
+        }
+        if( m_Textures[i].bStreamed )
+            ++pStats->NumStreamed;
+    }
+}
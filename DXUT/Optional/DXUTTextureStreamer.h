@@ -0,0 +1,161 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTTextureStreamer.h
+//
+// Streams the mips of DDS textures in and out against a memory budget.  Textures start
+// at their low resolution mip tail; more detailed mips are read on a background thread
+// when asked for on screen, and dropped again when unused or over budget.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "DXUTStreamingPolicy.h"
+
+class CDXUTArchive;
+struct DXUT_ARCHIVE_ENTRY;
+
+struct DXUT_STREAMING_TEXTURE_STATS
+{
+    UINT Width;
+    UINT Height;
+    UINT MipCount;
+    UINT TailMip;
+    UINT ResidentMip;           // Most detailed mip in memory
+    UINT PendingMip;            // Target of the read in flight, or ResidentMip
+    UINT DesiredMip;            // Where the policy wants the texture after the budget fit
+    UINT RequestedPixels;
+    UINT64 ResidentBytes;
+    bool bStreamed;             // False for layouts that cannot stream, which load whole
+};
+
+struct DXUT_STREAMING_STATS
+{
+    UINT64 BudgetBytes;
+    UINT64 ResidentBytes;       // Every texture, including ones loaded whole
+    UINT64 PendingBytes;        // Still to arrive for the reads in flight
+    UINT64 IdealBytes;          // What the requested sizes ask for, before the budget fit
+    UINT64 DesiredBytes;        // What the policy settled on
+    UINT NumTextures;
+    UINT NumStreamed;
+    UINT UpgradesInFlight;
+    UINT UpgradesIssued;        // In the last Update
+    UINT UpgradesCompleted;     // In the last Update
+    UINT Downgrades;            // In the last Update
+    UINT64 TotalBytesRead;
+    UINT StaleReads;            // Completed after a downgrade cancelled them
+    UINT FailedReads;
+};
+
+
+//--------------------------------------------------------------------------------------
+// Only 2D DDS textures without arrays stream, in the DXGI formats with a fixed block size:
+// BC1 to BC7 and the 32, 64 and 128 bpp formats.  Anything else, including other file
+// types, is loaded whole through the global resource cache and only counts toward the
+// resident bytes.  Stored textures in an archive are read from its mapping, which the
+// streamer keeps open through DXUTUnmountArchives; compressed ones are loaded whole.
+//
+// GetSRV may return a different view after each Update, so fetch it every frame rather
+// than holding on to it.
+//--------------------------------------------------------------------------------------
+class CDXUTTextureStreamer
+{
+public:
+    CDXUTTextureStreamer();
+    ~CDXUTTextureStreamer();
+
+    // nBudgetBytes of 0 leaves the budget unlimited
+    HRESULT OnD3D11CreateDevice( _In_ ID3D11Device* pd3dDevice, _In_ ID3D11DeviceContext* pd3dImmediateContext,
+                                 _In_ UINT64 nBudgetBytes = 0 );
+    void OnD3D11DestroyDevice();
+
+    // The file is found through the media search.  Loads the mip tail before returning.
+    HRESULT AddTexture( _In_z_ LPCWSTR szFileName, _Out_ UINT* pHandle, _In_ bool bSRGB = false );
+
+    // Asks for the texture to be shown nPixels across at most on screen this frame; the
+    // largest of the frame's requests counts
+    void RequestSize( _In_ UINT nHandle, _In_ UINT nPixels );
+
+    ID3D11ShaderResourceView* GetSRV( _In_ UINT nHandle ) const { return m_Textures[nHandle].pSRV; }
+
+    // Call once per frame, after the frame's RequestSize calls.  Applies the reads that
+    // have finished, then issues downgrades and new reads.
+    HRESULT Update();
+
+    void SetBudget( _In_ UINT64 nBytes ) { m_Policy.SetBudget( nBytes ); }
+    void SetIdleFrames( _In_ UINT nFrames ) { m_Policy.SetIdleFrames( nFrames ); }
+    void SetMaxUpgradesInFlight( _In_ UINT nUpgrades ) { m_Policy.SetMaxUpgradesInFlight( nUpgrades ); }
+
+    UINT GetNumTextures() const { return UINT( m_Textures.size() ); }
+    void GetTextureStats( _In_ UINT nHandle, _Out_ DXUT_STREAMING_TEXTURE_STATS* pStats ) const;
+    void GetStats( _Out_ DXUT_STREAMING_STATS* pStats ) const;
+
+private:
+    CDXUTTextureStreamer( const CDXUTTextureStreamer& );
+    CDXUTTextureStreamer& operator=( const CDXUTTextureStreamer& );
+
+    struct Texture
+    {
+        std::wstring strPath;
+        std::shared_ptr<const CDXUTArchive> pArchive;   // Null for loose files
+        const DXUT_ARCHIVE_ENTRY* pEntry;
+        DXGI_FORMAT Format;
+        bool bStreamed;
+        UINT64 MipOffset[DXUT_STREAMING_MAX_MIPS];  // Within the file
+        UINT64 WholeBytes;                          // For textures loaded whole
+        UINT nGeneration;                           // Bumped to discard the read in flight
+        ID3D11Texture2D* pTexture;
+        ID3D11ShaderResourceView* pSRV;
+    };
+
+    // Mips from TargetMip down to the resident top of one texture, contiguous in the file
+    struct ReadJob
+    {
+        UINT iTexture;
+        UINT nGeneration;
+        UINT TargetMip;
+        std::wstring strPath;
+        std::shared_ptr<const CDXUTArchive> pArchive;
+        const DXUT_ARCHIVE_ENTRY* pEntry;
+        UINT64 nOffset;
+        size_t nBytes;
+        std::unique_ptr<BYTE[]> pData;
+        HRESULT hr;
+    };
+
+    HRESULT LoadTail( _Inout_ Texture& tex, _Inout_ DXUT_STREAMING_TEXTURE& state );
+    HRESULT Resize( _Inout_ Texture& tex, _Inout_ DXUT_STREAMING_TEXTURE& state, _In_ UINT nNewTop,
+                    _In_opt_ const BYTE* pNewMips );
+    void IOThread();
+    void StopIOThread();
+
+    ID3D11Device* m_pd3dDevice;
+    ID3D11DeviceContext* m_pd3dImmediateContext;
+    std::vector<Texture> m_Textures;
+    std::vector<DXUT_STREAMING_TEXTURE> m_States;   // Parallel to m_Textures, for the policy
+    CDXUTStreamingPolicy m_Policy;
+    std::vector<DXUT_STREAMING_REQUEST> m_Upgrades;
+    std::vector<DXUT_STREAMING_REQUEST> m_Downgrades;
+    UINT64 m_nFrame;
+    DXUT_STREAMING_STATS m_Stats;
+
+    std::thread m_IOThread;
+    std::mutex m_Mutex;
+    std::condition_variable m_WorkReady;
+    std::deque<std::unique_ptr<ReadJob>> m_Reads;       // Issued, in priority order
+    std::deque<std::unique_ptr<ReadJob>> m_Completed;
+    bool m_bQuit;
+};
@@ -0,0 +1,821 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTarchive.cpp
+//
+// Packed asset archives
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUT.h"
+#include "DXUTarchive.h"
+#include "SDKmisc.h"
+
+#include <string>
+
+//--------------------------------------------------------------------------------------
+namespace
+{
+
+// Lower case with '\' separators and without leading ".\", so the same asset always maps
+// to the same name whichever way the caller spelled it
+size_t NormalizeArchiveName( _In_z_ LPCWSTR szName, _Out_writes_(cchDest) WCHAR* strDest, _In_ size_t cchDest )
+{
+    while( ( szName[0] == L'.' ) && ( szName[1] == L'\\' || szName[1] == L'/' ) )
+        szName += 2;
+
+    size_t len = 0;
+    for( ; *szName && len + 1 < cchDest; ++szName )
+    {
+        WCHAR ch = *szName;
+        strDest[len++] = ( ch == L'/' ) ? L'\\' : towlower( ch );
+    }
+    strDest[len] = 0;
+    return *szName ? 0 : len;
+}
+
+UINT64 HashArchiveName( _In_reads_(len) const WCHAR* strName, _In_ size_t len )
+{
+    // FNV-1a, 64-bit
+    UINT64 hash = 14695981039346656037ULL;
+    auto pBytes = reinterpret_cast<const BYTE*>( strName );
+    for( size_t i = 0; i < len * sizeof( WCHAR ); ++i )
+    {
+        hash ^= pBytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+inline UINT64 AlignArchiveOffset( UINT64 offset )
+{
+    return ( offset + DXUT_ARCHIVE_ALIGNMENT - 1 ) & ~UINT64( DXUT_ARCHIVE_ALIGNMENT - 1 );
+}
+
+// Archives are searched from the back, so the last one mounted wins.  Shared so that
+// DXUTFindArchiveEntry callers keep an archive mapped after it is unmounted.
+std::vector<std::shared_ptr<CDXUTArchive>> s_MountedArchives;
+
+};
+
+
+//======================================================================================
+// DXUTArchive_View
+//======================================================================================
+
+BYTE* DXUTArchive_View::Detach()
+{
+    if( Decoded )
+    {
+        pData = nullptr;
+        Bytes = 0;
+        return Decoded.release();
+    }
+
+    if( !pData )
+        return nullptr;
+
+    auto pCopy = new (std::nothrow) BYTE[ Bytes ];
+    if( pCopy )
+        memcpy( pCopy, pData, Bytes );
+    pData = nullptr;
+    Bytes = 0;
+    return pCopy;
+}
+
+
+//======================================================================================
+// CDXUTArchive
+//======================================================================================
+
+CDXUTArchive::CDXUTArchive() :
+    m_hFile( INVALID_HANDLE_VALUE ),
+    m_hFileMapping( nullptr ),
+    m_pData( nullptr ),
+    m_pHeader( nullptr ),
+    m_pEntries( nullptr ),
+    m_pNames( nullptr )
+{
+}
+
+
+//--------------------------------------------------------------------------------------
+CDXUTArchive::~CDXUTArchive()
+{
+    Close();
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTArchive::Open( LPCWSTR szFileName )
+{
+    Close();
+
+    m_hFile = CreateFileW( szFileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+    if( m_hFile == INVALID_HANDLE_VALUE )
+        return DXUTERR_MEDIANOTFOUND;
+
+    LARGE_INTEGER FileSize;
+    if( !GetFileSizeEx( m_hFile, &FileSize ) || UINT64( FileSize.QuadPart ) < sizeof( DXUT_ARCHIVE_HEADER ) )
+    {
+        Close();
+        return E_FAIL;
+    }
+
+    // Map the whole archive once; every lookup after this is pointer arithmetic
+    m_hFileMapping = CreateFileMappingW( m_hFile, nullptr, PAGE_READONLY, 0, 0, nullptr );
+    if( !m_hFileMapping )
+    {
+        Close();
+        return HRESULT_FROM_WIN32( GetLastError() );
+    }
+
+    m_pData = reinterpret_cast<const BYTE*>( MapViewOfFile( m_hFileMapping, FILE_MAP_READ, 0, 0, 0 ) );
+    if( !m_pData )
+    {
+        Close();
+        return HRESULT_FROM_WIN32( GetLastError() );
+    }
+
+    const UINT64 fileSize = UINT64( FileSize.QuadPart );
+    auto pHeader = reinterpret_cast<const DXUT_ARCHIVE_HEADER*>( m_pData );
+    if( pHeader->Magic != DXUT_ARCHIVE_MAGIC
+        || pHeader->Version != DXUT_ARCHIVE_VERSION
+        || pHeader->FileSize != fileSize
+        || pHeader->EntriesOffset + UINT64( pHeader->NumEntries ) * sizeof( DXUT_ARCHIVE_ENTRY ) > fileSize
+        || pHeader->NamesOffset + pHeader->NamesBytes > fileSize
+        || ( pHeader->NamesBytes % sizeof( WCHAR ) ) != 0 )
+    {
+        Close();
+        return E_FAIL;
+    }
+
+    auto pEntries = reinterpret_cast<const DXUT_ARCHIVE_ENTRY*>( m_pData + pHeader->EntriesOffset );
+    const UINT64 nameChars = pHeader->NamesBytes / sizeof( WCHAR );
+    for( UINT i = 0; i < pHeader->NumEntries; ++i )
+    {
+        const DXUT_ARCHIVE_ENTRY& entry = pEntries[i];
+        if( UINT64( entry.NameOffset ) + entry.NameLength >= nameChars
+            || entry.DataOffset + entry.StoredBytes > fileSize
+            || entry.Compression > DXUT_ARCHIVE_LZ4
+            || ( entry.Compression == DXUT_ARCHIVE_STORED && entry.StoredBytes != entry.Bytes ) )
+        {
+            Close();
+            return E_FAIL;
+        }
+    }
+
+    m_pHeader = pHeader;
+    m_pEntries = pEntries;
+    m_pNames = reinterpret_cast<const WCHAR*>( m_pData + pHeader->NamesOffset );
+
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+void CDXUTArchive::Close()
+{
+    if( m_pData )
+    {
+        UnmapViewOfFile( m_pData );
+        m_pData = nullptr;
+    }
+
+    if( m_hFileMapping )
+    {
+        CloseHandle( m_hFileMapping );
+        m_hFileMapping = nullptr;
+    }
+
+    if( m_hFile != INVALID_HANDLE_VALUE )
+    {
+        CloseHandle( m_hFile );
+        m_hFile = INVALID_HANDLE_VALUE;
+    }
+
+    m_pHeader = nullptr;
+    m_pEntries = nullptr;
+    m_pNames = nullptr;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+const DXUT_ARCHIVE_ENTRY* CDXUTArchive::FindEntry( LPCWSTR szName ) const
+{
+    if( !m_pHeader || !szName )
+        return nullptr;
+
+    WCHAR strName[MAX_PATH];
+    size_t len = NormalizeArchiveName( szName, strName, MAX_PATH );
+    if( !len )
+        return nullptr;
+
+    const UINT64 hash = HashArchiveName( strName, len );
+
+    const DXUT_ARCHIVE_ENTRY* pEnd = m_pEntries + m_pHeader->NumEntries;
+    auto it = std::lower_bound( m_pEntries, pEnd, hash, []( const DXUT_ARCHIVE_ENTRY& entry, UINT64 value )
+    {
+        return entry.NameHash < value;
+    } );
+
+    for( ; it != pEnd && it->NameHash == hash; ++it )
+    {
+        if( it->NameLength == len && !wmemcmp( m_pNames + it->NameOffset, strName, len ) )
+            return it;
+    }
+
+    return nullptr;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTArchive::GetView( const DXUT_ARCHIVE_ENTRY* pEntry, DXUTArchive_View& view ) const
+{
+    view.pData = nullptr;
+    view.Bytes = 0;
+    view.Decoded.reset();
+
+    if( !m_pHeader || !pEntry )
+        return E_INVALIDARG;
+
+    const BYTE* pStored = m_pData + pEntry->DataOffset;
+    if( pEntry->Compression == DXUT_ARCHIVE_STORED )
+    {
+        view.pData = pStored;
+        view.Bytes = size_t( pEntry->Bytes );
+        return S_OK;
+    }
+
+    view.Decoded.reset( new (std::nothrow) BYTE[ size_t( pEntry->Bytes ) ] );
+    if( !view.Decoded )
+        return E_OUTOFMEMORY;
+
+    HRESULT hr = DXUTLZ4Decompress( pStored, size_t( pEntry->StoredBytes ), view.Decoded.get(), size_t( pEntry->Bytes ) );
+    if( FAILED( hr ) )
+    {
+        view.Decoded.reset();
+        return hr;
+    }
+
+    view.pData = view.Decoded.get();
+    view.Bytes = size_t( pEntry->Bytes );
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+const DXUT_ARCHIVE_ENTRY* CDXUTArchive::GetEntry( _In_ UINT iEntry ) const
+{
+    if( !m_pHeader || iEntry >= m_pHeader->NumEntries )
+        return nullptr;
+    return &m_pEntries[iEntry];
+}
+
+
+//--------------------------------------------------------------------------------------
+LPCWSTR CDXUTArchive::GetEntryName( _In_ const DXUT_ARCHIVE_ENTRY* pEntry ) const
+{
+    return ( m_pNames && pEntry ) ? m_pNames + pEntry->NameOffset : nullptr;
+}
+
+
+//======================================================================================
+// Mounted archives
+//======================================================================================
+
+_Use_decl_annotations_
+HRESULT WINAPI DXUTMountArchive( LPCWSTR szFileName )
+{
+    if( !szFileName )
+        return E_INVALIDARG;
+
+    WCHAR strPath[MAX_PATH];
+    HRESULT hr = DXUTFindDXSDKMediaFileCch( strPath, MAX_PATH, szFileName );
+    if( FAILED( hr ) )
+        return hr;
+
+    std::shared_ptr<CDXUTArchive> archive( new (std::nothrow) CDXUTArchive );
+    if( !archive )
+        return E_OUTOFMEMORY;
+
+    hr = archive->Open( strPath );
+    if( FAILED( hr ) )
+        return hr;
+
+    s_MountedArchives.push_back( std::move( archive ) );
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+void WINAPI DXUTUnmountArchives()
+{
+    s_MountedArchives.clear();
+    s_MountedArchives.shrink_to_fit();
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT WINAPI DXUTFindArchiveFile( LPCWSTR szFileName, DXUTArchive_View& view )
+{
+    view.pData = nullptr;
+    view.Bytes = 0;
+    view.Decoded.reset();
+
+    if( !szFileName )
+        return E_INVALIDARG;
+
+    for( auto it = s_MountedArchives.crbegin(); it != s_MountedArchives.crend(); ++it )
+    {
+        auto pEntry = ( *it )->FindEntry( szFileName );
+        if( pEntry )
+            return ( *it )->GetView( pEntry, view );
+    }
+
+    return DXUTERR_MEDIANOTFOUND;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT WINAPI DXUTFindArchiveEntry( LPCWSTR szFileName, std::shared_ptr<const CDXUTArchive>& archive,
+                                     const DXUT_ARCHIVE_ENTRY** ppEntry )
+{
+    archive.reset();
+    if( ppEntry )
+        *ppEntry = nullptr;
+
+    if( !szFileName || !ppEntry )
+        return E_INVALIDARG;
+
+    for( auto it = s_MountedArchives.crbegin(); it != s_MountedArchives.crend(); ++it )
+    {
+        auto pEntry = ( *it )->FindEntry( szFileName );
+        if( pEntry )
+        {
+            archive = *it;
+            *ppEntry = pEntry;
+            return S_OK;
+        }
+    }
+
+    return DXUTERR_MEDIANOTFOUND;
+}
+
+
+//======================================================================================
+// Archive creation
+//======================================================================================
+
+namespace
+{
+
+struct ARCHIVE_SOURCE_FILE
+{
+    std::wstring strRelative;
+    std::wstring strNormalized;
+    UINT64 NameHash;
+};
+
+HRESULT EnumerateArchiveFiles( _In_ const std::wstring& strRoot, _In_ const std::wstring& strRelativeDir,
+                               _In_ const std::wstring& strExclude, _Inout_ std::vector<ARCHIVE_SOURCE_FILE>& files )
+{
+    WIN32_FIND_DATAW fd;
+    std::wstring strPattern = strRoot + strRelativeDir + L"*";
+    HANDLE hFind = FindFirstFileW( strPattern.c_str(), &fd );
+    if( hFind == INVALID_HANDLE_VALUE )
+        return HRESULT_FROM_WIN32( GetLastError() );
+
+    HRESULT hr = S_OK;
+    do
+    {
+        std::wstring strRelative = strRelativeDir + fd.cFileName;
+        if( fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY )
+        {
+            if( wcscmp( fd.cFileName, L"." ) && wcscmp( fd.cFileName, L".." ) )
+                hr = EnumerateArchiveFiles( strRoot, strRelative + L"\\", strExclude, files );
+        }
+        else if( _wcsicmp( ( strRoot + strRelative ).c_str(), strExclude.c_str() ) != 0 )
+        {
+            WCHAR strName[MAX_PATH];
+            size_t len = NormalizeArchiveName( strRelative.c_str(), strName, MAX_PATH );
+            if( !len )
+            {
+                hr = HRESULT_FROM_WIN32( ERROR_FILENAME_EXCED_RANGE );
+            }
+            else
+            {
+                ARCHIVE_SOURCE_FILE file;
+                file.strRelative = strRelative;
+                file.strNormalized.assign( strName, len );
+                file.NameHash = HashArchiveName( strName, len );
+                files.push_back( file );
+            }
+        }
+    } while( SUCCEEDED( hr ) && FindNextFileW( hFind, &fd ) );
+
+    FindClose( hFind );
+    return hr;
+}
+
+HRESULT WriteArchiveBytes( _In_ HANDLE hFile, _In_reads_bytes_(bytes) const void* pData, _In_ size_t bytes )
+{
+    auto pBytes = reinterpret_cast<const BYTE*>( pData );
+    while( bytes > 0 )
+    {
+        DWORD chunk = DWORD( std::min<size_t>( bytes, 0x40000000 ) );
+        DWORD written = 0;
+        if( !WriteFile( hFile, pBytes, chunk, &written, nullptr ) || written != chunk )
+            return HRESULT_FROM_WIN32( GetLastError() );
+        pBytes += chunk;
+        bytes -= chunk;
+    }
+    return S_OK;
+}
+
+HRESULT PadArchive( _In_ HANDLE hFile, _Inout_ UINT64& offset )
+{
+    static const BYTE s_zeros[DXUT_ARCHIVE_ALIGNMENT] = {};
+    UINT64 aligned = AlignArchiveOffset( offset );
+    HRESULT hr = WriteArchiveBytes( hFile, s_zeros, size_t( aligned - offset ) );
+    offset = aligned;
+    return hr;
+}
+
+HRESULT ReadArchiveSource( _In_z_ LPCWSTR szFileName, _Inout_ std::unique_ptr<BYTE[]>& data, _Out_ size_t& bytes )
+{
+    bytes = 0;
+
+    HANDLE hFile = CreateFileW( szFileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr );
+    if( hFile == INVALID_HANDLE_VALUE )
+        return HRESULT_FROM_WIN32( GetLastError() );
+
+    HRESULT hr = S_OK;
+    LARGE_INTEGER FileSize;
+    if( !GetFileSizeEx( hFile, &FileSize ) )
+    {
+        hr = HRESULT_FROM_WIN32( GetLastError() );
+    }
+    else if( FileSize.HighPart > 0 )
+    {
+        hr = E_FAIL;
+    }
+    else
+    {
+        data.reset( new (std::nothrow) BYTE[ FileSize.LowPart + 1 ] );
+        DWORD read = 0;
+        if( !data )
+            hr = E_OUTOFMEMORY;
+        else if( !ReadFile( hFile, data.get(), FileSize.LowPart, &read, nullptr ) || read != FileSize.LowPart )
+            hr = HRESULT_FROM_WIN32( GetLastError() );
+        else
+            bytes = FileSize.LowPart;
+    }
+
+    CloseHandle( hFile );
+    return hr;
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT WINAPI DXUTCreateArchive( LPCWSTR szArchiveFile, LPCWSTR szSourceDir, DWORD dwFlags )
+{
+    if( !szArchiveFile || !szSourceDir )
+        return E_INVALIDARG;
+
+    WCHAR strRoot[MAX_PATH];
+    WCHAR strArchive[MAX_PATH];
+    if( !GetFullPathNameW( szSourceDir, MAX_PATH, strRoot, nullptr )
+        || !GetFullPathNameW( szArchiveFile, MAX_PATH, strArchive, nullptr ) )
+        return HRESULT_FROM_WIN32( GetLastError() );
+
+    std::wstring root( strRoot );
+    if( !root.empty() && root.back() != L'\\' && root.back() != L'/' )
+        root += L'\\';
+
+    std::vector<ARCHIVE_SOURCE_FILE> files;
+    HRESULT hr = EnumerateArchiveFiles( root, std::wstring(), strArchive, files );
+    if( FAILED( hr ) )
+        return hr;
+
+    // The table of contents is sorted for lookups, payloads keep the directory order so
+    // that assets that sit together on disk are read together
+    std::vector<UINT> order( files.size() );
+    for( size_t i = 0; i < files.size(); ++i )
+        order[i] = UINT( i );
+    std::sort( order.begin(), order.end(), [&files]( UINT a, UINT b )
+    {
+        if( files[a].NameHash != files[b].NameHash )
+            return files[a].NameHash < files[b].NameHash;
+        return files[a].strNormalized < files[b].strNormalized;
+    } );
+
+    DXUT_ARCHIVE_HEADER header;
+    ZeroMemory( &header, sizeof( header ) );
+    header.Magic = DXUT_ARCHIVE_MAGIC;
+    header.Version = DXUT_ARCHIVE_VERSION;
+    header.NumEntries = UINT( files.size() );
+    header.Alignment = DXUT_ARCHIVE_ALIGNMENT;
+    header.EntriesOffset = sizeof( DXUT_ARCHIVE_HEADER );
+    header.NamesOffset = header.EntriesOffset + files.size() * sizeof( DXUT_ARCHIVE_ENTRY );
+
+    std::vector<DXUT_ARCHIVE_ENTRY> entries( files.size() );
+    std::vector<WCHAR> names;
+    std::vector<UINT> entryOfFile( files.size() );
+    for( size_t i = 0; i < order.size(); ++i )
+    {
+        const ARCHIVE_SOURCE_FILE& file = files[ order[i] ];
+        DXUT_ARCHIVE_ENTRY& entry = entries[i];
+        ZeroMemory( &entry, sizeof( entry ) );
+        entry.NameHash = file.NameHash;
+        entry.NameOffset = UINT( names.size() );
+        entry.NameLength = UINT( file.strNormalized.size() );
+        names.insert( names.end(), file.strNormalized.cbegin(), file.strNormalized.cend() );
+        names.push_back( 0 );
+        entryOfFile[ order[i] ] = UINT( i );
+    }
+    names.push_back( 0 );
+    header.NamesBytes = names.size() * sizeof( WCHAR );
+
+    HANDLE hFile = CreateFileW( strArchive, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr );
+    if( hFile == INVALID_HANDLE_VALUE )
+        return HRESULT_FROM_WIN32( GetLastError() );
+
+    // Payloads first, the table of contents is written once all sizes are known
+    UINT64 offset = header.NamesOffset + header.NamesBytes;
+    LARGE_INTEGER liMove;
+    liMove.QuadPart = LONGLONG( AlignArchiveOffset( offset ) );
+    offset = UINT64( liMove.QuadPart );
+    if( !SetFilePointerEx( hFile, liMove, nullptr, FILE_BEGIN ) )
+        hr = HRESULT_FROM_WIN32( GetLastError() );
+
+    std::unique_ptr<BYTE[]> data;
+    std::vector<BYTE> compressed;
+    for( size_t i = 0; i < files.size() && SUCCEEDED( hr ); ++i )
+    {
+        size_t bytes = 0;
+        hr = ReadArchiveSource( ( root + files[i].strRelative ).c_str(), data, bytes );
+        if( FAILED( hr ) )
+            break;
+
+        DXUT_ARCHIVE_ENTRY& entry = entries[ entryOfFile[i] ];
+        entry.DataOffset = offset;
+        entry.Bytes = bytes;
+        entry.StoredBytes = bytes;
+        entry.Compression = DXUT_ARCHIVE_STORED;
+
+        const BYTE* pPayload = data.get();
+        if( ( dwFlags & DXUT_ARCHIVE_COMPRESS ) && bytes > 0 )
+        {
+            compressed.resize( DXUTLZ4CompressBound( bytes ) );
+            size_t compressedBytes = DXUTLZ4Compress( data.get(), bytes, compressed.data(), compressed.size() );
+            if( compressedBytes && compressedBytes <= bytes - bytes / 8 )
+            {
+                entry.StoredBytes = compressedBytes;
+                entry.Compression = DXUT_ARCHIVE_LZ4;
+                pPayload = compressed.data();
+            }
+        }
+
+        hr = WriteArchiveBytes( hFile, pPayload, size_t( entry.StoredBytes ) );
+        if( SUCCEEDED( hr ) )
+        {
+            offset += entry.StoredBytes;
+            hr = PadArchive( hFile, offset );
+        }
+    }
+
+    if( SUCCEEDED( hr ) )
+    {
+        header.FileSize = offset;
+
+        liMove.QuadPart = 0;
+        if( !SetFilePointerEx( hFile, liMove, nullptr, FILE_BEGIN ) )
+            hr = HRESULT_FROM_WIN32( GetLastError() );
+        if( SUCCEEDED( hr ) )
+            hr = WriteArchiveBytes( hFile, &header, sizeof( header ) );
+        if( SUCCEEDED( hr ) && !entries.empty() )
+            hr = WriteArchiveBytes( hFile, entries.data(), entries.size() * sizeof( DXUT_ARCHIVE_ENTRY ) );
+        if( SUCCEEDED( hr ) )
+            hr = WriteArchiveBytes( hFile, names.data(), names.size() * sizeof( WCHAR ) );
+    }
+
+    CloseHandle( hFile );
+    if( FAILED( hr ) )
+        DeleteFileW( strArchive );
+
+    return hr;
+}
+
+
+//======================================================================================
+// LZ4 block format
+//======================================================================================
+
+namespace
+{
+
+const size_t LZ4_MINMATCH = 4;
+const size_t LZ4_LASTLITERALS = 5;  // The last 5 bytes are always literals
+const size_t LZ4_MFLIMIT = 12;      // The last match starts at least 12 bytes before the end
+const size_t LZ4_MAXOFFSET = 65535;
+const UINT LZ4_HASHLOG = 16;
+
+inline UINT ReadLZ4Word( _In_reads_bytes_(4) const BYTE* p )
+{
+    UINT v;
+    memcpy( &v, p, sizeof( v ) );
+    return v;
+}
+
+inline UINT HashLZ4Word( UINT v )
+{
+    return ( v * 2654435761U ) >> ( 32 - LZ4_HASHLOG );
+}
+
+bool WriteLZ4Length( _Inout_ BYTE*& pOut, _In_ const BYTE* pEnd, size_t length )
+{
+    while( length >= 255 )
+    {
+        if( pOut >= pEnd )
+            return false;
+        *pOut++ = 255;
+        length -= 255;
+    }
+    if( pOut >= pEnd )
+        return false;
+    *pOut++ = BYTE( length );
+    return true;
+}
+
+bool WriteLZ4Sequence( _Inout_ BYTE*& pOut, _In_ const BYTE* pEnd, _In_reads_(literals) const BYTE* pLiterals,
+                       size_t literals, size_t offset, size_t matchLength )
+{
+    if( pOut >= pEnd )
+        return false;
+
+    BYTE* pToken = pOut++;
+    BYTE token = BYTE( std::min<size_t>( literals, 15 ) << 4 );
+    if( literals >= 15 && !WriteLZ4Length( pOut, pEnd, literals - 15 ) )
+        return false;
+
+    if( size_t( pEnd - pOut ) < literals )
+        return false;
+    memcpy( pOut, pLiterals, literals );
+    pOut += literals;
+
+    if( matchLength )
+    {
+        if( pEnd - pOut < 2 )
+            return false;
+        *pOut++ = BYTE( offset );
+        *pOut++ = BYTE( offset >> 8 );
+
+        size_t code = matchLength - LZ4_MINMATCH;
+        token |= BYTE( std::min<size_t>( code, 15 ) );
+        if( code >= 15 && !WriteLZ4Length( pOut, pEnd, code - 15 ) )
+            return false;
+    }
+
+    *pToken = token;
+    return true;
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+size_t WINAPI DXUTLZ4CompressBound( _In_ size_t srcBytes )
+{
+    return srcBytes + srcBytes / 255 + 16;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Greedy single-probe compressor; returns 0 when the output does not fit
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+size_t WINAPI DXUTLZ4Compress( const BYTE* pSrc, size_t srcBytes, BYTE* pDest, size_t destCapacity )
+{
+    BYTE* pOut = pDest;
+    const BYTE* pEnd = pDest + destCapacity;
+    size_t anchor = 0;
+
+    if( srcBytes > LZ4_MFLIMIT )
+    {
+        std::vector<size_t> table( size_t( 1 ) << LZ4_HASHLOG, size_t( -1 ) );
+        const size_t matchLimit = srcBytes - LZ4_LASTLITERALS;
+        const size_t inputLimit = srcBytes - LZ4_MFLIMIT;
+
+        size_t ip = 0;
+        while( ip <= inputLimit )
+        {
+            UINT seq = ReadLZ4Word( pSrc + ip );
+            UINT h = HashLZ4Word( seq );
+            size_t ref = table[h];
+            table[h] = ip;
+
+            if( ref == size_t( -1 ) || ip - ref > LZ4_MAXOFFSET || ReadLZ4Word( pSrc + ref ) != seq )
+            {
+                ++ip;
+                continue;
+            }
+
+            size_t length = LZ4_MINMATCH;
+            while( ip + length < matchLimit && pSrc[ref + length] == pSrc[ip + length] )
+                ++length;
+
+            if( !WriteLZ4Sequence( pOut, pEnd, pSrc + anchor, ip - anchor, ip - ref, length ) )
+                return 0;
+
+            ip += length;
+            anchor = ip;
+        }
+    }
+
+    if( !WriteLZ4Sequence( pOut, pEnd, pSrc + anchor, srcBytes - anchor, 0, 0 ) )
+        return 0;
+
+    return size_t( pOut - pDest );
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT WINAPI DXUTLZ4Decompress( const BYTE* pSrc, size_t srcBytes, BYTE* pDest, size_t destBytes )
+{
+    size_t ip = 0;
+    size_t op = 0;
+    while( ip < srcBytes )
+    {
+        BYTE token = pSrc[ip++];
+
+        size_t literals = token >> 4;
+        if( literals == 15 )
+        {
+            BYTE b;
+            do
+            {
+                if( ip >= srcBytes )
+                    return E_FAIL;
+                b = pSrc[ip++];
+                literals += b;
+            } while( b == 255 );
+        }
+
+        if( literals > srcBytes - ip || literals > destBytes - op )
+            return E_FAIL;
+        memcpy( pDest + op, pSrc + ip, literals );
+        ip += literals;
+        op += literals;
+
+        // The last sequence has no match
+        if( ip >= srcBytes )
+            break;
+
+        if( srcBytes - ip < 2 )
+            return E_FAIL;
+        size_t offset = size_t( pSrc[ip] ) | ( size_t( pSrc[ip + 1] ) << 8 );
+        ip += 2;
+        if( !offset || offset > op )
+            return E_FAIL;
+
+        size_t length = ( token & 15 );
+        if( length == 15 )
+        {
+            BYTE b;
+            do
+            {
+                if( ip >= srcBytes )
+                    return E_FAIL;
+                b = pSrc[ip++];
+                length += b;
+            } while( b == 255 );
+        }
+        length += LZ4_MINMATCH;
+
+        if( length > destBytes - op )
+            return E_FAIL;
+
+        // Matches may overlap their own output, so copy forward one byte at a time
+        const BYTE* pMatch = pDest + op - offset;
+        for( size_t i = 0; i < length; ++i )
+            pDest[op + i] = pMatch[i];
+        op += length;
+    }
+
+    return ( op == destBytes ) ? S_OK : E_FAIL;
+}
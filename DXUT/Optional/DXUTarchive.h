@@ -0,0 +1,153 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTarchive.h
+//
+// Packed asset archives.  An archive holds many media files in a single file that is
+// memory mapped once; lookups are a binary search of a hashed table of contents instead
+// of a directory probe and CreateFile per asset.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+//--------------------------------------------------------------------------------------
+// File layout:
+//   DXUT_ARCHIVE_HEADER
+//   DXUT_ARCHIVE_ENTRY[NumEntries]     sorted by NameHash, then by name
+//   Name table                         null terminated UTF-16 names
+//   Payloads                           each starting on a DXUT_ARCHIVE_ALIGNMENT boundary
+//
+// Names are stored relative to the packed directory, lower case with '\' separators, so
+// they match the relative names passed to DXUTFindDXSDKMediaFileCch.
+//--------------------------------------------------------------------------------------
+#define DXUT_ARCHIVE_MAGIC 0x52415844 // "DXAR"
+#define DXUT_ARCHIVE_VERSION 1
+#define DXUT_ARCHIVE_ALIGNMENT 4096
+
+enum DXUT_ARCHIVE_COMPRESSION
+{
+    DXUT_ARCHIVE_STORED = 0,
+    DXUT_ARCHIVE_LZ4,
+};
+
+// Flags for DXUTCreateArchive
+#define DXUT_ARCHIVE_COMPRESS 0x1
+
+#pragma pack(push,8)
+
+struct DXUT_ARCHIVE_HEADER
+{
+    UINT Magic;
+    UINT Version;
+    UINT NumEntries;
+    UINT Alignment;
+    UINT64 EntriesOffset;
+    UINT64 NamesOffset;
+    UINT64 NamesBytes;
+    UINT64 FileSize;
+};
+
+struct DXUT_ARCHIVE_ENTRY
+{
+    UINT64 NameHash;        // FNV-1a of the normalized name
+    UINT NameOffset;        // In characters from the start of the name table
+    UINT NameLength;        // In characters, excluding the terminator
+    UINT64 DataOffset;
+    UINT64 StoredBytes;
+    UINT64 Bytes;
+    UINT Compression;
+    UINT Reserved;
+};
+
+#pragma pack(pop)
+
+static_assert( sizeof(DXUT_ARCHIVE_HEADER) == 48, "DXUT archive structure size incorrect" );
+static_assert( sizeof(DXUT_ARCHIVE_ENTRY) == 48, "DXUT archive structure size incorrect" );
+
+
+//--------------------------------------------------------------------------------------
+// Contents of an archive entry.  Stored entries point straight into the mapped archive and
+// stay valid while the archive is open; compressed entries are decoded into Decoded.
+//--------------------------------------------------------------------------------------
+struct DXUTArchive_View
+{
+    const BYTE* pData;
+    size_t Bytes;
+    std::unique_ptr<BYTE[]> Decoded;
+
+    DXUTArchive_View() :
+        pData( nullptr ),
+        Bytes( 0 )
+    {
+    }
+
+    // Hands the contents over as a new[] allocation, copying out of the mapping if needed
+    _Ret_maybenull_ BYTE* Detach();
+};
+
+
+//--------------------------------------------------------------------------------------
+// A memory mapped archive
+//--------------------------------------------------------------------------------------
+class CDXUTArchive
+{
+public:
+    CDXUTArchive();
+    ~CDXUTArchive();
+
+    HRESULT Open( _In_z_ LPCWSTR szFileName );
+    void Close();
+    bool IsOpen() const { return m_pHeader != nullptr; }
+
+    const DXUT_ARCHIVE_ENTRY* FindEntry( _In_z_ LPCWSTR szName ) const;
+    HRESULT GetView( _In_ const DXUT_ARCHIVE_ENTRY* pEntry, _Out_ DXUTArchive_View& view ) const;
+
+    UINT GetNumEntries() const { return m_pHeader ? m_pHeader->NumEntries : 0; }
+    const DXUT_ARCHIVE_ENTRY* GetEntry( _In_ UINT iEntry ) const;
+    LPCWSTR GetEntryName( _In_ const DXUT_ARCHIVE_ENTRY* pEntry ) const;
+
+private:
+    // Not copyable, the mapping is owned
+    CDXUTArchive( const CDXUTArchive& );
+    CDXUTArchive& operator=( const CDXUTArchive& );
+
+    HANDLE m_hFile;
+    HANDLE m_hFileMapping;
+    const BYTE* m_pData;
+    const DXUT_ARCHIVE_HEADER* m_pHeader;
+    const DXUT_ARCHIVE_ENTRY* m_pEntries;
+    const WCHAR* m_pNames;
+};
+
+
+//--------------------------------------------------------------------------------------
+// Mounted archives are searched, most recently mounted first, by the DXUT texture and mesh
+// loaders before they fall back to the media search path.  Mounting and unmounting must not
+// race with loads that use the archives.
+//
+// A stored entry's view from DXUTFindArchiveFile points into the mapping and is only valid
+// until DXUTUnmountArchives.  DXUTFindArchiveEntry instead hands out a reference to the
+// archive itself, which stays mapped for as long as the reference is held.
+//--------------------------------------------------------------------------------------
+HRESULT WINAPI DXUTMountArchive( _In_z_ LPCWSTR szFileName );
+void WINAPI DXUTUnmountArchives();
+HRESULT WINAPI DXUTFindArchiveFile( _In_z_ LPCWSTR szFileName, _Out_ DXUTArchive_View& view );
+HRESULT WINAPI DXUTFindArchiveEntry( _In_z_ LPCWSTR szFileName, _Out_ std::shared_ptr<const CDXUTArchive>& archive,
+                                     _Outptr_ const DXUT_ARCHIVE_ENTRY** ppEntry );
+
+// Packs every file below szSourceDir into a new archive.  With DXUT_ARCHIVE_COMPRESS each
+// entry is LZ4 compressed when that saves at least an eighth of its size.
+HRESULT WINAPI DXUTCreateArchive( _In_z_ LPCWSTR szArchiveFile, _In_z_ LPCWSTR szSourceDir, _In_ DWORD dwFlags );
+
+// LZ4 block format codec used for compressed entries
+size_t WINAPI DXUTLZ4CompressBound( _In_ size_t srcBytes );
+size_t WINAPI DXUTLZ4Compress( _In_reads_bytes_(srcBytes) const BYTE* pSrc, _In_ size_t srcBytes,
+                               _Out_writes_bytes_to_(destCapacity, return) BYTE* pDest, _In_ size_t destCapacity );
+HRESULT WINAPI DXUTLZ4Decompress( _In_reads_bytes_(srcBytes) const BYTE* pSrc, _In_ size_t srcBytes,
+                                  _Out_writes_bytes_all_(destBytes) BYTE* pDest, _In_ size_t destBytes );
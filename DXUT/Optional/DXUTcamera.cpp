@@ -13,9 +13,261 @@
 #include "DXUT.h"
 #include "DXUTcamera.h"
 #include "DXUTres.h"
+#include "SDKmisc.h"
+#include "DXUTLockFreePipe.h"
+
+#include <atomic>
+#include <thread>
 
 using namespace DirectX;
 
+//======================================================================================
+// CDXUTInputSampler
+//======================================================================================
+
+//--------------------------------------------------------------------------------------
+// Samples the cursor and the gamepads on a thread of its own at a fixed rate.  Changes
+// reach the camera as timestamped events through a DXUTLockFreePipe.  Ports with no
+// controller are polled once a second, since XInputGetState is slow on them.  The thread
+// waits on a high-resolution timer where the OS has one, and otherwise raises the system
+// timer resolution to 1ms while it runs.
+//
+// The thread touches no DXUT window state: the render thread decides whether and where
+// the cursor is recentered and publishes the point with SetRecenterPoint.
+//--------------------------------------------------------------------------------------
+#define DXUT_INPUT_PIPE_SIZE_LOG2 15            // Room for a few hundred events
+#define DXUT_INPUT_DISCONNECTED_POLL_SECS 1.0
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+enum DXUT_INPUT_EVENT_TYPE
+{
+    DXUT_INPUT_MOUSE_MOVE = 0,
+    DXUT_INPUT_GAMEPAD,
+};
+
+struct DXUT_INPUT_EVENT
+{
+    LONGLONG Timestamp;                         // DXUTGetTimestamp ticks
+    DXUT_INPUT_EVENT_TYPE Type;
+    POINT ptDelta;                              // DXUT_INPUT_MOUSE_MOVE
+    DWORD dwPort;                               // DXUT_INPUT_GAMEPAD
+    DXUT_GAMEPAD GamePad;
+};
+
+class CDXUTInputSampler
+{
+public:
+    CDXUTInputSampler() :
+        m_bQuit( false ),
+        m_Recenter( NO_RECENTER ),
+        m_nIntervalMs( 2 )
+    {
+    }
+
+    ~CDXUTInputSampler() { Stop(); }
+
+    HRESULT Start( _In_ UINT nIntervalMs );
+    void Stop();
+
+    // Set each frame to where the cursor is put back after it moves, or nullptr to leave it
+    void SetRecenterPoint( _In_opt_ const POINT* pPoint )
+    {
+        m_Recenter.store( pPoint ? PackPoint( *pPoint ) : NO_RECENTER, std::memory_order_relaxed );
+    }
+
+    // Consumer side, only called from the thread running the camera
+    bool Pop( _Out_ DXUT_INPUT_EVENT& event );
+
+private:
+    CDXUTInputSampler( const CDXUTInputSampler& );
+    CDXUTInputSampler& operator=( const CDXUTInputSampler& );
+
+    // x = INT_MIN is never the middle of a monitor
+    static const uint64_t NO_RECENTER = 0x8000000000000000ULL;
+
+    static uint64_t PackPoint( const POINT& pt ) { return ( uint64_t( uint32_t( pt.x ) ) << 32 ) | uint32_t( pt.y ); }
+    static POINT UnpackPoint( uint64_t packed )
+    {
+        POINT pt = { LONG( int32_t( uint32_t( packed >> 32 ) ) ), LONG( int32_t( uint32_t( packed ) ) ) };
+        return pt;
+    }
+
+    bool Push( _In_ const DXUT_INPUT_EVENT& event );
+    void Run();
+
+    DXUTLockFreePipe<DXUT_INPUT_PIPE_SIZE_LOG2> m_Pipe;     // Written by the sampler, read by the camera
+    std::atomic<bool> m_bQuit;
+    std::atomic<uint64_t> m_Recenter;                       // Packed POINT, or NO_RECENTER
+    UINT m_nIntervalMs;
+    std::thread m_Thread;
+};
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTInputSampler::Start( UINT nIntervalMs )
+{
+    Stop();
+
+    m_nIntervalMs = std::max<UINT>( nIntervalMs, 1 );
+    m_bQuit.store( false );
+
+    // Drop what a previous run left behind
+    DXUT_INPUT_EVENT event;
+    while( Pop( event ) ) {}
+
+    // Load XInput here so the sampling thread only ever reads the function pointers.  No
+    // XInput is not an error; the ports just never connect.
+    DXUTInitXInput();
+
+    try
+    {
+        m_Thread = std::thread( [this]() { Run(); } );
+    }
+    catch( ... )
+    {
+        return E_FAIL;
+    }
+
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+void CDXUTInputSampler::Stop()
+{
+    if( m_Thread.joinable() )
+    {
+        m_bQuit.store( true );
+        m_Thread.join();
+    }
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+bool CDXUTInputSampler::Push( const DXUT_INPUT_EVENT& event )
+{
+    return m_Pipe.Write( &event, sizeof( DXUT_INPUT_EVENT ) );
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+bool CDXUTInputSampler::Pop( DXUT_INPUT_EVENT& event )
+{
+    return m_Pipe.Read( &event, sizeof( DXUT_INPUT_EVENT ) );
+}
+
+
+//--------------------------------------------------------------------------------------
+// Sampling thread.  While the pipe is full, mouse motion keeps accumulating and changed
+// gamepads stay pending, so nothing is lost, only merged.
+//--------------------------------------------------------------------------------------
+void CDXUTInputSampler::Run()
+{
+    // Windows 10 1803 and later; elsewhere Sleep at 1ms timer resolution
+    HANDLE hTimer = CreateWaitableTimerEx( nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS );
+    bool bRaisedTimerResolution = false;
+    if( !hTimer )
+        bRaisedTimerResolution = ( timeBeginPeriod( 1 ) == TIMERR_NOERROR );
+
+    DXUT_GAMEPAD GamePad[DXUT_MAX_CONTROLLERS];
+    ZeroMemory( GamePad, sizeof( GamePad ) );
+    bool bGamePadPending[DXUT_MAX_CONTROLLERS] = {};
+    LONGLONG llNextPoll[DXUT_MAX_CONTROLLERS] = {};
+    LONGLONG llDisconnectedInterval = LONGLONG( DXUT_INPUT_DISCONNECTED_POLL_SECS / DXUTTimestampToSeconds( 1 ) );
+
+    POINT ptLast;
+    GetCursorPos( &ptLast );
+    POINT ptPending = { 0, 0 };
+
+    while( !m_bQuit.load( std::memory_order_relaxed ) )
+    {
+        LONGLONG llNow = DXUTGetTimestamp();
+
+        POINT ptCur;
+        if( GetCursorPos( &ptCur ) )
+        {
+            ptPending.x += ptCur.x - ptLast.x;
+            ptPending.y += ptCur.y - ptLast.y;
+            ptLast = ptCur;
+
+            // Recenter here rather than on the render thread so the jump is never sampled
+            uint64_t recenter = m_Recenter.load( std::memory_order_relaxed );
+            if( recenter != NO_RECENTER && ( ptPending.x || ptPending.y ) )
+            {
+                ptLast = UnpackPoint( recenter );
+                SetCursorPos( ptLast.x, ptLast.y );
+            }
+        }
+
+        if( ptPending.x || ptPending.y )
+        {
+            DXUT_INPUT_EVENT event;
+            event.Timestamp = llNow;
+            event.Type = DXUT_INPUT_MOUSE_MOVE;
+            event.ptDelta = ptPending;
+            event.dwPort = 0;
+            if( Push( event ) )
+                ptPending.x = ptPending.y = 0;
+        }
+
+        for( DWORD iPort = 0; iPort < DXUT_MAX_CONTROLLERS; iPort++ )
+        {
+            if( llNow >= llNextPoll[iPort] )
+            {
+                DXUT_GAMEPAD previous = GamePad[iPort];
+                DXUTGetGamepadState( iPort, &GamePad[iPort], true, true );
+
+                if( GamePad[iPort].bConnected != previous.bConnected ||
+                    ( GamePad[iPort].bConnected && memcmp( &GamePad[iPort], &previous, sizeof( XINPUT_GAMEPAD ) ) != 0 ) )
+                    bGamePadPending[iPort] = true;
+
+                // Back off on empty ports
+                llNextPoll[iPort] = GamePad[iPort].bConnected ? 0 : llNow + llDisconnectedInterval;
+            }
+
+            if( bGamePadPending[iPort] )
+            {
+                DXUT_INPUT_EVENT event;
+                event.Timestamp = llNow;
+                event.Type = DXUT_INPUT_GAMEPAD;
+                event.ptDelta.x = event.ptDelta.y = 0;
+                event.dwPort = iPort;
+                event.GamePad = GamePad[iPort];
+                if( Push( event ) )
+                    bGamePadPending[iPort] = false;
+            }
+        }
+
+        if( hTimer )
+        {
+            // Negative due time is relative, in 100ns units
+            LARGE_INTEGER dueTime;
+            dueTime.QuadPart = -LONGLONG( m_nIntervalMs ) * 10000;
+            if( SetWaitableTimer( hTimer, &dueTime, 0, nullptr, nullptr, FALSE ) )
+                WaitForSingleObject( hTimer, INFINITE );
+            else
+                Sleep( m_nIntervalMs );
+        }
+        else
+        {
+            Sleep( m_nIntervalMs );
+        }
+    }
+
+    if( hTimer )
+        CloseHandle( hTimer );
+    if( bRaisedTimerResolution )
+        timeEndPeriod( 1 );
+}
+
+
+
 //======================================================================================
 // CD3DArcBall
 //======================================================================================
@@ -206,6 +458,7 @@ CBaseCamera::CBaseCamera() :
 {
     ZeroMemory( m_aKeys, sizeof( BYTE ) * CAM_MAX_KEYS );
     ZeroMemory( m_GamePad, sizeof( DXUT_GAMEPAD ) * DXUT_MAX_CONTROLLERS );
+    ZeroMemory( m_GamePadLastActive, sizeof( m_GamePadLastActive ) );
 
     // Setup the view matrix
     SetViewParams( g_XMZero, g_XMIdentityR2 );
@@ -227,6 +480,42 @@ CBaseCamera::CBaseCamera() :
 }
 
 
+//--------------------------------------------------------------------------------------
+CBaseCamera::~CBaseCamera()
+{
+}
+
+
+//--------------------------------------------------------------------------------------
+// Moves mouse and gamepad polling to a background thread, or back to the frame
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CBaseCamera::SetBackgroundInputSampling( bool bEnable, UINT nIntervalMs )
+{
+    if( !bEnable )
+    {
+        m_pInputSampler.reset();
+        GetCursorPos( &m_ptLastMousePosition );
+        return S_OK;
+    }
+
+    if( !m_pInputSampler )
+    {
+        m_pInputSampler.reset( new (std::nothrow) CDXUTInputSampler );
+        if( !m_pInputSampler )
+            return E_OUTOFMEMORY;
+    }
+
+    // DrainSampledInput turns recentering on once the camera reads the mouse
+    m_pInputSampler->SetRecenterPoint( nullptr );
+
+    HRESULT hr = m_pInputSampler->Start( nIntervalMs );
+    if( FAILED( hr ) )
+        m_pInputSampler.reset();
+    return hr;
+}
+
+
 //--------------------------------------------------------------------------------------
 // Client can call this to change the position and direction of camera
 //--------------------------------------------------------------------------------------
@@ -435,7 +724,12 @@ void CBaseCamera::GetInput( bool bGetKeyboardInput, bool bGetMouseInput, bool bG
             m_vKeyboardDirection.x -= 1.0f;
     }
 
-    if( bGetMouseInput )
+    if( m_pInputSampler )
+    {
+        // The sampling thread already polled the mouse and the gamepads
+        DrainSampledInput( bGetMouseInput );
+    }
+    else if( bGetMouseInput )
     {
         UpdateMouseDelta();
     }
@@ -445,18 +739,21 @@ void CBaseCamera::GetInput( bool bGetKeyboardInput, bool bGetMouseInput, bool bG
         m_vGamePadLeftThumb = XMFLOAT3( 0, 0, 0 );
         m_vGamePadRightThumb = XMFLOAT3( 0, 0, 0 );
 
-        // Get controller state
-        for( DWORD iUserIndex = 0; iUserIndex < DXUT_MAX_CONTROLLERS; iUserIndex++ )
+        // Get controller state, unless the sampling thread already did
+        if( !m_pInputSampler )
         {
-            DXUTGetGamepadState( iUserIndex, &m_GamePad[iUserIndex], true, true );
-
-            // Mark time if the controller is in a non-zero state
-            if( m_GamePad[iUserIndex].wButtons ||
-                m_GamePad[iUserIndex].sThumbLX || m_GamePad[iUserIndex].sThumbLY ||
-                m_GamePad[iUserIndex].sThumbRX || m_GamePad[iUserIndex].sThumbRY ||
-                m_GamePad[iUserIndex].bLeftTrigger || m_GamePad[iUserIndex].bRightTrigger )
+            for( DWORD iUserIndex = 0; iUserIndex < DXUT_MAX_CONTROLLERS; iUserIndex++ )
             {
-                m_GamePadLastActive[iUserIndex] = DXUTGetTime();
+                DXUTGetGamepadState( iUserIndex, &m_GamePad[iUserIndex], true, true );
+
+                // Mark time if the controller is in a non-zero state
+                if( m_GamePad[iUserIndex].wButtons ||
+                    m_GamePad[iUserIndex].sThumbLX || m_GamePad[iUserIndex].sThumbLY ||
+                    m_GamePad[iUserIndex].sThumbRX || m_GamePad[iUserIndex].sThumbRY ||
+                    m_GamePad[iUserIndex].bLeftTrigger || m_GamePad[iUserIndex].bRightTrigger )
+                {
+                    m_GamePadLastActive[iUserIndex] = DXUTGetTime();
+                }
             }
         }
 
@@ -487,6 +784,97 @@ void CBaseCamera::GetInput( bool bGetKeyboardInput, bool bGetMouseInput, bool bG
 }
 
 
+//--------------------------------------------------------------------------------------
+// Integrates the events queued by the sampling thread since the last frame
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void CBaseCamera::DrainSampledInput( bool bGetMouseInput )
+{
+    // Recenter only while the mouse is being read, as UpdateMouseDelta does, so the cursor
+    // stays free while no button is down.  The window is looked at here, on the render
+    // thread, and the sampling thread is only handed the point.
+    POINT ptCenter = { 0, 0 };
+    bool bRecenter = false;
+    if( m_bResetCursorAfterMove && bGetMouseInput && DXUTIsActive() )
+    {
+        MONITORINFO mi;
+        mi.cbSize = sizeof( MONITORINFO );
+        if( DXUTGetMonitorInfo( DXUTMonitorFromWindow( DXUTGetHWND(), MONITOR_DEFAULTTONEAREST ), &mi ) )
+        {
+            ptCenter.x = ( mi.rcMonitor.left + mi.rcMonitor.right ) / 2;
+            ptCenter.y = ( mi.rcMonitor.top + mi.rcMonitor.bottom ) / 2;
+            bRecenter = true;
+        }
+    }
+    m_pInputSampler->SetRecenterPoint( bRecenter ? &ptCenter : nullptr );
+
+    // Press, insert and remove flags last one frame, as with DXUTGetGamepadState per frame
+    for( DWORD iPort = 0; iPort < DXUT_MAX_CONTROLLERS; iPort++ )
+    {
+        m_GamePad[iPort].wPressedButtons = 0;
+        m_GamePad[iPort].bPressedLeftTrigger = m_GamePad[iPort].bPressedRightTrigger = false;
+        m_GamePad[iPort].bInserted = m_GamePad[iPort].bRemoved = false;
+    }
+
+    // Event timestamps are converted to the DXUTGetTime base the non-sampled path uses
+    LONGLONG llNow = DXUTGetTimestamp();
+    double fNow = DXUTGetTime();
+
+    POINT ptDelta = { 0, 0 };
+    DXUT_INPUT_EVENT event;
+    while( m_pInputSampler->Pop( event ) )
+    {
+        switch( event.Type )
+        {
+            case DXUT_INPUT_MOUSE_MOVE:
+                ptDelta.x += event.ptDelta.x;
+                ptDelta.y += event.ptDelta.y;
+                break;
+
+            case DXUT_INPUT_GAMEPAD:
+            {
+                // Several samples can land in one frame; a press in any of them counts
+                auto& gamePad = m_GamePad[event.dwPort];
+                WORD wPressedButtons = gamePad.wPressedButtons | event.GamePad.wPressedButtons;
+                bool bPressedLeftTrigger = gamePad.bPressedLeftTrigger || event.GamePad.bPressedLeftTrigger;
+                bool bPressedRightTrigger = gamePad.bPressedRightTrigger || event.GamePad.bPressedRightTrigger;
+                bool bInserted = gamePad.bInserted || event.GamePad.bInserted;
+                bool bRemoved = gamePad.bRemoved || event.GamePad.bRemoved;
+
+                gamePad = event.GamePad;
+                gamePad.wPressedButtons = wPressedButtons;
+                gamePad.bPressedLeftTrigger = bPressedLeftTrigger;
+                gamePad.bPressedRightTrigger = bPressedRightTrigger;
+                gamePad.bInserted = bInserted;
+                gamePad.bRemoved = bRemoved;
+
+                // Mark when the controller was in a non-zero state
+                if( gamePad.wButtons ||
+                    gamePad.sThumbLX || gamePad.sThumbLY ||
+                    gamePad.sThumbRX || gamePad.sThumbRY ||
+                    gamePad.bLeftTrigger || gamePad.bRightTrigger )
+                {
+                    m_GamePadLastActive[event.dwPort] = fNow - DXUTTimestampToSeconds( llNow - event.Timestamp );
+                }
+                break;
+            }
+        }
+    }
+
+    // Motion between samples is not lost, so unlike UpdateMouseDelta there is nothing to
+    // smooth.  Motion while the camera is not reading the mouse is dropped, like a button
+    // press resetting m_ptLastMousePosition.
+    if( bGetMouseInput )
+    {
+        m_vMouseDelta.x = float( ptDelta.x );
+        m_vMouseDelta.y = float( ptDelta.y );
+
+        m_vRotVelocity.x = m_vMouseDelta.x * m_fRotationScaler;
+        m_vRotVelocity.y = m_vMouseDelta.y * m_fRotationScaler;
+    }
+}
+
+
 //--------------------------------------------------------------------------------------
 // Figure out the mouse delta based on mouse movement
 //--------------------------------------------------------------------------------------
@@ -14,6 +14,8 @@
 //--------------------------------------------------------------------------------------
 #pragma once
 
+#include "DXUTCameraBatch.h"
+
 //--------------------------------------------------------------------------------------
 class CD3DArcBall
 {
@@ -140,10 +142,13 @@ enum D3DUtil_CameraKeys
 //       records mouse and keyboard input for use by a derived class, and 
 //       keeps common state.
 //--------------------------------------------------------------------------------------
+class CDXUTInputSampler;
+
 class CBaseCamera
 {
 public:
     CBaseCamera();
+    virtual ~CBaseCamera();
 
     // Call these from client and use Get*Matrix() to read new matrices
     virtual LRESULT HandleMessages( _In_ HWND hWnd, _In_ UINT uMsg, _In_ WPARAM wParam, _In_ LPARAM lParam );
@@ -178,6 +183,10 @@ public:
     void SetNumberOfFramesToSmoothMouseData( _In_ int nFrames ) { if( nFrames > 0 ) m_fFramesToSmoothMouseData = ( float )nFrames; }
     void SetResetCursorAfterMove( _In_ bool bResetCursorAfterMove ) { m_bResetCursorAfterMove = bResetCursorAfterMove; }
 
+    // Samples the mouse and gamepads on a background thread every nIntervalMs instead of once
+    // per frame.  Mouse motion between frames is summed instead of smoothed.
+    HRESULT SetBackgroundInputSampling( _In_ bool bEnable, _In_ UINT nIntervalMs = 2 );
+
     // Functions to get state
     DirectX::XMMATRIX GetViewMatrix() const { return DirectX::XMLoadFloat4x4( &m_mView ); }
     DirectX::XMMATRIX GetProjMatrix() const { return DirectX::XMLoadFloat4x4( &m_mProj ); }
@@ -212,6 +221,7 @@ protected:
     void UpdateMouseDelta();
     void UpdateVelocity( _In_ float fElapsedTime );
     void GetInput( _In_ bool bGetKeyboardInput, _In_ bool bGetMouseInput, _In_ bool bGetGamepadInput );
+    void DrainSampledInput( _In_ bool bGetMouseInput );
 
     DirectX::XMFLOAT4X4 m_mView;                    // View matrix 
     DirectX::XMFLOAT4X4 m_mProj;                    // Projection matrix
@@ -263,6 +273,8 @@ protected:
 
     DirectX::XMFLOAT3 m_vMinBoundary;       // Min point in clip boundary
     DirectX::XMFLOAT3 m_vMaxBoundary;       // Max point in clip boundary
+
+    std::unique_ptr<CDXUTInputSampler> m_pInputSampler; // Background input thread, if enabled
 };
 
 
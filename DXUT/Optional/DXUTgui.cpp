@@ -208,7 +208,7 @@ inline int RectHeight( RECT& rc )
 
 ID3D11Buffer* g_pFontBuffer11 = nullptr;
 UINT g_FontBufferBytes11 = 0;
-std::vector<DXUTSpriteVertex> g_FontVertices;
+CDXUTFrameArray<DXUTSpriteVertex> g_FontVertices( DXUTGetFrameArena() );
 ID3D11ShaderResourceView* g_pFont11 = nullptr;
 ID3D11InputLayout* g_pInputLayout11 = nullptr;
 
@@ -247,6 +247,21 @@ _Use_decl_annotations_
 void DrawText11DXUT( ID3D11Device* pd3dDevice, ID3D11DeviceContext* pd3d11DeviceContext,
                  LPCWSTR strText, const RECT& rcScreen, XMFLOAT4 vFontColor,
                  float fBBWidth, float fBBHeight, bool bCenter )
+{
+    DrawText11DXUT( pd3dDevice, pd3d11DeviceContext, strText, (int)wcslen( strText ), nullptr, 0,
+                    rcScreen, vFontColor, fBBWidth, fBBHeight, bCenter );
+}
+
+
+//--------------------------------------------------------------------------------------
+// Draws strFirst then strSecond as one string, such as the text either side of the gap
+// in a CUniBuffer, without joining them
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void DrawText11DXUT( ID3D11Device* pd3dDevice, ID3D11DeviceContext* pd3d11DeviceContext,
+                 LPCWSTR strFirst, int nFirst, LPCWSTR strSecond, int nSecond,
+                 const RECT& rcScreen, XMFLOAT4 vFontColor,
+                 float fBBWidth, float fBBHeight, bool bCenter )
 {
     float fCharTexSizeX = 0.010526315f;
     //float fGlyphSizeX = 14.0f / fBBWidth;
@@ -261,7 +276,7 @@ void DrawText11DXUT( ID3D11Device* pd3dDevice, ID3D11DeviceContext* pd3d11Device
     fRectLeft = fRectLeft * 2.0f - 1.0f;
     fRectTop = fRectTop * 2.0f - 1.0f;
 
-    int NumChars = (int)wcslen( strText );
+    int NumChars = nFirst + nSecond;
     if (bCenter) {
         float fRectRight = rcScreen.right / fBBWidth;
         fRectRight = fRectRight * 2.0f - 1.0f;
@@ -279,14 +294,15 @@ void DrawText11DXUT( ID3D11Device* pd3dDevice, ID3D11DeviceContext* pd3d11Device
     float fDepth = 0.5f;
     for( int i=0; i<NumChars; i++ )
     {
-        if( strText[i] == '\n' )
+        WCHAR wch = ( i < nFirst ) ? strFirst[i] : strSecond[i - nFirst];
+        if( wch == '\n' )
         {
             fRectLeft = fOriginalLeft;
             fRectTop -= fGlyphSizeY;
 
             continue;
         }
-        else if( strText[i] < 32 || strText[i] > 126 )
+        else if( wch < 32 || wch > 126 )
         {
             continue;
         }
@@ -295,7 +311,7 @@ void DrawText11DXUT( ID3D11Device* pd3dDevice, ID3D11DeviceContext* pd3d11Device
         DXUTSpriteVertex SpriteVertex;
         float fRectRight = fRectLeft + fGlyphSizeX;
         float fRectBottom = fRectTop - fGlyphSizeY;
-        float fTexLeft = ( strText[i] - 32 ) * fCharTexSizeX;
+        float fTexLeft = ( wch - 32 ) * fCharTexSizeX;
         float fTexRight = fTexLeft + fCharTexSizeX;
 
         // tri1
@@ -348,8 +364,9 @@ void EndText11( ID3D11Device* pd3dDevice, ID3D11DeviceContext* pd3d11DeviceConte
     UINT FontDataBytes = static_cast<UINT>( g_FontVertices.size() * sizeof( DXUTSpriteVertex ) );
     if( g_FontBufferBytes11 < FontDataBytes )
     {
+        // Grow geometrically so a longer line does not recreate the buffer every time
         SAFE_RELEASE( g_pFontBuffer11 );
-        g_FontBufferBytes11 = FontDataBytes;
+        g_FontBufferBytes11 = std::max<UINT>( std::max<UINT>( FontDataBytes, g_FontBufferBytes11 * 2 ), 16384 );
 
         D3D11_BUFFER_DESC BufferDesc;
         BufferDesc.ByteWidth = g_FontBufferBytes11;
@@ -375,26 +392,27 @@ void EndText11( ID3D11Device* pd3dDevice, ID3D11DeviceContext* pd3d11DeviceConte
     destRegion.bottom = 1;
     destRegion.front = 0;
     destRegion.back = 1;
+    CDXUTCountedContext ctx( pd3d11DeviceContext );
     D3D11_MAPPED_SUBRESOURCE MappedResource;
-    if ( S_OK == pd3d11DeviceContext->Map( g_pFontBuffer11, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource ) )
+    if ( S_OK == ctx.Map( g_pFontBuffer11, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource ) )
     { 
-        memcpy( MappedResource.pData, (void*)&g_FontVertices[0], FontDataBytes );
-        pd3d11DeviceContext->Unmap(g_pFontBuffer11, 0);
+        memcpy( MappedResource.pData, g_FontVertices.data(), FontDataBytes );
+        ctx.Unmap(g_pFontBuffer11, 0);
     }
 
     ID3D11ShaderResourceView* pOldTexture = nullptr;
-    pd3d11DeviceContext->PSGetShaderResources( 0, 1, &pOldTexture );
-    pd3d11DeviceContext->PSSetShaderResources( 0, 1, &g_pFont11 );
+    ctx.Get()->PSGetShaderResources( 0, 1, &pOldTexture );
+    ctx.PSSetShaderResources( 0, 1, &g_pFont11 );
 
     // Draw
     UINT Stride = sizeof( DXUTSpriteVertex );
     UINT Offset = 0;
-    pd3d11DeviceContext->IASetVertexBuffers( 0, 1, &g_pFontBuffer11, &Stride, &Offset );
-    pd3d11DeviceContext->IASetInputLayout( g_pInputLayout11 );
-    pd3d11DeviceContext->IASetPrimitiveTopology( D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST );
-    pd3d11DeviceContext->Draw( static_cast<UINT>( g_FontVertices.size() ), 0 );
+    ctx.IASetVertexBuffers( 0, 1, &g_pFontBuffer11, &Stride, &Offset );
+    ctx.IASetInputLayout( g_pInputLayout11 );
+    ctx.IASetPrimitiveTopology( D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST );
+    ctx.Draw( static_cast<UINT>( g_FontVertices.size() ), 0 );
 
-    pd3d11DeviceContext->PSSetShaderResources( 0, 1, &pOldTexture );
+    ctx.PSSetShaderResources( 0, 1, &pOldTexture );
     SAFE_RELEASE( pOldTexture );
 
     g_FontVertices.clear();
@@ -411,6 +429,7 @@ CDXUTDialog::CDXUTDialog() :
     m_width( 0 ),
     m_height( 0 ),
     m_pManager( nullptr ),
+    m_pd3dRenderContext( nullptr ),
     m_bVisible( true ),
     m_bCaption( false ),
     m_bMinimized( false ),
@@ -576,7 +595,8 @@ void CDXUTDialog::Refresh()
 
 
 //--------------------------------------------------------------------------------------
-HRESULT CDXUTDialog::OnRender( _In_ float fElapsedTime )
+_Use_decl_annotations_
+HRESULT CDXUTDialog::OnRender( float fElapsedTime, ID3D11DeviceContext* pd3dContext )
 {
     // If this assert triggers, you need to call CDXUTDialogResourceManager::On*Device() from inside
     // the application's device callbacks.  See the SDK samples for an example of how to do this.
@@ -595,11 +615,16 @@ HRESULT CDXUTDialog::OnRender( _In_ float fElapsedTime )
         ( m_bMinimized && !m_bCaption ) )
         return S_OK;
 
+    LARGE_INTEGER qpcStart;
+    QueryPerformanceCounter( &qpcStart );
+
     auto pd3dDevice = m_pManager->GetD3D11Device();
-    auto pd3dDeviceContext = m_pManager->GetD3D11DeviceContext();
+    auto pd3dDeviceContext = pd3dContext ? pd3dContext : m_pManager->GetD3D11DeviceContext();
+    m_pd3dRenderContext = pd3dDeviceContext;
 
     // Set up a state block here and restore it when finished drawing all the controls
     m_pManager->StoreD3D11State( pd3dDeviceContext );
+    CDXUTCountedContext ctx( pd3dDeviceContext );
 
     BOOL bBackgroundIsVisible = ( m_colorTopLeft | m_colorTopRight | m_colorBottomRight | m_colorBottomLeft ) & 0xff000000;
     if( !m_bMinimized && bBackgroundIsVisible )
@@ -621,27 +646,27 @@ HRESULT CDXUTDialog::OnRender( _In_ float fElapsedTime )
 
         //DXUT_SCREEN_VERTEX_10 *pVB;
         D3D11_MAPPED_SUBRESOURCE MappedData;
-        if( SUCCEEDED( pd3dDeviceContext->Map( m_pManager->m_pVBScreenQuad11, 0, D3D11_MAP_WRITE_DISCARD,
-                                               0, &MappedData ) ) )
+        if( SUCCEEDED( ctx.Map( m_pManager->m_pVBScreenQuad11, 0, D3D11_MAP_WRITE_DISCARD,
+                                0, &MappedData ) ) )
         {
             memcpy( MappedData.pData, vertices, sizeof( vertices ) );
-            pd3dDeviceContext->Unmap( m_pManager->m_pVBScreenQuad11, 0 );
+            ctx.Unmap( m_pManager->m_pVBScreenQuad11, 0 );
         }
 
         // Set the quad VB as current
         UINT stride = sizeof( DXUT_SCREEN_VERTEX_10 );
         UINT offset = 0;
-        pd3dDeviceContext->IASetVertexBuffers( 0, 1, &m_pManager->m_pVBScreenQuad11, &stride, &offset );
-        pd3dDeviceContext->IASetInputLayout( m_pManager->m_pInputLayout11 );
-        pd3dDeviceContext->IASetPrimitiveTopology( D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP );
+        ctx.IASetVertexBuffers( 0, 1, &m_pManager->m_pVBScreenQuad11, &stride, &offset );
+        ctx.IASetInputLayout( m_pManager->m_pInputLayout11 );
+        ctx.IASetPrimitiveTopology( D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP );
 
         // Setup for rendering
         m_pManager->ApplyRenderUIUntex11( pd3dDeviceContext );
-        pd3dDeviceContext->Draw( 4, 0 );
+        ctx.Draw( 4, 0 );
     }
 
     auto pTextureNode = GetTexture( 0 );
-    pd3dDeviceContext->PSSetShaderResources( 0, 1, &pTextureNode->pTexResView11 );
+    ctx.PSSetShaderResources( 0, 1, &pTextureNode->pTexResView11 );
 
     // Sort depth back to front
     m_pManager->BeginSprites11();
@@ -689,6 +714,11 @@ HRESULT CDXUTDialog::OnRender( _In_ float fElapsedTime )
         EndText11( pd3dDevice, pd3dDeviceContext );
     }
     m_pManager->RestoreD3D11State( pd3dDeviceContext );
+    m_pd3dRenderContext = nullptr;
+
+    LARGE_INTEGER qpcEnd;
+    QueryPerformanceCounter( &qpcEnd );
+    DXUTAddFrameGUITime( qpcEnd.QuadPart - qpcStart.QuadPart );
 
     return S_OK;
 }
@@ -1687,7 +1717,8 @@ HRESULT CDXUTDialog::DrawSprite( CDXUTElement* pElement, const RECT* prcDest, fl
 
     // Why are we drawing the sprite every time?  This is very inefficient, but the sprite workaround doesn't have support for sorting now, so we have to
     // draw a sprite every time to keep the order correct between sprites and text.
-    m_pManager->EndSprites11( DXUTGetD3D11Device(), DXUTGetD3D11DeviceContext() );
+    m_pManager->EndSprites11( m_pManager->GetD3D11Device(),
+                              m_pd3dRenderContext ? m_pd3dRenderContext : m_pManager->GetD3D11DeviceContext() );
 
     return S_OK;
 }
@@ -1713,6 +1744,15 @@ HRESULT CDXUTDialog::CalcTextRect( LPCWSTR strText, CDXUTElement* pElement, cons
 //--------------------------------------------------------------------------------------
 _Use_decl_annotations_
 HRESULT CDXUTDialog::DrawText( LPCWSTR strText, CDXUTElement* pElement, const RECT* prcDest, bool bShadow, bool bCenter   )
+{
+    return DrawText( strText, (int)wcslen( strText ), nullptr, 0, pElement, prcDest, bShadow, bCenter );
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTDialog::DrawText( LPCWSTR strFirst, int nFirst, LPCWSTR strSecond, int nSecond, CDXUTElement* pElement,
+                               const RECT* prcDest, bool bShadow, bool bCenter )
 {
     // No need to draw fully transparent layers
     if( pElement->FontColor.Current.w == 0 )
@@ -1729,7 +1769,7 @@ HRESULT CDXUTDialog::DrawText( LPCWSTR strText, CDXUTElement* pElement, const RE
     float fBBHeight = ( float )m_pManager->m_nBackBufferHeight;
 
     auto pd3dDevice = m_pManager->GetD3D11Device();
-    auto pd3d11DeviceContext =  m_pManager->GetD3D11DeviceContext();
+    auto pd3d11DeviceContext = m_pd3dRenderContext ? m_pd3dRenderContext : m_pManager->GetD3D11DeviceContext();
 
     if( bShadow )
     {
@@ -1738,14 +1778,14 @@ HRESULT CDXUTDialog::DrawText( LPCWSTR strText, CDXUTElement* pElement, const RE
 
         XMFLOAT4 vShadowColor( 0,0,0, 1.0f );
         DrawText11DXUT( pd3dDevice, pd3d11DeviceContext,
-                 strText, rcShadow, vShadowColor,
+                 strFirst, nFirst, strSecond, nSecond, rcShadow, vShadowColor,
                  fBBWidth, fBBHeight, bCenter );
 
     }
 
     XMFLOAT4 vFontColor( pElement->FontColor.Current.x, pElement->FontColor.Current.y, pElement->FontColor.Current.z, 1.0f );
     DrawText11DXUT( pd3dDevice, pd3d11DeviceContext,
-             strText, rcScreen, vFontColor,
+             strFirst, nFirst, strSecond, nSecond, rcScreen, vFontColor,
              fBBWidth, fBBHeight, bCenter );
 
     return S_OK;
@@ -2257,7 +2297,8 @@ CDXUTDialogResourceManager::CDXUTDialogResourceManager() :
     m_pInputLayout11(nullptr),
     m_pVBScreenQuad11(nullptr),
     m_pSpriteBuffer11(nullptr),
-    m_SpriteBufferBytes11(0)
+    m_SpriteBufferBytes11(0),
+    m_SpriteVertices( DXUTGetFrameArena() )
 {
 }
 
@@ -2506,38 +2547,42 @@ void CDXUTDialogResourceManager::RestoreD3D11State( _In_ ID3D11DeviceContext* pd
 //--------------------------------------------------------------------------------------
 void CDXUTDialogResourceManager::ApplyRenderUI11( _In_ ID3D11DeviceContext* pd3dImmediateContext )
 {
+    CDXUTCountedContext ctx( pd3dImmediateContext );
+
     // Shaders
-    pd3dImmediateContext->VSSetShader( m_pVSRenderUI11, nullptr, 0 );
-    pd3dImmediateContext->HSSetShader( nullptr, nullptr, 0 );
-    pd3dImmediateContext->DSSetShader( nullptr, nullptr, 0 );
-    pd3dImmediateContext->GSSetShader( nullptr, nullptr, 0 );
-    pd3dImmediateContext->PSSetShader( m_pPSRenderUI11, nullptr, 0 );
+    ctx.VSSetShader( m_pVSRenderUI11, nullptr, 0 );
+    ctx.HSSetShader( nullptr, nullptr, 0 );
+    ctx.DSSetShader( nullptr, nullptr, 0 );
+    ctx.GSSetShader( nullptr, nullptr, 0 );
+    ctx.PSSetShader( m_pPSRenderUI11, nullptr, 0 );
 
     // States
-    pd3dImmediateContext->OMSetDepthStencilState( m_pDepthStencilStateUI11, 0 );
-    pd3dImmediateContext->RSSetState( m_pRasterizerStateUI11 );
+    ctx.OMSetDepthStencilState( m_pDepthStencilStateUI11, 0 );
+    ctx.RSSetState( m_pRasterizerStateUI11 );
     float BlendFactor[4] = { 0, 0, 0, 0 };
-    pd3dImmediateContext->OMSetBlendState( m_pBlendStateUI11, BlendFactor, 0xFFFFFFFF );
-    pd3dImmediateContext->PSSetSamplers( 0, 1, &m_pSamplerStateUI11 );
+    ctx.OMSetBlendState( m_pBlendStateUI11, BlendFactor, 0xFFFFFFFF );
+    ctx.PSSetSamplers( 0, 1, &m_pSamplerStateUI11 );
 }
 
 
 //--------------------------------------------------------------------------------------
 void CDXUTDialogResourceManager::ApplyRenderUIUntex11( _In_ ID3D11DeviceContext* pd3dImmediateContext )
 {
+    CDXUTCountedContext ctx( pd3dImmediateContext );
+
     // Shaders
-    pd3dImmediateContext->VSSetShader( m_pVSRenderUI11, nullptr, 0 );
-    pd3dImmediateContext->HSSetShader( nullptr, nullptr, 0 );
-    pd3dImmediateContext->DSSetShader( nullptr, nullptr, 0 );
-    pd3dImmediateContext->GSSetShader( nullptr, nullptr, 0 );
-    pd3dImmediateContext->PSSetShader( m_pPSRenderUIUntex11, nullptr, 0 );
+    ctx.VSSetShader( m_pVSRenderUI11, nullptr, 0 );
+    ctx.HSSetShader( nullptr, nullptr, 0 );
+    ctx.DSSetShader( nullptr, nullptr, 0 );
+    ctx.GSSetShader( nullptr, nullptr, 0 );
+    ctx.PSSetShader( m_pPSRenderUIUntex11, nullptr, 0 );
 
     // States
-    pd3dImmediateContext->OMSetDepthStencilState( m_pDepthStencilStateUI11, 0 );
-    pd3dImmediateContext->RSSetState( m_pRasterizerStateUI11 );
+    ctx.OMSetDepthStencilState( m_pDepthStencilStateUI11, 0 );
+    ctx.RSSetState( m_pRasterizerStateUI11 );
     float BlendFactor[4] = { 0, 0, 0, 0 };
-    pd3dImmediateContext->OMSetBlendState( m_pBlendStateUI11, BlendFactor, 0xFFFFFFFF );
-    pd3dImmediateContext->PSSetSamplers( 0, 1, &m_pSamplerStateUI11 );
+    ctx.OMSetBlendState( m_pBlendStateUI11, BlendFactor, 0xFFFFFFFF );
+    ctx.PSSetSamplers( 0, 1, &m_pSamplerStateUI11 );
 }
 
 
@@ -2552,13 +2597,16 @@ void CDXUTDialogResourceManager::BeginSprites11( )
 _Use_decl_annotations_
 void CDXUTDialogResourceManager::EndSprites11( ID3D11Device* pd3dDevice, ID3D11DeviceContext* pd3dImmediateContext )
 {
+    if( m_SpriteVertices.empty() )
+        return;
 
     // ensure our buffer size can hold our sprites
     UINT SpriteDataBytes = static_cast<UINT>( m_SpriteVertices.size() * sizeof( DXUTSpriteVertex ) );
     if( m_SpriteBufferBytes11 < SpriteDataBytes )
     {
+        // Grow geometrically so a busier dialog does not recreate the buffer every frame
         SAFE_RELEASE( m_pSpriteBuffer11 );
-        m_SpriteBufferBytes11 = SpriteDataBytes;
+        m_SpriteBufferBytes11 = std::max<UINT>( std::max<UINT>( SpriteDataBytes, m_SpriteBufferBytes11 * 2 ), 16384 );
 
         D3D11_BUFFER_DESC BufferDesc;
         BufferDesc.ByteWidth = m_SpriteBufferBytes11;
@@ -2584,20 +2632,21 @@ void CDXUTDialogResourceManager::EndSprites11( ID3D11Device* pd3dDevice, ID3D11D
     destRegion.bottom = 1;
     destRegion.front = 0;
     destRegion.back = 1;
+    CDXUTCountedContext ctx( pd3dImmediateContext );
     D3D11_MAPPED_SUBRESOURCE MappedResource;
-    if ( S_OK == pd3dImmediateContext->Map( m_pSpriteBuffer11, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource ) )
+    if ( S_OK == ctx.Map( m_pSpriteBuffer11, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource ) )
     { 
-        memcpy( MappedResource.pData, (const void*)&m_SpriteVertices[0], SpriteDataBytes );
-        pd3dImmediateContext->Unmap(m_pSpriteBuffer11, 0);
+        memcpy( MappedResource.pData, m_SpriteVertices.data(), SpriteDataBytes );
+        ctx.Unmap(m_pSpriteBuffer11, 0);
     }
 
     // Draw
     UINT Stride = sizeof( DXUTSpriteVertex );
     UINT Offset = 0;
-    pd3dImmediateContext->IASetVertexBuffers( 0, 1, &m_pSpriteBuffer11, &Stride, &Offset );
-    pd3dImmediateContext->IASetInputLayout( m_pInputLayout11 );
-    pd3dImmediateContext->IASetPrimitiveTopology( D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST );
-    pd3dImmediateContext->Draw( static_cast<UINT>( m_SpriteVertices.size() ), 0 );
+    ctx.IASetVertexBuffers( 0, 1, &m_pSpriteBuffer11, &Stride, &Offset );
+    ctx.IASetInputLayout( m_pInputLayout11 );
+    ctx.IASetPrimitiveTopology( D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST );
+    ctx.Draw( static_cast<UINT>( m_SpriteVertices.size() ), 0 );
 
     m_SpriteVertices.clear();
 }
@@ -5592,8 +5641,7 @@ void CDXUTEditBox::DeleteSelectionText()
     PlaceCaret( nFirst );
     m_nSelStart = m_nCaret;
     // Remove the characters
-    for( int i = nFirst; i < nLast; ++i )
-        m_Buffer.RemoveChar( nFirst );
+    m_Buffer.RemoveString( nFirst, nLast - nFirst );
 }
 
 
@@ -6007,7 +6055,7 @@ bool CDXUTEditBox::MsgProc( UINT uMsg, WPARAM wParam, LPARAM lParam )
                     // Otherwise, we insert the char as normal.
                     if( !m_bInsertMode && m_nCaret < m_Buffer.GetTextSize() )
                     {
-                        m_Buffer[m_nCaret] = ( WCHAR )wParam;
+                        m_Buffer.ReplaceChar( m_nCaret, ( WCHAR )wParam );
                         PlaceCaret( m_nCaret + 1 );
                         m_nSelStart = m_nCaret;
                     }
@@ -6096,15 +6144,20 @@ void CDXUTEditBox::Render( _In_ float fElapsedTime )
     //
     // Element 0 for text
     m_Elements[ 0 ]->FontColor.SetCurrent( m_TextColor );
-    m_pDialog->DrawText( m_Buffer.GetBuffer() + m_nFirstVisible, m_Elements[ 0 ], &m_rcText );
+    // The text is drawn straight from either side of the buffer's gap, which stays at the caret
+    const WCHAR* pFirst;
+    const WCHAR* pSecond;
+    int nFirst, nSecond;
+    m_Buffer.GetSpans( m_nFirstVisible, &pFirst, &nFirst, &pSecond, &nSecond );
+    m_pDialog->DrawText( pFirst, nFirst, pSecond, nSecond, m_Elements[ 0 ], &m_rcText );
 
     // Render the selected text
     if( m_nCaret != m_nSelStart )
     {
         int nFirstToRender = std::max( m_nFirstVisible, std::min( m_nSelStart, m_nCaret ) );
         m_Elements[ 0 ]->FontColor.SetCurrent( m_SelTextColor );
-        m_pDialog->DrawText( m_Buffer.GetBuffer() + nFirstToRender,
-                             m_Elements[ 0 ], &rcSelection, false );
+        m_Buffer.GetSpans( nFirstToRender, &pFirst, &nFirst, &pSecond, &nSecond );
+        m_pDialog->DrawText( pFirst, nFirst, pSecond, nSecond, m_Elements[ 0 ], &rcSelection, false );
     }
 
     //
@@ -6218,46 +6271,125 @@ void CDXUTEditBox::ResetCaretBlink()
 // CUniBuffer
 //======================================================================================
 
+namespace
+{
+
+// Lines are analysed separately, ending after these
+inline bool IsUniLineBreak( _In_ WCHAR wch )
+{
+    return wch == L'\n' || wch == 0x2029;
+}
+
+bool ContainsUniLineBreak( _In_reads_(nCount) const WCHAR* pStr, _In_ int nCount )
+{
+    for( int i = 0; i < nCount; ++i )
+    {
+        if( IsUniLineBreak( pStr[i] ) )
+            return true;
+    }
+    return false;
+}
+
+bool ContainsUniLineBreak( _In_ const CDXUTGapBuffer& text, _In_ int nIndex, _In_ int nCount )
+{
+    for( int i = nIndex; i < nIndex + nCount; ++i )
+    {
+        if( IsUniLineBreak( text[i] ) )
+            return true;
+    }
+    return false;
+}
+
+};
+
+
 //--------------------------------------------------------------------------------------
-bool CUniBuffer::SetBufferSize( _In_ int nNewSize )
+void CUniBuffer::FreeRuns()
 {
-    // If the current size is already the maximum allowed,
-    // we can't possibly allocate more.
-    if( m_nBufferSize >= DXUT_MAX_EDITBOXLENGTH )
-        return false;
+    for( auto it = m_Runs.begin(); it != m_Runs.end(); ++it )
+    {
+        if( it->Analysis )
+            (void)ScriptStringFree( &it->Analysis );
+    }
+    m_Runs.clear();
+}
 
-    int nAllocateSize = ( nNewSize == -1 || nNewSize < m_nBufferSize * 2 ) ? ( m_nBufferSize ? m_nBufferSize *
-                                                                               2 : 256 ) : nNewSize * 2;
 
-    // Cap the buffer size at the maximum allowed.
-    if( nAllocateSize > DXUT_MAX_EDITBOXLENGTH )
-        nAllocateSize = DXUT_MAX_EDITBOXLENGTH;
+//--------------------------------------------------------------------------------------
+// Returns the run holding nCP, where the nul after the text belongs to the last run
+//--------------------------------------------------------------------------------------
+size_t CUniBuffer::FindRun( _In_ int nCP ) const
+{
+    size_t nLow = 0;
+    size_t nHigh = m_Runs.size();
+    while( nHigh - nLow > 1 )
+    {
+        size_t nMid = ( nLow + nHigh ) / 2;
+        if( m_Runs[ nMid ].nStart <= nCP )
+            nLow = nMid;
+        else
+            nHigh = nMid;
+    }
+    return nLow;
+}
 
-    auto pTempBuffer = new (std::nothrow) WCHAR[nAllocateSize];
-    if( !pTempBuffer )
-        return false;
 
-    ZeroMemory( pTempBuffer, sizeof( WCHAR ) * nAllocateSize );
+//--------------------------------------------------------------------------------------
+// The analysis must be up to date
+//--------------------------------------------------------------------------------------
+const SCRIPT_LOGATTR* CUniBuffer::GetLogAttr( _In_ int nCP ) const
+{
+    const Run& run = m_Runs[ FindRun( nCP ) ];
+
+    const SCRIPT_LOGATTR* pLogAttr = ScriptString_pLogAttr( run.Analysis );
+    const int* pcOutChars = ScriptString_pcOutChars( run.Analysis );
+    if( !pLogAttr || !pcOutChars || nCP - run.nStart < 0 || nCP - run.nStart >= *pcOutChars )
+        return nullptr;
+
+    return pLogAttr + ( nCP - run.nStart );
+}
 
-    if( m_pwszBuffer )
+
+//--------------------------------------------------------------------------------------
+// Records an edit of the text at nIndex.  Only the run it falls in needs shaping again,
+// unless a line break came or went and the text has to be split into runs again.
+//--------------------------------------------------------------------------------------
+void CUniBuffer::InvalidateRuns( _In_ int nIndex, _In_ int nRemoved, _In_ int nInserted, _In_ bool bLineBreak )
+{
+    if( m_bAnalyseRequired )
+        return;
+
+    if( bLineBreak || m_Runs.empty() )
     {
-        memcpy( pTempBuffer, m_pwszBuffer, m_nBufferSize * sizeof( WCHAR ) );
-        delete[] m_pwszBuffer;
+        m_bAnalyseRequired = true;
+        return;
     }
 
-    m_pwszBuffer = pTempBuffer;
-    m_nBufferSize = nAllocateSize;
-    return true;
+    size_t iRun = FindRun( nIndex );
+    Run& run = m_Runs[ iRun ];
+    if( run.Analysis )
+        (void)ScriptStringFree( &run.Analysis );
+
+    int nDelta = nInserted - nRemoved;
+    run.nLength += nDelta;
+    for( size_t i = iRun + 1; i < m_Runs.size(); ++i )
+        m_Runs[ i ].nStart += nDelta;
 }
 
 
 //--------------------------------------------------------------------------------------
-// Uniscribe -- Analyse() analyses the string in the buffer
+// Uniscribe -- Analyse() analyses the lines that changed since the last call
 //--------------------------------------------------------------------------------------
 HRESULT CUniBuffer::Analyse()
 {
-    if( m_Analysis )
-        (void)ScriptStringFree( &m_Analysis );
+    if( !m_bAnalyseRequired )
+    {
+        auto it = m_Runs.cbegin();
+        while( it != m_Runs.cend() && it->Analysis )
+            ++it;
+        if( it == m_Runs.cend() )
+            return S_OK;  // Analysis is up-to-date
+    }
 
     SCRIPT_CONTROL ScriptControl; // For uniscribe
     SCRIPT_STATE ScriptState;   // For uniscribe
@@ -6271,36 +6403,75 @@ HRESULT CUniBuffer::Analyse()
         return hr;
 #pragma warning(pop)
 
-    if( !m_pFontNode )
+    if( !m_pFontNode || !m_Text.GetBufferSize() )
         return E_FAIL;
 
+    const int nTextSize = m_Text.GetTextSize();
+
+    if( m_bAnalyseRequired )
+    {
+        FreeRuns();
+
+        Run run;
+        run.nStart = 0;
+        run.nWidth = 0;
+        run.Analysis = nullptr;
+        for( int i = 0; i < nTextSize; ++i )
+        {
+            if( IsUniLineBreak( m_Text[i] ) )
+            {
+                run.nLength = i + 1 - run.nStart;
+                m_Runs.push_back( run );
+                run.nStart = i + 1;
+            }
+        }
+
+        // nul is also analyzed.
+        run.nLength = nTextSize + 1 - run.nStart;
+        m_Runs.push_back( run );
+
+        m_bAnalyseRequired = false;
+    }
+
     HDC hDC = nullptr;
-    hr = ScriptStringAnalyse( hDC,
-                                m_pwszBuffer,
-                                (int)wcslen( m_pwszBuffer ) + 1,  // nul is also analyzed.
-                                (int)wcslen( m_pwszBuffer ) * 3 / 2 + 16,
-                                -1,
-                                SSA_BREAK | SSA_GLYPHS | SSA_FALLBACK | SSA_LINK,
-                                0,
-                                &ScriptControl,
-                                &ScriptState,
-                                nullptr,
-                                nullptr,
-                                nullptr,
-                                &m_Analysis );
-    if( SUCCEEDED( hr ) )
-        m_bAnalyseRequired = false;  // Analysis is up-to-date
-    return hr;
+    for( auto it = m_Runs.begin(); it != m_Runs.end(); ++it )
+    {
+        if( it->Analysis )
+            continue;
+
+        // Only a run the gap falls inside moves anything, and then only its own characters
+        hr = ScriptStringAnalyse( hDC,
+                                  m_Text.GetContiguous( it->nStart, it->nLength ),
+                                  it->nLength,
+                                  it->nLength * 3 / 2 + 16,
+                                  -1,
+                                  SSA_BREAK | SSA_GLYPHS | SSA_FALLBACK | SSA_LINK,
+                                  0,
+                                  &ScriptControl,
+                                  &ScriptState,
+                                  nullptr,
+                                  nullptr,
+                                  nullptr,
+                                  &it->Analysis );
+        if( FAILED( hr ) )
+        {
+            it->Analysis = nullptr;
+            return hr;
+        }
+
+        const SIZE* pSize = ScriptString_pSize( it->Analysis );
+        it->nWidth = pSize ? pSize->cx : 0;
+    }
+
+    return S_OK;
 }
 
 
 //--------------------------------------------------------------------------------------
-CUniBuffer::CUniBuffer( _In_ int nInitialSize )
+CUniBuffer::CUniBuffer( _In_ int nInitialSize ) :
+    m_Text( DXUT_MAX_EDITBOXLENGTH )
 {
-    m_nBufferSize = 0;
-    m_pwszBuffer = nullptr;
     m_bAnalyseRequired = true;
-    m_Analysis = nullptr;
     m_pFontNode = nullptr;
 
     if( nInitialSize > 0 )
@@ -6311,9 +6482,7 @@ CUniBuffer::CUniBuffer( _In_ int nInitialSize )
 //--------------------------------------------------------------------------------------
 CUniBuffer::~CUniBuffer()
 {
-    delete[] m_pwszBuffer;
-    if( m_Analysis )
-        (void)ScriptStringFree( &m_Analysis );
+    FreeRuns();
 }
 
 
@@ -6322,16 +6491,17 @@ WCHAR& CUniBuffer::operator[]( _In_ int n )  // No param checking
 {
     // This version of operator[] is called only
     // if we are asking for write access, so
-    // re-analysis is required.
+    // re-analysis is required.  The new character is
+    // not known here, so every line is split again.
     m_bAnalyseRequired = true;
-    return m_pwszBuffer[n];
+    return m_Text.At( n );
 }
 
 
 //--------------------------------------------------------------------------------------
 void CUniBuffer::Clear()
 {
-    *m_pwszBuffer = L'\0';
+    m_Text.Clear();
     m_bAnalyseRequired = true;
 }
 
@@ -6344,51 +6514,47 @@ bool CUniBuffer::InsertChar( _In_ int nIndex, _In_ WCHAR wChar )
 {
     assert( nIndex >= 0 );
 
-    if( nIndex < 0 || nIndex > (int)wcslen( m_pwszBuffer ) )
-        return false;  // invalid index
-
-    // Check for maximum length allowed
-    if( GetTextSize() + 1 >= DXUT_MAX_EDITBOXLENGTH )
-        return false;
+    return InsertString( nIndex, &wChar, 1 );
+}
 
-    if( (int)wcslen( m_pwszBuffer ) + 1 >= m_nBufferSize )
-    {
-        if( !SetBufferSize( -1 ) )
-            return false;  // out of memory
-    }
 
-    assert( m_nBufferSize >= 2 );
+//--------------------------------------------------------------------------------------
+// Removes the char at specified index.
+// If nIndex == -1, remove the last char.
+//--------------------------------------------------------------------------------------
+bool CUniBuffer::RemoveChar( _In_ int nIndex )
+{
+    return RemoveString( nIndex, 1 );
+}
 
-    // Shift the characters after the index, start by copying the null terminator
-    WCHAR* dest = m_pwszBuffer + wcslen( m_pwszBuffer ) + 1;
-    WCHAR* stop = m_pwszBuffer + nIndex;
-    WCHAR* src = dest - 1;
 
-    while( dest > stop )
-    {
-        *dest-- = *src--;
-    }
+//--------------------------------------------------------------------------------------
+// Removes nCount characters starting at the specified index.
+//--------------------------------------------------------------------------------------
+bool CUniBuffer::RemoveString( _In_ int nIndex, _In_ int nCount )
+{
+    if( !m_Text.GetTextSize() || nIndex < 0 || nCount <= 0 || nIndex + nCount > m_Text.GetTextSize() )
+        return false;  // Invalid index
 
-    // Set new character
-    m_pwszBuffer[ nIndex ] = wChar;
-    m_bAnalyseRequired = true;
+    bool bLineBreak = ContainsUniLineBreak( m_Text, nIndex, nCount );
+    m_Text.RemoveString( nIndex, nCount );
 
+    InvalidateRuns( nIndex, nCount, 0, bLineBreak );
     return true;
 }
 
 
 //--------------------------------------------------------------------------------------
-// Removes the char at specified index.
-// If nIndex == -1, remove the last char.
-//--------------------------------------------------------------------------------------
-bool CUniBuffer::RemoveChar( _In_ int nIndex )
+bool CUniBuffer::ReplaceChar( _In_ int nIndex, _In_ WCHAR wChar )
 {
-    if( !wcslen( m_pwszBuffer ) || nIndex < 0 || nIndex >= (int)wcslen( m_pwszBuffer ) )
+    if( nIndex < 0 || nIndex >= m_Text.GetTextSize() )
         return false;  // Invalid index
 
-    MoveMemory( m_pwszBuffer + nIndex, m_pwszBuffer + nIndex + 1, sizeof( WCHAR ) *
-                ( wcslen( m_pwszBuffer ) - nIndex ) );
-    m_bAnalyseRequired = true;
+    WCHAR& wch = m_Text.At( nIndex );
+    bool bLineBreak = IsUniLineBreak( wch ) || IsUniLineBreak( wChar );
+    wch = wChar;
+
+    InvalidateRuns( nIndex, 1, 1, bLineBreak );
     return true;
 }
 
@@ -6405,27 +6571,14 @@ bool CUniBuffer::InsertString( int nIndex, const WCHAR* pStr, int nCount )
     if( nIndex < 0 )
         return false;
 
-    if( nIndex > (int)wcslen( m_pwszBuffer ) )
-        return false;  // invalid index
-
     if( -1 == nCount )
         nCount = (int)wcslen( pStr );
 
-    // Check for maximum length allowed
-    if( GetTextSize() + nCount >= DXUT_MAX_EDITBOXLENGTH )
+    // Fails for an invalid index, past the maximum length, or out of memory
+    if( !m_Text.InsertString( nIndex, pStr, nCount ) )
         return false;
 
-    if( (int)wcslen( m_pwszBuffer ) + nCount >= m_nBufferSize )
-    {
-        if( !SetBufferSize( (int)wcslen( m_pwszBuffer ) + nCount + 1 ) )
-            return false;  // out of memory
-    }
-
-    MoveMemory( m_pwszBuffer + nIndex + nCount, m_pwszBuffer + nIndex, sizeof( WCHAR ) *
-                ( wcslen( m_pwszBuffer ) - nIndex + 1 ) );
-    memcpy( m_pwszBuffer + nIndex, pStr, nCount * sizeof( WCHAR ) );
-    m_bAnalyseRequired = true;
-
+    InvalidateRuns( nIndex, 0, nCount, ContainsUniLineBreak( pStr, nCount ) );
     return true;
 }
 
@@ -6435,24 +6588,11 @@ bool CUniBuffer::SetText( _In_z_ LPCWSTR wszText )
 {
     assert( wszText );
 
-    size_t nRequired = wcslen( wszText ) + 1;
-
-    // Check for maximum length allowed
-    if( nRequired >= DXUT_MAX_EDITBOXLENGTH )
+    if( !m_Text.SetText( wszText ) )
         return false;
 
-    while( GetBufferSize() < nRequired )
-        if( !SetBufferSize( -1 ) )
-            break;
-    // Check again in case out of memory occurred inside while loop.
-    if( GetBufferSize() >= nRequired )
-    {
-        wcscpy_s( m_pwszBuffer, GetBufferSize(), wszText );
-        m_bAnalyseRequired = true;
-        return true;
-    }
-    else
-        return false;
+    m_bAnalyseRequired = true;
+    return true;
 }
 
 
@@ -6463,12 +6603,19 @@ bool CUniBuffer::CPtoX( int nCP, bool bTrail, int* pX )
     assert( pX );
     *pX = 0;  // Default
 
-    HRESULT hr = S_OK;
-    if( m_bAnalyseRequired )
-        hr = Analyse();
+    HRESULT hr = Analyse();
 
     if( SUCCEEDED( hr ) )
-        hr = ScriptStringCPtoX( m_Analysis, nCP, bTrail, pX );
+    {
+        // Lines are laid out one after another
+        size_t iRun = FindRun( nCP );
+        int nX = 0;
+        for( size_t i = 0; i < iRun; ++i )
+            nX += m_Runs[ i ].nWidth;
+
+        hr = ScriptStringCPtoX( m_Runs[ iRun ].Analysis, nCP - m_Runs[ iRun ].nStart, bTrail, pX );
+        *pX += nX;
+    }
 
     if ( FAILED(hr) )
     {
@@ -6487,18 +6634,22 @@ bool CUniBuffer::XtoCP( int nX, int* pCP, int* pnTrail )
     assert( pCP && pnTrail );
     *pCP = 0; *pnTrail = FALSE;  // Default
 
-    HRESULT hr = S_OK;
-    if( m_bAnalyseRequired )
-        hr = Analyse();
+    HRESULT hr = Analyse();
 
     if (SUCCEEDED(hr))
     {
-        hr = ScriptStringXtoCP( m_Analysis, nX, pCP, pnTrail );
+        size_t iRun = 0;
+        int nRunX = 0;
+        while( iRun + 1 < m_Runs.size() && nX >= nRunX + m_Runs[ iRun ].nWidth )
+            nRunX += m_Runs[ iRun++ ].nWidth;
+
+        hr = ScriptStringXtoCP( m_Runs[ iRun ].Analysis, nX - nRunX, pCP, pnTrail );
         if (FAILED(hr))
         {
             *pCP = 0; *pnTrail = FALSE;
             return false;
         }
+        *pCP += m_Runs[ iRun ].nStart;
     }
 
     // If the coordinate falls outside the text region, we
@@ -6508,9 +6659,9 @@ bool CUniBuffer::XtoCP( int nX, int* pCP, int* pnTrail )
     {
         *pCP = 0; *pnTrail = FALSE;
     }
-    else if( *pCP > (int)wcslen( m_pwszBuffer ) && *pnTrail == FALSE )
+    else if( *pCP > m_Text.GetTextSize() && *pnTrail == FALSE )
     {
-        *pCP = (int)wcslen( m_pwszBuffer ); *pnTrail = TRUE;
+        *pCP = m_Text.GetTextSize(); *pnTrail = TRUE;
     }
 
     if (FAILED(hr))
@@ -6528,27 +6679,27 @@ void CUniBuffer::GetPriorItemPos( int nCP, int* pPrior )
 {
     *pPrior = nCP;  // Default is the char itself
 
-    if( m_bAnalyseRequired )
-        if( FAILED( Analyse() ) )
-            return;
-
-    const SCRIPT_LOGATTR* pLogAttr = ScriptString_pLogAttr( m_Analysis );
-    if( !pLogAttr )
+    if( FAILED( Analyse() ) )
         return;
 
-    if( !ScriptString_pcOutChars( m_Analysis ) )
-        return;
-    int nInitial = *ScriptString_pcOutChars( m_Analysis );
+    int nInitial = m_Text.GetTextSize() + 1;
     if( nCP - 1 < nInitial )
         nInitial = nCP - 1;
     for( int i = nInitial; i > 0; --i )
-        if( pLogAttr[i].fWordStop ||       // Either the fWordStop flag is set
-            ( !pLogAttr[i].fWhiteSpace &&  // Or the previous char is whitespace but this isn't.
-              pLogAttr[i - 1].fWhiteSpace ) )
+    {
+        const SCRIPT_LOGATTR* pLogAttr = GetLogAttr( i );
+        const SCRIPT_LOGATTR* pPrevLogAttr = GetLogAttr( i - 1 );
+        if( !pLogAttr || !pPrevLogAttr )
+            return;
+
+        if( pLogAttr->fWordStop ||       // Either the fWordStop flag is set
+            ( !pLogAttr->fWhiteSpace &&  // Or the previous char is whitespace but this isn't.
+              pPrevLogAttr->fWhiteSpace ) )
         {
             *pPrior = i;
             return;
         }
+    }
     // We have reached index 0.  0 is always a break point, so simply return it.
     *pPrior = 0;
 }
@@ -6560,43 +6711,38 @@ void CUniBuffer::GetNextItemPos( int nCP, int* pPrior )
 {
     *pPrior = nCP;  // Default is the char itself
 
-    HRESULT hr = S_OK;
-    if( m_bAnalyseRequired )
-        hr = Analyse();
-    if( FAILED( hr ) )
-        return;
-
-    const SCRIPT_LOGATTR* pLogAttr = ScriptString_pLogAttr( m_Analysis );
-    if( !pLogAttr )
+    if( FAILED( Analyse() ) )
         return;
 
-    if( !ScriptString_pcOutChars( m_Analysis ) )
-        return;
-    int nInitial = *ScriptString_pcOutChars( m_Analysis );
-    if( nCP + 1 < nInitial )
-        nInitial = nCP + 1;
+    // Every run is analysed, so the characters out are the text and its nul
+    int limit = m_Text.GetTextSize() + 1;
+    int i = nCP + 1;
+    if( i > limit )
+        i = limit;
 
-    int i = nInitial;
-    int limit = *ScriptString_pcOutChars( m_Analysis );
-    while( limit > 0 && i < limit - 1 )
+    while( i < limit - 1 )
     {
-        if( pLogAttr[i].fWordStop )      // Either the fWordStop flag is set
+        const SCRIPT_LOGATTR* pLogAttr = GetLogAttr( i );
+        const SCRIPT_LOGATTR* pNextLogAttr = GetLogAttr( i + 1 );
+        if( !pLogAttr || !pNextLogAttr )
+            return;
+
+        if( pLogAttr->fWordStop )      // Either the fWordStop flag is set
         {
             *pPrior = i;
             return;
         }
-        else if( pLogAttr[i].fWhiteSpace &&  // Or this whitespace but the next char isn't.
-                 !pLogAttr[i + 1].fWhiteSpace )
+        else if( pLogAttr->fWhiteSpace &&  // Or this whitespace but the next char isn't.
+                 !pNextLogAttr->fWhiteSpace )
         {
             *pPrior = i + 1;  // The next char is a word stop
             return;
         }
 
         ++i;
-        limit = *ScriptString_pcOutChars( m_Analysis );
     }
     // We have reached the end. It's always a word stop, so simply return it.
-    *pPrior = *ScriptString_pcOutChars( m_Analysis ) - 1;
+    *pPrior = limit - 1;
 }
 
 
@@ -15,6 +15,8 @@
 #include <usp10.h>
 #include <dimm.h>
 
+#include "DXUTGapBuffer.h"
+
 #ifdef DXUT_AUTOLIB
 #pragma comment( lib, "usp10.lib" )
 #endif
@@ -228,6 +230,8 @@ public:
     HRESULT CalcTextRect( _In_z_ LPCWSTR strText, _In_ CDXUTElement* pElement, _In_ const RECT* prcDest, _In_ int nCount = -1 );
     HRESULT DrawText( _In_z_ LPCWSTR strText, _In_ CDXUTElement* pElement, _In_ const RECT* prcDest, _In_ bool bShadow = false,
                       _In_ bool bCenter = false  );
+    HRESULT DrawText( _In_reads_(nFirst) LPCWSTR strFirst, _In_ int nFirst, _In_reads_opt_(nSecond) LPCWSTR strSecond, _In_ int nSecond,
+                      _In_ CDXUTElement* pElement, _In_ const RECT* prcDest, _In_ bool bShadow = false, _In_ bool bCenter = false );
 
     // Attributes
     bool GetVisible() const { return m_bVisible; }
@@ -275,7 +279,11 @@ public:
 
     // Device state notification
     void Refresh();
-    HRESULT OnRender( _In_ float fElapsedTime );
+
+    // Records on pd3dContext, such as a CDXUTPassScheduler pass's deferred context, or on
+    // the resource manager's immediate context when it is null.  The sprite and text
+    // batches are shared, so only one pass at a time may render dialogs or text.
+    HRESULT OnRender( _In_ float fElapsedTime, _In_opt_ ID3D11DeviceContext* pd3dContext = nullptr );
 
     // Shared resource access. Indexed fonts and textures are shared among
     // all the controls.
@@ -336,6 +344,7 @@ private:
     DWORD m_colorBottomRight;
 
     CDXUTDialogResourceManager* m_pManager;
+    ID3D11DeviceContext* m_pd3dRenderContext;      // Set for the duration of OnRender
     PCALLBACKDXUTGUIEVENT m_pCallbackEvent;
     void* m_pCallbackEventUserContext;
 
@@ -448,7 +457,7 @@ public:
     // Sprite workaround
     ID3D11Buffer* m_pSpriteBuffer11;
     UINT m_SpriteBufferBytes11;
-    std::vector<DXUTSpriteVertex> m_SpriteVertices;
+    CDXUTFrameArray<DXUTSpriteVertex> m_SpriteVertices;
 
     UINT m_nBackBufferWidth;
     UINT m_nBackBufferHeight;
@@ -989,6 +998,16 @@ protected:
 
 //-----------------------------------------------------------------------------
 // CUniBuffer class for the edit control
+//
+// The text is kept in a CDXUTGapBuffer, so edits at the caret only move the
+// characters between the old and new edit position.  Per-frame readers take the text
+// as the two spans either side of the gap with GetSpans().  GetBuffer() moves the gap
+// to the end to return the text in one piece, and is for occasional readers; its
+// pointer lasts until the next edit or Uniscribe call.
+//
+// Uniscribe analysis is kept per line, splitting after each LF or U+2029, and an
+// edit only re-shapes the line it touches unless it adds or removes a line break.
+// Single-line text, such as an edit box's, is one line and is shaped whole.
 //-----------------------------------------------------------------------------
 class CUniBuffer
 {
@@ -996,17 +1015,16 @@ public:
     CUniBuffer( _In_ int nInitialSize = 1 );
     ~CUniBuffer();
 
-    size_t GetBufferSize() const { return m_nBufferSize; }
-    bool SetBufferSize( _In_ int nSize );
-    int GetTextSize() const { return (int)wcslen( m_pwszBuffer ); }
-    const WCHAR* GetBuffer() const
+    size_t GetBufferSize() const { return size_t( m_Text.GetBufferSize() ); }
+    bool SetBufferSize( _In_ int nSize ) { return m_Text.SetBufferSize( nSize ); }
+    int GetTextSize() const { return m_Text.GetTextSize(); }
+    const WCHAR* GetBuffer() const { return m_Text.GetBuffer(); }
+    void GetSpans( _In_ int nFirst, _Outptr_result_buffer_(*pnFirst) const WCHAR** ppFirst, _Out_ int* pnFirst,
+                   _Outptr_result_buffer_(*pnSecond) const WCHAR** ppSecond, _Out_ int* pnSecond ) const
     {
-        return m_pwszBuffer;
-    }
-    const WCHAR& operator[]( _In_ int n ) const
-    {
-        return m_pwszBuffer[n];
+        m_Text.GetSpans( nFirst, ppFirst, pnFirst, ppSecond, pnSecond );
     }
+    WCHAR operator[]( _In_ int n ) const { return m_Text[ n ]; }
     WCHAR& operator[]( _In_ int n );
     DXUTFontNode* GetFontNode() const { return m_pFontNode; }
     void SetFontNode( _In_opt_ DXUTFontNode* pFontNode ) { m_pFontNode = pFontNode; }
@@ -1018,6 +1036,12 @@ public:
     bool RemoveChar( _In_ int nIndex );
         // Removes the char at specified index. If nIndex == -1, remove the last char.
 
+    bool RemoveString( _In_ int nIndex, _In_ int nCount );
+        // Removes nCount characters starting at the specified index.
+
+    bool ReplaceChar( _In_ int nIndex, _In_ WCHAR wChar );
+        // Overwrites the char at specified index.  Unlike operator[], only that line is re-shaped.
+
     bool InsertString( _In_ int nIndex, _In_z_ const WCHAR* pStr, _In_ int nCount = -1 );
         // Inserts the first nCount characters of the string pStr at specified index.  If nCount == -1, the entire string is inserted. If nIndex == -1, insert to the end.
 
@@ -1030,15 +1054,30 @@ public:
     void GetNextItemPos( _In_ int nCP, _Out_ int* pPrior );
 
 private:
-    HRESULT Analyse();      // Uniscribe -- Analyse() analyses the string in the buffer
+    CUniBuffer( const CUniBuffer& );
+    CUniBuffer& operator=( const CUniBuffer& );
+
+    // A line of text with its own Uniscribe analysis
+    struct Run
+    {
+        int nStart;                     // First character
+        int nLength;                    // Including the line break ending it, or the nul after the last run
+        int nWidth;
+        SCRIPT_STRING_ANALYSIS Analysis;  // nullptr until the run is shaped
+    };
 
-    WCHAR* m_pwszBuffer;    // Buffer to hold text
-    int m_nBufferSize;   // Size of the buffer allocated, in characters
+    HRESULT Analyse();      // Uniscribe -- Analyse() analyses the lines that changed
+    void FreeRuns();
+    size_t FindRun( _In_ int nCP ) const;
+    const SCRIPT_LOGATTR* GetLogAttr( _In_ int nCP ) const;
+    void InvalidateRuns( _In_ int nIndex, _In_ int nRemoved, _In_ int nInserted, _In_ bool bLineBreak );
+
+    CDXUTGapBuffer m_Text;
 
     // Uniscribe-specific
     DXUTFontNode* m_pFontNode;          // Font node for the font that this buffer uses
-    bool m_bAnalyseRequired;            // True if the string has changed since last analysis.
-    SCRIPT_STRING_ANALYSIS m_Analysis;  // Analysis for the current string
+    bool m_bAnalyseRequired;            // True if the lines must be split again, because a line break changed
+    std::vector<Run> m_Runs;            // Analysis for each line of the current string
 };
 
 
@@ -1122,4 +1161,8 @@ void BeginText11();
 void DrawText11DXUT( _In_ ID3D11Device* pd3dDevice, _In_ ID3D11DeviceContext* pd3d11DeviceContext,
                      _In_z_ LPCWSTR strText, _In_ const RECT& rcScreen, _In_ DirectX::XMFLOAT4 vFontColor,
                      _In_ float fBBWidth, _In_ float fBBHeight, _In_ bool bCenter );
+void DrawText11DXUT( _In_ ID3D11Device* pd3dDevice, _In_ ID3D11DeviceContext* pd3d11DeviceContext,
+                     _In_reads_(nFirst) LPCWSTR strFirst, _In_ int nFirst, _In_reads_opt_(nSecond) LPCWSTR strSecond, _In_ int nSecond,
+                     _In_ const RECT& rcScreen, _In_ DirectX::XMFLOAT4 vFontColor,
+                     _In_ float fBBWidth, _In_ float fBBHeight, _In_ bool bCenter );
 void EndText11( _In_ ID3D11Device* pd3dDevice, _In_ ID3D11DeviceContext* pd3d11DeviceContext );
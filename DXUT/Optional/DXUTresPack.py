@@ -0,0 +1,180 @@
+#!/usr/bin/env python
+#--------------------------------------------------------------------------------------
+# File: DXUTresPack.py
+#
+# Packs an uncompressed 32-bit DDS into the blob DXUTres.cpp embeds: the image is
+# encoded as BC2, since the DXUT GUI art only uses 4-bit alpha, and the resulting DDS is
+# compressed with the LZ4 block format.  Writes a C++ array to stdout.
+#
+#   python DXUTresPack.py ..\..\Media\UI\dxutcontrols.dds g_DXUTGUITexturePacked > out.inc
+#
+# THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+# ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+# PARTICULAR PURPOSE.
+#
+# Copyright (c) Microsoft Corporation. All rights reserved.
+#
+# http://go.microsoft.com/fwlink/?LinkId=320437
+#--------------------------------------------------------------------------------------
+import struct
+import sys
+
+DDS_MAGIC = 0x20534444
+DDSD_CAPS, DDSD_HEIGHT, DDSD_WIDTH, DDSD_PIXELFORMAT, DDSD_LINEARSIZE = 0x1, 0x2, 0x4, 0x1000, 0x80000
+DDPF_FOURCC = 0x4
+DDSCAPS_TEXTURE = 0x1000
+
+
+def to565(r, g, b):
+    return ((r * 31 + 127) // 255) << 11 | ((g * 63 + 127) // 255) << 5 | ((b * 31 + 127) // 255)
+
+
+def from565(c):
+    r, g, b = (c >> 11) & 31, (c >> 5) & 63, c & 31
+    return (r << 3 | r >> 2, g << 2 | g >> 4, b << 3 | b >> 2)
+
+
+def palette(c0, c1):
+    p0, p1 = from565(c0), from565(c1)
+    return [p0, p1,
+            tuple((2 * a + b + 1) // 3 for a, b in zip(p0, p1)),
+            tuple((a + 2 * b + 1) // 3 for a, b in zip(p0, p1))]
+
+
+def encode_block(pixels):
+    # Explicit 4-bit alpha, 16 pixels in row order
+    alpha = 0
+    for i, (r, g, b, a) in enumerate(pixels):
+        alpha |= ((a * 15 + 127) // 255) << (4 * i)
+
+    # Color error is weighted by alpha, so fully transparent texels are free
+    visible = [(r, g, b) for r, g, b, a in pixels if a]
+    if not visible:
+        return struct.pack('<QHHI', alpha, 0, 0, 0)
+
+    # Endpoints are searched among the block's own colors and the corners of its bounding box
+    lo = tuple(min(c[i] for c in visible) for i in range(3))
+    hi = tuple(max(c[i] for c in visible) for i in range(3))
+    candidates = sorted(set(to565(*c) for c in visible + [lo, hi]))
+
+    best = None
+    for i, c0 in enumerate(candidates):
+        for c1 in candidates[i:]:
+            hi, lo = max(c0, c1), min(c0, c1)
+            pal = palette(hi, lo)
+            error, indices = 0, 0
+            for n, (r, g, b, a) in enumerate(pixels):
+                e, k = min((sum((x - y) ** 2 for x, y in zip((r, g, b), p)), k) for k, p in enumerate(pal))
+                error += e * a
+                indices |= k << (2 * n)
+            if best is None or error < best[0]:
+                best = (error, hi, lo, indices)
+            if error == 0:
+                break
+        if best[0] == 0:
+            break
+
+    # BC2 always decodes in four color mode, whatever the endpoint order
+    return struct.pack('<QHHI', alpha, best[1], best[2], best[3])
+
+
+def encode_bc2(width, height, rgba):
+    out = bytearray()
+    for by in range(0, height, 4):
+        for bx in range(0, width, 4):
+            block = []
+            for y in range(by, by + 4):
+                for x in range(bx, bx + 4):
+                    o = (y * width + x) * 4
+                    block.append(tuple(rgba[o:o + 4]))
+            out += encode_block(block)
+    return bytes(out)
+
+
+def lz4_compress(data):
+    # Greedy LZ4 block format with a hash of the next four bytes
+    out = bytearray()
+    table = {}
+    anchor = pos = 0
+    limit = len(data) - 12
+
+    def emit(literals, match_len, offset):
+        lit = len(literals)
+        token = (min(lit, 15) << 4) | (min(match_len - 4, 15) if offset else 0)
+        out.append(token)
+        if lit >= 15:
+            n = lit - 15
+            while n >= 255:
+                out.append(255)
+                n -= 255
+            out.append(n)
+        out.extend(literals)
+        if offset:
+            out.extend(struct.pack('<H', offset))
+            if match_len - 4 >= 15:
+                n = match_len - 4 - 15
+                while n >= 255:
+                    out.append(255)
+                    n -= 255
+                out.append(n)
+
+    while pos < limit:
+        key = data[pos:pos + 4]
+        cand = table.get(key)
+        table[key] = pos
+        if cand is not None and pos - cand <= 0xFFFF:
+            length = 4
+            while pos + length < len(data) - 5 and data[cand + length] == data[pos + length]:
+                length += 1
+            emit(data[anchor:pos], length, pos - cand)
+            pos += length
+            anchor = pos
+        else:
+            pos += 1
+    emit(data[anchor:], 0, 0)
+    return bytes(out)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('usage: DXUTresPack.py <input.dds> <array name>')
+
+    src = open(sys.argv[1], 'rb').read()
+    magic, size, flags, height, width = struct.unpack_from('<5I', src, 0)
+    pf_size, pf_flags, fourcc, bits, rmask, gmask, bmask, amask = struct.unpack_from('<8I', src, 76)
+    if magic != DDS_MAGIC or bits != 32 or (rmask, gmask, bmask, amask) not in (
+            (0xff, 0xff00, 0xff0000, 0xff000000), (0xff0000, 0xff00, 0xff, 0xff000000)):
+        sys.exit('expected an uncompressed 32-bit RGBA DDS')
+
+    pixels = bytearray(src[128:128 + width * height * 4])
+    if rmask == 0xff0000:
+        pixels[0::4], pixels[2::4] = pixels[2::4], pixels[0::4]
+
+    bc2 = encode_bc2(width, height, pixels)
+
+    header = bytearray(128)
+    struct.pack_into('<7I', header, 0, DDS_MAGIC, 124,
+                     DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_LINEARSIZE,
+                     height, width, len(bc2), 0)
+    struct.pack_into('<8I', header, 76, 32, DDPF_FOURCC, 0x33545844, 0, 0, 0, 0, 0)  # "DXT3"
+    struct.pack_into('<I', header, 108, DDSCAPS_TEXTURE)
+    dds = bytes(header) + bc2
+
+    packed = lz4_compress(dds)
+    sys.stderr.write('%s: %d bytes, BC2 %d bytes, LZ4 %d bytes\n' % (sys.argv[1], len(src), len(dds), len(packed)))
+
+    name = sys.argv[2]
+    print('// Generated by DXUTresPack.py from %s, do not edit' % sys.argv[1].replace('\\', '/').split('/')[-1])
+    print('static const BYTE %s[] =' % name)
+    print('{')
+    for i in range(0, len(packed), 16):
+        print('    ' + ', '.join('0x%02x' % b for b in packed[i:i + 16]) + ',')
+    print('};')
+    print('')
+    print('static const UINT %sSizeInBytes = %d;' % (name, len(packed)))
+    print('static const UINT %sUnpackedSizeInBytes = %d;' % (name, len(dds)))
+
+
+if __name__ == '__main__':
+    main()
@@ -412,10 +412,11 @@ void CD3DSettingsDlg::SetSelectedD3D11RefreshRate( _In_ DXGI_RATIONAL RefreshRat
 }
 
 //--------------------------------------------------------------------------------------
-void CD3DSettingsDlg::OnRender( _In_ float fElapsedTime )
+_Use_decl_annotations_
+void CD3DSettingsDlg::OnRender( float fElapsedTime, ID3D11DeviceContext* pd3dContext )
 {
     // Render the scene
-    m_pActiveDialog->OnRender( fElapsedTime );
+    m_pActiveDialog->OnRender( fElapsedTime, pd3dContext );
 }
 
 
@@ -74,7 +74,7 @@ public:
                _In_ HMODULE hModule );
 
     HRESULT Refresh();
-    void OnRender( _In_ float fElapsedTime );
+    void OnRender( _In_ float fElapsedTime, _In_opt_ ID3D11DeviceContext* pd3dContext = nullptr );
 
     HRESULT OnD3D11CreateDevice( _In_ ID3D11Device* pd3dDevice );
     HRESULT OnD3D11ResizedSwapChain( _In_ ID3D11Device* pd3dDevice,
@@ -18,9 +18,891 @@
 #include "DXUT.h"
 #include "SDKMesh.h"
 #include "SDKMisc.h"
+#include "DXUTarchive.h"
+
+#include <DirectXPackedVector.h>
 
 using namespace DirectX;
 
+//--------------------------------------------------------------------------------------
+// Vertex cache optimization helpers
+//--------------------------------------------------------------------------------------
+namespace
+{
+
+// Scoring constants from Tom Forsyth's "Linear-Speed Vertex Cache Optimisation"
+const float VCACHE_DECAY_POWER = 1.5f;
+const float VCACHE_LAST_TRI_SCORE = 0.75f;
+const float VCACHE_VALENCE_BOOST_SCALE = 2.0f;
+const float VCACHE_VALENCE_BOOST_POWER = 0.5f;
+
+float VCacheVertexScore( int cachePosition, UINT activeTris, UINT cacheSize )
+{
+    if( !activeTris )
+        return -1.0f;
+
+    float score = 0.0f;
+    if( cachePosition >= 0 )
+    {
+        if( cachePosition < 3 )
+        {
+            // The last triangle's vertices get a fixed score so that the next triangle
+            // does not simply reuse the same edge over and over
+            score = VCACHE_LAST_TRI_SCORE;
+        }
+        else
+        {
+            float scaler = 1.0f / float( cacheSize - 3 );
+            score = powf( 1.0f - float( cachePosition - 3 ) * scaler, VCACHE_DECAY_POWER );
+        }
+    }
+
+    // Boost vertices with few triangles left so that lone triangles are not left behind
+    score += VCACHE_VALENCE_BOOST_SCALE * powf( float( activeTris ), -VCACHE_VALENCE_BOOST_POWER );
+    return score;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Reorders a triangle list for post-transform cache locality
+//--------------------------------------------------------------------------------------
+void VCacheOptimizeFaces( _In_reads_(nIndices) const UINT* pIndices, _In_ size_t nIndices, _In_ UINT nVerts,
+                          _In_ UINT cacheSize, _Out_writes_(nIndices) UINT* pOut )
+{
+    const size_t nTris = nIndices / 3;
+    if( !nTris )
+        return;
+
+    // Per-vertex list of the triangles that still need to be emitted
+    std::vector<UINT> activeTris( nVerts, 0 );
+    for( size_t i = 0; i < nTris * 3; ++i )
+        activeTris[ pIndices[i] ]++;
+
+    std::vector<UINT> triOffset( nVerts + 1, 0 );
+    for( UINT v = 0; v < nVerts; ++v )
+        triOffset[v + 1] = triOffset[v] + activeTris[v];
+
+    std::vector<UINT> triList( nTris * 3 );
+    std::vector<UINT> fill( triOffset.begin(), triOffset.end() - 1 );
+    for( size_t i = 0; i < nTris * 3; ++i )
+        triList[ fill[ pIndices[i] ]++ ] = UINT( i / 3 );
+
+    std::vector<int> cachePos( nVerts, -1 );
+    std::vector<float> vertexScore( nVerts );
+    for( UINT v = 0; v < nVerts; ++v )
+        vertexScore[v] = VCacheVertexScore( -1, activeTris[v], cacheSize );
+
+    std::vector<float> triScore( nTris );
+    std::vector<bool> triAdded( nTris, false );
+    size_t bestTri = 0;
+    for( size_t t = 0; t < nTris; ++t )
+    {
+        triScore[t] = vertexScore[ pIndices[t * 3] ] + vertexScore[ pIndices[t * 3 + 1] ] + vertexScore[ pIndices[t * 3 + 2] ];
+        if( triScore[t] > triScore[bestTri] )
+            bestTri = t;
+    }
+
+    // The emulated cache holds three extra entries so that vertices pushed out by the
+    // current triangle still get their scores updated
+    std::vector<UINT> cache;
+    std::vector<UINT> newCache;
+    cache.reserve( cacheSize + 3 );
+    newCache.reserve( cacheSize + 3 );
+
+    size_t scanPos = 0;
+    for( size_t out = 0; out < nTris; ++out )
+    {
+        if( bestTri == SIZE_MAX )
+        {
+            // Nothing adjacent to the cache is left, continue with the next unused triangle
+            while( triAdded[scanPos] )
+                ++scanPos;
+            bestTri = scanPos;
+        }
+
+        triAdded[bestTri] = true;
+        newCache.clear();
+        for( size_t k = 0; k < 3; ++k )
+        {
+            UINT v = pIndices[bestTri * 3 + k];
+            pOut[out * 3 + k] = v;
+
+            // Remove the triangle from the vertex's active list
+            UINT* pTris = &triList[ triOffset[v] ];
+            for( UINT j = 0; j < activeTris[v]; ++j )
+            {
+                if( pTris[j] == bestTri )
+                {
+                    pTris[j] = pTris[ activeTris[v] - 1 ];
+                    activeTris[v]--;
+                    break;
+                }
+            }
+
+            if( std::find( newCache.begin(), newCache.end(), v ) == newCache.end() )
+                newCache.push_back( v );
+        }
+
+        for( auto it = cache.cbegin(); it != cache.cend(); ++it )
+        {
+            if( std::find( newCache.begin(), newCache.end(), *it ) == newCache.end() )
+                newCache.push_back( *it );
+        }
+
+        for( size_t i = 0; i < newCache.size(); ++i )
+        {
+            UINT v = newCache[i];
+            cachePos[v] = ( i < cacheSize ) ? int( i ) : -1;
+            vertexScore[v] = VCacheVertexScore( cachePos[v], activeTris[v], cacheSize );
+        }
+
+        // Only triangles touching the cache can have changed score
+        bestTri = SIZE_MAX;
+        float bestScore = -1.0f;
+        for( auto it = newCache.cbegin(); it != newCache.cend(); ++it )
+        {
+            const UINT* pTris = &triList[ triOffset[*it] ];
+            for( UINT j = 0; j < activeTris[*it]; ++j )
+            {
+                UINT t = pTris[j];
+                triScore[t] = vertexScore[ pIndices[t * 3] ] + vertexScore[ pIndices[t * 3 + 1] ] + vertexScore[ pIndices[t * 3 + 2] ];
+                if( triScore[t] > bestScore )
+                {
+                    bestScore = triScore[t];
+                    bestTri = t;
+                }
+            }
+        }
+
+        if( newCache.size() > cacheSize )
+            newCache.resize( cacheSize );
+        cache.swap( newCache );
+    }
+}
+
+
+//--------------------------------------------------------------------------------------
+// Counts the misses of a FIFO post-transform cache.  Vertex ids are offset by baseVertex
+// so that subsets drawn with different base vertices do not alias.
+//--------------------------------------------------------------------------------------
+UINT64 VCacheCountMisses( _In_reads_(nIndices) const UINT* pIndices, _In_ size_t nIndices, _In_ UINT baseVertex,
+                          _In_ UINT cacheSize, _Inout_ std::vector<UINT64>& insertTime, _Inout_ UINT64& clock )
+{
+    UINT64 misses = 0;
+    for( size_t i = 0; i < nIndices; ++i )
+    {
+        UINT v = baseVertex + pIndices[i];
+        if( v >= insertTime.size() )
+            insertTime.resize( v + 1, 0 );
+
+        // insertTime holds the FIFO clock at insertion plus one, zero means never cached
+        if( !insertTime[v] || clock - ( insertTime[v] - 1 ) >= cacheSize )
+        {
+            insertTime[v] = clock + 1;
+            ++clock;
+            ++misses;
+        }
+    }
+    return misses;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Pointers to the buffer data of a mesh, either a raw file image or a loaded mesh
+//--------------------------------------------------------------------------------------
+struct SDKMESH_BUFFER_VIEW
+{
+    SDKMESH_HEADER* pHeader;
+    SDKMESH_VERTEX_BUFFER_HEADER* pVertexBufferArray;
+    SDKMESH_INDEX_BUFFER_HEADER* pIndexBufferArray;
+    SDKMESH_MESH* pMeshArray;
+    SDKMESH_SUBSET* pSubsetArray;
+    std::vector<const UINT*> meshSubsets;
+    std::vector<BYTE*> vertices;
+    std::vector<BYTE*> indices;
+};
+
+struct SDKMESH_VERTEX_RANGE
+{
+    UINT64 VertexStart;
+    UINT64 VertexCount;
+    std::vector<UINT> subsets;
+};
+
+
+//--------------------------------------------------------------------------------------
+HRESULT OptimizeIndexBuffer( _Inout_ SDKMESH_BUFFER_VIEW& view, _In_ UINT iIB, _In_ UINT cacheSize,
+                             _Inout_ SDKMESH_OPTIMIZE_STATS& stats )
+{
+    auto pIBHeader = &view.pIndexBufferArray[iIB];
+    const size_t nIndices = size_t( pIBHeader->NumIndices );
+    const bool b16Bit = ( pIBHeader->IndexType == IT_16BIT );
+    if( !nIndices || pIBHeader->SizeBytes < pIBHeader->NumIndices * ( b16Bit ? 2 : 4 ) )
+        return S_OK;
+
+    // Gather the subsets drawn from this index buffer and the vertex streams they use
+    std::vector<UINT> subsets;
+    std::vector<UINT> vbSet;
+    bool bReorderVertices = true;
+    bool bFirstMesh = true;
+    for( UINT m = 0; m < view.pHeader->NumMeshes; ++m )
+    {
+        const SDKMESH_MESH& mesh = view.pMeshArray[m];
+        if( mesh.IndexBuffer != iIB )
+            continue;
+
+        std::vector<UINT> meshVBs( mesh.VertexBuffers, mesh.VertexBuffers + std::min<UINT>( mesh.NumVertexBuffers, MAX_VERTEX_STREAMS ) );
+        if( bFirstMesh )
+            vbSet = meshVBs;
+        else if( vbSet != meshVBs )
+            bReorderVertices = false;
+        bFirstMesh = false;
+
+        for( UINT s = 0; s < mesh.NumSubsets; ++s )
+        {
+            UINT iSubset = view.meshSubsets[m][s];
+            if( iSubset >= view.pHeader->NumTotalSubsets )
+                return E_FAIL;
+            if( std::find( subsets.begin(), subsets.end(), iSubset ) == subsets.end() )
+                subsets.push_back( iSubset );
+        }
+    }
+
+    // Vertex streams shared with meshes using another index buffer must keep their order
+    for( UINT m = 0; m < view.pHeader->NumMeshes; ++m )
+    {
+        const SDKMESH_MESH& mesh = view.pMeshArray[m];
+        if( mesh.IndexBuffer == iIB )
+            continue;
+        for( UINT i = 0; i < mesh.NumVertexBuffers && i < MAX_VERTEX_STREAMS; ++i )
+        {
+            if( std::find( vbSet.begin(), vbSet.end(), mesh.VertexBuffers[i] ) != vbSet.end() )
+                bReorderVertices = false;
+        }
+    }
+
+    if( subsets.empty() )
+        return S_OK;
+
+    // Index ranges must be disjoint, otherwise reordering one subset corrupts another
+    std::sort( subsets.begin(), subsets.end(), [&view]( UINT a, UINT b )
+    {
+        return view.pSubsetArray[a].IndexStart < view.pSubsetArray[b].IndexStart;
+    } );
+    for( size_t i = 0; i < subsets.size(); ++i )
+    {
+        const SDKMESH_SUBSET& subset = view.pSubsetArray[ subsets[i] ];
+        if( subset.IndexStart + subset.IndexCount > nIndices )
+            return E_FAIL;
+        if( i > 0 )
+        {
+            const SDKMESH_SUBSET& prev = view.pSubsetArray[ subsets[i - 1] ];
+            if( prev.IndexStart + prev.IndexCount > subset.IndexStart )
+                return S_OK;
+        }
+    }
+
+    std::vector<UINT> indices( nIndices );
+    if( b16Bit )
+    {
+        auto pSrc = reinterpret_cast<const WORD*>( view.indices[iIB] );
+        for( size_t i = 0; i < nIndices; ++i )
+            indices[i] = pSrc[i];
+    }
+    else
+    {
+        memcpy( indices.data(), view.indices[iIB], nIndices * sizeof( UINT ) );
+    }
+
+    // Group the subsets by vertex range; distinct ranges must not overlap
+    UINT64 numVertices = UINT64( -1 );
+    for( auto it = vbSet.cbegin(); it != vbSet.cend(); ++it )
+    {
+        if( *it >= view.pHeader->NumVertexBuffers )
+            return E_FAIL;
+        const SDKMESH_VERTEX_BUFFER_HEADER& vb = view.pVertexBufferArray[*it];
+        if( !vb.StrideBytes || vb.SizeBytes < vb.NumVertices * vb.StrideBytes )
+            bReorderVertices = false;
+        numVertices = std::min( numVertices, vb.NumVertices );
+    }
+    if( vbSet.empty() )
+        bReorderVertices = false;
+
+    std::vector<SDKMESH_VERTEX_RANGE> ranges;
+    for( auto it = subsets.cbegin(); it != subsets.cend(); ++it )
+    {
+        const SDKMESH_SUBSET& subset = view.pSubsetArray[*it];
+        if( !subset.VertexCount || subset.VertexStart + subset.VertexCount > numVertices )
+            bReorderVertices = false;
+
+        for( UINT64 i = subset.IndexStart; i < subset.IndexStart + subset.IndexCount; ++i )
+        {
+            if( indices[ size_t( i ) ] >= subset.VertexCount )
+                bReorderVertices = false;
+        }
+
+        bool bMerged = false;
+        for( auto range = ranges.begin(); range != ranges.end(); ++range )
+        {
+            if( range->VertexStart == subset.VertexStart && range->VertexCount == subset.VertexCount )
+            {
+                range->subsets.push_back( *it );
+                bMerged = true;
+                break;
+            }
+            if( subset.VertexStart < range->VertexStart + range->VertexCount
+                && range->VertexStart < subset.VertexStart + subset.VertexCount )
+                bReorderVertices = false;
+        }
+        if( !bMerged )
+        {
+            SDKMESH_VERTEX_RANGE range;
+            range.VertexStart = subset.VertexStart;
+            range.VertexCount = subset.VertexCount;
+            range.subsets.push_back( *it );
+            ranges.push_back( range );
+        }
+    }
+
+    // Measure before
+    std::vector<UINT64> insertTime;
+    UINT64 clock = 0;
+    for( auto it = subsets.cbegin(); it != subsets.cend(); ++it )
+    {
+        const SDKMESH_SUBSET& subset = view.pSubsetArray[*it];
+        if( subset.PrimitiveType != PT_TRIANGLE_LIST )
+            continue;
+        const UINT* pSubsetIndices = &indices[ size_t( subset.IndexStart ) ];
+        stats.CacheMissesBefore += VCacheCountMisses( pSubsetIndices, size_t( subset.IndexCount ), UINT( subset.VertexStart ),
+                                                      cacheSize, insertTime, clock );
+        stats.NumTriangles += subset.IndexCount / 3;
+    }
+    stats.NumReferencedVertices += std::count_if( insertTime.cbegin(), insertTime.cend(), []( UINT64 t ) { return t != 0; } );
+
+    // Reorder the triangles of each subset
+    std::vector<UINT> optimized;
+    for( auto it = subsets.cbegin(); it != subsets.cend(); ++it )
+    {
+        const SDKMESH_SUBSET& subset = view.pSubsetArray[*it];
+        if( subset.PrimitiveType != PT_TRIANGLE_LIST || subset.IndexCount < 6 )
+            continue;
+
+        UINT* pSubsetIndices = &indices[ size_t( subset.IndexStart ) ];
+        const size_t nSubsetIndices = size_t( subset.IndexCount - ( subset.IndexCount % 3 ) );
+        UINT nVerts = 1 + *std::max_element( pSubsetIndices, pSubsetIndices + nSubsetIndices );
+
+        optimized.resize( nSubsetIndices );
+        VCacheOptimizeFaces( pSubsetIndices, nSubsetIndices, nVerts, cacheSize, optimized.data() );
+        memcpy( pSubsetIndices, optimized.data(), nSubsetIndices * sizeof( UINT ) );
+    }
+
+    // Reorder the vertices of each range into first-use order and remap the indices
+    if( bReorderVertices )
+    {
+        std::vector<UINT> remap;
+        std::vector<BYTE> scratch;
+        for( auto range = ranges.cbegin(); range != ranges.cend(); ++range )
+        {
+            const UINT count = UINT( range->VertexCount );
+            remap.assign( count, UINT( -1 ) );
+            UINT next = 0;
+            for( auto it = range->subsets.cbegin(); it != range->subsets.cend(); ++it )
+            {
+                const SDKMESH_SUBSET& subset = view.pSubsetArray[*it];
+                for( UINT64 i = subset.IndexStart; i < subset.IndexStart + subset.IndexCount; ++i )
+                {
+                    UINT& index = indices[ size_t( i ) ];
+                    if( remap[index] == UINT( -1 ) )
+                        remap[index] = next++;
+                    index = remap[index];
+                }
+            }
+
+            // Unreferenced vertices keep their relative order at the end of the range
+            for( UINT i = 0; i < count; ++i )
+            {
+                if( remap[i] == UINT( -1 ) )
+                    remap[i] = next++;
+            }
+
+            for( auto it = vbSet.cbegin(); it != vbSet.cend(); ++it )
+            {
+                const size_t stride = size_t( view.pVertexBufferArray[*it].StrideBytes );
+                BYTE* pVertices = view.vertices[*it] + size_t( range->VertexStart ) * stride;
+
+                scratch.assign( pVertices, pVertices + count * stride );
+                for( UINT i = 0; i < count; ++i )
+                    memcpy( pVertices + remap[i] * stride, &scratch[i * stride], stride );
+            }
+        }
+
+        stats.NumVertexBuffersReordered += UINT( vbSet.size() );
+    }
+
+    // Measure after
+    std::fill( insertTime.begin(), insertTime.end(), 0 );
+    clock = 0;
+    for( auto it = subsets.cbegin(); it != subsets.cend(); ++it )
+    {
+        const SDKMESH_SUBSET& subset = view.pSubsetArray[*it];
+        if( subset.PrimitiveType != PT_TRIANGLE_LIST )
+            continue;
+        const UINT* pSubsetIndices = &indices[ size_t( subset.IndexStart ) ];
+        stats.CacheMissesAfter += VCacheCountMisses( pSubsetIndices, size_t( subset.IndexCount ), UINT( subset.VertexStart ),
+                                                     cacheSize, insertTime, clock );
+    }
+
+    // Write back, shrinking to 16-bit when every index fits (0xFFFF is kept free as the strip cut value)
+    UINT maxIndex = *std::max_element( indices.cbegin(), indices.cend() );
+    if( b16Bit || maxIndex < 0xFFFF )
+    {
+        auto pDest = reinterpret_cast<WORD*>( view.indices[iIB] );
+        for( size_t i = 0; i < nIndices; ++i )
+            pDest[i] = WORD( indices[i] );
+
+        if( !b16Bit )
+        {
+            pIBHeader->IndexType = IT_16BIT;
+            pIBHeader->SizeBytes = pIBHeader->NumIndices * sizeof( WORD );
+            stats.NumIndexBuffersShrunk++;
+        }
+    }
+    else
+    {
+        memcpy( view.indices[iIB], indices.data(), nIndices * sizeof( UINT ) );
+    }
+
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+HRESULT OptimizeSDKMeshBuffers( _Inout_ SDKMESH_BUFFER_VIEW& view, _In_ UINT cacheSize, _Out_opt_ SDKMESH_OPTIMIZE_STATS* pStats )
+{
+    if( cacheSize < 4 )
+        return E_INVALIDARG;
+
+    SDKMESH_OPTIMIZE_STATS stats;
+    ZeroMemory( &stats, sizeof( stats ) );
+
+    for( UINT i = 0; i < view.pHeader->NumIndexBuffers; ++i )
+    {
+        HRESULT hr = OptimizeIndexBuffer( view, i, cacheSize, stats );
+        if( FAILED( hr ) )
+            return hr;
+    }
+
+    if( stats.NumTriangles )
+    {
+        stats.ACMRBefore = float( double( stats.CacheMissesBefore ) / double( stats.NumTriangles ) );
+        stats.ACMRAfter = float( double( stats.CacheMissesAfter ) / double( stats.NumTriangles ) );
+    }
+    if( stats.NumReferencedVertices )
+    {
+        stats.ATVRBefore = float( double( stats.CacheMissesBefore ) / double( stats.NumReferencedVertices ) );
+        stats.ATVRAfter = float( double( stats.CacheMissesAfter ) / double( stats.NumReferencedVertices ) );
+    }
+
+    if( pStats )
+        *pStats = stats;
+
+    return S_OK;
+}
+
+//--------------------------------------------------------------------------------------
+// Vertex quantization helpers
+//--------------------------------------------------------------------------------------
+UINT GetDeclTypeSize( _In_ BYTE type )
+{
+    switch( type )
+    {
+    case D3DDECLTYPE_FLOAT1:    return 4;
+    case D3DDECLTYPE_FLOAT2:    return 8;
+    case D3DDECLTYPE_FLOAT3:    return 12;
+    case D3DDECLTYPE_FLOAT4:    return 16;
+    case D3DDECLTYPE_SHORT4:
+    case D3DDECLTYPE_SHORT4N:
+    case D3DDECLTYPE_USHORT4N:
+    case D3DDECLTYPE_FLOAT16_4: return 8;
+    case D3DDECLTYPE_UNUSED:    return 0;
+    default:                    return 4;
+    }
+}
+
+inline short QuantizeSNorm16( float v )
+{
+    v = std::max( -1.0f, std::min( 1.0f, v ) );
+    return short( v * 32767.0f + ( v >= 0.0f ? 0.5f : -0.5f ) );
+}
+
+inline WORD QuantizeUNorm16( float v )
+{
+    v = std::max( 0.0f, std::min( 1.0f, v ) );
+    return WORD( v * 65535.0f + 0.5f );
+}
+
+// Octahedral mapping of a unit vector onto [-1,1]^2
+void EncodeOctahedral( _In_reads_(3) const float* n, _Out_writes_(2) short* pOut )
+{
+    float l1 = fabsf( n[0] ) + fabsf( n[1] ) + fabsf( n[2] );
+    if( l1 <= 0.0f )
+    {
+        pOut[0] = pOut[1] = 0;
+        return;
+    }
+
+    float x = n[0] / l1;
+    float y = n[1] / l1;
+    if( n[2] < 0.0f )
+    {
+        float ox = ( 1.0f - fabsf( y ) ) * ( x >= 0.0f ? 1.0f : -1.0f );
+        float oy = ( 1.0f - fabsf( x ) ) * ( y >= 0.0f ? 1.0f : -1.0f );
+        x = ox;
+        y = oy;
+    }
+    pOut[0] = QuantizeSNorm16( x );
+    pOut[1] = QuantizeSNorm16( y );
+}
+
+bool IsPositionElement( _In_ const D3DVERTEXELEMENT9& element )
+{
+    return element.Usage == D3DDECLUSAGE_POSITION && element.UsageIndex == 0;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Quantizes one vertex buffer in place.  pMesh receives the position bounds when
+// positions are to be quantized, otherwise positions are left as is.
+//--------------------------------------------------------------------------------------
+HRESULT QuantizeVertexBuffer( _Inout_ SDKMESH_VERTEX_BUFFER_HEADER& vb, _Inout_ BYTE* pVertices,
+                              _Inout_opt_ SDKMESH_MESH* pMesh, _Inout_ SDKMESH_QUANTIZE_STATS& stats )
+{
+    const size_t oldStride = size_t( vb.StrideBytes );
+    const size_t nVerts = size_t( vb.NumVertices );
+    if( !oldStride || !nVerts || vb.SizeBytes < vb.NumVertices * vb.StrideBytes )
+        return S_OK;
+
+    UINT nElements = 0;
+    while( nElements < MAX_VERTEX_ELEMENTS && vb.Decl[nElements].Stream != 0xFF )
+        ++nElements;
+
+    // Choose the packed format of each element
+    D3DVERTEXELEMENT9 newDecl[MAX_VERTEX_ELEMENTS];
+    memcpy( newDecl, vb.Decl, sizeof( newDecl ) );
+
+    float posMin[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+    float posMax[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+    WORD offset = 0;
+    for( UINT e = 0; e < nElements; ++e )
+    {
+        const D3DVERTEXELEMENT9& element = vb.Decl[e];
+        if( element.Offset + GetDeclTypeSize( element.Type ) > oldStride )
+            return E_FAIL;
+
+        BYTE type = element.Type;
+        switch( element.Usage )
+        {
+        case D3DDECLUSAGE_POSITION:
+            if( pMesh && IsPositionElement( element ) && element.Type == D3DDECLTYPE_FLOAT3 )
+            {
+                for( size_t i = 0; i < nVerts; ++i )
+                {
+                    auto p = reinterpret_cast<const float*>( pVertices + i * oldStride + element.Offset );
+                    for( int k = 0; k < 3; ++k )
+                    {
+                        posMin[k] = std::min( posMin[k], p[k] );
+                        posMax[k] = std::max( posMax[k], p[k] );
+                    }
+                }
+                type = D3DDECLTYPE_SHORT4N;
+            }
+            break;
+
+        case D3DDECLUSAGE_NORMAL:
+        case D3DDECLUSAGE_TANGENT:
+        case D3DDECLUSAGE_BINORMAL:
+            if( element.Type == D3DDECLTYPE_FLOAT3 )
+                type = D3DDECLTYPE_SHORT2N;
+            break;
+
+        case D3DDECLUSAGE_TEXCOORD:
+            if( element.Type == D3DDECLTYPE_FLOAT2 )
+            {
+                bool bUnit = true;
+                bool bHalf = true;
+                for( size_t i = 0; i < nVerts && bHalf; ++i )
+                {
+                    auto uv = reinterpret_cast<const float*>( pVertices + i * oldStride + element.Offset );
+                    for( int k = 0; k < 2; ++k )
+                    {
+                        if( !( uv[k] >= 0.0f && uv[k] <= 1.0f ) )
+                            bUnit = false;
+                        if( !( fabsf( uv[k] ) <= 65504.0f ) )
+                            bHalf = false;
+                    }
+                }
+                if( bUnit )
+                    type = D3DDECLTYPE_USHORT2N;
+                else if( bHalf )
+                    type = D3DDECLTYPE_FLOAT16_2;
+            }
+            break;
+
+        case D3DDECLUSAGE_BLENDWEIGHT:
+            if( element.Type == D3DDECLTYPE_FLOAT4 )
+                type = D3DDECLTYPE_UBYTE4N;
+            break;
+        }
+
+        newDecl[e].Type = type;
+        newDecl[e].Offset = offset;
+        offset += WORD( GetDeclTypeSize( type ) );
+    }
+
+    const size_t newStride = offset;
+    if( !nElements || newStride >= oldStride )
+        return S_OK;
+
+    float center[3] = { 0, 0, 0 };
+    float extents[3] = { 0, 0, 0 };
+    if( posMin[0] <= posMax[0] )
+    {
+        for( int k = 0; k < 3; ++k )
+        {
+            center[k] = ( posMin[k] + posMax[k] ) * 0.5f;
+            extents[k] = ( posMax[k] - posMin[k] ) * 0.5f;
+        }
+        pMesh->BoundingBoxCenter = XMFLOAT3( center[0], center[1], center[2] );
+        pMesh->BoundingBoxExtents = XMFLOAT3( extents[0], extents[1], extents[2] );
+        memcpy( pMesh->PositionQuantized, SDKMESH_POSITION_QUANTIZED, sizeof( pMesh->PositionQuantized ) );
+    }
+
+    // Vertices are rewritten front to back; vertex i never lands past its own source, so
+    // a copy of the current vertex is all the scratch space needed
+    std::vector<BYTE> src( oldStride );
+    for( size_t i = 0; i < nVerts; ++i )
+    {
+        memcpy( src.data(), pVertices + i * oldStride, oldStride );
+        BYTE* pDest = pVertices + i * newStride;
+
+        for( UINT e = 0; e < nElements; ++e )
+        {
+            const BYTE* pSrcElement = src.data() + vb.Decl[e].Offset;
+            BYTE* pDestElement = pDest + newDecl[e].Offset;
+            auto f = reinterpret_cast<const float*>( pSrcElement );
+
+            if( newDecl[e].Type == vb.Decl[e].Type )
+            {
+                memcpy( pDestElement, pSrcElement, GetDeclTypeSize( newDecl[e].Type ) );
+                continue;
+            }
+
+            switch( newDecl[e].Type )
+            {
+            case D3DDECLTYPE_SHORT4N:
+                {
+                    auto q = reinterpret_cast<short*>( pDestElement );
+                    for( int k = 0; k < 3; ++k )
+                        q[k] = ( extents[k] > 0.0f ) ? QuantizeSNorm16( ( f[k] - center[k] ) / extents[k] ) : 0;
+                    q[3] = 32767;
+                }
+                break;
+
+            case D3DDECLTYPE_SHORT2N:
+                EncodeOctahedral( f, reinterpret_cast<short*>( pDestElement ) );
+                break;
+
+            case D3DDECLTYPE_USHORT2N:
+                {
+                    auto q = reinterpret_cast<WORD*>( pDestElement );
+                    q[0] = QuantizeUNorm16( f[0] );
+                    q[1] = QuantizeUNorm16( f[1] );
+                }
+                break;
+
+            case D3DDECLTYPE_FLOAT16_2:
+                {
+                    auto q = reinterpret_cast<PackedVector::HALF*>( pDestElement );
+                    q[0] = PackedVector::XMConvertFloatToHalf( f[0] );
+                    q[1] = PackedVector::XMConvertFloatToHalf( f[1] );
+                }
+                break;
+
+            case D3DDECLTYPE_UBYTE4N:
+                {
+                    // Round each weight down, then hand the units lost to rounding to the
+                    // weights with the largest remainders, so the bytes sum to exactly 255
+                    float w[4];
+                    float sum = 0.0f;
+                    for( int k = 0; k < 4; ++k )
+                    {
+                        w[k] = std::max( 0.0f, std::min( 1.0f, f[k] ) );
+                        sum += w[k];
+                    }
+
+                    int q[4] = { 0, 0, 0, 0 };
+                    if( sum > 0.0f )
+                    {
+                        float remainder[4];
+                        int total = 0;
+                        for( int k = 0; k < 4; ++k )
+                        {
+                            float scaled = w[k] / sum * 255.0f;
+                            q[k] = std::min( 255, int( scaled ) );
+                            remainder[k] = scaled - float( q[k] );
+                            total += q[k];
+                        }
+
+                        for( ; total < 255; ++total )
+                        {
+                            int largest = 0;
+                            for( int k = 1; k < 4; ++k )
+                            {
+                                if( remainder[k] > remainder[largest] )
+                                    largest = k;
+                            }
+                            q[largest]++;
+                            remainder[largest] -= 1.0f;
+                        }
+                    }
+
+                    for( int k = 0; k < 4; ++k )
+                        pDestElement[k] = BYTE( q[k] );
+                }
+                break;
+            }
+        }
+    }
+
+    memcpy( vb.Decl, newDecl, sizeof( newDecl ) );
+    stats.VertexBytesBefore += vb.SizeBytes;
+    vb.StrideBytes = newStride;
+    vb.SizeBytes = vb.NumVertices * newStride;
+    stats.VertexBytesAfter += vb.SizeBytes;
+    stats.NumVertexBuffersQuantized++;
+
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+HRESULT QuantizeSDKMeshBuffers( _Inout_ SDKMESH_BUFFER_VIEW& view, _Out_opt_ SDKMESH_QUANTIZE_STATS* pStats )
+{
+    SDKMESH_QUANTIZE_STATS stats;
+    ZeroMemory( &stats, sizeof( stats ) );
+
+    // Positions are normalized per mesh, so only streams owned by a single mesh qualify
+    std::vector<UINT> refCount( view.pHeader->NumVertexBuffers, 0 );
+    std::vector<SDKMESH_MESH*> positionOwner( view.pHeader->NumVertexBuffers, nullptr );
+    for( UINT m = 0; m < view.pHeader->NumMeshes; ++m )
+    {
+        SDKMESH_MESH& mesh = view.pMeshArray[m];
+        for( UINT i = 0; i < mesh.NumVertexBuffers && i < MAX_VERTEX_STREAMS; ++i )
+        {
+            if( mesh.VertexBuffers[i] >= view.pHeader->NumVertexBuffers )
+                return E_FAIL;
+            refCount[ mesh.VertexBuffers[i] ]++;
+        }
+        if( mesh.NumVertexBuffers > 0 )
+            positionOwner[ mesh.VertexBuffers[0] ] = &mesh;
+    }
+
+    for( UINT i = 0; i < view.pHeader->NumVertexBuffers; ++i )
+    {
+        HRESULT hr = QuantizeVertexBuffer( view.pVertexBufferArray[i], view.vertices[i],
+                                           ( refCount[i] == 1 ) ? positionOwner[i] : nullptr, stats );
+        if( FAILED( hr ) )
+            return hr;
+    }
+
+    if( pStats )
+        *pStats = stats;
+
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Validates an .sdkmesh file image and sets up pointers to its buffer data
+//--------------------------------------------------------------------------------------
+HRESULT GetSDKMeshBufferView( _In_reads_bytes_(DataBytes) BYTE* pData, _In_ size_t DataBytes, _Out_ SDKMESH_BUFFER_VIEW& view )
+{
+    if( !pData || DataBytes < sizeof( SDKMESH_HEADER ) )
+        return E_INVALIDARG;
+
+    auto pHeader = reinterpret_cast<SDKMESH_HEADER*>( pData );
+    if( pHeader->Version != SDKMESH_FILE_VERSION )
+        return E_NOINTERFACE;
+
+    if( pHeader->VertexStreamHeadersOffset + UINT64( pHeader->NumVertexBuffers ) * sizeof( SDKMESH_VERTEX_BUFFER_HEADER ) > DataBytes
+        || pHeader->IndexStreamHeadersOffset + UINT64( pHeader->NumIndexBuffers ) * sizeof( SDKMESH_INDEX_BUFFER_HEADER ) > DataBytes
+        || pHeader->MeshDataOffset + UINT64( pHeader->NumMeshes ) * sizeof( SDKMESH_MESH ) > DataBytes
+        || pHeader->SubsetDataOffset + UINT64( pHeader->NumTotalSubsets ) * sizeof( SDKMESH_SUBSET ) > DataBytes )
+        return E_FAIL;
+
+    view.pHeader = pHeader;
+    view.pVertexBufferArray = reinterpret_cast<SDKMESH_VERTEX_BUFFER_HEADER*>( pData + pHeader->VertexStreamHeadersOffset );
+    view.pIndexBufferArray = reinterpret_cast<SDKMESH_INDEX_BUFFER_HEADER*>( pData + pHeader->IndexStreamHeadersOffset );
+    view.pMeshArray = reinterpret_cast<SDKMESH_MESH*>( pData + pHeader->MeshDataOffset );
+    view.pSubsetArray = reinterpret_cast<SDKMESH_SUBSET*>( pData + pHeader->SubsetDataOffset );
+
+    for( UINT i = 0; i < pHeader->NumMeshes; ++i )
+    {
+        const SDKMESH_MESH& mesh = view.pMeshArray[i];
+        if( mesh.SubsetOffset + UINT64( mesh.NumSubsets ) * sizeof( UINT ) > DataBytes
+            || mesh.IndexBuffer >= pHeader->NumIndexBuffers )
+            return E_FAIL;
+        view.meshSubsets.push_back( reinterpret_cast<const UINT*>( pData + mesh.SubsetOffset ) );
+    }
+
+    for( UINT i = 0; i < pHeader->NumVertexBuffers; ++i )
+    {
+        const SDKMESH_VERTEX_BUFFER_HEADER& vb = view.pVertexBufferArray[i];
+        if( vb.DataOffset + vb.SizeBytes > DataBytes )
+            return E_FAIL;
+        view.vertices.push_back( pData + vb.DataOffset );
+    }
+
+    for( UINT i = 0; i < pHeader->NumIndexBuffers; ++i )
+    {
+        const SDKMESH_INDEX_BUFFER_HEADER& ib = view.pIndexBufferArray[i];
+        if( ib.DataOffset + ib.SizeBytes > DataBytes )
+            return E_FAIL;
+        view.indices.push_back( pData + ib.DataOffset );
+    }
+
+    return S_OK;
+}
+
+}; // namespace
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT WINAPI DXUTOptimizeSDKMeshInPlace( BYTE* pData, size_t DataBytes, UINT CacheSize, SDKMESH_OPTIMIZE_STATS* pStats )
+{
+    SDKMESH_BUFFER_VIEW view;
+    HRESULT hr = GetSDKMeshBufferView( pData, DataBytes, view );
+    if( FAILED( hr ) )
+        return hr;
+
+    return OptimizeSDKMeshBuffers( view, CacheSize, pStats );
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT WINAPI DXUTQuantizeSDKMeshInPlace( BYTE* pData, size_t DataBytes, SDKMESH_QUANTIZE_STATS* pStats )
+{
+    SDKMESH_BUFFER_VIEW view;
+    HRESULT hr = GetSDKMeshBufferView( pData, DataBytes, view );
+    if( FAILED( hr ) )
+        return hr;
+
+    return QuantizeSDKMeshBuffers( view, pStats );
+}
+
+
 //--------------------------------------------------------------------------------------
 _Use_decl_annotations_
 void CDXUTSDKMesh::LoadMaterials( ID3D11Device* pd3dDevice, SDKMESH_MATERIAL* pMaterials, UINT numMaterials,
@@ -171,6 +1053,48 @@ HRESULT CDXUTSDKMesh::CreateIndexBuffer( ID3D11Device* pd3dDevice, SDKMESH_INDEX
 }
 
 
+//--------------------------------------------------------------------------------------
+// The page gets a reference of its own, so Destroy releases pooled and unpooled
+// buffers alike
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTSDKMesh::AllocatePooledVertexBuffer( UINT iVB )
+{
+    auto pHeader = &m_pVertexBufferArray[iVB];
+    if( !pHeader->StrideBytes || pHeader->NumVertices * pHeader->StrideBytes > pHeader->SizeBytes )
+        return E_FAIL;
+
+    HRESULT hr;
+    V_RETURN( m_pGeometryPool->AllocateVertices( ( UINT )pHeader->StrideBytes, ( UINT )pHeader->NumVertices, m_ppVertices[iVB],
+                                                 &m_VertexAllocations[iVB] ) );
+
+    pHeader->DataOffset = 0;
+    pHeader->pVB11 = m_VertexAllocations[iVB].pBuffer;
+    pHeader->pVB11->AddRef();
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTSDKMesh::AllocatePooledIndexBuffer( UINT iIB )
+{
+    auto pHeader = &m_pIndexBufferArray[iIB];
+    UINT IndexBytes = ( pHeader->IndexType == IT_32BIT ) ? 4 : 2;
+    if( pHeader->NumIndices * IndexBytes > pHeader->SizeBytes )
+        return E_FAIL;
+
+    HRESULT hr;
+    V_RETURN( m_pGeometryPool->AllocateIndices( ( IndexBytes == 4 ) ? DXGI_FORMAT_R32_UINT : DXGI_FORMAT_R16_UINT,
+                                                ( UINT )pHeader->NumIndices, m_ppIndices[iIB], &m_IndexAllocations[iIB] ) );
+
+    pHeader->DataOffset = 0;
+    pHeader->pIB11 = m_IndexAllocations[iIB].pBuffer;
+    pHeader->pIB11->AddRef();
+    return S_OK;
+}
+
+
 //--------------------------------------------------------------------------------------
 _Use_decl_annotations_
 HRESULT CDXUTSDKMesh::CreateFromFile( ID3D11Device* pDev11,
@@ -178,15 +1102,50 @@ HRESULT CDXUTSDKMesh::CreateFromFile( ID3D11Device* pDev11,
                                       SDKMESH_CALLBACKS11* pLoaderCallbacks11 )
 {
     HRESULT hr = S_OK;
+    UINT cBytes = 0;
+
+    DXUTArchive_View view;
+    if( SUCCEEDED( DXUTFindArchiveFile( szFileName, view ) ) )
+    {
+        // Keep the archive relative path so that materials resolve into the archive too
+        wcscpy_s( m_strPathW, MAX_PATH, szFileName );
+
+        cBytes = ( UINT )view.Bytes;
+        m_pStaticMeshData = view.Detach();
+        if( !m_pStaticMeshData )
+            return E_OUTOFMEMORY;
+    }
+    else
+    {
+        // Find the path for the file
+        V_RETURN( DXUTFindDXSDKMediaFileCch( m_strPathW, sizeof( m_strPathW ) / sizeof( WCHAR ), szFileName ) );
+
+        // Open the file
+        m_hFile = CreateFile( m_strPathW, FILE_READ_DATA, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN,
+                              nullptr );
+        if( INVALID_HANDLE_VALUE == m_hFile )
+            return DXUTERR_MEDIANOTFOUND;
+
+        // Get the file size
+        LARGE_INTEGER FileSize;
+        GetFileSizeEx( m_hFile, &FileSize );
+        cBytes = FileSize.LowPart;
+
+        // Allocate memory
+        m_pStaticMeshData = new (std::nothrow) BYTE[ cBytes ];
+        if( !m_pStaticMeshData )
+        {
+            CloseHandle( m_hFile );
+            return E_OUTOFMEMORY;
+        }
 
-    // Find the path for the file
-    V_RETURN( DXUTFindDXSDKMediaFileCch( m_strPathW, sizeof( m_strPathW ) / sizeof( WCHAR ), szFileName ) );
+        // Read in the file
+        DWORD dwBytesRead;
+        if( !ReadFile( m_hFile, m_pStaticMeshData, cBytes, &dwBytesRead, nullptr ) )
+            hr = E_FAIL;
 
-    // Open the file
-    m_hFile = CreateFile( m_strPathW, FILE_READ_DATA, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN,
-                          nullptr );
-    if( INVALID_HANDLE_VALUE == m_hFile )
-        return DXUTERR_MEDIANOTFOUND;
+        CloseHandle( m_hFile );
+    }
 
     // Change the path to just the directory
     WCHAR* pLastBSlash = wcsrchr( m_strPathW, L'\\' );
@@ -197,26 +1156,6 @@ HRESULT CDXUTSDKMesh::CreateFromFile( ID3D11Device* pDev11,
 
     WideCharToMultiByte( CP_ACP, 0, m_strPathW, -1, m_strPath, MAX_PATH, nullptr, FALSE );
 
-    // Get the file size
-    LARGE_INTEGER FileSize;
-    GetFileSizeEx( m_hFile, &FileSize );
-    UINT cBytes = FileSize.LowPart;
-
-    // Allocate memory
-    m_pStaticMeshData = new (std::nothrow) BYTE[ cBytes ];
-    if( !m_pStaticMeshData )
-    {
-        CloseHandle( m_hFile );
-        return E_OUTOFMEMORY;
-    }
-
-    // Read in the file
-    DWORD dwBytesRead;
-    if( !ReadFile( m_hFile, m_pStaticMeshData, cBytes, &dwBytesRead, nullptr ) )
-        hr = E_FAIL;
-
-    CloseHandle( m_hFile );
-
     if( SUCCEEDED( hr ) )
     {
         hr = CreateFromMemory( pDev11,
@@ -304,7 +1243,7 @@ HRESULT CDXUTSDKMesh::CreateFromMemory( ID3D11Device* pDev11,
     // Get the start of the buffer data
     UINT64 BufferDataStart = m_pMeshHeader->HeaderSize + m_pMeshHeader->NonBufferDataSize;
 
-    // Create VBs
+    // Setup VB data pointers
     m_ppVertices = new (std::nothrow) BYTE*[m_pMeshHeader->NumVertexBuffers];
     if ( !m_ppVertices )
     {
@@ -313,41 +1252,127 @@ HRESULT CDXUTSDKMesh::CreateFromMemory( ID3D11Device* pDev11,
     }
     for( UINT i = 0; i < m_pMeshHeader->NumVertexBuffers; i++ )
     {
-        BYTE* pVertices = nullptr;
-        pVertices = ( BYTE* )( pBufferData + ( m_pVertexBufferArray[i].DataOffset - BufferDataStart ) );
-
-        if( pDev11 )
-            CreateVertexBuffer( pDev11, &m_pVertexBufferArray[i], pVertices, pLoaderCallbacks11 );
-
-        m_ppVertices[i] = pVertices;
+        m_ppVertices[i] = ( BYTE* )( pBufferData + ( m_pVertexBufferArray[i].DataOffset - BufferDataStart ) );
     }
 
-    // Create IBs
+    // Setup IB data pointers
     m_ppIndices = new (std::nothrow) BYTE*[m_pMeshHeader->NumIndexBuffers];
     if ( !m_ppIndices )
     {
         hr = E_OUTOFMEMORY;
         goto Error;
     }
-
     for( UINT i = 0; i < m_pMeshHeader->NumIndexBuffers; i++ )
     {
-        BYTE* pIndices = nullptr;
-        pIndices = ( BYTE* )( pBufferData + ( m_pIndexBufferArray[i].DataOffset - BufferDataStart ) );
+        m_ppIndices[i] = ( BYTE* )( pBufferData + ( m_pIndexBufferArray[i].DataOffset - BufferDataStart ) );
+    }
+
+    // Quantize and optimize the buffer data before any buffers are created from it
+    ZeroMemory( &m_OptimizeStats, sizeof( m_OptimizeStats ) );
+    ZeroMemory( &m_QuantizeStats, sizeof( m_QuantizeStats ) );
+    if( m_bOptimizeOnLoad || m_bQuantizeOnLoad )
+    {
+        SDKMESH_BUFFER_VIEW view;
+        view.pHeader = m_pMeshHeader;
+        view.pVertexBufferArray = m_pVertexBufferArray;
+        view.pIndexBufferArray = m_pIndexBufferArray;
+        view.pMeshArray = m_pMeshArray;
+        view.pSubsetArray = m_pSubsetArray;
+        for( UINT i = 0; i < m_pMeshHeader->NumMeshes; i++ )
+            view.meshSubsets.push_back( m_pMeshArray[i].pSubsets );
+        view.vertices.assign( m_ppVertices, m_ppVertices + m_pMeshHeader->NumVertexBuffers );
+        view.indices.assign( m_ppIndices, m_ppIndices + m_pMeshHeader->NumIndexBuffers );
+
+        if( m_bQuantizeOnLoad )
+        {
+            hr = QuantizeSDKMeshBuffers( view, &m_QuantizeStats );
+            if( FAILED( hr ) )
+                goto Error;
+        }
+
+        if( m_bOptimizeOnLoad )
+        {
+            hr = OptimizeSDKMeshBuffers( view, SDKMESH_DEFAULT_VCACHE_SIZE, &m_OptimizeStats );
+            if( FAILED( hr ) )
+                goto Error;
+
+            DXUTOutputDebugString( L"DXUT: optimized %llu triangles, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f\n",
+                                   m_OptimizeStats.NumTriangles, m_OptimizeStats.ACMRBefore, m_OptimizeStats.ACMRAfter,
+                                   m_OptimizeStats.ATVRBefore, m_OptimizeStats.ATVRAfter );
+        }
+    }
+
+    // Buffers the pool cannot take get a buffer of their own
+    bool bPooled = ( pDev11 && m_pGeometryPool
+                     && !( pLoaderCallbacks11 && ( pLoaderCallbacks11->pCreateVertexBuffer || pLoaderCallbacks11->pCreateIndexBuffer ) ) );
+    if( bPooled )
+    {
+        DXUT_GEOMETRY_ALLOCATION none = {};
+        m_VertexAllocations.assign( m_pMeshHeader->NumVertexBuffers, none );
+        m_IndexAllocations.assign( m_pMeshHeader->NumIndexBuffers, none );
+    }
 
-        if( pDev11 )
-            CreateIndexBuffer( pDev11, &m_pIndexBufferArray[i], pIndices, pLoaderCallbacks11 );
+    // Create VBs
+    if( pDev11 )
+    {
+        for( UINT i = 0; i < m_pMeshHeader->NumVertexBuffers; i++ )
+        {
+            if( !bPooled || FAILED( AllocatePooledVertexBuffer( i ) ) )
+                CreateVertexBuffer( pDev11, &m_pVertexBufferArray[i], m_ppVertices[i], pLoaderCallbacks11 );
+        }
+    }
 
-        m_ppIndices[i] = pIndices;
+    // Create IBs
+    if( pDev11 )
+    {
+        for( UINT i = 0; i < m_pMeshHeader->NumIndexBuffers; i++ )
+        {
+            if( !bPooled || FAILED( AllocatePooledIndexBuffer( i ) ) )
+                CreateIndexBuffer( pDev11, &m_pIndexBufferArray[i], m_ppIndices[i], pLoaderCallbacks11 );
+        }
     }
 
     // Load Materials
     if( pDev11 )
         LoadMaterials( pDev11, m_pMaterialArray, m_pMeshHeader->NumMaterials, pLoaderCallbacks11 );
 
+    // Build the render records
+    m_SubsetDraws.resize( m_pMeshHeader->NumTotalSubsets );
+    for( UINT i = 0; i < m_pMeshHeader->NumTotalSubsets; i++ )
+    {
+        const SDKMESH_SUBSET& subset = m_pSubsetArray[i];
+        SDKMESH_SUBSET_DRAW& draw = m_SubsetDraws[i];
+        draw.MaterialID = subset.MaterialID;
+        draw.IndexCount = ( UINT )subset.IndexCount;
+        draw.IndexStart = ( UINT )subset.IndexStart;
+        draw.VertexStart = ( UINT )subset.VertexStart;
+        draw.Topology = GetPrimitiveType11( ( SDKMESH_PRIMITIVE_TYPE )subset.PrimitiveType );
+
+        switch( draw.Topology )
+        {
+        case D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST:
+            draw.TopologyAdj = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST_ADJ;
+            break;
+        case D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP:
+            draw.TopologyAdj = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP_ADJ;
+            break;
+        case D3D11_PRIMITIVE_TOPOLOGY_LINELIST:
+            draw.TopologyAdj = D3D11_PRIMITIVE_TOPOLOGY_LINELIST_ADJ;
+            break;
+        case D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP:
+            draw.TopologyAdj = D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP_ADJ;
+            break;
+        default:
+            draw.TopologyAdj = draw.Topology;
+            break;
+        }
+    }
+    UpdateMaterialBindings();
+
     // Create a place to store our bind pose frame matrices
     m_pBindPoseFrameMatrices = new (std::nothrow) XMFLOAT4X4[ m_pMeshHeader->NumFrames ];
-    if( !m_pBindPoseFrameMatrices )
+    m_pInvBindPoseFrameMatrices = new (std::nothrow) XMFLOAT4X4[ m_pMeshHeader->NumFrames ];
+    if( !m_pBindPoseFrameMatrices || !m_pInvBindPoseFrameMatrices )
     {
         hr = E_OUTOFMEMORY;
         goto Error;
@@ -378,6 +1403,11 @@ HRESULT CDXUTSDKMesh::CreateFromMemory( ID3D11Device* pDev11,
         lower.x = FLT_MAX; lower.y = FLT_MAX; lower.z = FLT_MAX;
         upper.x = -FLT_MAX; upper.y = -FLT_MAX; upper.z = -FLT_MAX;
         currentMesh = GetMesh( meshi );
+
+        // Quantized positions are relative to the stored bounding box, keep it
+        if( IsMeshPositionQuantized( meshi ) )
+            continue;
+
         INT indsize;
         if (m_pIndexBufferArray[currentMesh->IndexBuffer].IndexType == IT_16BIT ) {
             indsize = 2;
@@ -482,6 +1512,7 @@ void CDXUTSDKMesh::TransformBindPoseFrame( UINT iFrame, CXMMATRIX parentWorld )
     XMMATRIX m = XMLoadFloat4x4( &m_pFrameArray[iFrame].Matrix );
     XMMATRIX mLocalWorld = XMMatrixMultiply( m, parentWorld );
     XMStoreFloat4x4( &m_pBindPoseFrameMatrices[iFrame], mLocalWorld );
+    XMStoreFloat4x4( &m_pInvBindPoseFrameMatrices[iFrame], XMMatrixInverse( nullptr, mLocalWorld ) );
 
     // Transform our siblings
     if( m_pFrameArray[iFrame].SiblingFrame != INVALID_FRAME )
@@ -581,104 +1612,120 @@ void CDXUTSDKMesh::TransformFrameAbsolute( UINT iFrame, double fTime )
 
 #define MAX_D3D11_VERTEX_STREAMS D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT
 
+//--------------------------------------------------------------------------------------
+// Pooled meshes with one stream draw with a base vertex, so consecutive meshes in the same
+// page keep their binding; with several streams each stream is offset instead
 //--------------------------------------------------------------------------------------
 _Use_decl_annotations_
-void CDXUTSDKMesh::RenderMesh( UINT iMesh,
-                               bool bAdjacent,
-                               ID3D11DeviceContext* pd3dDeviceContext,
-                               UINT iDiffuseSlot,
-                               UINT iNormalSlot,
-                               UINT iSpecularSlot )
+HRESULT CDXUTSDKMesh::GetMeshGeometry11( UINT iMesh, bool bAdjacent, SDKMESH_MESH_GEOMETRY* pGeometry ) const
 {
-    if( 0 < GetOutstandingBufferResources() )
-        return;
+    if( !pGeometry || !m_pMeshHeader || iMesh >= m_pMeshHeader->NumMeshes )
+        return E_INVALIDARG;
 
     auto pMesh = &m_pMeshArray[iMesh];
-
-    UINT Strides[MAX_D3D11_VERTEX_STREAMS];
-    UINT Offsets[MAX_D3D11_VERTEX_STREAMS];
-    ID3D11Buffer* pVB[MAX_D3D11_VERTEX_STREAMS];
-
     if( pMesh->NumVertexBuffers > MAX_D3D11_VERTEX_STREAMS )
-        return;
+        return E_FAIL;
 
-    for( UINT64 i = 0; i < pMesh->NumVertexBuffers; i++ )
+    pGeometry->NumVertexBuffers = UINT( pMesh->NumVertexBuffers );
+    pGeometry->BaseVertex = 0;
+    for( UINT i = 0; i < pGeometry->NumVertexBuffers; i++ )
     {
-        pVB[i] = m_pVertexBufferArray[ pMesh->VertexBuffers[i] ].pVB11;
-        Strides[i] = ( UINT )m_pVertexBufferArray[ pMesh->VertexBuffers[i] ].StrideBytes;
-        Offsets[i] = 0;
+        pGeometry->pVB[i] = m_pVertexBufferArray[ pMesh->VertexBuffers[i] ].pVB11;
+        pGeometry->Strides[i] = ( UINT )m_pVertexBufferArray[ pMesh->VertexBuffers[i] ].StrideBytes;
+        pGeometry->Offsets[i] = 0;
+
+        UINT VertexBase = GetVertexBufferBase( pMesh->VertexBuffers[i] );
+        if( pGeometry->NumVertexBuffers == 1 )
+            pGeometry->BaseVertex = INT( VertexBase );
+        else
+            pGeometry->Offsets[i] = VertexBase * pGeometry->Strides[i];
     }
 
-    SDKMESH_INDEX_BUFFER_HEADER* pIndexBufferArray;
+    const SDKMESH_INDEX_BUFFER_HEADER* pIndexBufferArray;
     if( bAdjacent )
         pIndexBufferArray = m_pAdjacencyIndexBufferArray;
     else
         pIndexBufferArray = m_pIndexBufferArray;
 
-    auto pIB = pIndexBufferArray[ pMesh->IndexBuffer ].pIB11;
-    DXGI_FORMAT ibFormat = DXGI_FORMAT_R16_UINT;
+    pGeometry->pIB = pIndexBufferArray[ pMesh->IndexBuffer ].pIB11;
+    pGeometry->IBFormat = DXGI_FORMAT_R16_UINT;
     switch( pIndexBufferArray[ pMesh->IndexBuffer ].IndexType )
     {
     case IT_16BIT:
-        ibFormat = DXGI_FORMAT_R16_UINT;
+        pGeometry->IBFormat = DXGI_FORMAT_R16_UINT;
         break;
     case IT_32BIT:
-        ibFormat = DXGI_FORMAT_R32_UINT;
+        pGeometry->IBFormat = DXGI_FORMAT_R32_UINT;
         break;
     };
 
-    pd3dDeviceContext->IASetVertexBuffers( 0, pMesh->NumVertexBuffers, pVB, Strides, Offsets );
-    pd3dDeviceContext->IASetIndexBuffer( pIB, ibFormat, 0 );
+    // Adjacency index buffers are never pooled
+    pGeometry->BaseIndex = bAdjacent ? 0 : GetIndexBufferBase( pMesh->IndexBuffer );
 
-    SDKMESH_SUBSET* pSubset = nullptr;
-    SDKMESH_MATERIAL* pMat = nullptr;
-    D3D11_PRIMITIVE_TOPOLOGY PrimType;
+    return S_OK;
+}
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+void CDXUTSDKMesh::RenderMesh( UINT iMesh,
+                               bool bAdjacent,
+                               ID3D11DeviceContext* pd3dDeviceContext,
+                               UINT iDiffuseSlot,
+                               UINT iNormalSlot,
+                               UINT iSpecularSlot,
+                               DXUT_GEOMETRY_BIND_CACHE* pBindCache )
+{
+    if( 0 < GetOutstandingBufferResources() )
+        return;
+
+    auto pMesh = &m_pMeshArray[iMesh];
+
+    SDKMESH_MESH_GEOMETRY geometry;
+    if( FAILED( GetMeshGeometry11( iMesh, bAdjacent, &geometry ) ) )
+        return;
+
+    UINT nBinds = DXUTSetGeometryBuffers( pd3dDeviceContext, geometry.NumVertexBuffers, geometry.pVB, geometry.Strides,
+                                          geometry.Offsets, geometry.pIB, geometry.IBFormat, pBindCache );
+
+    if( m_bMaterialBindingsPending )
+        UpdateMaterialBindings();
+
+    D3D11_PRIMITIVE_TOPOLOGY LastPrimType = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+    UINT LastMaterialID = UINT( -1 );
 
     for( UINT subset = 0; subset < pMesh->NumSubsets; subset++ )
     {
-        pSubset = &m_pSubsetArray[ pMesh->pSubsets[subset] ];
+        const SDKMESH_SUBSET_DRAW& draw = m_SubsetDraws[ pMesh->pSubsets[subset] ];
 
-        PrimType = GetPrimitiveType11( ( SDKMESH_PRIMITIVE_TYPE )pSubset->PrimitiveType );
-        if( bAdjacent )
+        // Subsets of a mesh are often sorted by material, so most state carries over
+        D3D11_PRIMITIVE_TOPOLOGY PrimType = bAdjacent ? draw.TopologyAdj : draw.Topology;
+        if( PrimType != LastPrimType )
         {
-            switch( PrimType )
-            {
-            case D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST:
-                PrimType = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST_ADJ;
-                break;
-            case D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP:
-                PrimType = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP_ADJ;
-                break;
-            case D3D11_PRIMITIVE_TOPOLOGY_LINELIST:
-                PrimType = D3D11_PRIMITIVE_TOPOLOGY_LINELIST_ADJ;
-                break;
-            case D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP:
-                PrimType = D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP_ADJ;
-                break;
-            }
+            pd3dDeviceContext->IASetPrimitiveTopology( PrimType );
+            LastPrimType = PrimType;
+            nBinds++;
         }
 
-        pd3dDeviceContext->IASetPrimitiveTopology( PrimType );
-
-        pMat = &m_pMaterialArray[ pSubset->MaterialID ];
-        if( iDiffuseSlot != INVALID_SAMPLER_SLOT && !IsErrorResource( pMat->pDiffuseRV11 ) )
-            pd3dDeviceContext->PSSetShaderResources( iDiffuseSlot, 1, &pMat->pDiffuseRV11 );
-        if( iNormalSlot != INVALID_SAMPLER_SLOT && !IsErrorResource( pMat->pNormalRV11 ) )
-            pd3dDeviceContext->PSSetShaderResources( iNormalSlot, 1, &pMat->pNormalRV11 );
-        if( iSpecularSlot != INVALID_SAMPLER_SLOT && !IsErrorResource( pMat->pSpecularRV11 ) )
-            pd3dDeviceContext->PSSetShaderResources( iSpecularSlot, 1, &pMat->pSpecularRV11 );
+        if( draw.MaterialID != LastMaterialID && draw.MaterialID < m_MaterialBindings.size() )
+        {
+            LastMaterialID = draw.MaterialID;
+            nBinds += BindMaterial11( pd3dDeviceContext, m_MaterialBindings[ draw.MaterialID ],
+                                      iDiffuseSlot, iNormalSlot, iSpecularSlot );
+        }
 
-        UINT IndexCount = ( UINT )pSubset->IndexCount;
-        UINT IndexStart = ( UINT )pSubset->IndexStart;
-        UINT VertexStart = ( UINT )pSubset->VertexStart;
+        UINT IndexCount = draw.IndexCount;
+        UINT IndexStart = draw.IndexStart;
         if( bAdjacent )
         {
             IndexCount *= 2;
             IndexStart *= 2;
         }
 
-        pd3dDeviceContext->DrawIndexed( IndexCount, IndexStart, VertexStart );
+        pd3dDeviceContext->DrawIndexed( IndexCount, geometry.BaseIndex + IndexStart, geometry.BaseVertex + INT( draw.VertexStart ) );
     }
+
+    DXUTCountAPICalls( DXUT_API_BIND, nBinds );
+    DXUTCountAPICalls( DXUT_API_DRAW, pMesh->NumSubsets );
 }
 
 //--------------------------------------------------------------------------------------
@@ -688,7 +1735,8 @@ void CDXUTSDKMesh::RenderFrame( UINT iFrame,
                                 ID3D11DeviceContext* pd3dDeviceContext,
                                 UINT iDiffuseSlot,
                                 UINT iNormalSlot,
-                                UINT iSpecularSlot )
+                                UINT iSpecularSlot,
+                                DXUT_GEOMETRY_BIND_CACHE* pBindCache )
 {
     if( !m_pStaticMeshData || !m_pFrameArray )
         return;
@@ -700,18 +1748,19 @@ void CDXUTSDKMesh::RenderFrame( UINT iFrame,
                     pd3dDeviceContext,
                     iDiffuseSlot,
                     iNormalSlot,
-                    iSpecularSlot );
+                    iSpecularSlot,
+                    pBindCache );
     }
 
     // Render our children
     if( m_pFrameArray[iFrame].ChildFrame != INVALID_FRAME )
         RenderFrame( m_pFrameArray[iFrame].ChildFrame, bAdjacent, pd3dDeviceContext, iDiffuseSlot, 
-                     iNormalSlot, iSpecularSlot );
+                     iNormalSlot, iSpecularSlot, pBindCache );
 
     // Render our siblings
     if( m_pFrameArray[iFrame].SiblingFrame != INVALID_FRAME )
         RenderFrame( m_pFrameArray[iFrame].SiblingFrame, bAdjacent, pd3dDeviceContext, iDiffuseSlot, 
-                     iNormalSlot, iSpecularSlot );
+                     iNormalSlot, iSpecularSlot, pBindCache );
 }
 
 //--------------------------------------------------------------------------------------
@@ -728,10 +1777,18 @@ CDXUTSDKMesh::CDXUTSDKMesh() : m_NumOutstandingResources( 0 ),
                                m_ppVertices( nullptr ),
                                m_ppIndices( nullptr ),
                                m_pBindPoseFrameMatrices( nullptr ),
+                               m_pInvBindPoseFrameMatrices( nullptr ),
+                               m_bBindPoseSet( false ),
                                m_pTransformedFrameMatrices( nullptr ),
                                m_pWorldPoseFrameMatrices( nullptr ),
-                               m_pDev11( nullptr )
+                               m_pDev11( nullptr ),
+                               m_bOptimizeOnLoad( false ),
+                               m_bQuantizeOnLoad( false ),
+                               m_bMaterialBindingsPending( false ),
+                               m_pGeometryPool( nullptr )
 {
+    ZeroMemory( &m_OptimizeStats, sizeof( m_OptimizeStats ) );
+    ZeroMemory( &m_QuantizeStats, sizeof( m_QuantizeStats ) );
 }
 
 
@@ -763,37 +1820,51 @@ HRESULT CDXUTSDKMesh::LoadAnimation( _In_z_ const WCHAR* szFileName )
     DWORD dwBytesRead = 0;
     LARGE_INTEGER liMove;
     WCHAR strPath[MAX_PATH];
+    HANDLE hFile = INVALID_HANDLE_VALUE;
 
-    // Find the path for the file
-    V_RETURN( DXUTFindDXSDKMediaFileCch( strPath, MAX_PATH, szFileName ) );
-
-    // Open the file
-    HANDLE hFile = CreateFile( strPath, FILE_READ_DATA, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
-                               FILE_FLAG_SEQUENTIAL_SCAN, nullptr );
-    if( INVALID_HANDLE_VALUE == hFile )
-        return DXUTERR_MEDIANOTFOUND;
-
-    /////////////////////////
-    // Header
-    SDKANIMATION_FILE_HEADER fileheader;
-    if( !ReadFile( hFile, &fileheader, sizeof( SDKANIMATION_FILE_HEADER ), &dwBytesRead, nullptr ) )
-        goto Error;
-
-    //allocate
-    m_pAnimationData = new (std::nothrow) BYTE[ ( size_t )( sizeof( SDKANIMATION_FILE_HEADER ) + fileheader.AnimationDataSize ) ];
-    if( !m_pAnimationData )
+    DXUTArchive_View view;
+    if( SUCCEEDED( DXUTFindArchiveFile( szFileName, view ) ) )
     {
-        hr = E_OUTOFMEMORY;
-        goto Error;
+        if( view.Bytes < sizeof( SDKANIMATION_FILE_HEADER ) )
+            return E_FAIL;
+
+        m_pAnimationData = view.Detach();
+        if( !m_pAnimationData )
+            return E_OUTOFMEMORY;
     }
+    else
+    {
+        // Find the path for the file
+        V_RETURN( DXUTFindDXSDKMediaFileCch( strPath, MAX_PATH, szFileName ) );
+
+        // Open the file
+        hFile = CreateFile( strPath, FILE_READ_DATA, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_FLAG_SEQUENTIAL_SCAN, nullptr );
+        if( INVALID_HANDLE_VALUE == hFile )
+            return DXUTERR_MEDIANOTFOUND;
+
+        /////////////////////////
+        // Header
+        SDKANIMATION_FILE_HEADER fileheader;
+        if( !ReadFile( hFile, &fileheader, sizeof( SDKANIMATION_FILE_HEADER ), &dwBytesRead, nullptr ) )
+            goto Error;
+
+        //allocate
+        m_pAnimationData = new (std::nothrow) BYTE[ ( size_t )( sizeof( SDKANIMATION_FILE_HEADER ) + fileheader.AnimationDataSize ) ];
+        if( !m_pAnimationData )
+        {
+            hr = E_OUTOFMEMORY;
+            goto Error;
+        }
 
-    // read it all in
-    liMove.QuadPart = 0;
-    if( !SetFilePointerEx( hFile, liMove, nullptr, FILE_BEGIN ) )
-        goto Error;
-    if( !ReadFile( hFile, m_pAnimationData, ( DWORD )( sizeof( SDKANIMATION_FILE_HEADER ) +
-                                                       fileheader.AnimationDataSize ), &dwBytesRead, nullptr ) )
-        goto Error;
+        // read it all in
+        liMove.QuadPart = 0;
+        if( !SetFilePointerEx( hFile, liMove, nullptr, FILE_BEGIN ) )
+            goto Error;
+        if( !ReadFile( hFile, m_pAnimationData, ( DWORD )( sizeof( SDKANIMATION_FILE_HEADER ) +
+                                                           fileheader.AnimationDataSize ), &dwBytesRead, nullptr ) )
+            goto Error;
+    }
 
     // pointer fixup
     m_pAnimationHeader = ( SDKANIMATION_FILE_HEADER* )m_pAnimationData;
@@ -814,7 +1885,8 @@ HRESULT CDXUTSDKMesh::LoadAnimation( _In_z_ const WCHAR* szFileName )
 
     hr = S_OK;
 Error:
-    CloseHandle( hFile );
+    if( hFile != INVALID_HANDLE_VALUE )
+        CloseHandle( hFile );
     return hr;
 }
 
@@ -856,6 +1928,14 @@ void CDXUTSDKMesh::Destroy()
                 }
             }
         }
+        if( m_pGeometryPool )
+        {
+            for( auto it = m_VertexAllocations.cbegin(); it != m_VertexAllocations.cend(); ++it )
+                m_pGeometryPool->Free( *it );
+            for( auto it = m_IndexAllocations.cbegin(); it != m_IndexAllocations.cend(); ++it )
+                m_pGeometryPool->Free( *it );
+        }
+
         for( UINT64 i = 0; i < m_pMeshHeader->NumVertexBuffers; i++ )
         {
             SAFE_RELEASE( m_pVertexBufferArray[i].pVB11 );
@@ -880,6 +1960,8 @@ void CDXUTSDKMesh::Destroy()
     m_pStaticMeshData = nullptr;
     SAFE_DELETE_ARRAY( m_pAnimationData );
     SAFE_DELETE_ARRAY( m_pBindPoseFrameMatrices );
+    SAFE_DELETE_ARRAY( m_pInvBindPoseFrameMatrices );
+    m_bBindPoseSet = false;
     SAFE_DELETE_ARRAY( m_pTransformedFrameMatrices );
     SAFE_DELETE_ARRAY( m_pWorldPoseFrameMatrices );
 
@@ -897,6 +1979,110 @@ void CDXUTSDKMesh::Destroy()
     m_pAnimationHeader = nullptr;
     m_pAnimationFrameData = nullptr;
 
+    ReleaseMaterialBindings();
+    m_SubsetDraws.clear();
+    m_bMaterialBindingsPending = false;
+    m_VertexAllocations.clear();
+    m_IndexAllocations.clear();
+}
+
+
+//--------------------------------------------------------------------------------------
+void CDXUTSDKMesh::ReleaseMaterialBindings()
+{
+    for( auto it = m_MaterialBindings.begin(); it != m_MaterialBindings.end(); ++it )
+    {
+        for( UINT i = 0; i < 3; i++ )
+            SAFE_RELEASE( it->pSRVs[i] );
+    }
+    m_MaterialBindings.clear();
+}
+
+
+//--------------------------------------------------------------------------------------
+// Copies each material's views into a contiguous binding record, which holds a reference
+// to each so a view released and replaced in the material is never bound after it is
+// freed.  While the mesh is marked as loading, textures the loader callbacks have not
+// created yet are picked up by a later call from RenderMesh, with one more call once
+// loading ends.  A texture a callback left null on a mesh that is not loading has failed,
+// and stays unbound.
+//--------------------------------------------------------------------------------------
+void CDXUTSDKMesh::UpdateMaterialBindings()
+{
+    m_bMaterialBindingsPending = false;
+    if( !m_pMeshHeader || m_MaterialBindings.size() != m_pMeshHeader->NumMaterials )
+        ReleaseMaterialBindings();
+    if( !m_pMeshHeader )
+        return;
+
+    // New records start with no views
+    m_MaterialBindings.resize( m_pMeshHeader->NumMaterials );
+    for( UINT m = 0; m < m_pMeshHeader->NumMaterials; m++ )
+    {
+        const SDKMESH_MATERIAL& material = m_pMaterialArray[m];
+        ID3D11ShaderResourceView* const pViews[3] = { material.pDiffuseRV11, material.pNormalRV11, material.pSpecularRV11 };
+        const char* const pNames[3] = { material.DiffuseTexture, material.NormalTexture, material.SpecularTexture };
+
+        SDKMESH_MATERIAL_BINDING& binding = m_MaterialBindings[m];
+        binding.ValidMask = 0;
+        for( UINT i = 0; i < 3; i++ )
+        {
+            // Reference the new view before releasing the old one, which may be the same
+            ID3D11ShaderResourceView* pView = IsErrorResource( pViews[i] ) ? nullptr : pViews[i];
+            if( pView )
+                pView->AddRef();
+            SAFE_RELEASE( binding.pSRVs[i] );
+            binding.pSRVs[i] = pView;
+
+            if( IsErrorResource( pViews[i] ) )
+                continue;
+
+            binding.ValidMask |= ( 1 << i );
+
+            if( m_bLoading && m_pDev11 && !pViews[i] && pNames[i][0] != 0 )
+                m_bMaterialBindingsPending = true;
+        }
+    }
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+const SDKMESH_MATERIAL_BINDING* CDXUTSDKMesh::GetMaterialBinding( UINT iMaterial )
+{
+    if( m_bMaterialBindingsPending )
+        UpdateMaterialBindings();
+
+    return ( iMaterial < m_MaterialBindings.size() ) ? &m_MaterialBindings[iMaterial] : nullptr;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+UINT CDXUTSDKMesh::BindMaterial11( ID3D11DeviceContext* pd3dDeviceContext, const SDKMESH_MATERIAL_BINDING& binding,
+                                   UINT iDiffuseSlot, UINT iNormalSlot, UINT iSpecularSlot )
+{
+    // Diffuse, normal and specular go in one call when the slots are consecutive
+    if( iDiffuseSlot != INVALID_SAMPLER_SLOT
+        && iNormalSlot == iDiffuseSlot + 1
+        && iSpecularSlot == iDiffuseSlot + 2
+        && binding.ValidMask == SDKMESH_BIND_ALL )
+    {
+        pd3dDeviceContext->PSSetShaderResources( iDiffuseSlot, 3, binding.pSRVs );
+        return 1;
+    }
+
+    const UINT Slots[3] = { iDiffuseSlot, iNormalSlot, iSpecularSlot };
+    UINT nBinds = 0;
+    for( UINT i = 0; i < 3; i++ )
+    {
+        if( Slots[i] != INVALID_SAMPLER_SLOT && ( binding.ValidMask & ( 1 << i ) ) )
+        {
+            pd3dDeviceContext->PSSetShaderResources( Slots[i], 1, &binding.pSRVs[i] );
+            nBinds++;
+        }
+    }
+    return nBinds;
 }
 
 
@@ -908,15 +2094,20 @@ void CDXUTSDKMesh::TransformMesh( CXMMATRIX world, double fTime )
 {
     if( !m_pAnimationHeader || FTT_RELATIVE == m_pAnimationHeader->FrameTransformType )
     {
+        if( !m_bBindPoseSet )
+        {
+            DXUTTRACE( L"CDXUTSDKMesh::TransformMesh: call TransformBindPose first\n" );
+            return;
+        }
+
         TransformFrame( 0, world, fTime );
 
         // For each frame, move the transform to the bind pose, then
         // move it to the final position
         for( UINT i = 0; i < m_pMeshHeader->NumFrames; i++ )
         {
-            XMMATRIX m = XMLoadFloat4x4( &m_pBindPoseFrameMatrices[i] );
-            XMMATRIX mInvBindPose = XMMatrixInverse( nullptr, m );
-            m = XMLoadFloat4x4( &m_pTransformedFrameMatrices[i] );
+            XMMATRIX mInvBindPose = XMLoadFloat4x4( &m_pInvBindPoseFrameMatrices[i] );
+            XMMATRIX m = XMLoadFloat4x4( &m_pTransformedFrameMatrices[i] );
             XMMATRIX mFinal = mInvBindPose * m;
             XMStoreFloat4x4( &m_pTransformedFrameMatrices[i], mFinal );
         }
@@ -934,9 +2125,14 @@ _Use_decl_annotations_
 void CDXUTSDKMesh::Render( ID3D11DeviceContext* pd3dDeviceContext,
                            UINT iDiffuseSlot,
                            UINT iNormalSlot,
-                           UINT iSpecularSlot )
+                           UINT iSpecularSlot,
+                           DXUT_GEOMETRY_BIND_CACHE* pBindCache )
 {
-    RenderFrame( 0, false, pd3dDeviceContext, iDiffuseSlot, iNormalSlot, iSpecularSlot );
+    // Without the caller's cache the input assembler state is unknown on entry and may be
+    // changed by the caller after
+    DXUT_GEOMETRY_BIND_CACHE localCache;
+    RenderFrame( 0, false, pd3dDeviceContext, iDiffuseSlot, iNormalSlot, iSpecularSlot,
+                 pBindCache ? pBindCache : &localCache );
 }
 
 //--------------------------------------------------------------------------------------
@@ -944,9 +2140,12 @@ _Use_decl_annotations_
 void CDXUTSDKMesh::RenderAdjacent( ID3D11DeviceContext* pd3dDeviceContext,
                                    UINT iDiffuseSlot,
                                    UINT iNormalSlot,
-                                   UINT iSpecularSlot )
+                                   UINT iSpecularSlot,
+                                   DXUT_GEOMETRY_BIND_CACHE* pBindCache )
 {
-    RenderFrame( 0, true, pd3dDeviceContext, iDiffuseSlot, iNormalSlot, iSpecularSlot );
+    DXUT_GEOMETRY_BIND_CACHE localCache;
+    RenderFrame( 0, true, pd3dDeviceContext, iDiffuseSlot, iNormalSlot, iSpecularSlot,
+                 pBindCache ? pBindCache : &localCache );
 }
 
 
@@ -1023,6 +2222,99 @@ ID3D11Buffer* CDXUTSDKMesh::GetAdjIB11( _In_ UINT iMesh ) const
     return m_pAdjacencyIndexBufferArray[ m_pMeshArray[ iMesh ].IndexBuffer ].pIB11;
 }
 
+//--------------------------------------------------------------------------------------
+namespace
+{
+
+DXGI_FORMAT GetDeclTypeFormat11( _In_ BYTE type )
+{
+    switch( type )
+    {
+    case D3DDECLTYPE_FLOAT1:    return DXGI_FORMAT_R32_FLOAT;
+    case D3DDECLTYPE_FLOAT2:    return DXGI_FORMAT_R32G32_FLOAT;
+    case D3DDECLTYPE_FLOAT3:    return DXGI_FORMAT_R32G32B32_FLOAT;
+    case D3DDECLTYPE_FLOAT4:    return DXGI_FORMAT_R32G32B32A32_FLOAT;
+    case D3DDECLTYPE_D3DCOLOR:  return DXGI_FORMAT_B8G8R8A8_UNORM;
+    case D3DDECLTYPE_UBYTE4:    return DXGI_FORMAT_R8G8B8A8_UINT;
+    case D3DDECLTYPE_SHORT2:    return DXGI_FORMAT_R16G16_SINT;
+    case D3DDECLTYPE_SHORT4:    return DXGI_FORMAT_R16G16B16A16_SINT;
+    case D3DDECLTYPE_UBYTE4N:   return DXGI_FORMAT_R8G8B8A8_UNORM;
+    case D3DDECLTYPE_SHORT2N:   return DXGI_FORMAT_R16G16_SNORM;
+    case D3DDECLTYPE_SHORT4N:   return DXGI_FORMAT_R16G16B16A16_SNORM;
+    case D3DDECLTYPE_USHORT2N:  return DXGI_FORMAT_R16G16_UNORM;
+    case D3DDECLTYPE_USHORT4N:  return DXGI_FORMAT_R16G16B16A16_UNORM;
+    case D3DDECLTYPE_UDEC3:     return DXGI_FORMAT_R10G10B10A2_UINT;
+    case D3DDECLTYPE_FLOAT16_2: return DXGI_FORMAT_R16G16_FLOAT;
+    case D3DDECLTYPE_FLOAT16_4: return DXGI_FORMAT_R16G16B16A16_FLOAT;
+    default:                    return DXGI_FORMAT_UNKNOWN;
+    }
+}
+
+LPCSTR GetDeclUsageSemantic( _In_ BYTE usage )
+{
+    switch( usage )
+    {
+    case D3DDECLUSAGE_POSITION:     return "POSITION";
+    case D3DDECLUSAGE_BLENDWEIGHT:  return "BLENDWEIGHT";
+    case D3DDECLUSAGE_BLENDINDICES: return "BLENDINDICES";
+    case D3DDECLUSAGE_NORMAL:       return "NORMAL";
+    case D3DDECLUSAGE_PSIZE:        return "PSIZE";
+    case D3DDECLUSAGE_TEXCOORD:     return "TEXCOORD";
+    case D3DDECLUSAGE_TANGENT:      return "TANGENT";
+    case D3DDECLUSAGE_BINORMAL:     return "BINORMAL";
+    case D3DDECLUSAGE_TESSFACTOR:   return "TESSFACTOR";
+    case D3DDECLUSAGE_POSITIONT:    return "POSITIONT";
+    case D3DDECLUSAGE_COLOR:        return "COLOR";
+    case D3DDECLUSAGE_FOG:          return "FOG";
+    case D3DDECLUSAGE_DEPTH:        return "DEPTH";
+    default:                        return nullptr;
+    }
+}
+
+}; // namespace
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTSDKMesh::GetInputLayoutDesc11( UINT iMesh, D3D11_INPUT_ELEMENT_DESC* pDesc, UINT* pNumElements ) const
+{
+    if( !pDesc || !pNumElements || iMesh >= m_pMeshHeader->NumMeshes )
+        return E_INVALIDARG;
+
+    const UINT capacity = *pNumElements;
+    UINT count = 0;
+
+    // Each vertex stream of the mesh goes into the input slot of the same index, matching
+    // the buffers bound by RenderMesh
+    const SDKMESH_MESH& mesh = m_pMeshArray[iMesh];
+    for( UINT slot = 0; slot < mesh.NumVertexBuffers && slot < MAX_VERTEX_STREAMS; slot++ )
+    {
+        const SDKMESH_VERTEX_BUFFER_HEADER& vb = m_pVertexBufferArray[ mesh.VertexBuffers[slot] ];
+        for( UINT i = 0; i < MAX_VERTEX_ELEMENTS && vb.Decl[i].Stream != 0xFF; i++ )
+        {
+            const D3DVERTEXELEMENT9& element = vb.Decl[i];
+            DXGI_FORMAT format = GetDeclTypeFormat11( element.Type );
+            LPCSTR semantic = GetDeclUsageSemantic( element.Usage );
+            if( format == DXGI_FORMAT_UNKNOWN || !semantic )
+                return E_FAIL;
+
+            if( count >= capacity )
+                return HRESULT_FROM_WIN32( ERROR_INSUFFICIENT_BUFFER );
+
+            D3D11_INPUT_ELEMENT_DESC& desc = pDesc[count++];
+            desc.SemanticName = semantic;
+            desc.SemanticIndex = element.UsageIndex;
+            desc.Format = format;
+            desc.InputSlot = slot;
+            desc.AlignedByteOffset = element.Offset;
+            desc.InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
+            desc.InstanceDataStepRate = 0;
+        }
+    }
+
+    *pNumElements = count;
+    return S_OK;
+}
+
 //--------------------------------------------------------------------------------------
 const char* CDXUTSDKMesh::GetMeshPathA() const
 {
@@ -1171,6 +2463,37 @@ XMVECTOR CDXUTSDKMesh::GetMeshBBoxExtents( _In_ UINT iMesh ) const
     return XMLoadFloat3( &m_pMeshArray[iMesh].BoundingBoxExtents );
 }
 
+//--------------------------------------------------------------------------------------
+bool CDXUTSDKMesh::IsMeshPositionQuantized( _In_ UINT iMesh ) const
+{
+    // Only the quantizer's marker counts; SHORT4N positions may also be authored that way
+    const SDKMESH_MESH& mesh = m_pMeshArray[iMesh];
+    if( !mesh.NumVertexBuffers
+        || memcmp( mesh.PositionQuantized, SDKMESH_POSITION_QUANTIZED, sizeof( mesh.PositionQuantized ) ) )
+        return false;
+
+    const SDKMESH_VERTEX_BUFFER_HEADER& vb = m_pVertexBufferArray[ mesh.VertexBuffers[0] ];
+    for( UINT i = 0; i < MAX_VERTEX_ELEMENTS && vb.Decl[i].Stream != 0xFF; i++ )
+    {
+        if( IsPositionElement( vb.Decl[i] ) )
+            return vb.Decl[i].Type == D3DDECLTYPE_SHORT4N;
+    }
+    return false;
+}
+
+//--------------------------------------------------------------------------------------
+// Maps SHORT4N positions in [-1,1] back onto the mesh bounding box
+//--------------------------------------------------------------------------------------
+XMMATRIX CDXUTSDKMesh::GetMeshDequantizeTransform( _In_ UINT iMesh ) const
+{
+    if( !IsMeshPositionQuantized( iMesh ) )
+        return XMMatrixIdentity();
+
+    const SDKMESH_MESH& mesh = m_pMeshArray[iMesh];
+    return XMMatrixScaling( mesh.BoundingBoxExtents.x, mesh.BoundingBoxExtents.y, mesh.BoundingBoxExtents.z )
+         * XMMatrixTranslation( mesh.BoundingBoxCenter.x, mesh.BoundingBoxCenter.y, mesh.BoundingBoxCenter.z );
+}
+
 //--------------------------------------------------------------------------------------
 UINT CDXUTSDKMesh::GetOutstandingResources() const
 {
@@ -1222,7 +2545,7 @@ bool CDXUTSDKMesh::CheckLoadDone()
 {
     if( 0 == GetOutstandingResources() )
     {
-        m_bLoading = false;
+        SetLoading( false );
         return true;
     }
 
@@ -1249,6 +2572,9 @@ bool CDXUTSDKMesh::IsLoading() const
 //--------------------------------------------------------------------------------------
 void CDXUTSDKMesh::SetLoading( _In_ bool bLoading )
 {
+    // Refresh the bindings with whatever the asynchronous loads have delivered so far
+    if( bLoading != m_bLoading )
+        m_bMaterialBindingsPending = true;
     m_bLoading = bLoading;
 }
 
@@ -1271,6 +2597,101 @@ XMMATRIX CDXUTSDKMesh::GetMeshInfluenceMatrix( _In_ UINT iMesh, _In_ UINT iInflu
     return XMLoadFloat4x4( &m_pTransformedFrameMatrices[iFrame] );
 }
 
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+UINT CDXUTSDKMesh::GetPaletteStride( SDKMESH_PALETTE_FORMAT format )
+{
+    switch( format )
+    {
+    case SDKMESH_PALETTE_FLOAT4X4:          return sizeof( XMFLOAT4X4 );
+    case SDKMESH_PALETTE_FLOAT3X4:          return 3 * sizeof( XMFLOAT4 );
+    case SDKMESH_PALETTE_DUAL_QUATERNION:   return 2 * sizeof( XMFLOAT4 );
+    default:                                return 0;
+    }
+}
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT CDXUTSDKMesh::GetMeshInfluencePalette( UINT iMesh, SDKMESH_PALETTE_FORMAT format, void* pPalette, size_t nPaletteBytes ) const
+{
+    UINT nStride = GetPaletteStride( format );
+    if( !pPalette || !nStride || !m_pMeshArray || iMesh >= m_pMeshHeader->NumMeshes )
+        return E_INVALIDARG;
+
+    const SDKMESH_MESH& mesh = m_pMeshArray[iMesh];
+    if( nPaletteBytes < size_t( mesh.NumFrameInfluences ) * nStride )
+        return E_INVALIDARG;
+
+    // Relative animations are only defined once the bind pose has been set
+    bool bNeedsBindPose = ( !m_pAnimationHeader || FTT_RELATIVE == m_pAnimationHeader->FrameTransformType );
+    if( !m_pTransformedFrameMatrices || ( bNeedsBindPose && !m_bBindPoseSet ) )
+        return E_FAIL;
+
+    // Everything is checked before the first write, as pPalette may be mapped memory
+    const UINT* pFrames = mesh.pFrameInfluences;
+    for( UINT i = 0; i < mesh.NumFrameInfluences; i++ )
+    {
+        if( pFrames[i] >= m_pMeshHeader->NumFrames )
+            return E_FAIL;
+    }
+
+    // Dual quaternions hold rotation and translation only, so scaled or mirrored bones
+    // are refused rather than written with their scale dropped
+    if( format == SDKMESH_PALETTE_DUAL_QUATERNION )
+    {
+        const XMVECTOR ScaleEpsilon = XMVectorReplicate( 1.0e-3f );
+        for( UINT i = 0; i < mesh.NumFrameInfluences; i++ )
+        {
+            XMVECTOR scale, rotation, translation;
+            if( !XMMatrixDecompose( &scale, &rotation, &translation, XMLoadFloat4x4( &m_pTransformedFrameMatrices[ pFrames[i] ] ) )
+                || !XMVector3NearEqual( scale, g_XMOne, ScaleEpsilon ) )
+                return E_FAIL;
+        }
+    }
+
+    switch( format )
+    {
+    case SDKMESH_PALETTE_FLOAT4X4:
+        {
+            auto pDest = reinterpret_cast<XMFLOAT4X4*>( pPalette );
+            for( UINT i = 0; i < mesh.NumFrameInfluences; i++ )
+                XMStoreFloat4x4( &pDest[i], XMMatrixTranspose( XMLoadFloat4x4( &m_pTransformedFrameMatrices[ pFrames[i] ] ) ) );
+        }
+        break;
+
+    case SDKMESH_PALETTE_FLOAT3X4:
+        {
+            auto pDest = reinterpret_cast<XMFLOAT4*>( pPalette );
+            for( UINT i = 0; i < mesh.NumFrameInfluences; i++, pDest += 3 )
+            {
+                XMMATRIX m = XMMatrixTranspose( XMLoadFloat4x4( &m_pTransformedFrameMatrices[ pFrames[i] ] ) );
+                XMStoreFloat4( &pDest[0], m.r[0] );
+                XMStoreFloat4( &pDest[1], m.r[1] );
+                XMStoreFloat4( &pDest[2], m.r[2] );
+            }
+        }
+        break;
+
+    case SDKMESH_PALETTE_DUAL_QUATERNION:
+        {
+            // The dual part is half the translation times the rotation
+            auto pDest = reinterpret_cast<XMFLOAT4*>( pPalette );
+            for( UINT i = 0; i < mesh.NumFrameInfluences; i++, pDest += 2 )
+            {
+                XMVECTOR scale, real, translation;
+                XMMatrixDecompose( &scale, &real, &translation, XMLoadFloat4x4( &m_pTransformedFrameMatrices[ pFrames[i] ] ) );
+                translation = XMVectorAndInt( translation, g_XMMask3 );
+                XMVECTOR dual = XMVectorScale( XMQuaternionMultiply( real, translation ), 0.5f );
+                XMStoreFloat4( &pDest[0], real );
+                XMStoreFloat4( &pDest[1], dual );
+            }
+        }
+        break;
+    }
+
+    return S_OK;
+}
+
 XMMATRIX CDXUTSDKMesh::GetWorldMatrix( _In_ UINT iFrameIndex ) const
 {
     return XMLoadFloat4x4( &m_pWorldPoseFrameMatrices[iFrameIndex] );
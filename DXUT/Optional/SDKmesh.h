@@ -137,6 +137,7 @@ struct SDKMESH_MESH
 {
     char Name[MAX_MESH_NAME];
     BYTE NumVertexBuffers;
+    char PositionQuantized[3];  // SDKMESH_POSITION_QUANTIZED when quantized, else padding
     UINT VertexBuffers[MAX_VERTEX_STREAMS];
     UINT IndexBuffer;
     UINT NumSubsets;
@@ -267,6 +268,7 @@ static_assert( sizeof(SDKMESH_HEADER)== 104, "SDK Mesh structure size incorrect"
 static_assert( sizeof(SDKMESH_VERTEX_BUFFER_HEADER) == 288, "SDK Mesh structure size incorrect" );
 static_assert( sizeof(SDKMESH_INDEX_BUFFER_HEADER) == 32, "SDK Mesh structure size incorrect" );
 static_assert( sizeof(SDKMESH_MESH) == 224, "SDK Mesh structure size incorrect" );
+static_assert( offsetof(SDKMESH_MESH, VertexBuffers) == 104, "SDK Mesh structure layout incorrect" );
 static_assert( sizeof(SDKMESH_SUBSET) == 144, "SDK Mesh structure size incorrect" );
 static_assert( sizeof(SDKMESH_FRAME) == 184, "SDK Mesh structure size incorrect" );
 static_assert( sizeof(SDKMESH_MATERIAL) == 1256, "SDK Mesh structure size incorrect" );
@@ -274,8 +276,71 @@ static_assert( sizeof(SDKANIMATION_FILE_HEADER) == 40, "SDK Mesh structure size
 static_assert( sizeof(SDKANIMATION_DATA) == 40, "SDK Mesh structure size incorrect" );
 static_assert( sizeof(SDKANIMATION_FRAME_DATA) == 112, "SDK Mesh structure size incorrect" );
 
+//--------------------------------------------------------------------------------------
+// Vertex cache optimization.  Triangles of each subset are reordered for post-transform
+// cache locality, vertices are then reordered into first-use order and the indices
+// remapped.  32-bit index buffers are shrunk to 16-bit when every index fits.  Subset
+// index and vertex ranges are preserved, so the result is still a valid .sdkmesh.
+//
+// ACMR is the average cache miss ratio (misses per triangle) and ATVR the average
+// transformed vertex ratio (misses per referenced vertex), both measured with a FIFO
+// cache of the requested size.
+//--------------------------------------------------------------------------------------
+#define SDKMESH_DEFAULT_VCACHE_SIZE 32
+
+struct SDKMESH_OPTIMIZE_STATS
+{
+    UINT64 NumTriangles;
+    UINT64 NumReferencedVertices;
+    UINT64 CacheMissesBefore;
+    UINT64 CacheMissesAfter;
+    UINT NumVertexBuffersReordered;
+    UINT NumIndexBuffersShrunk;
+
+    float ACMRBefore;
+    float ACMRAfter;
+    float ATVRBefore;
+    float ATVRAfter;
+};
+
+// Optimizes an .sdkmesh file image in memory; intended for offline conversion tools
+HRESULT WINAPI DXUTOptimizeSDKMeshInPlace( _Inout_updates_bytes_(DataBytes) BYTE* pData, _In_ size_t DataBytes,
+                                           _In_ UINT CacheSize = SDKMESH_DEFAULT_VCACHE_SIZE,
+                                           _Out_opt_ SDKMESH_OPTIMIZE_STATS* pStats = nullptr );
+
+//--------------------------------------------------------------------------------------
+// Vertex quantization.  Float vertex elements are rewritten into compact formats and the
+// vertex declaration and stride are updated to match:
+//   POSITION                    FLOAT3 -> SHORT4N, w = 1
+//   NORMAL, TANGENT, BINORMAL   FLOAT3 -> SHORT2N, octahedral encoding
+//   TEXCOORD                    FLOAT2 -> USHORT2N when within [0,1], otherwise FLOAT16_2
+//   BLENDWEIGHT                 FLOAT4 -> UBYTE4N, renormalized to sum to one
+//
+// Positions are normalized to the mesh bounding box, which is stored in the mesh header
+// and kept as is at load time.  The quantizer marks such meshes by writing
+// SDKMESH_POSITION_QUANTIZED into PositionQuantized, which older files leave as padding,
+// so authored SHORT4N positions are still taken as they are.  Vertex shaders apply GetMeshDequantizeTransform() before
+// the world transform.  Positions are only quantized in the first vertex stream of a
+// mesh and only when no other mesh uses that stream.
+//--------------------------------------------------------------------------------------
+#define SDKMESH_POSITION_QUANTIZED "QP"
+
+struct SDKMESH_QUANTIZE_STATS
+{
+    UINT64 VertexBytesBefore;
+    UINT64 VertexBytesAfter;
+    UINT NumVertexBuffersQuantized;
+};
+
+// Quantizes an .sdkmesh file image in memory.  Buffer data stays at the same offsets, so
+// the file keeps its size; tools that need the smaller file must repack it.
+HRESULT WINAPI DXUTQuantizeSDKMeshInPlace( _Inout_updates_bytes_(DataBytes) BYTE* pData, _In_ size_t DataBytes,
+                                           _Out_opt_ SDKMESH_QUANTIZE_STATS* pStats = nullptr );
+
 #ifndef _CONVERTER_APP_
 
+#include "DXUTGeometryPool.h"
+
 //--------------------------------------------------------------------------------------
 // AsyncLoading callbacks
 //--------------------------------------------------------------------------------------
@@ -293,6 +358,52 @@ struct SDKMESH_CALLBACKS11
     void* pContext;
 };
 
+//--------------------------------------------------------------------------------------
+// Render records built at load time, so RenderMesh walks compact arrays instead of the
+// file structures
+//--------------------------------------------------------------------------------------
+#define SDKMESH_BIND_DIFFUSE  0x1
+#define SDKMESH_BIND_NORMAL   0x2
+#define SDKMESH_BIND_SPECULAR 0x4
+#define SDKMESH_BIND_ALL      0x7
+
+struct SDKMESH_MATERIAL_BINDING
+{
+    ID3D11ShaderResourceView* pSRVs[3];     // Diffuse, normal, specular, so consecutive slots bind in one call; referenced
+    UINT ValidMask;                         // SDKMESH_BIND_* for the views that did not fail to load
+};
+
+struct SDKMESH_SUBSET_DRAW
+{
+    UINT MaterialID;
+    UINT IndexCount;
+    UINT IndexStart;
+    UINT VertexStart;
+    D3D11_PRIMITIVE_TOPOLOGY Topology;
+    D3D11_PRIMITIVE_TOPOLOGY TopologyAdj;
+};
+
+// The input assembler setup one mesh draws with, see GetMeshGeometry11
+struct SDKMESH_MESH_GEOMETRY
+{
+    UINT NumVertexBuffers;
+    ID3D11Buffer* pVB[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT];
+    UINT Strides[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT];
+    UINT Offsets[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT];
+    INT BaseVertex;                         // Added to each subset's VertexStart
+    ID3D11Buffer* pIB;
+    DXGI_FORMAT IBFormat;
+    UINT BaseIndex;                         // Added to each subset's IndexStart
+};
+
+// Layouts for GetMeshInfluencePalette, one element per influence
+enum SDKMESH_PALETTE_FORMAT
+{
+    SDKMESH_PALETTE_FLOAT4X4 = 0,       // Transposed for HLSL's default column_major packing; a float4x4, 64 bytes
+    SDKMESH_PALETTE_FLOAT3X4,           // The same without the constant last column; a float4x3, 48 bytes
+    SDKMESH_PALETTE_DUAL_QUATERNION,    // Rotation, then the translation's dual part; 32 bytes, rigid bones only
+};
+
 //--------------------------------------------------------------------------------------
 // CDXUTSDKMesh class.  This class reads the sdkmesh file format for use by the samples
 //--------------------------------------------------------------------------------------
@@ -307,6 +418,16 @@ private:
     std::vector<BYTE*> m_MappedPointers;
     ID3D11Device* m_pDev11;
     ID3D11DeviceContext* m_pDevContext11;
+    bool m_bOptimizeOnLoad;
+    SDKMESH_OPTIMIZE_STATS m_OptimizeStats;
+    bool m_bQuantizeOnLoad;
+    SDKMESH_QUANTIZE_STATS m_QuantizeStats;
+    std::vector<SDKMESH_MATERIAL_BINDING> m_MaterialBindings;
+    std::vector<SDKMESH_SUBSET_DRAW> m_SubsetDraws;
+    bool m_bMaterialBindingsPending;        // Textures may still arrive from asynchronous loads (see SetLoading)
+    CDXUTGeometryPool* m_pGeometryPool;
+    std::vector<DXUT_GEOMETRY_ALLOCATION> m_VertexAllocations;     // Per vertex buffer; empty when not pooled
+    std::vector<DXUT_GEOMETRY_ALLOCATION> m_IndexAllocations;      // Per index buffer; empty when not pooled
 
 protected:
     //These are the pointers to the two chunks of data loaded in from the mesh file
@@ -336,6 +457,8 @@ protected:
     SDKANIMATION_FILE_HEADER* m_pAnimationHeader;
     SDKANIMATION_FRAME_DATA* m_pAnimationFrameData;
     DirectX::XMFLOAT4X4* m_pBindPoseFrameMatrices;
+    DirectX::XMFLOAT4X4* m_pInvBindPoseFrameMatrices;  // Kept with the bind pose, so TransformMesh does not invert each frame
+    bool m_bBindPoseSet;                                // Both are uninitialized until TransformBindPose
     DirectX::XMFLOAT4X4* m_pTransformedFrameMatrices;
     DirectX::XMFLOAT4X4* m_pWorldPoseFrameMatrices;
 
@@ -351,6 +474,11 @@ protected:
                                _In_ SDKMESH_INDEX_BUFFER_HEADER* pHeader, _In_reads_(pHeader->SizeBytes) void* pIndices,
                                _In_opt_ SDKMESH_CALLBACKS11* pLoaderCallbacks = nullptr );
 
+    void ReleaseMaterialBindings();
+
+    HRESULT AllocatePooledVertexBuffer( _In_ UINT iVB );
+    HRESULT AllocatePooledIndexBuffer( _In_ UINT iIB );
+
     virtual HRESULT CreateFromFile( _In_opt_ ID3D11Device* pDev11,
                                     _In_z_ LPCWSTR szFileName,
                                     _In_opt_ SDKMESH_CALLBACKS11* pLoaderCallbacks11 = nullptr );
@@ -372,13 +500,15 @@ protected:
                      _In_ ID3D11DeviceContext* pd3dDeviceContext,
                      _In_ UINT iDiffuseSlot,
                      _In_ UINT iNormalSlot,
-                     _In_ UINT iSpecularSlot );
+                     _In_ UINT iSpecularSlot,
+                     _Inout_ DXUT_GEOMETRY_BIND_CACHE* pBindCache );
     void RenderFrame( _In_ UINT iFrame,
                       _In_ bool bAdjacent,
                       _In_ ID3D11DeviceContext* pd3dDeviceContext,
                       _In_ UINT iDiffuseSlot,
                       _In_ UINT iNormalSlot,
-                      _In_ UINT iSpecularSlot );
+                      _In_ UINT iSpecularSlot,
+                      _Inout_ DXUT_GEOMETRY_BIND_CACHE* pBindCache );
 
 public:
     CDXUTSDKMesh();
@@ -390,29 +520,67 @@ public:
     virtual HRESULT LoadAnimation( _In_z_ const WCHAR* szFileName );
     virtual void Destroy();
 
+    // Vertex cache optimization applied to the buffer data before the D3D11 buffers are
+    // created.  The data is rewritten in place, including memory passed to Create().
+    void SetOptimizeOnLoad( _In_ bool bOptimize ) { m_bOptimizeOnLoad = bOptimize; }
+    const SDKMESH_OPTIMIZE_STATS& GetOptimizeStats() const { return m_OptimizeStats; }
+
+    // Vertex quantization applied to the buffer data at load, see DXUTQuantizeSDKMeshInPlace
+    void SetQuantizeOnLoad( _In_ bool bQuantize ) { m_bQuantizeOnLoad = bQuantize; }
+    const SDKMESH_QUANTIZE_STATS& GetQuantizeStats() const { return m_QuantizeStats; }
+
+    // Meshes created after this sub-allocate their vertex and index buffers from pPool,
+    // which must outlive them; loader buffer callbacks still take precedence.  GetVB11 and
+    // GetIB11 then return the shared pages, at the element offsets given below.
+    void SetGeometryPool( _In_opt_ CDXUTGeometryPool* pPool ) { m_pGeometryPool = pPool; }
+    UINT GetVertexBufferBase( _In_ UINT iVB ) const { return m_VertexAllocations.empty() ? 0 : m_VertexAllocations[iVB].Offset; }
+    UINT GetIndexBufferBase( _In_ UINT iIB ) const { return m_IndexAllocations.empty() ? 0 : m_IndexAllocations[iIB].Offset; }
+
+    // Refreshes the views bound for each material; call after replacing the views of a
+    // material returned by GetMaterial.  Until then the old views stay referenced and bound.
+    void UpdateMaterialBindings();
+
+    // The record RenderMesh binds for a material, refreshed first while textures are still
+    // arriving; nullptr past the last material.  BindMaterial11 binds it to the given slots,
+    // in one call when they are consecutive, and returns the number of calls made.
+    const SDKMESH_MATERIAL_BINDING* GetMaterialBinding( _In_ UINT iMaterial );
+    static UINT BindMaterial11( _In_ ID3D11DeviceContext* pd3dDeviceContext, _In_ const SDKMESH_MATERIAL_BINDING& binding,
+                                _In_ UINT iDiffuseSlot, _In_ UINT iNormalSlot, _In_ UINT iSpecularSlot );
+
     //Frame manipulation
-    void TransformBindPose( _In_ DirectX::CXMMATRIX world ) { TransformBindPoseFrame( 0, world ); };
+    void TransformBindPose( _In_ DirectX::CXMMATRIX world ) { TransformBindPoseFrame( 0, world ); m_bBindPoseSet = true; };
     void TransformMesh( _In_ DirectX::CXMMATRIX world, _In_ double fTime );
 
     //Direct3D 11 Rendering
+    // Pass the context's bind cache to keep pooled buffers bound from one mesh to the next;
+    // without one the input assembler state is only tracked within the call.
     virtual void Render( _In_ ID3D11DeviceContext* pd3dDeviceContext,
                          _In_ UINT iDiffuseSlot = INVALID_SAMPLER_SLOT,
                          _In_ UINT iNormalSlot = INVALID_SAMPLER_SLOT,
-                         _In_ UINT iSpecularSlot = INVALID_SAMPLER_SLOT );
+                         _In_ UINT iSpecularSlot = INVALID_SAMPLER_SLOT,
+                         _Inout_opt_ DXUT_GEOMETRY_BIND_CACHE* pBindCache = nullptr );
     virtual void RenderAdjacent( _In_ ID3D11DeviceContext* pd3dDeviceContext,
                                  _In_ UINT iDiffuseSlot = INVALID_SAMPLER_SLOT,
                                  _In_ UINT iNormalSlot = INVALID_SAMPLER_SLOT,
-                                 _In_ UINT iSpecularSlot = INVALID_SAMPLER_SLOT );
+                                 _In_ UINT iSpecularSlot = INVALID_SAMPLER_SLOT,
+                                 _Inout_opt_ DXUT_GEOMETRY_BIND_CACHE* pBindCache = nullptr );
 
     //Helpers (D3D11 specific)
     static D3D11_PRIMITIVE_TOPOLOGY GetPrimitiveType11( _In_ SDKMESH_PRIMITIVE_TYPE PrimType );
     DXGI_FORMAT GetIBFormat11( _In_ UINT iMesh ) const;
     ID3D11Buffer* GetVB11( _In_ UINT iMesh, _In_ UINT iVB ) const;
     ID3D11Buffer* GetIB11( _In_ UINT iMesh ) const;
+    HRESULT GetMeshGeometry11( _In_ UINT iMesh, _In_ bool bAdjacent, _Out_ SDKMESH_MESH_GEOMETRY* pGeometry ) const;
     SDKMESH_INDEX_TYPE GetIndexType( _In_ UINT iMesh ) const; 
 
     ID3D11Buffer* GetAdjIB11( _In_ UINT iMesh ) const;
 
+    // Converts the vertex declarations of the mesh streams into an input layout; on input
+    // *pNumElements is the capacity of pDesc, on output the number of elements written.
+    // Fails on types with no DXGI equivalent, such as DEC3N, and on unknown usages.
+    HRESULT GetInputLayoutDesc11( _In_ UINT iMesh, _Out_writes_to_(*pNumElements, *pNumElements) D3D11_INPUT_ELEMENT_DESC* pDesc,
+                                  _Inout_ UINT* pNumElements ) const;
+
     //Helpers (general)
     const char* GetMeshPathA() const;
     const WCHAR* GetMeshPathW() const;
@@ -439,6 +607,8 @@ public:
     UINT64            GetNumIndices( _In_ UINT iMesh ) const;
     DirectX::XMVECTOR GetMeshBBoxCenter( _In_ UINT iMesh ) const;
     DirectX::XMVECTOR GetMeshBBoxExtents( _In_ UINT iMesh ) const;
+    bool              IsMeshPositionQuantized( _In_ UINT iMesh ) const;
+    DirectX::XMMATRIX GetMeshDequantizeTransform( _In_ UINT iMesh ) const;
     UINT              GetOutstandingResources() const;
     UINT              GetOutstandingBufferResources() const;
     bool              CheckLoadDone();
@@ -450,6 +620,18 @@ public:
     //Animation
     UINT              GetNumInfluences( _In_ UINT iMesh ) const;
     DirectX::XMMATRIX GetMeshInfluenceMatrix( _In_ UINT iMesh, _In_ UINT iInfluence ) const;
+
+    // Every influence matrix of a mesh, as left by the last TransformMesh.  Fails before
+    // writing anything if the mesh references a frame past the last, if the animation
+    // needs a bind pose and TransformBindPose has not been called, or if a dual quaternion
+    // palette is asked of a scaled bone.  Otherwise each element is written once and in
+    // order, so pPalette can be mapped write-combined memory.  Dual quaternions are not
+    // sign aligned between bones; shaders blending them should flip each by its dot
+    // product with the first.
+    static UINT       GetPaletteStride( _In_ SDKMESH_PALETTE_FORMAT format );
+    HRESULT           GetMeshInfluencePalette( _In_ UINT iMesh, _In_ SDKMESH_PALETTE_FORMAT format,
+                                               _Out_writes_bytes_(nPaletteBytes) void* pPalette, _In_ size_t nPaletteBytes ) const;
+
     UINT              GetAnimationKeyFromTime( _In_ double fTime ) const;
     DirectX::XMMATRIX GetWorldMatrix( _In_ UINT iFrameIndex ) const;
     DirectX::XMMATRIX GetInfluenceMatrix( _In_ UINT iFrameIndex ) const;
@@ -15,6 +15,8 @@
 #include "dxut.h"
 #include "SDKmisc.h"
 #include "DXUTres.h"
+#include "DXUTarchive.h"
+#include "DXUTShaderCache.h"
 
 #include "DXUTGui.h"
 
@@ -22,6 +24,11 @@
 #include "WICTextureLoader.h"
 #include "ScreenGrab.h"
 
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
 using namespace DirectX;
 
 //--------------------------------------------------------------------------------------
@@ -53,11 +60,13 @@ bool DXUTFindMediaSearchTypicalDirs( _Out_writes_(cchSearch) WCHAR* strSearchPat
                                      _In_ int cchSearch, 
                                      _In_ LPCWSTR strLeaf, 
                                      _In_ const WCHAR* strExePath,
-                                     _In_ const WCHAR* strExeName );
+                                     _In_ const WCHAR* strExeName,
+                                     _Inout_ UINT& nProbes );
 bool DXUTFindMediaSearchParentDirs( _Out_writes_(cchSearch) WCHAR* strSearchPath, 
                                     _In_ int cchSearch, 
                                     _In_ const WCHAR* strStartAt, 
-                                    _In_ const WCHAR* strLeafName );
+                                    _In_ const WCHAR* strLeafName,
+                                    _Inout_ UINT& nProbes );
 
 INT_PTR CALLBACK DisplaySwitchToREFWarningProc( _In_ HWND hDlg, _In_ UINT message, _In_ WPARAM wParam, _In_ LPARAM lParam );
 
@@ -215,6 +224,164 @@ WCHAR* DXUTMediaSearchPath()
 }
 
 
+//--------------------------------------------------------------------------------------
+// Media search cache.  Resolved names, including misses, are remembered per working
+// directory, and the files below the media search path are indexed once so that probing
+// that directory is a hash lookup.  Call DXUTClearMediaSearchCache after media files are
+// added or removed on disk.
+//--------------------------------------------------------------------------------------
+namespace
+{
+
+const size_t MAX_MEDIA_INDEX_FILES = 16384;
+
+struct DXUTMediaCache_Entry
+{
+    bool bFound;
+    UINT nProbes;           // Filesystem probes the resolution took
+    std::wstring strPath;
+};
+
+struct DXUTMediaSearchState
+{
+    std::mutex Lock;
+    std::unordered_map<std::wstring, DXUTMediaCache_Entry> Cache;
+    std::wstring strCacheDirectory;
+    std::unordered_set<std::wstring> Index;
+    bool bIndexBuilt;
+    bool bIndexValid;
+    DXUT_MEDIA_SEARCH_STATS Stats;
+
+    DXUTMediaSearchState() :
+        bIndexBuilt( false ),
+        bIndexValid( false )
+    {
+        ZeroMemory( &Stats, sizeof( Stats ) );
+    }
+};
+
+DXUTMediaSearchState& DXUTGetMediaSearchState()
+{
+    static DXUTMediaSearchState s_state;
+    return s_state;
+}
+
+std::wstring DXUTNormalizeMediaName( _In_z_ LPCWSTR strName )
+{
+    std::wstring str( strName );
+    for( auto it = str.begin(); it != str.end(); ++it )
+        *it = ( *it == L'/' ) ? L'\\' : towlower( *it );
+    return str;
+}
+
+bool DXUTIndexMediaDirectory( _In_ const std::wstring& strRoot, _In_ const std::wstring& strRelativeDir,
+                              _Inout_ std::unordered_set<std::wstring>& index, _Inout_ UINT64& nProbes )
+{
+    WIN32_FIND_DATAW fd;
+    std::wstring strPattern = strRoot + strRelativeDir + L"*";
+    HANDLE hFind = FindFirstFileW( strPattern.c_str(), &fd );
+    ++nProbes;
+    if( hFind == INVALID_HANDLE_VALUE )
+        return true;
+
+    bool bResult = true;
+    do
+    {
+        std::wstring strRelative = strRelativeDir + fd.cFileName;
+        if( fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY )
+        {
+            if( wcscmp( fd.cFileName, L"." ) && wcscmp( fd.cFileName, L".." ) )
+            {
+                index.insert( DXUTNormalizeMediaName( strRelative.c_str() ) );
+                bResult = DXUTIndexMediaDirectory( strRoot, strRelative + L"\\", index, nProbes );
+            }
+        }
+        else
+        {
+            index.insert( DXUTNormalizeMediaName( strRelative.c_str() ) );
+        }
+
+        // Too big to be a media directory, fall back to probing
+        if( index.size() > MAX_MEDIA_INDEX_FILES )
+            bResult = false;
+    } while( bResult && FindNextFileW( hFind, &fd ) );
+
+    FindClose( hFind );
+    return bResult;
+}
+
+// Reduces a relative name to the form the index holds: lower case, '\' separators, with
+// "." components and repeated separators dropped.  Fails for the names the file system
+// could resolve differently from the index: ".." components, absolute or drive relative
+// names, streams, short 8.3 names and components ending in a dot or a space.
+bool DXUTCanonicalizeMediaName( _In_z_ LPCWSTR strName, _Out_ std::wstring& strCanonical )
+{
+    strCanonical.clear();
+    if( strName[0] == L'\\' || strName[0] == L'/' )
+        return false;
+
+    const WCHAR* p = strName;
+    while( *p )
+    {
+        const WCHAR* pEnd = p;
+        while( *pEnd && *pEnd != L'\\' && *pEnd != L'/' )
+            ++pEnd;
+
+        std::wstring strComponent( p, pEnd );
+        p = *pEnd ? pEnd + 1 : pEnd;
+
+        if( strComponent.empty() || strComponent == L"." )
+            continue;
+        if( strComponent == L".."
+            || strComponent.find_first_of( L":~" ) != std::wstring::npos
+            || strComponent.back() == L'.' || strComponent.back() == L' ' )
+            return false;
+
+        if( !strCanonical.empty() )
+            strCanonical += L'\\';
+        strCanonical += DXUTNormalizeMediaName( strComponent.c_str() );
+    }
+
+    return !strCanonical.empty();
+}
+
+// Returns 1 if the file is in the indexed media search path, 0 if it is not and -1 if the
+// index cannot answer
+int DXUTLookupMediaIndex( _In_z_ LPCWSTR strLeaf )
+{
+    DXUTMediaSearchState& state = DXUTGetMediaSearchState();
+    std::lock_guard<std::mutex> lock( state.Lock );
+
+    if( !state.bIndexBuilt )
+    {
+        state.bIndexBuilt = true;
+        state.Index.clear();
+
+        WCHAR* s_strSearchPath = DXUTMediaSearchPath();
+        if( s_strSearchPath[0] != 0 )
+            state.bIndexValid = DXUTIndexMediaDirectory( s_strSearchPath, std::wstring(), state.Index, state.Stats.ProbesIssued );
+        if( !state.bIndexValid )
+            state.Index.clear();
+        state.Stats.IndexedFiles = UINT( state.Index.size() );
+    }
+
+    std::wstring strCanonical;
+    if( !state.bIndexValid || !DXUTCanonicalizeMediaName( strLeaf, strCanonical ) )
+        return -1;
+
+    state.Stats.ProbesAvoided++;
+    return state.Index.count( strCanonical ) ? 1 : 0;
+}
+
+inline bool DXUTMediaFileExists( _In_z_ LPCWSTR strPath, _Inout_ UINT& nProbes )
+{
+    ++nProbes;
+    return GetFileAttributes( strPath ) != 0xFFFFFFFF;
+}
+
+}; // namespace
+
+
 //--------------------------------------------------------------------------------------
 LPCWSTR WINAPI DXUTGetMediaSearchPath()
 {
@@ -241,25 +408,53 @@ HRESULT WINAPI DXUTSetMediaSearchPath( _In_z_ LPCWSTR strPath )
         }
     }
 
+    // Resolutions made with the old path are stale
+    DXUTClearMediaSearchCache();
+
     return hr;
 }
 
 
 //--------------------------------------------------------------------------------------
-// Tries to find the location of a SDK media file
-//       cchDest is the size in WCHARs of strDestPath.  Be careful not to 
-//       pass in sizeof(strDest) on UNICODE builds.
+void WINAPI DXUTClearMediaSearchCache()
+{
+    DXUTMediaSearchState& state = DXUTGetMediaSearchState();
+    std::lock_guard<std::mutex> lock( state.Lock );
+
+    state.Cache.clear();
+    state.strCacheDirectory.clear();
+    state.Index.clear();
+    state.bIndexBuilt = false;
+    state.bIndexValid = false;
+    state.Stats.IndexedFiles = 0;
+}
+
+
 //--------------------------------------------------------------------------------------
 _Use_decl_annotations_
-HRESULT WINAPI DXUTFindDXSDKMediaFileCch( WCHAR* strDestPath, int cchDest, 
-                                          LPCWSTR strFilename )
+void WINAPI DXUTGetMediaSearchStats( DXUT_MEDIA_SEARCH_STATS* pStats )
+{
+    if( !pStats )
+        return;
+
+    DXUTMediaSearchState& state = DXUTGetMediaSearchState();
+    std::lock_guard<std::mutex> lock( state.Lock );
+    *pStats = state.Stats;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Walks the media search order for strFilename, counting the filesystem probes issued
+//--------------------------------------------------------------------------------------
+namespace
+{
+
+bool DXUTResolveMediaFile( _Out_writes_(cchDest) WCHAR* strDestPath, _In_ int cchDest,
+                           _In_z_ LPCWSTR strFilename, _Inout_ UINT& nProbes )
 {
     bool bFound;
     WCHAR strSearchFor[MAX_PATH];
 
-    if( !strFilename || strFilename[0] == 0 || !strDestPath || cchDest < 10 )
-        return E_INVALIDARG;
-
     // Get the exe name, and exe path
     WCHAR strExePath[MAX_PATH] =
     {
@@ -297,15 +492,15 @@ HRESULT WINAPI DXUTFindDXSDKMediaFileCch( WCHAR* strDestPath, int cchDest,
     //      %EXE_DIR%\..\..\%EXE_NAME%
 
     // Typical directory search
-    bFound = DXUTFindMediaSearchTypicalDirs( strDestPath, cchDest, strFilename, strExePath, strExeName );
+    bFound = DXUTFindMediaSearchTypicalDirs( strDestPath, cchDest, strFilename, strExePath, strExeName, nProbes );
     if( bFound )
-        return S_OK;
+        return true;
 
     // Typical directory search again, but also look in a subdir called "\media\" 
     swprintf_s( strSearchFor, MAX_PATH, L"media\\%ls", strFilename );
-    bFound = DXUTFindMediaSearchTypicalDirs( strDestPath, cchDest, strSearchFor, strExePath, strExeName );
+    bFound = DXUTFindMediaSearchTypicalDirs( strDestPath, cchDest, strSearchFor, strExePath, strExeName, nProbes );
     if( bFound )
-        return S_OK;
+        return true;
 
     WCHAR strLeafName[MAX_PATH] =
     {
@@ -314,23 +509,109 @@ HRESULT WINAPI DXUTFindDXSDKMediaFileCch( WCHAR* strDestPath, int cchDest,
 
     // Search all parent directories starting at .\ and using strFilename as the leaf name
     wcscpy_s( strLeafName, MAX_PATH, strFilename );
-    bFound = DXUTFindMediaSearchParentDirs( strDestPath, cchDest, L".", strLeafName );
+    bFound = DXUTFindMediaSearchParentDirs( strDestPath, cchDest, L".", strLeafName, nProbes );
     if( bFound )
-        return S_OK;
+        return true;
 
     // Search all parent directories starting at the exe's dir and using strFilename as the leaf name
-    bFound = DXUTFindMediaSearchParentDirs( strDestPath, cchDest, strExePath, strLeafName );
+    bFound = DXUTFindMediaSearchParentDirs( strDestPath, cchDest, strExePath, strLeafName, nProbes );
     if( bFound )
-        return S_OK;
+        return true;
 
     // Search all parent directories starting at .\ and using "media\strFilename" as the leaf name
     swprintf_s( strLeafName, MAX_PATH, L"media\\%ls", strFilename );
-    bFound = DXUTFindMediaSearchParentDirs( strDestPath, cchDest, L".", strLeafName );
+    bFound = DXUTFindMediaSearchParentDirs( strDestPath, cchDest, L".", strLeafName, nProbes );
     if( bFound )
-        return S_OK;
+        return true;
 
     // Search all parent directories starting at the exe's dir and using "media\strFilename" as the leaf name
-    bFound = DXUTFindMediaSearchParentDirs( strDestPath, cchDest, strExePath, strLeafName );
+    bFound = DXUTFindMediaSearchParentDirs( strDestPath, cchDest, strExePath, strLeafName, nProbes );
+    if( bFound )
+        return true;
+
+    return false;
+}
+
+}; // namespace
+
+
+//--------------------------------------------------------------------------------------
+// Tries to find the location of a SDK media file
+//       cchDest is the size in WCHARs of strDestPath.  Be careful not to 
+//       pass in sizeof(strDest) on UNICODE builds.
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT WINAPI DXUTFindDXSDKMediaFileCch( WCHAR* strDestPath, int cchDest, 
+                                          LPCWSTR strFilename )
+{
+    if( !strFilename || strFilename[0] == 0 || !strDestPath || cchDest < 10 )
+        return E_INVALIDARG;
+
+    DXUTMediaSearchState& state = DXUTGetMediaSearchState();
+    std::wstring strKey = DXUTNormalizeMediaName( strFilename );
+
+    // Relative results are only valid for the working directory they were found from
+    WCHAR strCurrentDir[MAX_PATH] =
+    {
+        0
+    };
+    GetCurrentDirectory( MAX_PATH, strCurrentDir );
+
+    {
+        std::lock_guard<std::mutex> lock( state.Lock );
+
+        state.Stats.Lookups++;
+        if( _wcsicmp( state.strCacheDirectory.c_str(), strCurrentDir ) != 0 )
+        {
+            state.Cache.clear();
+            state.strCacheDirectory = strCurrentDir;
+
+            // A relative media search path now names a different directory
+            const WCHAR* s_strSearchPath = DXUTMediaSearchPath();
+            if( s_strSearchPath[0] != L'\\' && s_strSearchPath[1] != L':' )
+            {
+                state.Index.clear();
+                state.bIndexBuilt = state.bIndexValid = false;
+            }
+        }
+
+        auto it = state.Cache.find( strKey );
+        if( it != state.Cache.end() )
+        {
+            state.Stats.CacheHits++;
+            state.Stats.ProbesAvoided += it->second.nProbes;
+
+            // On failure, return the file as the path but also return an error code
+            if( !it->second.bFound )
+            {
+                wcscpy_s( strDestPath, cchDest, strFilename );
+                return DXUTERR_MEDIANOTFOUND;
+            }
+
+            if( it->second.strPath.length() >= size_t( cchDest ) )
+                return HRESULT_FROM_WIN32( ERROR_INSUFFICIENT_BUFFER );
+
+            wcscpy_s( strDestPath, cchDest, it->second.strPath.c_str() );
+            return S_OK;
+        }
+    }
+
+    UINT nProbes = 0;
+    bool bFound = DXUTResolveMediaFile( strDestPath, cchDest, strFilename, nProbes );
+
+    {
+        std::lock_guard<std::mutex> lock( state.Lock );
+
+        state.Stats.ProbesIssued += nProbes;
+
+        DXUTMediaCache_Entry entry;
+        entry.bFound = bFound;
+        entry.nProbes = nProbes;
+        if( bFound )
+            entry.strPath = strDestPath;
+        state.Cache[ strKey ] = entry;
+    }
+
     if( bFound )
         return S_OK;
 
@@ -346,7 +627,7 @@ HRESULT WINAPI DXUTFindDXSDKMediaFileCch( WCHAR* strDestPath, int cchDest,
 //--------------------------------------------------------------------------------------
 _Use_decl_annotations_
 bool DXUTFindMediaSearchTypicalDirs( WCHAR* strSearchPath, int cchSearch, LPCWSTR strLeaf, 
-                                     const WCHAR* strExePath, const WCHAR* strExeName )
+                                     const WCHAR* strExePath, const WCHAR* strExeName, UINT& nProbes )
 {
     // Typical directories:
     //      .\
@@ -361,47 +642,42 @@ bool DXUTFindMediaSearchTypicalDirs( WCHAR* strSearchPath, int cchSearch, LPCWST
 
     // Search in .\  
     wcscpy_s( strSearchPath, cchSearch, strLeaf );
-    if( GetFileAttributes( strSearchPath ) != 0xFFFFFFFF )
+    if( DXUTMediaFileExists( strSearchPath, nProbes ) )
         return true;
 
     // Search in ..\  
     swprintf_s( strSearchPath, cchSearch, L"..\\%ls", strLeaf );
-    if( GetFileAttributes( strSearchPath ) != 0xFFFFFFFF )
-        return true;
-
-    // Search in ..\..\ 
-    swprintf_s( strSearchPath, cchSearch, L"..\\..\\%ls", strLeaf );
-    if( GetFileAttributes( strSearchPath ) != 0xFFFFFFFF )
+    if( DXUTMediaFileExists( strSearchPath, nProbes ) )
         return true;
 
     // Search in ..\..\ 
     swprintf_s( strSearchPath, cchSearch, L"..\\..\\%ls", strLeaf );
-    if( GetFileAttributes( strSearchPath ) != 0xFFFFFFFF )
+    if( DXUTMediaFileExists( strSearchPath, nProbes ) )
         return true;
 
     // Search in the %EXE_DIR%\ 
     swprintf_s( strSearchPath, cchSearch, L"%ls\\%ls", strExePath, strLeaf );
-    if( GetFileAttributes( strSearchPath ) != 0xFFFFFFFF )
+    if( DXUTMediaFileExists( strSearchPath, nProbes ) )
         return true;
 
     // Search in the %EXE_DIR%\..\ 
     swprintf_s( strSearchPath, cchSearch, L"%ls\\..\\%ls", strExePath, strLeaf );
-    if( GetFileAttributes( strSearchPath ) != 0xFFFFFFFF )
+    if( DXUTMediaFileExists( strSearchPath, nProbes ) )
         return true;
 
     // Search in the %EXE_DIR%\..\..\ 
     swprintf_s( strSearchPath, cchSearch, L"%ls\\..\\..\\%ls", strExePath, strLeaf );
-    if( GetFileAttributes( strSearchPath ) != 0xFFFFFFFF )
+    if( DXUTMediaFileExists( strSearchPath, nProbes ) )
         return true;
 
     // Search in "%EXE_DIR%\..\%EXE_NAME%\".  This matches the DirectX SDK layout
     swprintf_s( strSearchPath, cchSearch, L"%ls\\..\\%ls\\%ls", strExePath, strExeName, strLeaf );
-    if( GetFileAttributes( strSearchPath ) != 0xFFFFFFFF )
+    if( DXUTMediaFileExists( strSearchPath, nProbes ) )
         return true;
 
     // Search in "%EXE_DIR%\..\..\%EXE_NAME%\".  This matches the DirectX SDK layout
     swprintf_s( strSearchPath, cchSearch, L"%ls\\..\\..\\%ls\\%ls", strExePath, strExeName, strLeaf );
-    if( GetFileAttributes( strSearchPath ) != 0xFFFFFFFF )
+    if( DXUTMediaFileExists( strSearchPath, nProbes ) )
         return true;
 
     // Search in media search dir 
@@ -409,7 +685,13 @@ bool DXUTFindMediaSearchTypicalDirs( WCHAR* strSearchPath, int cchSearch, LPCWST
     if( s_strSearchPath[0] != 0 )
     {
         swprintf_s( strSearchPath, cchSearch, L"%ls%ls", s_strSearchPath, strLeaf );
-        if( GetFileAttributes( strSearchPath ) != 0xFFFFFFFF )
+
+        // The media search path is indexed once rather than probed for every name
+        int iIndexed = DXUTLookupMediaIndex( strLeaf );
+        if( iIndexed >= 0 )
+            return iIndexed != 0;
+
+        if( DXUTMediaFileExists( strSearchPath, nProbes ) )
             return true;
     }
 
@@ -423,7 +705,7 @@ bool DXUTFindMediaSearchTypicalDirs( WCHAR* strSearchPath, int cchSearch, LPCWST
 //--------------------------------------------------------------------------------------
 _Use_decl_annotations_
 bool DXUTFindMediaSearchParentDirs( WCHAR* strSearchPath, int cchSearch, const WCHAR* strStartAt, 
-                                    const WCHAR* strLeafName )
+                                    const WCHAR* strLeafName, UINT& nProbes )
 {
     WCHAR strFullPath[MAX_PATH] =
     {
@@ -446,7 +728,7 @@ bool DXUTFindMediaSearchParentDirs( WCHAR* strSearchPath, int cchSearch, const W
     while( strFilePart && *strFilePart != '\0' )
     {
         swprintf_s( strFullFileName, MAX_PATH, L"%ls\\%ls", strFullPath, strLeafName );
-        if( GetFileAttributes( strFullFileName ) != 0xFFFFFFFF )
+        if( DXUTMediaFileExists( strFullFileName, nProbes ) )
         {
             wcscpy_s( strSearchPath, cchSearch, strFullFileName );
             return true;
@@ -475,126 +757,115 @@ typedef public std::unique_ptr<void, handle_closer> ScopedHandle;
 
 inline HANDLE safe_handle( HANDLE h ) { return (h == INVALID_HANDLE_VALUE) ? 0 : h; }
 
-class CIncludeHandler : public ID3DInclude
-    // Not as robust as D3D_COMPILE_STANDARD_FILE_INCLUDE, but it works in most cases
-{
-private:
-    static const unsigned int MAX_INCLUDES = 9;
+}; // namespace
 
-    struct sInclude
-    {
-        HANDLE         hFile;
-        HANDLE         hFileMap;
-        LARGE_INTEGER  FileSize;
-        void           *pMapData;
-    };
+#endif
 
-    struct sInclude     m_includeFiles[MAX_INCLUDES];
-    size_t              m_nIncludes;
-    bool                m_reset;
-    WCHAR               m_workingPath[MAX_PATH];
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+CDXUTIncludeHandler::CDXUTIncludeHandler( LPCWSTR szSourceFile )
+{
+    WCHAR strFullPath[MAX_PATH];
+    if( !GetFullPathNameW( szSourceFile, MAX_PATH, strFullPath, nullptr ) )
+        wcscpy_s( strFullPath, MAX_PATH, szSourceFile );
 
-public:
-    CIncludeHandler() : m_nIncludes(0), m_reset(false)
-    {
-        if ( !GetCurrentDirectoryW( MAX_PATH, m_workingPath ) )
-            *m_workingPath = 0;
+    WCHAR* strLastSlash = wcsrchr( strFullPath, L'\\' );
+    if( strLastSlash )
+        *strLastSlash = 0;
+    else
+        wcscpy_s( strFullPath, MAX_PATH, L"." );
 
-        for ( size_t i = 0; i < MAX_INCLUDES; ++i )
-        {
-            m_includeFiles[i].hFile = INVALID_HANDLE_VALUE;
-            m_includeFiles[i].hFileMap = INVALID_HANDLE_VALUE;
-            m_includeFiles[i].pMapData = nullptr;
-        }
-    }
-    virtual ~CIncludeHandler()
-    {
-        for ( size_t i = 0; i < m_nIncludes; ++i )
-        {
-            UnmapViewOfFile( m_includeFiles[i].pMapData );
+    m_strSourceDir = strFullPath;
+}
 
-            if ( m_includeFiles[i].hFileMap != INVALID_HANDLE_VALUE)
-                CloseHandle( m_includeFiles[i].hFileMap );
 
-            if ( m_includeFiles[i].hFile != INVALID_HANDLE_VALUE)
-                CloseHandle( m_includeFiles[i].hFile );
-        }
+//--------------------------------------------------------------------------------------
+HRESULT STDMETHODCALLTYPE CDXUTIncludeHandler::Open( D3D_INCLUDE_TYPE IncludeType, LPCSTR pFileName, LPCVOID pParentData, LPCVOID *ppData, UINT *pBytes )
+{
+    UNREFERENCED_PARAMETER(IncludeType);
 
-        m_nIncludes = 0;
+    WCHAR strName[MAX_PATH];
+    if( !MultiByteToWideChar( CP_ACP, 0, pFileName, -1, strName, MAX_PATH ) )
+        return E_FAIL;
 
-        if ( m_reset && *m_workingPath )
-        {
-            SetCurrentDirectoryW( m_workingPath );
-        }
+    WCHAR strPath[MAX_PATH];
+    if( strName[0] == L'\\' || strName[0] == L'/' || ( strName[0] && strName[1] == L':' ) )
+    {
+        wcscpy_s( strPath, MAX_PATH, strName );
     }
-
-    STDMETHOD(Open( D3D_INCLUDE_TYPE IncludeType, LPCSTR pFileName, LPCVOID pParentData, LPCVOID *ppData, UINT *pBytes ) )
+    else
     {
-        UNREFERENCED_PARAMETER(IncludeType);
-        UNREFERENCED_PARAMETER(pParentData);
-
-        size_t incIndex = m_nIncludes+1;
-
-        // Make sure we have enough room for this include file
-        if ( incIndex >= MAX_INCLUDES )
-            return E_FAIL;
-
-        // try to open the file
-        m_includeFiles[incIndex].hFile  = CreateFileA( pFileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr );
-        if( INVALID_HANDLE_VALUE == m_includeFiles[incIndex].hFile )
+        // Relative to the includer, which is the source file unless pParentData is one of ours
+        const std::wstring* pDir = &m_strSourceDir;
+        for( auto it = m_files.cbegin(); it != m_files.cend(); ++it )
         {
-            return E_FAIL;
+            if( it->data.get() == pParentData )
+            {
+                pDir = &it->strDir;
+                break;
+            }
         }
+        swprintf_s( strPath, MAX_PATH, L"%ls\\%ls", pDir->c_str(), strName );
+    }
 
-        // Get the file size
-        GetFileSizeEx( m_includeFiles[incIndex].hFile, &m_includeFiles[incIndex].FileSize );
+    File file;
 
-        // Use Memory Mapped File I/O for the header data
-        m_includeFiles[incIndex].hFileMap = CreateFileMappingA( m_includeFiles[incIndex].hFile, nullptr, PAGE_READONLY, m_includeFiles[incIndex].FileSize.HighPart, m_includeFiles[incIndex].FileSize.LowPart, pFileName);
-        if( !m_includeFiles[incIndex].hFileMap )
-        {
-            if (m_includeFiles[incIndex].hFile != INVALID_HANDLE_VALUE)
-                CloseHandle( m_includeFiles[incIndex].hFile );
-            return E_FAIL;
-        }
+    WCHAR strFullPath[MAX_PATH];
+    if( !GetFullPathNameW( strPath, MAX_PATH, strFullPath, nullptr ) )
+        return E_FAIL;
+    file.strPath = strFullPath;
 
-        // Create Map view
-        *ppData = MapViewOfFile( m_includeFiles[incIndex].hFileMap, FILE_MAP_READ, 0, 0, 0 );
-        *pBytes = m_includeFiles[incIndex].FileSize.LowPart;
+    WCHAR* strLastSlash = wcsrchr( strFullPath, L'\\' );
+    if( strLastSlash )
+        *strLastSlash = 0;
+    file.strDir = strFullPath;
 
-        // Success - Increment the include file count
-        m_nIncludes = incIndex;
+    HANDLE hFile = CreateFileW( file.strPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr );
+    if( hFile == INVALID_HANDLE_VALUE )
+        return HRESULT_FROM_WIN32( GetLastError() );
 
-        return S_OK;
+    LARGE_INTEGER FileSize = { 0 };
+    if( !GetFileSizeEx( hFile, &FileSize ) || FileSize.HighPart > 0 )
+    {
+        CloseHandle( hFile );
+        return E_FAIL;
     }
 
-    STDMETHOD(Close( LPCVOID pData ))
+    // At least a byte, so an empty include still has a pointer of its own for pParentData
+    file.data.reset( new (std::nothrow) BYTE[ FileSize.LowPart ? FileSize.LowPart : 1 ] );
+    if( !file.data )
     {
-        UNREFERENCED_PARAMETER(pData);
-        // Defer Closure until the container destructor 
-        return S_OK;
+        CloseHandle( hFile );
+        return E_OUTOFMEMORY;
     }
 
-    void SetCWD( LPCWSTR pFileName )
-    {
-        WCHAR filePath[MAX_PATH];
-        wcscpy_s( filePath, MAX_PATH, pFileName );
+    DWORD BytesRead = 0;
+    BOOL bRead = FileSize.LowPart ? ReadFile( hFile, file.data.get(), FileSize.LowPart, &BytesRead, nullptr ) : TRUE;
+    CloseHandle( hFile );
 
-        WCHAR *strLastSlash = wcsrchr( filePath, L'\\' );
-        if( strLastSlash )
-        {
-            // Chop the exe name from the exe path
-            *strLastSlash = 0;
-            m_reset = true;
-            SetCurrentDirectoryW( filePath );
-        }
-    }
-};
+    if( !bRead || BytesRead < FileSize.LowPart )
+        return E_FAIL;
 
-}; // namespace
+    file.bytes = FileSize.LowPart;
+
+    *ppData = file.data.get();
+    *pBytes = UINT( file.bytes );
+    m_files.push_back( std::move( file ) );
+
+    return S_OK;
+}
 
-#endif
 
+//--------------------------------------------------------------------------------------
+HRESULT STDMETHODCALLTYPE CDXUTIncludeHandler::Close( LPCVOID pData )
+{
+    UNREFERENCED_PARAMETER(pData);
+    // Defer Closure until the container destructor
+    return S_OK;
+}
+
+
+//--------------------------------------------------------------------------------------
 _Use_decl_annotations_
 HRESULT WINAPI DXUTCompileFromFile( LPCWSTR pFileName,
                                     const D3D_SHADER_MACRO* pDefines,
@@ -616,6 +887,18 @@ HRESULT WINAPI DXUTCompileFromFile( LPCWSTR pFileName,
 
     ID3DBlob* pErrorBlob = nullptr;
 
+    // Persistent bytecode cache, when the app has set a cache directory
+    if ( DXUTIsShaderCacheEnabled() )
+    {
+        hr = DXUTCompileShaderCached( str, pDefines, pEntrypoint, pTarget, Flags1, Flags2, ppCode, &pErrorBlob );
+        if ( pErrorBlob )
+        {
+            OutputDebugStringA( reinterpret_cast<const char*>( pErrorBlob->GetBufferPointer() ) );
+            pErrorBlob->Release();
+        }
+        return hr;
+    }
+
 #if D3D_COMPILER_VERSION >= 46
 
     hr = D3DCompileFromFile( str, pDefines, D3D_COMPILE_STANDARD_FILE_INCLUDE,
@@ -672,12 +955,10 @@ HRESULT WINAPI DXUTCompileFromFile( LPCWSTR pFileName,
         pstrName++;
     }
 
-    std::unique_ptr<CIncludeHandler> includes( new (std::nothrow) CIncludeHandler );
+    std::unique_ptr<CDXUTIncludeHandler> includes( new (std::nothrow) CDXUTIncludeHandler( str ) );
     if ( !includes )
         return E_OUTOFMEMORY;
 
-    includes->SetCWD( str );
-
     hr = D3DCompile( fxData.get(), BytesRead, pstrName, pDefines, includes.get(),
                      pEntrypoint, pTarget, Flags1, Flags2,
                      ppCode, &pErrorBlob );
@@ -705,14 +986,24 @@ HRESULT WINAPI DXUTCreateShaderResourceViewFromFile( ID3D11Device* d3dDevice, co
     if ( !d3dDevice || !szFileName || !textureView )
         return E_INVALIDARG;
 
+    WCHAR ext[_MAX_EXT];
+    _wsplitpath_s( szFileName, nullptr, 0, nullptr, 0, nullptr, 0, ext, _MAX_EXT );
+
+    // Mounted archives first
+    DXUTArchive_View view;
+    if ( SUCCEEDED( DXUTFindArchiveFile( szFileName, view ) ) )
+    {
+        if ( _wcsicmp( ext, L".dds" ) == 0 )
+            return DirectX::CreateDDSTextureFromMemory( d3dDevice, view.pData, view.Bytes, nullptr, textureView );
+        else
+            return DirectX::CreateWICTextureFromMemory( d3dDevice, nullptr, view.pData, view.Bytes, nullptr, textureView );
+    }
+
     WCHAR str[MAX_PATH];
     HRESULT hr = DXUTFindDXSDKMediaFileCch( str, MAX_PATH, szFileName );
     if ( FAILED(hr) )
         return hr;
 
-    WCHAR ext[_MAX_EXT];
-    _wsplitpath_s( str, nullptr, 0, nullptr, 0, nullptr, 0, ext, _MAX_EXT );
-
     if ( _wcsicmp( ext, L".dds" ) == 0 )
     {
         hr = DirectX::CreateDDSTextureFromFile( d3dDevice, str, nullptr, textureView );
@@ -731,14 +1022,24 @@ HRESULT WINAPI DXUTCreateTextureFromFile( ID3D11Device* d3dDevice, const wchar_t
     if ( !d3dDevice || !szFileName || !texture )
         return E_INVALIDARG;
 
+    WCHAR ext[_MAX_EXT];
+    _wsplitpath_s( szFileName, nullptr, 0, nullptr, 0, nullptr, 0, ext, _MAX_EXT );
+
+    // Mounted archives first
+    DXUTArchive_View view;
+    if ( SUCCEEDED( DXUTFindArchiveFile( szFileName, view ) ) )
+    {
+        if ( _wcsicmp( ext, L".dds" ) == 0 )
+            return DirectX::CreateDDSTextureFromMemory( d3dDevice, view.pData, view.Bytes, texture, nullptr );
+        else
+            return DirectX::CreateWICTextureFromMemory( d3dDevice, nullptr, view.pData, view.Bytes, texture, nullptr );
+    }
+
     WCHAR str[MAX_PATH];
     HRESULT hr = DXUTFindDXSDKMediaFileCch( str, MAX_PATH, szFileName );
     if ( FAILED(hr) )
         return hr;
 
-    WCHAR ext[_MAX_EXT];
-    _wsplitpath_s( str, nullptr, 0, nullptr, 0, nullptr, 0, ext, _MAX_EXT );
-
     if ( _wcsicmp( ext, L".dds" ) == 0 )
     {
         hr = DirectX::CreateDDSTextureFromFile( d3dDevice, str, texture, nullptr );
@@ -843,7 +1144,23 @@ HRESULT CDXUTResourceCache::CreateTextureFromFile( ID3D11Device* pDevice, ID3D11
     _wsplitpath_s( pSrcFile, nullptr, 0, nullptr, 0, nullptr, 0, ext, _MAX_EXT );
 
     HRESULT hr;
-    if ( _wcsicmp( ext, L".dds" ) == 0 )
+    DXUTArchive_View view;
+    if ( SUCCEEDED( DXUTFindArchiveFile( pSrcFile, view ) ) )
+    {
+        if ( _wcsicmp( ext, L".dds" ) == 0 )
+        {
+            hr = DirectX::CreateDDSTextureFromMemoryEx( pDevice, view.pData, view.Bytes, 0,
+                                                        D3D11_USAGE_DEFAULT, D3D11_BIND_SHADER_RESOURCE, 0, 0, bSRGB,
+                                                        nullptr, ppOutputRV, nullptr );
+        }
+        else
+        {
+            hr = DirectX::CreateWICTextureFromMemoryEx( pDevice, pContext, view.pData, view.Bytes, 0,
+                                                        D3D11_USAGE_DEFAULT, D3D11_BIND_SHADER_RESOURCE, 0, 0, bSRGB,
+                                                        nullptr, ppOutputRV );
+        }
+    }
+    else if ( _wcsicmp( ext, L".dds" ) == 0 )
     {
         hr = DirectX::CreateDDSTextureFromFileEx( pDevice, pSrcFile, 0,
                                                   D3D11_USAGE_DEFAULT, D3D11_BIND_SHADER_RESOURCE, 0, 0, bSRGB,
@@ -931,7 +1248,9 @@ void CDXUTTextHelper::Init( _In_ int nLineHeight )
     m_nLineHeight = nLineHeight;
     m_pd3d11Device = nullptr;
     m_pd3d11DeviceContext = nullptr;
+    m_pd3dRenderContext = nullptr;
     m_pManager = nullptr; 
+    m_qpcBegin.QuadPart = 0;
 
     // Create a blend state if a sprite is passed in
 }
@@ -940,12 +1259,10 @@ void CDXUTTextHelper::Init( _In_ int nLineHeight )
 //--------------------------------------------------------------------------------------
 HRESULT CDXUTTextHelper::DrawFormattedTextLine( _In_z_ const WCHAR* strMsg, ... )
 {
-    WCHAR strBuffer[512];
-
     va_list args;
     va_start( args, strMsg );
-    vswprintf_s( strBuffer, 512, strMsg, args );
-    strBuffer[511] = L'\0';
+    // Sized for the message in frame arena scratch, so long lines are not truncated
+    const WCHAR* strBuffer = DXUTFormatFrameTextV( DXUTGetFrameArena(), strMsg, args );
     va_end( args );
 
     return DrawTextLine( strBuffer );
@@ -955,13 +1272,13 @@ HRESULT CDXUTTextHelper::DrawFormattedTextLine( _In_z_ const WCHAR* strMsg, ...
 //--------------------------------------------------------------------------------------
 HRESULT CDXUTTextHelper::DrawTextLine( _In_z_ const WCHAR* strMsg )
 {
-    if( !m_pd3d11DeviceContext )
+    if( !GetRenderContext() )
         return DXUT_ERR_MSGBOX( L"DrawTextLine", E_INVALIDARG );
 
     HRESULT hr = S_OK;
     RECT rc;
     SetRect( &rc, m_pt.x, m_pt.y, 0, 0 );
-    DrawText11DXUT( m_pd3d11Device, m_pd3d11DeviceContext, strMsg, rc, m_clr,
+    DrawText11DXUT( m_pd3d11Device, GetRenderContext(), strMsg, rc, m_clr,
                     (float)m_pManager->m_nBackBufferWidth, (float)m_pManager->m_nBackBufferHeight, false );
 
     if( FAILED( hr ) )
@@ -977,12 +1294,9 @@ HRESULT CDXUTTextHelper::DrawTextLine( _In_z_ const WCHAR* strMsg )
 _Use_decl_annotations_
 HRESULT CDXUTTextHelper::DrawFormattedTextLine( const RECT& rc, const WCHAR* strMsg, ... )
 {
-    WCHAR strBuffer[512];
-
     va_list args;
     va_start( args, strMsg );
-    vswprintf_s( strBuffer, 512, strMsg, args );
-    strBuffer[511] = L'\0';
+    const WCHAR* strBuffer = FormatFrameText( strMsg, args );
     va_end( args );
 
     return DrawTextLine( rc, strBuffer );
@@ -993,11 +1307,11 @@ HRESULT CDXUTTextHelper::DrawFormattedTextLine( const RECT& rc, const WCHAR* str
 _Use_decl_annotations_
 HRESULT CDXUTTextHelper::DrawTextLine( const RECT& rc, const WCHAR* strMsg )
 {
-    if( !m_pd3d11DeviceContext )
+    if( !GetRenderContext() )
         return DXUT_ERR_MSGBOX( L"DrawTextLine", E_INVALIDARG );
 
     HRESULT hr = S_OK;
-    DrawText11DXUT( m_pd3d11Device, m_pd3d11DeviceContext, strMsg, rc, m_clr,
+    DrawText11DXUT( m_pd3d11Device, GetRenderContext(), strMsg, rc, m_clr,
                     (float)m_pManager->m_nBackBufferWidth, (float)m_pManager->m_nBackBufferHeight, false );
 
     if( FAILED( hr ) )
@@ -1010,12 +1324,16 @@ HRESULT CDXUTTextHelper::DrawTextLine( const RECT& rc, const WCHAR* strMsg )
 
 
 //--------------------------------------------------------------------------------------
-void CDXUTTextHelper::Begin()
+_Use_decl_annotations_
+void CDXUTTextHelper::Begin( ID3D11DeviceContext* pd3dContext )
 {
-    if( m_pd3d11DeviceContext )
+    QueryPerformanceCounter( &m_qpcBegin );
+
+    m_pd3dRenderContext = pd3dContext;
+    if( GetRenderContext() )
     {
-        m_pManager->StoreD3D11State( m_pd3d11DeviceContext );
-        m_pManager->ApplyRenderUI11( m_pd3d11DeviceContext );
+        m_pManager->StoreD3D11State( GetRenderContext() );
+        m_pManager->ApplyRenderUI11( GetRenderContext() );
     }
 
 
@@ -1025,8 +1343,13 @@ void CDXUTTextHelper::Begin()
 //--------------------------------------------------------------------------------------
 void CDXUTTextHelper::End()
 {
-    if( m_pd3d11DeviceContext )
+    if( GetRenderContext() )
     {
-        m_pManager->RestoreD3D11State( m_pd3d11DeviceContext );
+        m_pManager->RestoreD3D11State( GetRenderContext() );
     }
+    m_pd3dRenderContext = nullptr;
+
+    LARGE_INTEGER qpcEnd;
+    QueryPerformanceCounter( &qpcEnd );
+    DXUTAddFrameGUITime( qpcEnd.QuadPart - m_qpcBegin.QuadPart );
 }
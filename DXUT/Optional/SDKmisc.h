@@ -14,6 +14,8 @@
 //--------------------------------------------------------------------------------------
 #pragma once
 
+#include <string>
+
 //-----------------------------------------------------------------------------
 // Resource cache for textures, fonts, meshs, and effects.  
 // Use DXUTGetGlobalResourceCache() to access the global cache
@@ -78,7 +80,9 @@ public:
     void SetForegroundColor( _In_ DirectX::XMFLOAT4 clr ) { m_clr = clr; }
     void SetForegroundColor( _In_ DirectX::FXMVECTOR clr ) { XMStoreFloat4( &m_clr, clr ); }
 
-    void    Begin();
+    // Until End, draws on pd3dContext, such as a CDXUTPassScheduler pass's deferred context,
+    // or on the context the helper was created with when it is null
+    void    Begin( _In_opt_ ID3D11DeviceContext* pd3dContext = nullptr );
     HRESULT DrawFormattedTextLine( _In_z_ const WCHAR* strMsg, ... );
     HRESULT DrawTextLine( _In_z_ const WCHAR* strMsg );
     HRESULT DrawFormattedTextLine( _In_ const RECT& rc, _In_z_ const WCHAR* strMsg, ... );
@@ -93,7 +97,12 @@ protected:
     // D3D11 font 
     ID3D11Device* m_pd3d11Device;
     ID3D11DeviceContext* m_pd3d11DeviceContext;
+    ID3D11DeviceContext* m_pd3dRenderContext;  // Set from Begin to End
     CDXUTDialogResourceManager* m_pManager;
+
+    ID3D11DeviceContext* GetRenderContext() const { return m_pd3dRenderContext ? m_pd3dRenderContext : m_pd3d11DeviceContext; }
+
+    LARGE_INTEGER m_qpcBegin;   // Begin to End is reported as GUI time
 };
 
 
@@ -111,6 +120,21 @@ HRESULT WINAPI DXUTFindDXSDKMediaFileCch( _Out_writes_(cchDest) WCHAR* strDestPa
 HRESULT WINAPI DXUTSetMediaSearchPath( _In_z_ LPCWSTR strPath );
 LPCWSTR WINAPI DXUTGetMediaSearchPath();
 
+// Lookups are memoized, including misses, and the media search path is indexed on first
+// use.  Setting the search path flushes both; call DXUTClearMediaSearchCache if media
+// files are added or removed while the app runs.
+struct DXUT_MEDIA_SEARCH_STATS
+{
+    UINT64 Lookups;
+    UINT64 CacheHits;
+    UINT64 ProbesIssued;    // GetFileAttributes/FindFirstFile calls made
+    UINT64 ProbesAvoided;   // Calls answered from the cache or the directory index
+    UINT IndexedFiles;
+};
+
+void WINAPI DXUTClearMediaSearchCache();
+void WINAPI DXUTGetMediaSearchStats( _Out_ DXUT_MEDIA_SEARCH_STATS* pStats );
+
 
 //--------------------------------------------------------------------------------------
 // Compiles HLSL shaders
@@ -121,6 +145,50 @@ HRESULT WINAPI DXUTCompileFromFile( _In_z_ LPCWSTR pFileName,
                                     _In_ UINT Flags1, _In_ UINT Flags2,
                                     _Outptr_ ID3DBlob** ppCode );
 
+//--------------------------------------------------------------------------------------
+// Include handler for D3DCompile.  Resolves #include "file" relative to the file that
+// included it, as D3D_COMPILE_STANDARD_FILE_INCLUDE does, without changing the working
+// directory, so compiles can run on several threads.  Every file opened stays loaded
+// until the handler is destroyed, and is listed in the order it was opened.
+//--------------------------------------------------------------------------------------
+class CDXUTIncludeHandler : public ID3DInclude
+{
+public:
+    explicit CDXUTIncludeHandler( _In_z_ LPCWSTR szSourceFile );
+
+    STDMETHOD(Open( D3D_INCLUDE_TYPE IncludeType, LPCSTR pFileName, LPCVOID pParentData, LPCVOID *ppData, UINT *pBytes ) );
+    STDMETHOD(Close( LPCVOID pData ));
+
+    size_t GetNumFiles() const { return m_files.size(); }
+    const std::wstring& GetFilePath( _In_ size_t iFile ) const { return m_files[iFile].strPath; }
+    const BYTE* GetFileData( _In_ size_t iFile ) const { return m_files[iFile].data.get(); }
+    size_t GetFileBytes( _In_ size_t iFile ) const { return m_files[iFile].bytes; }
+
+private:
+    // Not copyable, the file data is owned
+    CDXUTIncludeHandler( const CDXUTIncludeHandler& );
+    CDXUTIncludeHandler& operator=( const CDXUTIncludeHandler& );
+
+    struct File
+    {
+        std::unique_ptr<BYTE[]> data;
+        size_t bytes;
+        std::wstring strPath;   // Full path
+        std::wstring strDir;    // Where the file's own includes are resolved
+
+        File() : bytes( 0 ) {}
+        File( File&& other ) : data( std::move( other.data ) ), bytes( other.bytes ), strPath( std::move( other.strPath ) ), strDir( std::move( other.strDir ) ) {}
+        File& operator=( File&& other ) { data = std::move( other.data ); bytes = other.bytes; strPath = std::move( other.strPath ); strDir = std::move( other.strDir ); return *this; }
+
+    private:
+        File( const File& );
+        File& operator=( const File& );
+    };
+
+    std::wstring m_strSourceDir;
+    std::vector<File> m_files;
+};
+
 //--------------------------------------------------------------------------------------
 // Texture utilities
 //--------------------------------------------------------------------------------------
@@ -6,8 +6,10 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 //--------------------------------------------------------------------------------------
 #include "DXUT.h"
+#include "DXUTAssetBenchmark.h"
 #include "DXUTcamera.h"
 #include "DXUTgui.h"
+#include "DXUTPassScheduler.h"
 #include "SDKmisc.h"
 #include "VertexShader.h"
 #include "PixelShader.h"
@@ -53,6 +55,7 @@ ID3D11SamplerState*         g_pSamplerLinear = nullptr;
 CModelViewerCamera          g_Camera;
 CDXUTDialogResourceManager  g_DialogResourceManager;
 CDXUTTextHelper*            g_pTextHelper = nullptr;
+CDXUTPassScheduler          g_PassScheduler;
 XMMATRIX                    g_Model;
 XMVECTOR                    g_LightDir[2];
 
@@ -73,6 +76,10 @@ bool CALLBACK ModifyDeviceSettings(DXUTDeviceSettings* pDeviceSettings, void* pU
 }
 
 
+void CALLBACK RenderScenePass(ID3D11DeviceContext* pd3dContext, void* pUserContext);
+void CALLBACK RenderTextPass(ID3D11DeviceContext* pd3dContext, void* pUserContext);
+
+
 //--------------------------------------------------------------------------------------
 // Create any D3D11 resources that aren't dependant on the back buffer
 //--------------------------------------------------------------------------------------
@@ -221,6 +228,14 @@ HRESULT CALLBACK OnD3D11CreateDevice(ID3D11Device* pd3dDevice, const DXGI_SURFAC
 	// Initialize CDXUTTextHelper
 	g_pTextHelper = new CDXUTTextHelper(pd3dDevice, pd3dImmediateContext, &g_DialogResourceManager, 15);
 
+	// The scene is recorded on a deferred context.  The text pass formats into the render
+	// thread's frame arena and fills the shared sprite and font vertices, so it runs
+	// immediate, on the thread calling Render, after the scene is submitted.
+	V_RETURN(g_PassScheduler.OnD3D11CreateDevice(pd3dDevice));
+	g_PassScheduler.RemoveAllPasses();
+	g_PassScheduler.AddPass(L"Scene", RenderScenePass);
+	g_PassScheduler.AddPass(L"Text", RenderTextPass, nullptr, false);
+
 	return hr;
 }
 
@@ -259,10 +274,12 @@ void CALLBACK OnFrameMove(double fTime, float fElapsedTime, void* pUserContext)
 }
 
 //--------------------------------------------------------------------------------------
-// Render the help and statistics text.
+// Render the help and statistics text on the immediate context.  The frame stats are
+// formatted into the render thread's frame arena and the text helper's vertices are
+// shared, so this pass must not be deferred.
 //--------------------------------------------------------------------------------------
-void RenderText() {
-	g_pTextHelper->Begin();
+void CALLBACK RenderTextPass(ID3D11DeviceContext* pd3dContext, void* pUserContext) {
+	g_pTextHelper->Begin(pd3dContext);
 	g_pTextHelper->SetInsertionPos(5, 5);
 	g_pTextHelper->SetForegroundColor(Colors::Yellow);
 	g_pTextHelper->DrawTextLine(DXUTGetFrameStats(DXUTIsVsyncEnabled()));
@@ -271,36 +288,39 @@ void RenderText() {
 }
 
 //--------------------------------------------------------------------------------------
-// Render the scene using the D3D11 device
+// Render the scene on the pass's context, which comes with the back buffer bound
 //--------------------------------------------------------------------------------------
-void CALLBACK OnD3D11FrameRender(ID3D11Device* pd3dDevice, ID3D11DeviceContext* pd3dImmediateContext, double fTime, float fElapsedTime, void* pUserContext) {
+void CALLBACK RenderScenePass(ID3D11DeviceContext* pd3dContext, void* pUserContext) {
+	// Every call below is counted for the headless frame counters as it is made
+	CDXUTCountedContext ctx(pd3dContext);
+
 	//
 	// Clear the back buffer
 	//
 	auto pRTV = DXUTGetD3D11RenderTargetView();
-	pd3dImmediateContext->ClearRenderTargetView(pRTV, Colors::MidnightBlue);
+	ctx.ClearRenderTargetView(pRTV, Colors::MidnightBlue);
 
 	//
 	// Clear the depth stencil
 	//
 	auto pDSV = DXUTGetD3D11DepthStencilView();
-	pd3dImmediateContext->ClearDepthStencilView(pDSV, D3D11_CLEAR_DEPTH, 1.0, 0);
+	ctx.ClearDepthStencilView(pDSV, D3D11_CLEAR_DEPTH, 1.0, 0);
 
 	//
 	// Set Input Layout
 	//
-	pd3dImmediateContext->IASetInputLayout(g_pVertexLayout);
+	ctx.IASetInputLayout(g_pVertexLayout);
 
 	//
 	// Set Vertex and Index buffers
 	//
 	UINT stride = sizeof(Vertex);
 	UINT offset = 0;
-	pd3dImmediateContext->IASetVertexBuffers(0, 1, &g_pVertexBuffer, &stride, &offset);
-	pd3dImmediateContext->IASetIndexBuffer(g_pIndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+	ctx.IASetVertexBuffers(0, 1, &g_pVertexBuffer, &stride, &offset);
+	ctx.IASetIndexBuffer(g_pIndexBuffer, DXGI_FORMAT_R32_UINT, 0);
 
 	// Set primitive topology
-	pd3dImmediateContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	ctx.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
 	//
 	// Get the matrix
@@ -314,27 +334,27 @@ void CALLBACK OnD3D11FrameRender(ID3D11Device* pd3dDevice, ID3D11DeviceContext*
 	//
 	HRESULT hr;
 	D3D11_MAPPED_SUBRESOURCE MappedResource;
-	V(pd3dImmediateContext->Map(g_pConstantBufferPerFrame, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource));
+	V(ctx.Map(g_pConstantBufferPerFrame, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource));
 	auto pCB = reinterpret_cast<ConstantBufferPerFrame*>(MappedResource.pData);
 	XMStoreFloat4x4(&pCB->ModelViewProjection, XMMatrixTranspose(mWorldViewProjection));
 	XMStoreFloat4x4(&pCB->Model, XMMatrixTranspose(g_Model));
 
 	XMStoreFloat4(&pCB->LightDir[0], g_LightDir[0]);
 	XMStoreFloat4(&pCB->LightDir[1], g_LightDir[1]);
-	pd3dImmediateContext->Unmap(g_pConstantBufferPerFrame, 0);
+	ctx.Unmap(g_pConstantBufferPerFrame, 0);
 
 	//
 	// Render the center cube
 	//
-	pd3dImmediateContext->VSSetShader(g_pVertexShader, nullptr, 0);
-	pd3dImmediateContext->VSSetConstantBuffers(0, 1, &g_pConstantBufferPerFrame);
-	pd3dImmediateContext->VSSetConstantBuffers(1, 1, &g_pConstantBufferPersist);
-	pd3dImmediateContext->PSSetShader(g_pPixelShader, nullptr, 0);
-	pd3dImmediateContext->PSSetConstantBuffers(0, 1, &g_pConstantBufferPerFrame);
-	pd3dImmediateContext->PSSetConstantBuffers(1, 1, &g_pConstantBufferPersist);
-	pd3dImmediateContext->PSSetShaderResources(0, 1, &g_pTextureRV);
-	pd3dImmediateContext->PSSetSamplers(0, 1, &g_pSamplerLinear);
-	pd3dImmediateContext->DrawIndexed(36, 0, 0);
+	ctx.VSSetShader(g_pVertexShader, nullptr, 0);
+	ctx.VSSetConstantBuffers(0, 1, &g_pConstantBufferPerFrame);
+	ctx.VSSetConstantBuffers(1, 1, &g_pConstantBufferPersist);
+	ctx.PSSetShader(g_pPixelShader, nullptr, 0);
+	ctx.PSSetConstantBuffers(0, 1, &g_pConstantBufferPerFrame);
+	ctx.PSSetConstantBuffers(1, 1, &g_pConstantBufferPersist);
+	ctx.PSSetShaderResources(0, 1, &g_pTextureRV);
+	ctx.PSSetSamplers(0, 1, &g_pSamplerLinear);
+	ctx.DrawIndexed(36, 0, 0);
 
 	//
 	// Update variables for the first light
@@ -342,57 +362,63 @@ void CALLBACK OnD3D11FrameRender(ID3D11Device* pd3dDevice, ID3D11DeviceContext*
 	XMMATRIX mLight = XMMatrixScaling(0.25f, 0.25f, 0.25f) * XMMatrixTranslationFromVector(4 * g_LightDir[0]);
 	mWorldViewProjection = mLight * mView * mProj;
 
-	V(pd3dImmediateContext->Map(g_pConstantBufferPerFrame, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource));
+	V(ctx.Map(g_pConstantBufferPerFrame, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource));
 	pCB = reinterpret_cast<ConstantBufferPerFrame*>(MappedResource.pData);
 	XMStoreFloat4x4(&pCB->ModelViewProjection, XMMatrixTranspose(mWorldViewProjection));
 	XMStoreFloat4x4(&pCB->Model, XMMatrixTranspose(mLight));
 
 	XMStoreFloat4(&pCB->LightDir[0], g_LightDir[0]);
 	XMStoreFloat4(&pCB->LightDir[1], g_LightDir[1]);
-	pd3dImmediateContext->Unmap(g_pConstantBufferPerFrame, 0);
+	ctx.Unmap(g_pConstantBufferPerFrame, 0);
 
 	//
 	// Render the first light
 	//
-	pd3dImmediateContext->VSSetShader(g_pVertexShader, nullptr, 0);
-	pd3dImmediateContext->VSSetConstantBuffers(0, 1, &g_pConstantBufferPerFrame);
-	pd3dImmediateContext->VSSetConstantBuffers(1, 1, &g_pConstantBufferPersist);
-	pd3dImmediateContext->PSSetShader(g_pPixelShader, nullptr, 0);
-	pd3dImmediateContext->PSSetConstantBuffers(0, 1, &g_pConstantBufferPerFrame);
-	pd3dImmediateContext->PSSetConstantBuffers(1, 1, &g_pConstantBufferPersist);
-	pd3dImmediateContext->PSSetShaderResources(0, 1, &g_pTextureRV);
-	pd3dImmediateContext->PSSetSamplers(0, 1, &g_pSamplerLinear);
-	pd3dImmediateContext->DrawIndexed(36, 0, 0);
+	ctx.VSSetShader(g_pVertexShader, nullptr, 0);
+	ctx.VSSetConstantBuffers(0, 1, &g_pConstantBufferPerFrame);
+	ctx.VSSetConstantBuffers(1, 1, &g_pConstantBufferPersist);
+	ctx.PSSetShader(g_pPixelShader, nullptr, 0);
+	ctx.PSSetConstantBuffers(0, 1, &g_pConstantBufferPerFrame);
+	ctx.PSSetConstantBuffers(1, 1, &g_pConstantBufferPersist);
+	ctx.PSSetShaderResources(0, 1, &g_pTextureRV);
+	ctx.PSSetSamplers(0, 1, &g_pSamplerLinear);
+	ctx.DrawIndexed(36, 0, 0);
 
 	//
 	// Update variables for the second light
 	//
 	mLight = XMMatrixScaling(0.25f, 0.25f, 0.25f) * XMMatrixTranslationFromVector(4 * g_LightDir[1]);
 	mWorldViewProjection = mLight * mView * mProj;
-	V(pd3dImmediateContext->Map(g_pConstantBufferPerFrame, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource));
+	V(ctx.Map(g_pConstantBufferPerFrame, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource));
 	pCB = reinterpret_cast<ConstantBufferPerFrame*>(MappedResource.pData);
 	XMStoreFloat4x4(&pCB->ModelViewProjection, XMMatrixTranspose(mWorldViewProjection));
 	XMStoreFloat4x4(&pCB->Model, XMMatrixTranspose(mLight));
 
 	XMStoreFloat4(&pCB->LightDir[0], g_LightDir[0]);
 	XMStoreFloat4(&pCB->LightDir[1], g_LightDir[1]);
-	pd3dImmediateContext->Unmap(g_pConstantBufferPerFrame, 0);
+	ctx.Unmap(g_pConstantBufferPerFrame, 0);
 
 	//
 	// Render the second light
 	//
-	pd3dImmediateContext->VSSetShader(g_pVertexShader, nullptr, 0);
-	pd3dImmediateContext->VSSetConstantBuffers(0, 1, &g_pConstantBufferPerFrame);
-	pd3dImmediateContext->VSSetConstantBuffers(1, 1, &g_pConstantBufferPersist);
-	pd3dImmediateContext->PSSetShader(g_pPixelShader, nullptr, 0);
-	pd3dImmediateContext->PSSetConstantBuffers(0, 1, &g_pConstantBufferPerFrame);
-	pd3dImmediateContext->PSSetConstantBuffers(1, 1, &g_pConstantBufferPersist);
-	pd3dImmediateContext->PSSetShaderResources(0, 1, &g_pTextureRV);
-	pd3dImmediateContext->PSSetSamplers(0, 1, &g_pSamplerLinear);
-	pd3dImmediateContext->DrawIndexed(36, 0, 0);
-
-	// Render Text
-	RenderText();
+	ctx.VSSetShader(g_pVertexShader, nullptr, 0);
+	ctx.VSSetConstantBuffers(0, 1, &g_pConstantBufferPerFrame);
+	ctx.VSSetConstantBuffers(1, 1, &g_pConstantBufferPersist);
+	ctx.PSSetShader(g_pPixelShader, nullptr, 0);
+	ctx.PSSetConstantBuffers(0, 1, &g_pConstantBufferPerFrame);
+	ctx.PSSetConstantBuffers(1, 1, &g_pConstantBufferPersist);
+	ctx.PSSetShaderResources(0, 1, &g_pTextureRV);
+	ctx.PSSetSamplers(0, 1, &g_pSamplerLinear);
+	ctx.DrawIndexed(36, 0, 0);
+}
+
+
+//--------------------------------------------------------------------------------------
+// Render the scene using the D3D11 device
+//--------------------------------------------------------------------------------------
+void CALLBACK OnD3D11FrameRender(ID3D11Device* pd3dDevice, ID3D11DeviceContext* pd3dImmediateContext, double fTime, float fElapsedTime, void* pUserContext) {
+	HRESULT hr;
+	V(g_PassScheduler.Render(pd3dImmediateContext));
 }
 
 
@@ -418,6 +444,7 @@ void CALLBACK OnD3D11DestroyDevice(void* pUserContext) {
 	SAFE_RELEASE(g_pTextureRV);
 	SAFE_RELEASE(g_pSamplerLinear);
 
+	g_PassScheduler.OnD3D11DestroyDevice();
 	g_DialogResourceManager.OnD3D11DestroyDevice();
 	DXUTGetGlobalResourceCache().OnDestroyDevice();
 	SAFE_DELETE(g_pTextHelper);
@@ -493,6 +520,18 @@ int WINAPI wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
 
 	// Only require 10-level hardware or later
 	DXUTCreateDevice(D3D_FEATURE_LEVEL_11_0, true, 800, 600);
+
+	// -assetbenchmark times the asset loaders on the device instead of running the sample
+	WCHAR strAssetReport[MAX_PATH];
+	UINT nAssetScale = 1;
+	if (DXUTGetAssetBenchmarkArgs(strAssetReport, MAX_PATH, &nAssetScale)) {
+		DXUT_ASSET_BENCHMARK_DESC desc;
+		DXUTGetDefaultAssetBenchmarkDesc(&desc, nAssetScale);
+		HRESULT hr = DXUTRunAssetBenchmark(DXUTGetD3D11Device(), DXUTGetD3D11DeviceContext(), &desc, L"AssetBenchmarkCorpus", strAssetReport);
+		DXUTShutdown(SUCCEEDED(hr) ? 0 : 1);
+		return DXUTGetExitCode();
+	}
+
 	DXUTMainLoop(); // Enter into the DXUT ren  der loop
 
 	// Perform any application-level cleanup here
@@ -0,0 +1,296 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTRecordingContext.h
+//
+// An ID3D11DeviceContext that draws nothing and records what it is asked to do: how many
+// input assembler, shader resource and draw calls were made, and the state bound at each
+// draw.  Lets a test see the exact calls a renderer makes without reading them back from
+// a real device.  Include after DXUT.h.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+#include <string.h>
+#include <vector>
+
+#define DXUT_RECORDED_SRV_SLOTS 8
+
+// State in effect at one draw
+struct DXUT_RECORDED_DRAW
+{
+    bool bIndirect;
+    UINT IndexCount;
+    UINT InstanceCount;
+    UINT StartIndex;
+    INT BaseVertex;
+    UINT StartInstance;
+    ID3D11Buffer* pArgs;                // DrawIndexedInstancedIndirect only
+    UINT ArgsOffset;
+
+    D3D11_PRIMITIVE_TOPOLOGY Topology;
+    ID3D11Buffer* pIB;
+    DXGI_FORMAT IBFormat;
+    UINT IBOffset;
+    ID3D11Buffer* pVB[2];
+    UINT Strides[2];
+    UINT Offsets[2];
+    ID3D11ShaderResourceView* pPSSRVs[DXUT_RECORDED_SRV_SLOTS];
+    ID3D11ShaderResourceView* pVSSRVs[DXUT_RECORDED_SRV_SLOTS];
+};
+
+// Stages whose calls are accepted and dropped
+#define DXUT_RECORDING_IGNORE_STAGE( Stage, ShaderType ) \
+    void STDMETHODCALLTYPE Stage##SetShader( ShaderType*, ID3D11ClassInstance* const*, UINT ) override {} \
+    void STDMETHODCALLTYPE Stage##SetSamplers( UINT, UINT, ID3D11SamplerState* const* ) override {} \
+    void STDMETHODCALLTYPE Stage##SetConstantBuffers( UINT, UINT, ID3D11Buffer* const* ) override {} \
+    void STDMETHODCALLTYPE Stage##GetShader( ShaderType** ppShader, ID3D11ClassInstance**, UINT* pNum ) override \
+        { if( ppShader ) *ppShader = nullptr; if( pNum ) *pNum = 0; } \
+    void STDMETHODCALLTYPE Stage##GetSamplers( UINT, UINT n, ID3D11SamplerState** pp ) override { ClearOut( pp, n ); } \
+    void STDMETHODCALLTYPE Stage##GetConstantBuffers( UINT, UINT n, ID3D11Buffer** pp ) override { ClearOut( pp, n ); }
+
+#define DXUT_RECORDING_IGNORE_SRVS( Stage ) \
+    void STDMETHODCALLTYPE Stage##SetShaderResources( UINT, UINT, ID3D11ShaderResourceView* const* ) override {} \
+    void STDMETHODCALLTYPE Stage##GetShaderResources( UINT, UINT n, ID3D11ShaderResourceView** pp ) override { ClearOut( pp, n ); }
+
+class CDXUTRecordingContext : public ID3D11DeviceContext
+{
+public:
+    explicit CDXUTRecordingContext( _In_ ID3D11Device* pDevice ) :
+        m_pDevice( pDevice ),
+        m_cRef( 1 )
+    {
+        Reset();
+    }
+
+    // Forgets the calls and the bound state
+    void Reset()
+    {
+        nVertexBufferCalls = nIndexBufferCalls = nTopologyCalls = nPSResourceCalls = nVSResourceCalls = 0;
+        Draws.clear();
+        memset( &m_State, 0, sizeof( m_State ) );
+    }
+
+    // Calls that change state, as opposed to draws
+    UINT GetStateCalls() const { return nVertexBufferCalls + nIndexBufferCalls + nTopologyCalls + nPSResourceCalls + nVSResourceCalls; }
+
+    UINT nVertexBufferCalls;
+    UINT nIndexBufferCalls;
+    UINT nTopologyCalls;
+    UINT nPSResourceCalls;
+    UINT nVSResourceCalls;
+    std::vector<DXUT_RECORDED_DRAW> Draws;
+
+    // IUnknown; the context lives on the stack, so the count is only checked
+    HRESULT STDMETHODCALLTYPE QueryInterface( REFIID riid, void** ppvObject ) override
+    {
+        if( !ppvObject )
+            return E_POINTER;
+        if( riid == __uuidof( IUnknown ) || riid == __uuidof( ID3D11DeviceChild ) || riid == __uuidof( ID3D11DeviceContext ) )
+        {
+            *ppvObject = this;
+            AddRef();
+            return S_OK;
+        }
+        *ppvObject = nullptr;
+        return E_NOINTERFACE;
+    }
+    ULONG STDMETHODCALLTYPE AddRef() override { return ++m_cRef; }
+    ULONG STDMETHODCALLTYPE Release() override { return --m_cRef; }
+
+    // ID3D11DeviceChild
+    void STDMETHODCALLTYPE GetDevice( ID3D11Device** ppDevice ) override
+    {
+        *ppDevice = m_pDevice;
+        if( m_pDevice )
+            m_pDevice->AddRef();
+    }
+    HRESULT STDMETHODCALLTYPE GetPrivateData( REFGUID, UINT*, void* ) override { return DXGI_ERROR_NOT_FOUND; }
+    HRESULT STDMETHODCALLTYPE SetPrivateData( REFGUID, UINT, const void* ) override { return S_OK; }
+    HRESULT STDMETHODCALLTYPE SetPrivateDataInterface( REFGUID, const IUnknown* ) override { return S_OK; }
+
+    // Recorded calls
+    void STDMETHODCALLTYPE IASetVertexBuffers( UINT StartSlot, UINT NumBuffers, ID3D11Buffer* const* ppVertexBuffers,
+                                               const UINT* pStrides, const UINT* pOffsets ) override
+    {
+        ++nVertexBufferCalls;
+        for( UINT i = 0; i < NumBuffers; ++i )
+        {
+            if( StartSlot + i < _countof( m_State.pVB ) )
+            {
+                m_State.pVB[StartSlot + i] = ppVertexBuffers ? ppVertexBuffers[i] : nullptr;
+                m_State.Strides[StartSlot + i] = pStrides ? pStrides[i] : 0;
+                m_State.Offsets[StartSlot + i] = pOffsets ? pOffsets[i] : 0;
+            }
+        }
+    }
+    void STDMETHODCALLTYPE IASetIndexBuffer( ID3D11Buffer* pIndexBuffer, DXGI_FORMAT Format, UINT Offset ) override
+    {
+        ++nIndexBufferCalls;
+        m_State.pIB = pIndexBuffer;
+        m_State.IBFormat = Format;
+        m_State.IBOffset = Offset;
+    }
+    void STDMETHODCALLTYPE IASetPrimitiveTopology( D3D11_PRIMITIVE_TOPOLOGY Topology ) override
+    {
+        ++nTopologyCalls;
+        m_State.Topology = Topology;
+    }
+    void STDMETHODCALLTYPE PSSetShaderResources( UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView* const* ppShaderResourceViews ) override
+    {
+        ++nPSResourceCalls;
+        SetViews( m_State.pPSSRVs, StartSlot, NumViews, ppShaderResourceViews );
+    }
+    void STDMETHODCALLTYPE VSSetShaderResources( UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView* const* ppShaderResourceViews ) override
+    {
+        ++nVSResourceCalls;
+        SetViews( m_State.pVSSRVs, StartSlot, NumViews, ppShaderResourceViews );
+    }
+    void STDMETHODCALLTYPE DrawIndexed( UINT IndexCount, UINT StartIndexLocation, INT BaseVertexLocation ) override
+    {
+        DrawIndexedInstanced( IndexCount, 1, StartIndexLocation, BaseVertexLocation, 0 );
+    }
+    void STDMETHODCALLTYPE DrawIndexedInstanced( UINT IndexCountPerInstance, UINT InstanceCount, UINT StartIndexLocation,
+                                                 INT BaseVertexLocation, UINT StartInstanceLocation ) override
+    {
+        DXUT_RECORDED_DRAW draw = m_State;
+        draw.bIndirect = false;
+        draw.IndexCount = IndexCountPerInstance;
+        draw.InstanceCount = InstanceCount;
+        draw.StartIndex = StartIndexLocation;
+        draw.BaseVertex = BaseVertexLocation;
+        draw.StartInstance = StartInstanceLocation;
+        Draws.push_back( draw );
+    }
+    void STDMETHODCALLTYPE DrawIndexedInstancedIndirect( ID3D11Buffer* pBufferForArgs, UINT AlignedByteOffsetForArgs ) override
+    {
+        DXUT_RECORDED_DRAW draw = m_State;
+        draw.bIndirect = true;
+        draw.pArgs = pBufferForArgs;
+        draw.ArgsOffset = AlignedByteOffsetForArgs;
+        Draws.push_back( draw );
+    }
+
+    void STDMETHODCALLTYPE PSGetShaderResources( UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView** ppShaderResourceViews ) override
+    {
+        GetViews( m_State.pPSSRVs, StartSlot, NumViews, ppShaderResourceViews );
+    }
+    void STDMETHODCALLTYPE VSGetShaderResources( UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView** ppShaderResourceViews ) override
+    {
+        GetViews( m_State.pVSSRVs, StartSlot, NumViews, ppShaderResourceViews );
+    }
+
+    // Everything else is accepted and dropped
+    DXUT_RECORDING_IGNORE_STAGE( VS, ID3D11VertexShader )
+    DXUT_RECORDING_IGNORE_STAGE( HS, ID3D11HullShader )
+    DXUT_RECORDING_IGNORE_STAGE( DS, ID3D11DomainShader )
+    DXUT_RECORDING_IGNORE_STAGE( GS, ID3D11GeometryShader )
+    DXUT_RECORDING_IGNORE_STAGE( PS, ID3D11PixelShader )
+    DXUT_RECORDING_IGNORE_STAGE( CS, ID3D11ComputeShader )
+    DXUT_RECORDING_IGNORE_SRVS( HS )
+    DXUT_RECORDING_IGNORE_SRVS( DS )
+    DXUT_RECORDING_IGNORE_SRVS( GS )
+    DXUT_RECORDING_IGNORE_SRVS( CS )
+
+    void STDMETHODCALLTYPE Draw( UINT, UINT ) override {}
+    HRESULT STDMETHODCALLTYPE Map( ID3D11Resource*, UINT, D3D11_MAP, UINT, D3D11_MAPPED_SUBRESOURCE* ) override { return E_NOTIMPL; }
+    void STDMETHODCALLTYPE Unmap( ID3D11Resource*, UINT ) override {}
+    void STDMETHODCALLTYPE IASetInputLayout( ID3D11InputLayout* ) override {}
+    void STDMETHODCALLTYPE DrawInstanced( UINT, UINT, UINT, UINT ) override {}
+    void STDMETHODCALLTYPE Begin( ID3D11Asynchronous* ) override {}
+    void STDMETHODCALLTYPE End( ID3D11Asynchronous* ) override {}
+    HRESULT STDMETHODCALLTYPE GetData( ID3D11Asynchronous*, void*, UINT, UINT ) override { return E_NOTIMPL; }
+    void STDMETHODCALLTYPE SetPredication( ID3D11Predicate*, BOOL ) override {}
+    void STDMETHODCALLTYPE OMSetRenderTargets( UINT, ID3D11RenderTargetView* const*, ID3D11DepthStencilView* ) override {}
+    void STDMETHODCALLTYPE OMSetRenderTargetsAndUnorderedAccessViews( UINT, ID3D11RenderTargetView* const*, ID3D11DepthStencilView*,
+                                                                      UINT, UINT, ID3D11UnorderedAccessView* const*, const UINT* ) override {}
+    void STDMETHODCALLTYPE OMSetBlendState( ID3D11BlendState*, const FLOAT[4], UINT ) override {}
+    void STDMETHODCALLTYPE OMSetDepthStencilState( ID3D11DepthStencilState*, UINT ) override {}
+    void STDMETHODCALLTYPE SOSetTargets( UINT, ID3D11Buffer* const*, const UINT* ) override {}
+    void STDMETHODCALLTYPE DrawAuto() override {}
+    void STDMETHODCALLTYPE DrawInstancedIndirect( ID3D11Buffer*, UINT ) override {}
+    void STDMETHODCALLTYPE Dispatch( UINT, UINT, UINT ) override {}
+    void STDMETHODCALLTYPE DispatchIndirect( ID3D11Buffer*, UINT ) override {}
+    void STDMETHODCALLTYPE RSSetState( ID3D11RasterizerState* ) override {}
+    void STDMETHODCALLTYPE RSSetViewports( UINT, const D3D11_VIEWPORT* ) override {}
+    void STDMETHODCALLTYPE RSSetScissorRects( UINT, const D3D11_RECT* ) override {}
+    void STDMETHODCALLTYPE CopySubresourceRegion( ID3D11Resource*, UINT, UINT, UINT, UINT, ID3D11Resource*, UINT, const D3D11_BOX* ) override {}
+    void STDMETHODCALLTYPE CopyResource( ID3D11Resource*, ID3D11Resource* ) override {}
+    void STDMETHODCALLTYPE UpdateSubresource( ID3D11Resource*, UINT, const D3D11_BOX*, const void*, UINT, UINT ) override {}
+    void STDMETHODCALLTYPE CopyStructureCount( ID3D11Buffer*, UINT, ID3D11UnorderedAccessView* ) override {}
+    void STDMETHODCALLTYPE ClearRenderTargetView( ID3D11RenderTargetView*, const FLOAT[4] ) override {}
+    void STDMETHODCALLTYPE ClearUnorderedAccessViewUint( ID3D11UnorderedAccessView*, const UINT[4] ) override {}
+    void STDMETHODCALLTYPE ClearUnorderedAccessViewFloat( ID3D11UnorderedAccessView*, const FLOAT[4] ) override {}
+    void STDMETHODCALLTYPE ClearDepthStencilView( ID3D11DepthStencilView*, UINT, FLOAT, UINT8 ) override {}
+    void STDMETHODCALLTYPE GenerateMips( ID3D11ShaderResourceView* ) override {}
+    void STDMETHODCALLTYPE SetResourceMinLOD( ID3D11Resource*, FLOAT ) override {}
+    FLOAT STDMETHODCALLTYPE GetResourceMinLOD( ID3D11Resource* ) override { return 0.0f; }
+    void STDMETHODCALLTYPE ResolveSubresource( ID3D11Resource*, UINT, ID3D11Resource*, UINT, DXGI_FORMAT ) override {}
+    void STDMETHODCALLTYPE ExecuteCommandList( ID3D11CommandList*, BOOL ) override {}
+    void STDMETHODCALLTYPE CSSetUnorderedAccessViews( UINT, UINT, ID3D11UnorderedAccessView* const*, const UINT* ) override {}
+    void STDMETHODCALLTYPE IAGetInputLayout( ID3D11InputLayout** pp ) override { *pp = nullptr; }
+    void STDMETHODCALLTYPE IAGetVertexBuffers( UINT, UINT n, ID3D11Buffer** pp, UINT*, UINT* ) override { ClearOut( pp, n ); }
+    void STDMETHODCALLTYPE IAGetIndexBuffer( ID3D11Buffer** pp, DXGI_FORMAT*, UINT* ) override { if( pp ) *pp = nullptr; }
+    void STDMETHODCALLTYPE IAGetPrimitiveTopology( D3D11_PRIMITIVE_TOPOLOGY* pTopology ) override { *pTopology = m_State.Topology; }
+    void STDMETHODCALLTYPE GetPredication( ID3D11Predicate** pp, BOOL* ) override { if( pp ) *pp = nullptr; }
+    void STDMETHODCALLTYPE OMGetRenderTargets( UINT n, ID3D11RenderTargetView** pp, ID3D11DepthStencilView** ppDSV ) override
+        { ClearOut( pp, n ); if( ppDSV ) *ppDSV = nullptr; }
+    void STDMETHODCALLTYPE OMGetRenderTargetsAndUnorderedAccessViews( UINT n, ID3D11RenderTargetView** pp, ID3D11DepthStencilView** ppDSV,
+                                                                      UINT, UINT nUAVs, ID3D11UnorderedAccessView** ppUAVs ) override
+        { ClearOut( pp, n ); if( ppDSV ) *ppDSV = nullptr; ClearOut( ppUAVs, nUAVs ); }
+    void STDMETHODCALLTYPE OMGetBlendState( ID3D11BlendState** pp, FLOAT[4], UINT* ) override { if( pp ) *pp = nullptr; }
+    void STDMETHODCALLTYPE OMGetDepthStencilState( ID3D11DepthStencilState** pp, UINT* ) override { if( pp ) *pp = nullptr; }
+    void STDMETHODCALLTYPE SOGetTargets( UINT n, ID3D11Buffer** pp ) override { ClearOut( pp, n ); }
+    void STDMETHODCALLTYPE RSGetState( ID3D11RasterizerState** pp ) override { *pp = nullptr; }
+    void STDMETHODCALLTYPE RSGetViewports( UINT* pNum, D3D11_VIEWPORT* ) override { *pNum = 0; }
+    void STDMETHODCALLTYPE RSGetScissorRects( UINT* pNum, D3D11_RECT* ) override { *pNum = 0; }
+    void STDMETHODCALLTYPE CSGetUnorderedAccessViews( UINT, UINT n, ID3D11UnorderedAccessView** pp ) override { ClearOut( pp, n ); }
+    void STDMETHODCALLTYPE ClearState() override { memset( &m_State, 0, sizeof( m_State ) ); }
+    void STDMETHODCALLTYPE Flush() override {}
+    D3D11_DEVICE_CONTEXT_TYPE STDMETHODCALLTYPE GetType() override { return D3D11_DEVICE_CONTEXT_DEFERRED; }
+    UINT STDMETHODCALLTYPE GetContextFlags() override { return 0; }
+    HRESULT STDMETHODCALLTYPE FinishCommandList( BOOL, ID3D11CommandList** pp ) override { *pp = nullptr; return E_NOTIMPL; }
+
+private:
+    CDXUTRecordingContext( const CDXUTRecordingContext& );
+    CDXUTRecordingContext& operator=( const CDXUTRecordingContext& );
+
+    template<class T> static void ClearOut( T** pp, UINT n )
+    {
+        for( UINT i = 0; pp && i < n; ++i )
+            pp[i] = nullptr;
+    }
+
+    static void SetViews( ID3D11ShaderResourceView** pSlots, UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView* const* ppViews )
+    {
+        for( UINT i = 0; i < NumViews; ++i )
+        {
+            if( StartSlot + i < DXUT_RECORDED_SRV_SLOTS )
+                pSlots[StartSlot + i] = ppViews ? ppViews[i] : nullptr;
+        }
+    }
+
+    // Views handed out are referenced, as the real context does
+    static void GetViews( ID3D11ShaderResourceView* const* pSlots, UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView** ppViews )
+    {
+        for( UINT i = 0; i < NumViews; ++i )
+        {
+            ppViews[i] = ( StartSlot + i < DXUT_RECORDED_SRV_SLOTS ) ? pSlots[StartSlot + i] : nullptr;
+            if( ppViews[i] )
+                ppViews[i]->AddRef();
+        }
+    }
+
+    ID3D11Device* m_pDevice;
+    ULONG m_cRef;
+    DXUT_RECORDED_DRAW m_State;         // What is bound now; the draw fields are unused
+};
+
+#undef DXUT_RECORDING_IGNORE_STAGE
+#undef DXUT_RECORDING_IGNORE_SRVS
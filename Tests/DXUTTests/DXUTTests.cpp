@@ -0,0 +1,96 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTTests.cpp
+//
+// Runs the registered DXUT tests.
+//
+//   DXUTTests [<name>...]
+//
+// With names, only the tests whose names contain one of them are run.  The exit code is
+// the number of tests that failed.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUTTests.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+namespace
+{
+
+struct DXUT_TEST_ENTRY
+{
+    const char* strName;
+    LPDXUTTEST pfnTest;
+};
+
+// Function-local so registration from other files never sees it unconstructed
+std::vector<DXUT_TEST_ENTRY>& GetTests()
+{
+    static std::vector<DXUT_TEST_ENTRY> s_Tests;
+    return s_Tests;
+}
+
+unsigned g_nFailures = 0;   // Checks failed by the running test
+
+bool IsSelected( const char* strName, int argc, char* argv[] )
+{
+    if( argc < 2 )
+        return true;
+    for( int i = 1; i < argc; ++i )
+    {
+        if( strstr( strName, argv[i] ) )
+            return true;
+    }
+    return false;
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+DXUTTestRegistration::DXUTTestRegistration( const char* strName, LPDXUTTEST pfnTest )
+{
+    DXUT_TEST_ENTRY entry = { strName, pfnTest };
+    GetTests().push_back( entry );
+}
+
+
+//--------------------------------------------------------------------------------------
+void DXUTTestFail( const char* strFile, int nLine, const char* strExpression )
+{
+    printf( "  %s(%d): check failed: %s\n", strFile, nLine, strExpression );
+    ++g_nFailures;
+}
+
+
+//--------------------------------------------------------------------------------------
+int main( int argc, char* argv[] )
+{
+    int nFailed = 0;
+    int nRun = 0;
+    const std::vector<DXUT_TEST_ENTRY>& tests = GetTests();
+    for( auto it = tests.cbegin(); it != tests.cend(); ++it )
+    {
+        if( !IsSelected( it->strName, argc, argv ) )
+            continue;
+
+        g_nFailures = 0;
+        it->pfnTest();
+        printf( "%s: %s\n", it->strName, g_nFailures ? "FAILED" : "ok" );
+        if( g_nFailures )
+            ++nFailed;
+        ++nRun;
+    }
+
+    printf( "%d of %d tests passed\n", nRun - nFailed, nRun );
+    return nFailed;
+}
@@ -0,0 +1,36 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTTests.h
+//
+// Minimal test registry for the DXUT tests.  Each test file defines its tests with
+// DXUT_TEST, which registers them before main runs, so a build only needs to list the
+// files it can compile.  The harness itself has no Windows dependency, so the portable
+// tests also build and run elsewhere.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#pragma once
+
+typedef void (*LPDXUTTEST)();
+
+struct DXUTTestRegistration
+{
+    DXUTTestRegistration( const char* strName, LPDXUTTEST pfnTest );
+};
+
+// Records a failure of the running test and carries on with it
+void DXUTTestFail( const char* strFile, int nLine, const char* strExpression );
+
+#define DXUT_TEST( name ) \
+    static void name(); \
+    static DXUTTestRegistration s_##name##Registration( #name, name ); \
+    static void name()
+
+#define DXUT_CHECK( expression ) \
+    do { if( !( expression ) ) DXUTTestFail( __FILE__, __LINE__, #expression ); } while( 0 )
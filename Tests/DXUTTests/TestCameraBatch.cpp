@@ -0,0 +1,283 @@
+//--------------------------------------------------------------------------------------
+// File: TestCameraBatch.cpp
+//
+// Checks CDXUTCameraBatch against the one-view-at-a-time DirectXMath path, and times a
+// batch Update against a camera per view.  Needs only DirectXMath.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUTCameraBatch.h"
+#include "DXUTTests.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <chrono>
+
+using namespace DirectX;
+
+namespace
+{
+
+struct TEST_VIEW
+{
+    XMFLOAT3 vEye;
+    XMFLOAT3 vLookat;
+    XMFLOAT3 vUp;
+    float fFOV;
+    float fAspect;
+    float fNear;
+    float fFar;
+};
+
+// Five views, so the second group of four is padded
+const TEST_VIEW s_Views[] =
+{
+    { XMFLOAT3( 0, 0, -5 ),     XMFLOAT3( 0, 0, 0 ),    XMFLOAT3( 0, 1, 0 ), XM_PIDIV4,  16.0f / 9.0f, 0.1f, 1000.0f },
+    { XMFLOAT3( 3, 4, 5 ),      XMFLOAT3( -1, 0, 2 ),   XMFLOAT3( 0, 1, 0 ), XM_PIDIV2,  1.0f,         1.0f, 50.0f },
+    { XMFLOAT3( -10, 2, 7 ),    XMFLOAT3( 4, -3, 1 ),   XMFLOAT3( 0, 0, 1 ), 1.0f,       4.0f / 3.0f,  0.5f, 200.0f },
+    { XMFLOAT3( 100, 50, -20 ), XMFLOAT3( 99, 50, -20 ), XMFLOAT3( 0, 1, 0 ), 0.3f,      2.0f,         2.0f, 10000.0f },
+    { XMFLOAT3( 0.5f, -2, 1 ),  XMFLOAT3( 0.5f, -2, 9 ), XMFLOAT3( 1, 1, 0 ), 2.0f,      0.75f,        0.01f, 10.0f },
+};
+
+const uint32_t NUM_TEST_VIEWS = sizeof( s_Views ) / sizeof( s_Views[0] );
+
+const uint32_t BENCHMARK_VIEWS = 1024;
+const uint32_t BENCHMARK_PASSES = 200;
+
+bool NearlyEqual( float a, float b )
+{
+    return fabsf( a - b ) <= 1e-4f * std::max<float>( 1.0f, std::max<float>( fabsf( a ), fabsf( b ) ) );
+}
+
+bool MatricesMatch( const XMFLOAT4X4& m, CXMMATRIX expected )
+{
+    XMFLOAT4X4 e;
+    XMStoreFloat4x4( &e, expected );
+    for( uint32_t r = 0; r < 4; ++r )
+    {
+        for( uint32_t c = 0; c < 4; ++c )
+        {
+            if( !NearlyEqual( m.m[r][c], e.m[r][c] ) )
+                return false;
+        }
+    }
+    return true;
+}
+
+// Gribb and Hartmann, one plane at a time
+void ComputePlanes( CXMMATRIX mViewProj, XMFLOAT4* pPlanes )
+{
+    XMMATRIX mT = XMMatrixTranspose( mViewProj );
+    XMVECTOR planes[6] =
+    {
+        mT.r[3] + mT.r[0],
+        mT.r[3] - mT.r[0],
+        mT.r[3] + mT.r[1],
+        mT.r[3] - mT.r[1],
+        mT.r[2],
+        mT.r[3] - mT.r[2],
+    };
+
+    for( uint32_t p = 0; p < 6; ++p )
+        XMStoreFloat4( &pPlanes[p], XMPlaneNormalize( planes[p] ) );
+}
+
+bool PlanesMatch( const XMFLOAT4* pPlanes, CXMMATRIX mViewProj )
+{
+    XMFLOAT4 expected[6];
+    ComputePlanes( mViewProj, expected );
+    for( uint32_t p = 0; p < 6; ++p )
+    {
+        const XMFLOAT4& e = expected[p];
+        if( !NearlyEqual( pPlanes[p].x, e.x ) || !NearlyEqual( pPlanes[p].y, e.y ) ||
+            !NearlyEqual( pPlanes[p].z, e.z ) || !NearlyEqual( pPlanes[p].w, e.w ) )
+            return false;
+    }
+    return true;
+}
+
+bool ResultMatches( const DXUT_CAMERA_BATCH_RESULT& result, FXMVECTOR vEye, FXMVECTOR vLookat, FXMVECTOR vUp,
+                    float fFOV, float fAspect, float fNear, float fFar )
+{
+    XMMATRIX mView = XMMatrixLookAtLH( vEye, vLookat, vUp );
+    XMMATRIX mProj = XMMatrixPerspectiveFovLH( fFOV, fAspect, fNear, fFar );
+    XMMATRIX mViewProj = mView * mProj;
+
+    return MatricesMatch( result.mView, mView ) &&
+           MatricesMatch( result.mProj, mProj ) &&
+           MatricesMatch( result.mViewProj, mViewProj ) &&
+           PlanesMatch( result.Planes, mViewProj );
+}
+
+bool ViewMatches( const DXUT_CAMERA_BATCH_RESULT& result, const TEST_VIEW& view )
+{
+    return ResultMatches( result, XMLoadFloat3( &view.vEye ), XMLoadFloat3( &view.vLookat ), XMLoadFloat3( &view.vUp ),
+                          view.fFOV, view.fAspect, view.fNear, view.fFar );
+}
+
+void AddTestViews( CDXUTCameraBatch& batch )
+{
+    for( uint32_t i = 0; i < NUM_TEST_VIEWS; ++i )
+    {
+        const TEST_VIEW& view = s_Views[i];
+        batch.AddView( XMLoadFloat3( &view.vEye ), XMLoadFloat3( &view.vLookat ), XMLoadFloat3( &view.vUp ),
+                       view.fFOV, view.fAspect, view.fNear, view.fFar );
+    }
+}
+
+// The test views, moved a little for each copy so no two are the same
+TEST_VIEW GetBenchmarkView( uint32_t i )
+{
+    TEST_VIEW view = s_Views[i % NUM_TEST_VIEWS];
+    float fOffset = float( i / NUM_TEST_VIEWS ) * 0.01f;
+    view.vEye.x += fOffset;
+    view.vLookat.y -= fOffset;
+    return view;
+}
+
+// What a camera per view does: FrameMove's XMMatrixLookAtLH, SetProjParams's
+// XMMatrixPerspectiveFovLH, then the product and planes a renderer culls with
+void UpdateOneView( const TEST_VIEW& view, DXUT_CAMERA_BATCH_RESULT& result )
+{
+    XMMATRIX mView = XMMatrixLookAtLH( XMLoadFloat3( &view.vEye ), XMLoadFloat3( &view.vLookat ), XMLoadFloat3( &view.vUp ) );
+    XMMATRIX mProj = XMMatrixPerspectiveFovLH( view.fFOV, view.fAspect, view.fNear, view.fFar );
+    XMMATRIX mViewProj = mView * mProj;
+
+    XMStoreFloat4x4( &result.mView, mView );
+    XMStoreFloat4x4( &result.mProj, mProj );
+    XMStoreFloat4x4( &result.mViewProj, mViewProj );
+    ComputePlanes( mViewProj, result.Planes );
+}
+
+double SecondsSince( std::chrono::high_resolution_clock::time_point start )
+{
+    return std::chrono::duration<double>( std::chrono::high_resolution_clock::now() - start ).count();
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( CameraBatchMatchesScalarPath )
+{
+    CDXUTCameraBatch batch;
+    AddTestViews( batch );
+    batch.Update();
+
+    DXUT_CHECK( batch.GetNumViews() == NUM_TEST_VIEWS );
+    for( uint32_t i = 0; i < NUM_TEST_VIEWS; ++i )
+        DXUT_CHECK( ViewMatches( batch.GetResult( i ), s_Views[i] ) );
+}
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( CameraBatchCubeMapViews )
+{
+    CDXUTCameraBatch batch;
+    AddTestViews( batch );
+    XMVECTOR vEye = XMVectorSet( 1, 2, 3, 0 );
+    uint32_t iFirst = batch.AddCubeMapViews( vEye, 0.1f, 100.0f );
+    batch.Update();
+
+    // The DXUTGetCubeMapViewMatrix faces, in D3D11_TEXTURECUBE_FACE order
+    static const XMVECTORF32 s_vLookDir[6] =
+    {
+        { 1, 0, 0, 0 }, { -1, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, -1, 0, 0 }, { 0, 0, 1, 0 }, { 0, 0, -1, 0 },
+    };
+    static const XMVECTORF32 s_vUpDir[6] =
+    {
+        { 0, 1, 0, 0 }, { 0, 1, 0, 0 }, { 0, 0, -1, 0 }, { 0, 0, 1, 0 }, { 0, 1, 0, 0 }, { 0, 1, 0, 0 },
+    };
+
+    DXUT_CHECK( iFirst == NUM_TEST_VIEWS );
+    DXUT_CHECK( batch.GetNumViews() == iFirst + 6 );
+    for( uint32_t iFace = 0; iFace < 6; ++iFace )
+    {
+        // Each face's view is the cube map view matrix moved to the eye
+        XMMATRIX mFace = XMMatrixLookAtLH( XMVectorZero(), s_vLookDir[iFace], s_vUpDir[iFace] );
+        XMMATRIX mExpected = XMMatrixTranslationFromVector( -vEye ) * mFace;
+        const DXUT_CAMERA_BATCH_RESULT& result = batch.GetResult( iFirst + iFace );
+        DXUT_CHECK( MatricesMatch( result.mView, mExpected ) );
+        DXUT_CHECK( MatricesMatch( result.mProj, XMMatrixPerspectiveFovLH( XM_PIDIV2, 1.0f, 0.1f, 100.0f ) ) );
+    }
+}
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( CameraBatchSetParamsAndRemove )
+{
+    CDXUTCameraBatch batch;
+    AddTestViews( batch );
+    batch.Update();
+
+    // Change one view in the padded group and one in the full group
+    const TEST_VIEW& moved = s_Views[1];
+    batch.SetViewParams( 4, XMLoadFloat3( &moved.vEye ), XMLoadFloat3( &moved.vLookat ), XMLoadFloat3( &moved.vUp ) );
+    batch.SetProjParams( 0, moved.fFOV, moved.fAspect, moved.fNear, moved.fFar );
+    batch.Update();
+
+    DXUT_CHECK( ResultMatches( batch.GetResult( 4 ), XMLoadFloat3( &moved.vEye ), XMLoadFloat3( &moved.vLookat ),
+                               XMLoadFloat3( &moved.vUp ), s_Views[4].fFOV, s_Views[4].fAspect, s_Views[4].fNear,
+                               s_Views[4].fFar ) );
+    DXUT_CHECK( ResultMatches( batch.GetResult( 0 ), XMLoadFloat3( &s_Views[0].vEye ), XMLoadFloat3( &s_Views[0].vLookat ),
+                               XMLoadFloat3( &s_Views[0].vUp ), moved.fFOV, moved.fAspect, moved.fNear, moved.fFar ) );
+    for( uint32_t i = 1; i < 4; ++i )
+        DXUT_CHECK( ViewMatches( batch.GetResult( i ), s_Views[i] ) );
+
+    batch.RemoveAllViews();
+    DXUT_CHECK( batch.GetNumViews() == 0 );
+    batch.Update();
+
+    AddTestViews( batch );
+    batch.Update();
+    DXUT_CHECK( ViewMatches( batch.GetResult( 2 ), s_Views[2] ) );
+}
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( CameraBatchBenchmark )
+{
+    std::vector<TEST_VIEW> views( BENCHMARK_VIEWS );
+    CDXUTCameraBatch batch;
+    for( uint32_t i = 0; i < BENCHMARK_VIEWS; ++i )
+    {
+        views[i] = GetBenchmarkView( i );
+        batch.AddView( XMLoadFloat3( &views[i].vEye ), XMLoadFloat3( &views[i].vLookat ), XMLoadFloat3( &views[i].vUp ),
+                       views[i].fFOV, views[i].fAspect, views[i].fNear, views[i].fFar );
+    }
+
+    std::vector<DXUT_CAMERA_BATCH_RESULT> results( BENCHMARK_VIEWS );
+    auto start = std::chrono::high_resolution_clock::now();
+    for( uint32_t iPass = 0; iPass < BENCHMARK_PASSES; ++iPass )
+    {
+        for( uint32_t i = 0; i < BENCHMARK_VIEWS; ++i )
+            UpdateOneView( views[i], results[i] );
+    }
+    double fOneAtATimeSeconds = SecondsSince( start );
+
+    start = std::chrono::high_resolution_clock::now();
+    for( uint32_t iPass = 0; iPass < BENCHMARK_PASSES; ++iPass )
+        batch.Update();
+    double fBatchSeconds = SecondsSince( start );
+
+    // Both timed loops must have produced the same views
+    uint32_t nMismatches = 0;
+    for( uint32_t i = 0; i < BENCHMARK_VIEWS; ++i )
+    {
+        if( !ViewMatches( batch.GetResult( i ), views[i] ) || !ViewMatches( results[i], views[i] ) )
+            ++nMismatches;
+    }
+    DXUT_CHECK( nMismatches == 0 );
+
+    double fViews = double( BENCHMARK_VIEWS ) * BENCHMARK_PASSES;
+    printf( "  %u views x %u passes: %.1f ns per view one camera at a time, %.1f ns per view batched (%.2fx)\n",
+            BENCHMARK_VIEWS, BENCHMARK_PASSES, fOneAtATimeSeconds * 1e9 / fViews, fBatchSeconds * 1e9 / fViews,
+            fBatchSeconds > 0 ? fOneAtATimeSeconds / fBatchSeconds : 0.0 );
+}
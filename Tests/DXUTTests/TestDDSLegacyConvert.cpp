@@ -0,0 +1,230 @@
+//--------------------------------------------------------------------------------------
+// File: TestDDSLegacyConvert.cpp
+//
+// Checks the legacy DDS mask conversions: the SSSE3 kernels and the threaded split against
+// the scalar reference for every layout in the table, a few values worked out by hand,
+// and the layouts GetDDSLegacyLayout must refuse.  The Makefile builds it with SSSE3 on
+// x86, so the kernels are checked on every compiler.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DDSLegacyKernels.h"
+#include "DXUTTests.h"
+
+#include <stdio.h>
+
+using namespace DirectX;
+
+namespace
+{
+
+// Bytes written past the end of the output to catch a kernel storing too much
+const size_t GUARD_BYTES = 16;
+const uint8_t GUARD_VALUE = 0xcd;
+
+struct TEST_LAYOUT
+{
+    const char* strName;
+    uint32_t flags;
+    uint32_t bitCount;
+    uint32_t masks[4];      // R, G, B, A
+    uint32_t channelCount;
+    uint32_t dstChannelBits;
+};
+
+// Whole byte channels take the shuffle kernel, the rest the masked kernel, and targets
+// wider than 32 bits only the scalar path
+const TEST_LAYOUT s_Layouts[] =
+{
+    { "r8g8b8",      DDS_LEGACY_RGB,       24, { 0x00ff0000, 0x0000ff00, 0x000000ff, 0x00000000 }, 4,  8 },
+    { "b8g8r8",      DDS_LEGACY_RGB,       24, { 0x000000ff, 0x0000ff00, 0x00ff0000, 0x00000000 }, 4,  8 },
+    { "x8r8g8b8",    DDS_LEGACY_RGB,       32, { 0x00ff0000, 0x0000ff00, 0x000000ff, 0x00000000 }, 4,  8 },
+    { "x8b8g8r8",    DDS_LEGACY_RGB,       32, { 0x000000ff, 0x0000ff00, 0x00ff0000, 0x00000000 }, 4,  8 },
+    { "a8r8g8b8",    DDS_LEGACY_RGB,       32, { 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000 }, 4,  8 },
+    { "x1r5g5b5",    DDS_LEGACY_RGB,       16, { 0x00007c00, 0x000003e0, 0x0000001f, 0x00000000 }, 4,  8 },
+    { "a1r5g5b5",    DDS_LEGACY_RGB,       16, { 0x00007c00, 0x000003e0, 0x0000001f, 0x00008000 }, 4,  8 },
+    { "r5g6b5",      DDS_LEGACY_RGB,       16, { 0x0000f800, 0x000007e0, 0x0000001f, 0x00000000 }, 4,  8 },
+    { "x4r4g4b4",    DDS_LEGACY_RGB,       16, { 0x00000f00, 0x000000f0, 0x0000000f, 0x00000000 }, 4,  8 },
+    { "a4r4g4b4",    DDS_LEGACY_RGB,       16, { 0x00000f00, 0x000000f0, 0x0000000f, 0x0000f000 }, 4,  8 },
+    { "r3g3b2",      DDS_LEGACY_RGB,        8, { 0x000000e0, 0x0000001c, 0x00000003, 0x00000000 }, 4,  8 },
+    { "a8r3g3b2",    DDS_LEGACY_RGB,       16, { 0x000000e0, 0x0000001c, 0x00000003, 0x0000ff00 }, 4,  8 },
+    { "a2r10g10b10", DDS_LEGACY_RGB,       32, { 0x3ff00000, 0x000ffc00, 0x000003ff, 0xc0000000 }, 4, 16 },
+    { "a2b10g10r10", DDS_LEGACY_RGB,       32, { 0x000003ff, 0x000ffc00, 0x3ff00000, 0xc0000000 }, 4, 16 },
+    { "l8",          DDS_LEGACY_LUMINANCE,  8, { 0x000000ff, 0x00000000, 0x00000000, 0x00000000 }, 1,  8 },
+    { "a4l4",        DDS_LEGACY_LUMINANCE,  8, { 0x0000000f, 0x00000000, 0x00000000, 0x000000f0 }, 2,  8 },
+    { "a8l8",        DDS_LEGACY_LUMINANCE, 16, { 0x000000ff, 0x00000000, 0x00000000, 0x0000ff00 }, 2,  8 },
+    { "l8a8",        DDS_LEGACY_LUMINANCE, 16, { 0x0000ff00, 0x00000000, 0x00000000, 0x000000ff }, 2,  8 },
+    { "l16",         DDS_LEGACY_LUMINANCE, 16, { 0x0000ffff, 0x00000000, 0x00000000, 0x00000000 }, 1, 16 },
+    { "a4l12",       DDS_LEGACY_LUMINANCE, 16, { 0x00000fff, 0x00000000, 0x00000000, 0x0000f000 }, 2, 16 },
+    { "l6a2",        DDS_LEGACY_LUMINANCE,  8, { 0x000000fc, 0x00000000, 0x00000000, 0x00000003 }, 2,  8 },
+    { "a8",          DDS_LEGACY_ALPHA,      8, { 0x00000000, 0x00000000, 0x00000000, 0x000000ff }, 1,  8 },
+    { "a4",          DDS_LEGACY_ALPHA,      8, { 0x00000000, 0x00000000, 0x00000000, 0x0000000f }, 1,  8 },
+};
+
+// Covers empty runs, every tail length after whole kernel steps, and runs just short of
+// the 16 source bytes a kernel step loads
+const size_t s_PixelCounts[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 15, 16, 17, 31, 32, 33, 63, 64, 65, 255, 1000 };
+
+struct TestRandom
+{
+    uint32_t State;
+
+    TestRandom() : State( 0x9E3779B9 ) {}
+
+    uint8_t NextByte()
+    {
+        State = State * 1664525u + 1013904223u;
+        return uint8_t( State >> 24 );
+    }
+};
+
+bool GetConversion( const TEST_LAYOUT& layout, DDS_LEGACY_LAYOUT& conv )
+{
+    return GetDDSLegacyLayout( layout.flags, layout.bitCount, layout.masks[0], layout.masks[1], layout.masks[2],
+                                   layout.masks[3], &conv );
+}
+
+// Converts src with the kernels, from a misaligned start, and with the threaded split,
+// and compares each with the scalar reference
+bool KernelsMatchScalar( const DDS_LEGACY_LAYOUT& conv, const std::vector<uint8_t>& src, size_t nPixels,
+                         size_t srcOffset, unsigned int maxThreads )
+{
+    std::vector<uint8_t> srcCopy( srcOffset + nPixels * conv.srcBytes );
+    if( nPixels )
+        memcpy( srcCopy.data() + srcOffset, src.data(), nPixels * conv.srcBytes );
+    const uint8_t* pSrc = srcCopy.data() + srcOffset;
+
+    size_t dstBytes = nPixels * conv.dstBytes;
+    std::vector<uint8_t> reference( dstBytes + GUARD_BYTES, GUARD_VALUE );
+    std::vector<uint8_t> kernel( dstBytes + GUARD_BYTES, GUARD_VALUE );
+    std::vector<uint8_t> parallel( dstBytes + GUARD_BYTES, GUARD_VALUE );
+
+    ConvertDDSLegacyPixelsScalar( conv, pSrc, reference.data(), nPixels );
+    ConvertDDSLegacyPixels( conv, pSrc, kernel.data(), nPixels );
+    ConvertDDSLegacyPixelsParallel( conv, pSrc, parallel.data(), nPixels, maxThreads );
+
+    for( size_t i = dstBytes; i < reference.size(); ++i )
+    {
+        if( reference[i] != GUARD_VALUE || kernel[i] != GUARD_VALUE || parallel[i] != GUARD_VALUE )
+            return false;
+    }
+    return kernel == reference && parallel == reference;
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( DDSLegacyKernelsMatchScalar )
+{
+    TestRandom rng;
+    for( size_t iLayout = 0; iLayout < sizeof( s_Layouts ) / sizeof( s_Layouts[0] ); ++iLayout )
+    {
+        const TEST_LAYOUT& layout = s_Layouts[iLayout];
+        DDS_LEGACY_LAYOUT conv;
+        bool bConverts = GetConversion( layout, conv );
+        DXUT_CHECK( bConverts );
+        if( !bConverts )
+        {
+            printf( "  %s: no conversion\n", layout.strName );
+            continue;
+        }
+        DXUT_CHECK( conv.channelCount == layout.channelCount && conv.dstChannelBits == layout.dstChannelBits );
+
+        std::vector<uint8_t> src( 1000 * conv.srcBytes );
+        for( auto it = src.begin(); it != src.end(); ++it )
+            *it = rng.NextByte();
+
+        // All zeros and all ones first, which bit replication must keep exact
+        for( size_t i = 0; i < 4 * conv.srcBytes; ++i )
+        {
+            src[i] = 0;
+            src[4 * conv.srcBytes + i] = 0xff;
+        }
+
+        for( size_t iCount = 0; iCount < sizeof( s_PixelCounts ) / sizeof( s_PixelCounts[0] ); ++iCount )
+        {
+            for( size_t srcOffset = 0; srcOffset < 4; ++srcOffset )
+            {
+                bool bMatches = KernelsMatchScalar( conv, src, s_PixelCounts[iCount], srcOffset, 4 );
+                DXUT_CHECK( bMatches );
+                if( !bMatches )
+                    printf( "  %s: %u pixels at offset %u differ from the scalar path\n", layout.strName,
+                            unsigned( s_PixelCounts[iCount] ), unsigned( srcOffset ) );
+            }
+        }
+
+        // Large enough to be split across threads, with a tail in the last run
+        const size_t nLarge = 1024 * 1024 + 3;
+        std::vector<uint8_t> large( nLarge * conv.srcBytes );
+        for( auto it = large.begin(); it != large.end(); ++it )
+            *it = rng.NextByte();
+        bool bLargeMatches = KernelsMatchScalar( conv, large, nLarge, 0, 4 );
+        DXUT_CHECK( bLargeMatches );
+        if( !bLargeMatches )
+            printf( "  %s: the threaded conversion differs from the scalar path\n", layout.strName );
+    }
+
+    printf( "  %u layouts checked against the scalar path, %s\n", unsigned( sizeof( s_Layouts ) / sizeof( s_Layouts[0] ) ),
+            HasDDSLegacyKernels() ? "with the SSSE3 kernels" : "without SSSE3 kernels in this build" );
+}
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( DDSLegacyKnownValues )
+{
+    DDS_LEGACY_LAYOUT conv;
+
+    // x1r5g5b5: white, pure red and a mid green; the missing alpha is opaque
+    DXUT_CHECK( GetDDSLegacyLayout( DDS_LEGACY_RGB, 16, 0x7c00, 0x03e0, 0x001f, 0, &conv ) );
+    const uint8_t x1r5g5b5[] = { 0xff, 0x7f, 0x00, 0x7c, 0x00, 0x02 };
+    uint8_t rgba[12];
+    ConvertDDSLegacyPixels( conv, x1r5g5b5, rgba, 3 );
+    const uint8_t expectedRGBA[] = { 255, 255, 255, 255,  255, 0, 0, 255,  0, 132, 0, 255 };
+    DXUT_CHECK( !memcmp( rgba, expectedRGBA, sizeof( rgba ) ) );
+
+    // a4l4: luminance in the low nibble, alpha in the high one
+    DXUT_CHECK( GetDDSLegacyLayout( DDS_LEGACY_LUMINANCE, 8, 0x0f, 0, 0, 0xf0, &conv ) );
+    const uint8_t a4l4[] = { 0xf0, 0x0f, 0x5a };
+    uint8_t rg[6];
+    ConvertDDSLegacyPixels( conv, a4l4, rg, 3 );
+    const uint8_t expectedRG[] = { 0, 255,  255, 0,  0xaa, 0x55 };
+    DXUT_CHECK( !memcmp( rg, expectedRG, sizeof( rg ) ) );
+
+    // a2r10g10b10 widens to 16 bits a channel
+    DXUT_CHECK( GetDDSLegacyLayout( DDS_LEGACY_RGB, 32, 0x3ff00000, 0x000ffc00, 0x000003ff, 0xc0000000, &conv ) );
+    const uint8_t a2r10g10b10[] = { 0x00, 0x00, 0xf0, 0xbf };     // A = 2, R = 1023, G = 0, B = 0
+    uint16_t rgba16[4];
+    ConvertDDSLegacyPixels( conv, a2r10g10b10, reinterpret_cast<uint8_t*>( rgba16 ), 1 );
+    DXUT_CHECK( rgba16[0] == 0xffff && rgba16[1] == 0 && rgba16[2] == 0 && rgba16[3] == 0xaaaa );
+}
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( DDSLegacyRejectsBadMasks )
+{
+    DDS_LEGACY_LAYOUT conv;
+
+    // Overlapping channels
+    DXUT_CHECK( !GetDDSLegacyLayout( DDS_LEGACY_RGB, 16, 0xff00, 0x0ff0, 0x000f, 0, &conv ) );
+    // Non-contiguous red
+    DXUT_CHECK( !GetDDSLegacyLayout( DDS_LEGACY_RGB, 16, 0x0005, 0x00f0, 0x0f00, 0, &conv ) );
+    // A mask beyond the bit count
+    DXUT_CHECK( !GetDDSLegacyLayout( DDS_LEGACY_RGB, 16, 0xff0000, 0x00ff00, 0x0000ff, 0, &conv ) );
+    // A channel wider than 16 bits
+    DXUT_CHECK( !GetDDSLegacyLayout( DDS_LEGACY_RGB, 32, 0x0001ffff, 0x00fe0000, 0, 0, &conv ) );
+    // Alpha wider than 8 bits
+    DXUT_CHECK( !GetDDSLegacyLayout( DDS_LEGACY_ALPHA, 16, 0, 0, 0, 0x0fff, &conv ) );
+    // Unusual bit count and missing masks
+    DXUT_CHECK( !GetDDSLegacyLayout( DDS_LEGACY_RGB, 12, 0x0f00, 0x00f0, 0x000f, 0, &conv ) );
+    DXUT_CHECK( !GetDDSLegacyLayout( DDS_LEGACY_RGB, 16, 0, 0, 0, 0xff00, &conv ) );
+    DXUT_CHECK( !GetDDSLegacyLayout( DDS_LEGACY_LUMINANCE, 8, 0, 0, 0, 0xf0, &conv ) );
+    DXUT_CHECK( !GetDDSLegacyLayout( 0, 32, 0xff0000, 0xff00, 0xff, 0, &conv ) );
+}
@@ -0,0 +1,348 @@
+//--------------------------------------------------------------------------------------
+// File: TestEnumerationCache.cpp
+//
+// Runs the D3D11 enumeration over a stand-in DXGI factory with one adapter and one output,
+// and checks what the enumeration cache saves it from asking again.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUT.h"
+#include "DXUTTests.h"
+
+#include <string>
+
+namespace
+{
+
+const WCHAR s_szAdapterName[] = L"DXUT Test Adapter";
+
+//--------------------------------------------------------------------------------------
+// One output with two R8G8B8A8_UNORM_SRGB modes, counting the mode list requests
+//--------------------------------------------------------------------------------------
+class CFakeOutput : public IDXGIOutput
+{
+public:
+    CFakeOutput() : m_cRef( 1 ), m_nModeListCalls( 0 ) {}
+
+    LONG GetModeListCalls() const { return m_nModeListCalls; }
+    void ResetModeListCalls() { m_nModeListCalls = 0; }
+
+    STDMETHODIMP QueryInterface( REFIID riid, void** ppv )
+    {
+        if( riid == __uuidof( IUnknown ) || riid == __uuidof( IDXGIObject ) || riid == __uuidof( IDXGIOutput ) )
+        {
+            *ppv = static_cast<IDXGIOutput*>( this );
+            AddRef();
+            return S_OK;
+        }
+        *ppv = nullptr;
+        return E_NOINTERFACE;
+    }
+    STDMETHODIMP_(ULONG) AddRef() { return InterlockedIncrement( &m_cRef ); }
+    STDMETHODIMP_(ULONG) Release() { return InterlockedDecrement( &m_cRef ); }
+
+    STDMETHODIMP SetPrivateData( REFGUID, UINT, const void* ) { return E_NOTIMPL; }
+    STDMETHODIMP SetPrivateDataInterface( REFGUID, const IUnknown* ) { return E_NOTIMPL; }
+    STDMETHODIMP GetPrivateData( REFGUID, UINT*, void* ) { return E_NOTIMPL; }
+    STDMETHODIMP GetParent( REFIID, void** ppParent ) { *ppParent = nullptr; return E_NOINTERFACE; }
+
+    STDMETHODIMP GetDesc( DXGI_OUTPUT_DESC* pDesc )
+    {
+        ZeroMemory( pDesc, sizeof( DXGI_OUTPUT_DESC ) );
+        wcscpy_s( pDesc->DeviceName, L"\\\\.\\DXUTTEST1" );
+        SetRect( &pDesc->DesktopCoordinates, 0, 0, 1024, 768 );
+        pDesc->AttachedToDesktop = TRUE;
+        pDesc->Rotation = DXGI_MODE_ROTATION_IDENTITY;
+        return S_OK;
+    }
+
+    STDMETHODIMP GetDisplayModeList( DXGI_FORMAT EnumFormat, UINT, UINT* pNumModes, DXGI_MODE_DESC* pDesc )
+    {
+        InterlockedIncrement( &m_nModeListCalls );
+        if( EnumFormat != DXGI_FORMAT_R8G8B8A8_UNORM_SRGB )
+        {
+            *pNumModes = 0;
+            return S_OK;
+        }
+
+        static const UINT s_Sizes[][2] = { { 800, 600 }, { 1024, 768 } };
+        if( !pDesc )
+        {
+            *pNumModes = _countof( s_Sizes );
+            return S_OK;
+        }
+        if( *pNumModes < _countof( s_Sizes ) )
+            return DXGI_ERROR_MORE_DATA;
+
+        for( UINT i = 0; i < _countof( s_Sizes ); ++i )
+        {
+            ZeroMemory( &pDesc[i], sizeof( DXGI_MODE_DESC ) );
+            pDesc[i].Width = s_Sizes[i][0];
+            pDesc[i].Height = s_Sizes[i][1];
+            pDesc[i].RefreshRate.Numerator = 60;
+            pDesc[i].RefreshRate.Denominator = 1;
+            pDesc[i].Format = EnumFormat;
+        }
+        *pNumModes = _countof( s_Sizes );
+        return S_OK;
+    }
+
+    STDMETHODIMP FindClosestMatchingMode( const DXGI_MODE_DESC*, DXGI_MODE_DESC*, IUnknown* ) { return E_NOTIMPL; }
+    STDMETHODIMP WaitForVBlank() { return E_NOTIMPL; }
+    STDMETHODIMP TakeOwnership( IUnknown*, BOOL ) { return E_NOTIMPL; }
+    STDMETHODIMP_(void) ReleaseOwnership() {}
+    STDMETHODIMP GetGammaControlCapabilities( DXGI_GAMMA_CONTROL_CAPABILITIES* ) { return E_NOTIMPL; }
+    STDMETHODIMP SetGammaControl( const DXGI_GAMMA_CONTROL* ) { return E_NOTIMPL; }
+    STDMETHODIMP GetGammaControl( DXGI_GAMMA_CONTROL* ) { return E_NOTIMPL; }
+    STDMETHODIMP SetDisplaySurface( IDXGISurface* ) { return E_NOTIMPL; }
+    STDMETHODIMP GetDisplaySurfaceData( IDXGISurface* ) { return E_NOTIMPL; }
+    STDMETHODIMP GetFrameStatistics( DXGI_FRAME_STATISTICS* ) { return E_NOTIMPL; }
+
+private:
+    volatile LONG m_cRef;
+    volatile LONG m_nModeListCalls;
+};
+
+
+//--------------------------------------------------------------------------------------
+// A hardware adapter D3D11 cannot create a device on, so only WARP and REF are probed on it
+//--------------------------------------------------------------------------------------
+class CFakeAdapter : public IDXGIAdapter1
+{
+public:
+    explicit CFakeAdapter( CFakeOutput* pOutput ) : m_cRef( 1 ), m_pOutput( pOutput ) { m_DriverVersion.QuadPart = 0x0001000200030004; }
+
+    void SetDriverVersion( LONGLONG version ) { m_DriverVersion.QuadPart = version; }
+
+    STDMETHODIMP QueryInterface( REFIID riid, void** ppv )
+    {
+        if( riid == __uuidof( IUnknown ) || riid == __uuidof( IDXGIObject ) || riid == __uuidof( IDXGIAdapter )
+            || riid == __uuidof( IDXGIAdapter1 ) )
+        {
+            *ppv = static_cast<IDXGIAdapter1*>( this );
+            AddRef();
+            return S_OK;
+        }
+        *ppv = nullptr;
+        return E_NOINTERFACE;
+    }
+    STDMETHODIMP_(ULONG) AddRef() { return InterlockedIncrement( &m_cRef ); }
+    STDMETHODIMP_(ULONG) Release() { return InterlockedDecrement( &m_cRef ); }
+
+    STDMETHODIMP SetPrivateData( REFGUID, UINT, const void* ) { return E_NOTIMPL; }
+    STDMETHODIMP SetPrivateDataInterface( REFGUID, const IUnknown* ) { return E_NOTIMPL; }
+    STDMETHODIMP GetPrivateData( REFGUID, UINT*, void* ) { return E_NOTIMPL; }
+    STDMETHODIMP GetParent( REFIID, void** ppParent ) { *ppParent = nullptr; return E_NOINTERFACE; }
+
+    STDMETHODIMP EnumOutputs( UINT Output, IDXGIOutput** ppOutput )
+    {
+        if( Output > 0 )
+        {
+            *ppOutput = nullptr;
+            return DXGI_ERROR_NOT_FOUND;
+        }
+        m_pOutput->AddRef();
+        *ppOutput = m_pOutput;
+        return S_OK;
+    }
+
+    STDMETHODIMP GetDesc( DXGI_ADAPTER_DESC* pDesc )
+    {
+        ZeroMemory( pDesc, sizeof( DXGI_ADAPTER_DESC ) );
+        wcscpy_s( pDesc->Description, s_szAdapterName );
+        pDesc->VendorId = 0xDEAD;
+        pDesc->DeviceId = 0xBEEF;
+        return S_OK;
+    }
+
+    STDMETHODIMP CheckInterfaceSupport( REFGUID, LARGE_INTEGER* pUMDVersion )
+    {
+        *pUMDVersion = m_DriverVersion;
+        return S_OK;
+    }
+
+    STDMETHODIMP GetDesc1( DXGI_ADAPTER_DESC1* pDesc )
+    {
+        ZeroMemory( pDesc, sizeof( DXGI_ADAPTER_DESC1 ) );
+        return GetDesc( reinterpret_cast<DXGI_ADAPTER_DESC*>( pDesc ) );
+    }
+
+private:
+    volatile LONG m_cRef;
+    CFakeOutput* m_pOutput;
+    LARGE_INTEGER m_DriverVersion;
+};
+
+
+//--------------------------------------------------------------------------------------
+class CFakeFactory : public IDXGIFactory1
+{
+public:
+    explicit CFakeFactory( CFakeAdapter* pAdapter ) : m_cRef( 1 ), m_pAdapter( pAdapter ) {}
+
+    LONG GetRefCount() const { return m_cRef; }
+
+    STDMETHODIMP QueryInterface( REFIID riid, void** ppv )
+    {
+        if( riid == __uuidof( IUnknown ) || riid == __uuidof( IDXGIObject ) || riid == __uuidof( IDXGIFactory )
+            || riid == __uuidof( IDXGIFactory1 ) )
+        {
+            *ppv = static_cast<IDXGIFactory1*>( this );
+            AddRef();
+            return S_OK;
+        }
+        *ppv = nullptr;
+        return E_NOINTERFACE;
+    }
+    STDMETHODIMP_(ULONG) AddRef() { return InterlockedIncrement( &m_cRef ); }
+    STDMETHODIMP_(ULONG) Release() { return InterlockedDecrement( &m_cRef ); }
+
+    STDMETHODIMP SetPrivateData( REFGUID, UINT, const void* ) { return E_NOTIMPL; }
+    STDMETHODIMP SetPrivateDataInterface( REFGUID, const IUnknown* ) { return E_NOTIMPL; }
+    STDMETHODIMP GetPrivateData( REFGUID, UINT*, void* ) { return E_NOTIMPL; }
+    STDMETHODIMP GetParent( REFIID, void** ppParent ) { *ppParent = nullptr; return E_NOINTERFACE; }
+
+    STDMETHODIMP EnumAdapters( UINT Adapter, IDXGIAdapter** ppAdapter )
+    {
+        IDXGIAdapter1* pAdapter1 = nullptr;
+        HRESULT hr = EnumAdapters1( Adapter, &pAdapter1 );
+        *ppAdapter = pAdapter1;
+        return hr;
+    }
+    STDMETHODIMP MakeWindowAssociation( HWND, UINT ) { return E_NOTIMPL; }
+    STDMETHODIMP GetWindowAssociation( HWND* ) { return E_NOTIMPL; }
+    STDMETHODIMP CreateSwapChain( IUnknown*, DXGI_SWAP_CHAIN_DESC*, IDXGISwapChain** ) { return E_NOTIMPL; }
+    STDMETHODIMP CreateSoftwareAdapter( HMODULE, IDXGIAdapter** ) { return E_NOTIMPL; }
+
+    STDMETHODIMP EnumAdapters1( UINT Adapter, IDXGIAdapter1** ppAdapter )
+    {
+        if( Adapter > 0 )
+        {
+            *ppAdapter = nullptr;
+            return DXGI_ERROR_NOT_FOUND;
+        }
+        m_pAdapter->AddRef();
+        *ppAdapter = m_pAdapter;
+        return S_OK;
+    }
+    STDMETHODIMP_(BOOL) IsCurrent() { return TRUE; }
+
+private:
+    volatile LONG m_cRef;
+    CFakeAdapter* m_pAdapter;
+};
+
+
+//--------------------------------------------------------------------------------------
+std::wstring GetCacheFileName()
+{
+    WCHAR szPath[MAX_PATH];
+    if( !GetTempPathW( MAX_PATH, szPath ) )
+        szPath[0] = 0;
+    return std::wstring( szPath ) + L"DXUTTestEnumerationCache.bin";
+}
+
+
+//--------------------------------------------------------------------------------------
+const CD3D11EnumAdapterInfo* FindFakeAdapter( CD3D11Enumeration* pEnum )
+{
+    auto pList = pEnum->GetAdapterInfoList();
+    for( auto it = pList->cbegin(); it != pList->cend(); ++it )
+    {
+        if( !wcscmp( (*it)->AdapterDesc.Description, s_szAdapterName ) )
+            return *it;
+    }
+    return nullptr;
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( EnumerationCacheSkipsProbes )
+{
+    CFakeOutput output;
+    CFakeAdapter adapter( &output );
+    CFakeFactory factory( &adapter );
+
+    const std::wstring strCache = GetCacheFileName();
+    DeleteFileW( strCache.c_str() );
+
+    auto pEnum = DXUTGetD3D11Enumeration();
+    DXUT_CHECK( pEnum != nullptr );
+    if( !pEnum )
+        return;
+
+    pEnum->SetDXGIFactory( &factory );
+    DXUT_CHECK( SUCCEEDED( DXUTSetD3D11EnumerationCacheFile( strCache.c_str() ) ) );
+
+    // No file yet, so the adapter is probed and written out
+    DXUT_CHECK( SUCCEEDED( pEnum->Enumerate( nullptr, nullptr ) ) );
+    DXUT_CHECK( pEnum->GetStats().CacheHits == 0 );
+    DXUT_CHECK( pEnum->GetStats().CacheMisses == 1 );
+    DXUT_CHECK( output.GetModeListCalls() > 0 );
+    DXUT_CHECK( GetFileAttributesW( strCache.c_str() ) != INVALID_FILE_ATTRIBUTES );
+
+    size_t nDevices = 0;
+    auto pAdapterInfo = FindFakeAdapter( pEnum );
+    if( pAdapterInfo )
+    {
+        nDevices = pAdapterInfo->deviceInfoList.size();
+        DXUT_CHECK( pAdapterInfo->outputInfoList.size() == 1 );
+        DXUT_CHECK( pAdapterInfo->outputInfoList[0]->displayModeList.size() == 2 );
+    }
+
+    // Same adapter, driver and output, so nothing is asked of them again
+    output.ResetModeListCalls();
+    DXUT_CHECK( SUCCEEDED( pEnum->Enumerate( nullptr, nullptr ) ) );
+    DXUT_CHECK( pEnum->GetStats().CacheHits == 1 );
+    DXUT_CHECK( pEnum->GetStats().CacheMisses == 0 );
+    DXUT_CHECK( output.GetModeListCalls() == 0 );
+
+    auto pCachedInfo = FindFakeAdapter( pEnum );
+    DXUT_CHECK( ( pCachedInfo != nullptr ) == ( pAdapterInfo != nullptr ) );
+    if( pCachedInfo )
+    {
+        DXUT_CHECK( pCachedInfo->deviceInfoList.size() == nDevices );
+        DXUT_CHECK( pCachedInfo->outputInfoList.size() == 1 );
+        DXUT_CHECK( pCachedInfo->outputInfoList[0]->displayModeList.size() == 2 );
+        DXUT_CHECK( pCachedInfo->outputInfoList[0]->displayModeList[1].Width == 1024 );
+    }
+
+    // A driver update changes the key, so the adapter is probed again
+    adapter.SetDriverVersion( 0x0001000200030005 );
+    DXUT_CHECK( SUCCEEDED( pEnum->Enumerate( nullptr, nullptr ) ) );
+    DXUT_CHECK( pEnum->GetStats().CacheHits == 0 );
+    DXUT_CHECK( pEnum->GetStats().CacheMisses == 1 );
+    DXUT_CHECK( output.GetModeListCalls() > 0 );
+
+    // A truncated file is a miss, never a failure
+    HANDLE hFile = CreateFileW( strCache.c_str(), GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+    DXUT_CHECK( hFile != INVALID_HANDLE_VALUE );
+    if( hFile != INVALID_HANDLE_VALUE )
+    {
+        LARGE_INTEGER pos;
+        pos.QuadPart = 20;
+        SetFilePointerEx( hFile, pos, nullptr, FILE_BEGIN );
+        SetEndOfFile( hFile );
+        CloseHandle( hFile );
+    }
+    DXUT_CHECK( SUCCEEDED( pEnum->Enumerate( nullptr, nullptr ) ) );
+    DXUT_CHECK( pEnum->GetStats().CacheHits == 0 );
+    DXUT_CHECK( pEnum->GetStats().CacheMisses == 1 );
+
+    DXUTSetD3D11EnumerationCacheFile( nullptr );
+    pEnum->SetDXGIFactory( nullptr );
+    DXUT_CHECK( factory.GetRefCount() == 1 );
+    DeleteFileW( strCache.c_str() );
+
+    // Leave the enumeration describing the real adapters for any later test
+    pEnum->Enumerate( nullptr, nullptr );
+}
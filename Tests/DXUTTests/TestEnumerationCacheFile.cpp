@@ -0,0 +1,184 @@
+//--------------------------------------------------------------------------------------
+// File: TestEnumerationCacheFile.cpp
+//
+// Writes and reads back D3D11 enumeration cache files, and checks that damaged ones keep
+// the adapters read before the damage without reading past the end.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUTEnumerationCache.h"
+#include "DXUTTests.h"
+
+#include <stddef.h>
+#include <stdio.h>
+
+namespace
+{
+
+//--------------------------------------------------------------------------------------
+// Three adapters: one with two outputs, one with an output that has no modes, and one
+// with nothing probed at all
+//--------------------------------------------------------------------------------------
+std::vector<DXUT_ENUM_CACHE_ADAPTER> MakeAdapters()
+{
+    std::vector<DXUT_ENUM_CACHE_ADAPTER> adapters( 3 );
+
+    adapters[0].Key = 0x0123456789ABCDEFULL;
+    adapters[0].OutputModes.resize( 2 );
+    for( uint32_t i = 0; i < 4; ++i )
+    {
+        DXUT_ENUM_CACHE_MODE mode = { 640 + i * 160, 480 + i * 120, 60, 1, 29, 0, 0 };
+        adapters[0].OutputModes[ i & 1 ].push_back( mode );
+    }
+    DXUT_ENUM_CACHE_DEVICE hardware = { 1, 0xb000, 0xb100, 0 };
+    DXUT_ENUM_CACHE_DEVICE warp = { 5, 0xb000, 0xb000, 0 };
+    adapters[0].Devices.push_back( hardware );
+    adapters[0].Devices.push_back( warp );
+    DXUT_ENUM_CACHE_SAMPLE_LEVEL level = { 1, 29, 4, 16 };
+    adapters[0].MultiSampleLevels.push_back( level );
+
+    adapters[1].Key = 42;
+    adapters[1].OutputModes.resize( 1 );
+    adapters[1].Devices.push_back( warp );
+
+    adapters[2].Key = 0;
+    return adapters;
+}
+
+bool SameModes( const std::vector<DXUT_ENUM_CACHE_MODE>& a, const std::vector<DXUT_ENUM_CACHE_MODE>& b )
+{
+    return a.size() == b.size() && ( a.empty() || !memcmp( a.data(), b.data(), a.size() * sizeof( DXUT_ENUM_CACHE_MODE ) ) );
+}
+
+bool SameAdapter( const DXUT_ENUM_CACHE_ADAPTER& a, const DXUT_ENUM_CACHE_ADAPTER& b )
+{
+    if( a.Key != b.Key || a.OutputModes.size() != b.OutputModes.size()
+        || a.Devices.size() != b.Devices.size() || a.MultiSampleLevels.size() != b.MultiSampleLevels.size() )
+        return false;
+
+    for( size_t i = 0; i < a.OutputModes.size(); ++i )
+    {
+        if( !SameModes( a.OutputModes[i], b.OutputModes[i] ) )
+            return false;
+    }
+
+    return ( a.Devices.empty() || !memcmp( a.Devices.data(), b.Devices.data(), a.Devices.size() * sizeof( DXUT_ENUM_CACHE_DEVICE ) ) )
+        && ( a.MultiSampleLevels.empty() || !memcmp( a.MultiSampleLevels.data(), b.MultiSampleLevels.data(),
+                                                     a.MultiSampleLevels.size() * sizeof( DXUT_ENUM_CACHE_SAMPLE_LEVEL ) ) );
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( EnumerationCacheFileRoundTrips )
+{
+    const std::vector<DXUT_ENUM_CACHE_ADAPTER> adapters = MakeAdapters();
+
+    std::vector<uint8_t> data;
+    DXUTWriteEnumerationCache( adapters, data );
+    DXUT_CHECK( data.size() > sizeof( DXUT_ENUM_CACHE_HEADER ) );
+
+    std::vector<DXUT_ENUM_CACHE_ADAPTER> read;
+    DXUT_CHECK( DXUTReadEnumerationCache( data.data(), data.size(), read ) );
+    DXUT_CHECK( read.size() == adapters.size() );
+    for( size_t i = 0; i < adapters.size() && i < read.size(); ++i )
+        DXUT_CHECK( SameAdapter( read[i], adapters[i] ) );
+
+    // Adapters are appended to what the caller already has
+    DXUT_CHECK( DXUTReadEnumerationCache( data.data(), data.size(), read ) );
+    DXUT_CHECK( read.size() == adapters.size() * 2 );
+
+    // Writing replaces what the buffer held
+    std::vector<uint8_t> again( 7, 0xCD );
+    DXUTWriteEnumerationCache( adapters, again );
+    DXUT_CHECK( again == data );
+
+    // No adapters is still a cache
+    std::vector<DXUT_ENUM_CACHE_ADAPTER> none;
+    DXUTWriteEnumerationCache( none, data );
+    DXUT_CHECK( data.size() == sizeof( DXUT_ENUM_CACHE_HEADER ) );
+    DXUT_CHECK( DXUTReadEnumerationCache( data.data(), data.size(), read ) );
+    DXUT_CHECK( read.size() == adapters.size() * 2 );
+}
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( EnumerationCacheFileKeepsRecordsBeforeDamage )
+{
+    const std::vector<DXUT_ENUM_CACHE_ADAPTER> adapters = MakeAdapters();
+
+    // The file size once each adapter is complete
+    std::vector<size_t> ends;
+    for( size_t i = 0; i <= adapters.size(); ++i )
+    {
+        std::vector<uint8_t> prefix;
+        DXUTWriteEnumerationCache( std::vector<DXUT_ENUM_CACHE_ADAPTER>( adapters.begin(), adapters.begin() + i ), prefix );
+        ends.push_back( prefix.size() );
+    }
+
+    std::vector<uint8_t> data;
+    DXUTWriteEnumerationCache( adapters, data );
+    DXUT_CHECK( ends.back() == data.size() );
+
+    // Cut at every length, copied so reading a byte past the cut is caught by the sanitizers
+    unsigned nMismatches = 0;
+    for( size_t bytes = 0; bytes < data.size(); ++bytes )
+    {
+        std::vector<uint8_t> cut( data.begin(), data.begin() + bytes );
+        std::vector<DXUT_ENUM_CACHE_ADAPTER> read;
+        bool bRead = DXUTReadEnumerationCache( cut.empty() ? nullptr : cut.data(), cut.size(), read );
+
+        size_t nComplete = 0;
+        while( nComplete + 1 < ends.size() && ends[ nComplete + 1 ] <= bytes )
+            ++nComplete;
+        if( bytes < sizeof( DXUT_ENUM_CACHE_HEADER ) )
+            nComplete = 0;
+
+        if( bRead || read.size() != nComplete )
+            ++nMismatches;
+        for( size_t i = 0; i < read.size(); ++i )
+        {
+            if( !SameAdapter( read[i], adapters[i] ) )
+                ++nMismatches;
+        }
+    }
+    DXUT_CHECK( nMismatches == 0 );
+
+    std::vector<DXUT_ENUM_CACHE_ADAPTER> read;
+
+    // Another format or version is not read at all
+    std::vector<uint8_t> bad = data;
+    bad[0] ^= 0xFF;
+    DXUT_CHECK( !DXUTReadEnumerationCache( bad.data(), bad.size(), read ) );
+    DXUT_CHECK( read.empty() );
+
+    bad = data;
+    uint32_t version = DXUT_ENUM_CACHE_VERSION + 1;
+    memcpy( bad.data() + offsetof( DXUT_ENUM_CACHE_HEADER, Version ), &version, sizeof( version ) );
+    DXUT_CHECK( !DXUTReadEnumerationCache( bad.data(), bad.size(), read ) );
+    DXUT_CHECK( read.empty() );
+
+    // A count too large to be real stops the read before anything is allocated for it
+    bad = data;
+    uint32_t nDevices = 0xFFFFFFFF;
+    memcpy( bad.data() + sizeof( DXUT_ENUM_CACHE_HEADER ) + offsetof( DXUT_ENUM_CACHE_RECORD, NumDevices ), &nDevices, sizeof( nDevices ) );
+    DXUT_CHECK( !DXUTReadEnumerationCache( bad.data(), bad.size(), read ) );
+    DXUT_CHECK( read.empty() );
+
+    // So does a header claiming more adapters than the file holds, after the real ones
+    bad = data;
+    uint32_t nAdapters = uint32_t( adapters.size() + 1 );
+    memcpy( bad.data() + offsetof( DXUT_ENUM_CACHE_HEADER, NumAdapters ), &nAdapters, sizeof( nAdapters ) );
+    DXUT_CHECK( !DXUTReadEnumerationCache( bad.data(), bad.size(), read ) );
+    DXUT_CHECK( read.size() == adapters.size() );
+
+    printf( "  %u-byte cache, %u adapters, every truncation checked\n", unsigned( data.size() ), unsigned( adapters.size() ) );
+}
@@ -0,0 +1,185 @@
+//--------------------------------------------------------------------------------------
+// File: TestFrameArena.cpp
+//
+// Runs frames shaped like HelloHLSL's GUI and text pass through a frame arena, with the
+// global operator new replaced to count allocations, and checks that once the first
+// frames have sized the arena a steady frame makes none.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUTFrameArena.h"
+#include "DXUTTests.h"
+
+#include <stdio.h>
+#include <atomic>
+#include <new>
+#include <string>
+
+namespace
+{
+
+const int WARMUP_FRAMES = 8;
+const int MEASURED_FRAMES = 1000;
+
+std::atomic<size_t> g_nNewCalls( 0 );
+
+void* CountedNew( size_t nBytes )
+{
+    ++g_nNewCalls;
+    return malloc( nBytes ? nBytes : 1 );
+}
+
+// DXUTSpriteVertex
+struct SpriteVertex
+{
+    float Pos[3];
+    float Color[4];
+    float Tex[2];
+};
+
+//--------------------------------------------------------------------------------------
+// Six vertices per character of each line, as DrawText11DXUT batches them, and a quad per
+// control, as the dialog's sprites are batched
+//--------------------------------------------------------------------------------------
+void AddText( CDXUTFrameArray<SpriteVertex>& vertices, const wchar_t* strText )
+{
+    for( const wchar_t* p = strText; *p; ++p )
+    {
+        SpriteVertex v = { { float( *p ), 0, 0.5f }, { 1, 1, 1, 1 }, { 0, 0 } };
+        for( int i = 0; i < 6; ++i )
+            vertices.push_back( v );
+    }
+}
+
+size_t RunFrame( CDXUTFrameArena& arena, CDXUTFrameArray<SpriteVertex>& fontVertices,
+                 CDXUTFrameArray<SpriteVertex>& spriteVertices, int nFrame )
+{
+    arena.Reset();
+
+    // The text pass of the sample: frame stats, device stats and a help line
+    const wchar_t* strLines[3];
+    strLines[0] = DXUTFormatFrameText( arena, L"%0.2f fps (%ux%u), Vsync %ls", 60.0f + float( nFrame % 17 ) * 0.25f,
+                                       1280u, 720u, ( nFrame & 1 ) ? L"On" : L"Off" );
+    strLines[1] = DXUTFormatFrameText( arena, L"D3D11 %ls (FL %d.%d), %ls", L"HARDWARE", 11, 0, L"NVIDIA GeForce" );
+    strLines[2] = DXUTFormatFrameText( arena, L"Frame %d, %d draws", nFrame, 7 + nFrame % 3 );
+
+    fontVertices.clear();
+    for( int i = 0; i < 3; ++i )
+        AddText( fontVertices, strLines[i] );
+
+    // The HUD and sample dialogs' controls
+    spriteVertices.clear();
+    for( int i = 0; i < 40; ++i )
+    {
+        SpriteVertex v = { { float( i ), 0, 0.5f }, { 1, 1, 1, 1 }, { 0, 0 } };
+        for( int j = 0; j < 6; ++j )
+            spriteVertices.push_back( v );
+    }
+
+    return fontVertices.size() + spriteVertices.size();
+}
+
+};
+
+void* operator new( size_t nBytes )
+{
+    void* p = CountedNew( nBytes );
+    if( !p )
+        throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[]( size_t nBytes )
+{
+    return operator new( nBytes );
+}
+
+void* operator new( size_t nBytes, const std::nothrow_t& ) noexcept
+{
+    return CountedNew( nBytes );
+}
+
+void* operator new[]( size_t nBytes, const std::nothrow_t& ) noexcept
+{
+    return CountedNew( nBytes );
+}
+
+void operator delete( void* p ) noexcept { free( p ); }
+void operator delete[]( void* p ) noexcept { free( p ); }
+void operator delete( void* p, size_t ) noexcept { free( p ); }
+void operator delete[]( void* p, size_t ) noexcept { free( p ); }
+void operator delete( void* p, const std::nothrow_t& ) noexcept { free( p ); }
+void operator delete[]( void* p, const std::nothrow_t& ) noexcept { free( p ); }
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( FrameArenaCountsAllocations )
+{
+    // The counter sees the allocations it is meant to catch
+    size_t nBefore = g_nNewCalls;
+    std::string* pString = new std::string( 100, 'x' );
+    delete pString;
+    DXUT_CHECK( g_nNewCalls - nBefore >= 2 );
+}
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( FrameArenaSteadyFramesDoNotAllocate )
+{
+    CDXUTFrameArena arena;
+    CDXUTFrameArray<SpriteVertex> fontVertices( arena );
+    CDXUTFrameArray<SpriteVertex> spriteVertices( arena );
+
+    for( int i = 0; i < WARMUP_FRAMES; ++i )
+        RunFrame( arena, fontVertices, spriteVertices, i );
+    arena.Reset();
+    size_t nCapacity = arena.GetCapacity();
+    DXUT_CHECK( nCapacity > 0 );
+
+    size_t nNewCalls = g_nNewCalls;
+    size_t nVertices = 0;
+    for( int i = WARMUP_FRAMES; i < WARMUP_FRAMES + MEASURED_FRAMES; ++i )
+        nVertices += RunFrame( arena, fontVertices, spriteVertices, i );
+    nNewCalls = g_nNewCalls - nNewCalls;
+
+    // A frame that overflowed would have grown the arena at the next reset
+    arena.Reset();
+    DXUT_CHECK( nNewCalls == 0 );
+    DXUT_CHECK( arena.GetCapacity() == nCapacity );
+    DXUT_CHECK( nVertices > 0 );
+
+    printf( "  %d frames, %.0f vertices and 3 formatted lines each: %u operator new calls, %u-byte arena\n",
+            MEASURED_FRAMES, double( nVertices ) / MEASURED_FRAMES, unsigned( nNewCalls ), unsigned( nCapacity ) );
+}
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( FrameArenaFormatsLongLines )
+{
+    CDXUTFrameArena arena;
+    std::wstring strLong( 3000, L'w' );
+
+    const wchar_t* strText = DXUTFormatFrameText( arena, L"[%ls] %d", strLong.c_str(), 42 );
+    DXUT_CHECK( std::wstring( strText ) == L"[" + strLong + L"] 42" );
+
+    // Once the arena has grown to the line, formatting it again takes nothing from the heap
+    arena.Reset();
+    size_t nNewCalls = g_nNewCalls;
+    strText = DXUTFormatFrameText( arena, L"[%ls] %d", strLong.c_str(), 42 );
+    DXUT_CHECK( g_nNewCalls == nNewCalls );
+    DXUT_CHECK( wcslen( strText ) == strLong.size() + 5 );
+
+    // Frame arrays come back empty once their memory is reset
+    CDXUTFrameArray<int> values( arena );
+    DXUT_CHECK( values.push_back( 1 ) && values.push_back( 2 ) );
+    DXUT_CHECK( values.size() == 2 && values[1] == 2 );
+    arena.Reset();
+    DXUT_CHECK( values.empty() && values.size() == 0 );
+}
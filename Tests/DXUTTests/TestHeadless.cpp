@@ -0,0 +1,74 @@
+//--------------------------------------------------------------------------------------
+// File: TestHeadless.cpp
+//
+// Smoke test for -headless: brings DXUT up on WARP with a hidden window, renders a few
+// frames through DXUTRender3DEnvironment and checks what the frame counters report.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUT.h"
+#include "DXUTTests.h"
+
+namespace
+{
+
+const UINT HEADLESS_TEST_FRAMES = 10;
+
+UINT s_nFrameRenders = 0;
+
+void CALLBACK OnHeadlessFrameRender( ID3D11Device*, ID3D11DeviceContext* pd3dImmediateContext,
+                                     double, float, void* )
+{
+    ++s_nFrameRenders;
+
+    pd3dImmediateContext->ClearRenderTargetView( DXUTGetD3D11RenderTargetView(), DirectX::Colors::MidnightBlue );
+    DXUTCountAPICalls( DXUT_API_CLEAR );
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( HeadlessFramesOnWarp )
+{
+    DXUTSetCallbackD3D11FrameRender( OnHeadlessFrameRender );
+    DXUTSetHeadless( true );
+
+    DXUT_CHECK( SUCCEEDED( DXUTInit( false, false, nullptr, false ) ) );
+    DXUT_CHECK( SUCCEEDED( DXUTCreateWindow( L"DXUTTests" ) ) );
+    HRESULT hr = DXUTCreateDevice( D3D_FEATURE_LEVEL_10_0, true, 320, 240 );
+    DXUT_CHECK( SUCCEEDED( hr ) );
+    if( FAILED( hr ) )
+    {
+        DXUTShutdown( 1 );
+        return;
+    }
+
+    // No GPU and no visible window
+    DXUT_CHECK( DXUTGetDeviceSettings().d3d11.DriverType == D3D_DRIVER_TYPE_WARP );
+    DXUT_CHECK( !IsWindowVisible( DXUTGetHWND() ) );
+
+    // The window never becomes active, and the frames still run
+    DXUTResetFrameCounters();
+    s_nFrameRenders = 0;
+    for( UINT i = 0; i < HEADLESS_TEST_FRAMES; ++i )
+        DXUTRender3DEnvironment();
+
+    DXUT_FRAME_COUNTERS counters;
+    DXUTGetFrameCounters( &counters );
+    DXUT_CHECK( s_nFrameRenders == HEADLESS_TEST_FRAMES );
+    DXUT_CHECK( counters.Frames == HEADLESS_TEST_FRAMES );
+    DXUT_CHECK( counters.APICalls[DXUT_API_CLEAR] >= HEADLESS_TEST_FRAMES );
+    DXUT_CHECK( counters.APICalls[DXUT_API_PRESENT] == 0 );
+    DXUT_CHECK( counters.FrameRenderSeconds > 0.0 );
+
+    DXUTShutdown( 0 );
+    DXUTSetCallbackD3D11FrameRender( nullptr );
+}
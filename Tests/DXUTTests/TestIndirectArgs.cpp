@@ -0,0 +1,202 @@
+//--------------------------------------------------------------------------------------
+// File: TestIndirectArgs.cpp
+//
+// Checks the records and instance data CDXUTIndirectArgBuilder lays out against a serial
+// gather, and that splitting the build across threads does not change them.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUTIndirectArgs.h"
+#include "DXUTTests.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+namespace
+{
+
+const uint32_t NUM_MESHES = 50;
+const size_t NUM_INSTANCES = 300000;    // Enough for the builder to use 18 threads
+
+uint32_t NextRandom( uint32_t& seed )
+{
+    seed = seed * 1664525 + 1013904223;
+    return seed >> 8;
+}
+
+// Mesh m has 1 + m % 4 subsets; a few handles past the last mesh are not valid
+void MakeTestInput( CDXUTIndirectArgBuilder& builder, std::vector<DXUT_INDIRECT_INSTANCE>& instances )
+{
+    for( uint32_t iMesh = 0; iMesh < NUM_MESHES; ++iMesh )
+    {
+        std::vector<DXUT_INDIRECT_SUBSET> subsets( 1 + iMesh % 4 );
+        for( uint32_t i = 0; i < subsets.size(); ++i )
+        {
+            subsets[i].IndexCount = iMesh * 10 + i + 3;
+            subsets[i].StartIndex = iMesh * 1000 + i * 100;
+            subsets[i].BaseVertex = int32_t( iMesh ) - 7;
+        }
+        builder.AddMesh( &subsets[0], uint32_t( subsets.size() ) );
+    }
+
+    uint32_t seed = 1;
+    instances.resize( NUM_INSTANCES );
+    for( size_t i = 0; i < instances.size(); ++i )
+    {
+        instances[i].Mesh = NextRandom( seed ) % ( NUM_MESHES + 5 );
+        instances[i].Data = NextRandom( seed );
+        instances[i].Visible = NextRandom( seed ) % 3;
+    }
+}
+
+bool ArgsEqual( const std::vector<DXUT_DRAW_INDEXED_INSTANCED_ARGS>& a, const std::vector<DXUT_DRAW_INDEXED_INSTANCED_ARGS>& b )
+{
+    return a.size() == b.size() && ( a.empty() || !memcmp( &a[0], &b[0], a.size() * sizeof( a[0] ) ) );
+}
+
+bool DrawsEqual( const std::vector<DXUT_INDIRECT_DRAW>& a, const std::vector<DXUT_INDIRECT_DRAW>& b )
+{
+    return a.size() == b.size() && ( a.empty() || !memcmp( &a[0], &b[0], a.size() * sizeof( a[0] ) ) );
+}
+
+double SecondsSince( std::chrono::high_resolution_clock::time_point start )
+{
+    return std::chrono::duration<double>( std::chrono::high_resolution_clock::now() - start ).count();
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( IndirectArgsCountsAndOffsets )
+{
+    // Mesh 1 has no visible instance, so it gets no records
+    const DXUT_INDIRECT_SUBSET mesh0[] = { { 36, 0, 0 }, { 12, 36, 0 } };
+    const DXUT_INDIRECT_SUBSET mesh1[] = { { 6, 100, 10 } };
+    const DXUT_INDIRECT_SUBSET mesh2[] = { { 3, 200, 20 }, { 9, 203, 20 }, { 15, 212, -4 } };
+
+    CDXUTIndirectArgBuilder builder;
+    DXUT_CHECK( builder.AddMesh( mesh0, 2 ) == 0 );
+    DXUT_CHECK( builder.AddMesh( mesh1, 1 ) == 1 );
+    DXUT_CHECK( builder.AddMesh( mesh2, 3 ) == 2 );
+    DXUT_CHECK( builder.GetNumMeshes() == 3 );
+    DXUT_CHECK( builder.GetFirstSubset( 2 ) == 3 && builder.GetNumSubsets( 2 ) == 3 );
+
+    const DXUT_INDIRECT_INSTANCE instances[] =
+    {
+        { 2, 100, 1 },
+        { 0, 101, 1 },
+        { 1, 102, 0 },
+        { 2, 103, 1 },
+        { 7, 104, 1 },      // Not a mesh
+        { 0, 105, 0 },
+        { 2, 106, 1 },
+        { 0, 107, 1 },
+    };
+    builder.Build( instances, sizeof( instances ) / sizeof( instances[0] ), 1 );
+
+    const uint32_t expectedData[] = { 101, 107, 100, 103, 106 };
+    const std::vector<uint32_t>& data = builder.GetInstanceData();
+    DXUT_CHECK( data.size() == 5 && std::equal( data.begin(), data.end(), expectedData ) );
+
+    const DXUT_DRAW_INDEXED_INSTANCED_ARGS expectedArgs[] =
+    {
+        { 36, 2, 0, 0, 0 },
+        { 12, 2, 36, 0, 0 },
+        { 3, 3, 200, 20, 2 },
+        { 9, 3, 203, 20, 2 },
+        { 15, 3, 212, -4, 2 },
+    };
+    const DXUT_INDIRECT_DRAW expectedDraws[] = { { 0, 0 }, { 0, 1 }, { 2, 3 }, { 2, 4 }, { 2, 5 } };
+    DXUT_CHECK( ArgsEqual( builder.GetArgs(), std::vector<DXUT_DRAW_INDEXED_INSTANCED_ARGS>( expectedArgs, expectedArgs + 5 ) ) );
+    DXUT_CHECK( DrawsEqual( builder.GetDraws(), std::vector<DXUT_INDIRECT_DRAW>( expectedDraws, expectedDraws + 5 ) ) );
+
+    builder.Build( nullptr, 0 );
+    DXUT_CHECK( builder.GetArgs().empty() && builder.GetDraws().empty() && builder.GetInstanceData().empty() );
+
+    builder.Clear();
+    DXUT_CHECK( builder.GetNumMeshes() == 0 );
+    builder.Build( instances, sizeof( instances ) / sizeof( instances[0] ), 1 );
+    DXUT_CHECK( builder.GetArgs().empty() && builder.GetInstanceData().empty() );
+}
+
+
+//--------------------------------------------------------------------------------------
+// Every thread count gives the serial gather's instance data and the same records
+//--------------------------------------------------------------------------------------
+DXUT_TEST( IndirectArgsSameForAnyThreadCount )
+{
+    CDXUTIndirectArgBuilder builder;
+    std::vector<DXUT_INDIRECT_INSTANCE> instances;
+    MakeTestInput( builder, instances );
+
+    std::vector<uint32_t> expectedData;
+    std::vector<uint32_t> meshInstances( NUM_MESHES, 0 );
+    for( uint32_t iMesh = 0; iMesh < NUM_MESHES; ++iMesh )
+    {
+        for( size_t i = 0; i < instances.size(); ++i )
+        {
+            if( instances[i].Visible && instances[i].Mesh == iMesh )
+            {
+                expectedData.push_back( instances[i].Data );
+                ++meshInstances[iMesh];
+            }
+        }
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    builder.Build( &instances[0], instances.size(), 1 );
+    double fSerialSeconds = SecondsSince( start );
+    DXUT_CHECK( builder.GetInstanceData() == expectedData );
+
+    // Records by mesh then subset, each drawing all of its mesh's instances
+    const std::vector<DXUT_DRAW_INDEXED_INSTANCED_ARGS>& args = builder.GetArgs();
+    const std::vector<DXUT_INDIRECT_DRAW>& draws = builder.GetDraws();
+    size_t iArg = 0;
+    uint32_t nFirstInstance = 0;
+    for( uint32_t iMesh = 0; iMesh < NUM_MESHES; ++iMesh )
+    {
+        if( !meshInstances[iMesh] )
+            continue;
+        for( uint32_t iSubset = 0; iSubset < builder.GetNumSubsets( iMesh ) && iArg < args.size(); ++iSubset, ++iArg )
+        {
+            DXUT_CHECK( draws[iArg].Mesh == iMesh );
+            DXUT_CHECK( draws[iArg].Subset == builder.GetFirstSubset( iMesh ) + iSubset );
+            DXUT_CHECK( args[iArg].IndexCountPerInstance == iMesh * 10 + iSubset + 3 );
+            DXUT_CHECK( args[iArg].InstanceCount == meshInstances[iMesh] );
+            DXUT_CHECK( args[iArg].StartIndexLocation == iMesh * 1000 + iSubset * 100 );
+            DXUT_CHECK( args[iArg].BaseVertexLocation == int32_t( iMesh ) - 7 );
+            DXUT_CHECK( args[iArg].StartInstanceLocation == nFirstInstance );
+        }
+        nFirstInstance += meshInstances[iMesh];
+    }
+    DXUT_CHECK( iArg == args.size() );
+    DXUT_CHECK( draws.size() == args.size() );
+
+    std::vector<DXUT_DRAW_INDEXED_INSTANCED_ARGS> serialArgs = args;
+    std::vector<DXUT_INDIRECT_DRAW> serialDraws = draws;
+
+    const unsigned int threadCounts[] = { 2, 3, 7, 16, 64, 0 };
+    double fParallelSeconds = 0;
+    for( size_t i = 0; i < sizeof( threadCounts ) / sizeof( threadCounts[0] ); ++i )
+    {
+        start = std::chrono::high_resolution_clock::now();
+        builder.Build( &instances[0], instances.size(), threadCounts[i] );
+        fParallelSeconds = SecondsSince( start );
+
+        DXUT_CHECK( builder.GetInstanceData() == expectedData );
+        DXUT_CHECK( ArgsEqual( builder.GetArgs(), serialArgs ) );
+        DXUT_CHECK( DrawsEqual( builder.GetDraws(), serialDraws ) );
+    }
+
+    printf( "  %u instances of %u meshes: %.2f ms on one thread, %.2f ms on every hardware thread\n",
+            unsigned( instances.size() ), NUM_MESHES, fSerialSeconds * 1000.0, fParallelSeconds * 1000.0 );
+}
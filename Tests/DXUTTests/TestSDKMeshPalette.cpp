@@ -0,0 +1,100 @@
+//--------------------------------------------------------------------------------------
+// File: TestSDKMeshPalette.cpp
+//
+// Writes Tiny's skinning palettes and checks that GetMeshInfluencePalette matches the
+// per-influence matrices, and that it fails without writing when the bind pose has not
+// been set or a dual quaternion palette is asked of scaled bones.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUT.h"
+#include "SDKmesh.h"
+#include "DXUTTests.h"
+
+using namespace DirectX;
+
+namespace
+{
+
+const WCHAR* const TINY_MESH = L"Tiny\\tiny.sdkmesh";
+const BYTE UNWRITTEN = 0xCD;
+
+bool IsUnwritten( const std::vector<BYTE>& palette )
+{
+    for( size_t i = 0; i < palette.size(); ++i )
+    {
+        if( palette[i] != UNWRITTEN )
+            return false;
+    }
+    return true;
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( SDKMeshPaletteChecksBones )
+{
+    ID3D11Device* pDevice = nullptr;
+    DXUT_CHECK( SUCCEEDED( D3D11CreateDevice( nullptr, D3D_DRIVER_TYPE_WARP, nullptr, 0, nullptr, 0, D3D11_SDK_VERSION,
+                                              &pDevice, nullptr, nullptr ) ) );
+    if( !pDevice )
+        return;
+
+    {
+        CDXUTSDKMesh mesh;
+        HRESULT hr = mesh.Create( pDevice, TINY_MESH );
+        DXUT_CHECK( SUCCEEDED( hr ) );
+
+        UINT iSkinned = UINT( -1 );
+        for( UINT i = 0; SUCCEEDED( hr ) && i < mesh.GetNumMeshes() && iSkinned == UINT( -1 ); ++i )
+        {
+            if( mesh.GetNumInfluences( i ) > 0 )
+                iSkinned = i;
+        }
+        DXUT_CHECK( iSkinned != UINT( -1 ) );
+
+        if( iSkinned != UINT( -1 ) )
+        {
+            UINT nBones = mesh.GetNumInfluences( iSkinned );
+            std::vector<BYTE> palette( nBones * CDXUTSDKMesh::GetPaletteStride( SDKMESH_PALETTE_FLOAT4X4 ), UNWRITTEN );
+
+            // Without a bind pose there is nothing to skin against
+            DXUT_CHECK( mesh.GetMeshInfluencePalette( iSkinned, SDKMESH_PALETTE_FLOAT4X4, &palette[0], palette.size() ) == E_FAIL );
+            DXUT_CHECK( IsUnwritten( palette ) );
+
+            mesh.TransformBindPose( XMMatrixIdentity() );
+            mesh.TransformMesh( XMMatrixIdentity(), 0.0 );
+            DXUT_CHECK( SUCCEEDED( mesh.GetMeshInfluencePalette( iSkinned, SDKMESH_PALETTE_FLOAT4X4, &palette[0], palette.size() ) ) );
+            bool bMatches = true;
+            for( UINT i = 0; i < nBones; ++i )
+            {
+                XMFLOAT4X4 expected;
+                XMStoreFloat4x4( &expected, XMMatrixTranspose( mesh.GetMeshInfluenceMatrix( iSkinned, i ) ) );
+                bMatches &= !memcmp( &palette[ i * sizeof( XMFLOAT4X4 ) ], &expected, sizeof( expected ) );
+            }
+            DXUT_CHECK( bMatches );
+
+            // In the bind pose every bone is rigid
+            DXUT_CHECK( SUCCEEDED( mesh.GetMeshInfluencePalette( iSkinned, SDKMESH_PALETTE_DUAL_QUATERNION, &palette[0], palette.size() ) ) );
+
+            // Scaled bones fit the matrix layouts only
+            mesh.TransformMesh( XMMatrixScaling( 2.0f, 2.0f, 2.0f ), 0.0 );
+            std::fill( palette.begin(), palette.end(), UNWRITTEN );
+            DXUT_CHECK( mesh.GetMeshInfluencePalette( iSkinned, SDKMESH_PALETTE_DUAL_QUATERNION, &palette[0], palette.size() ) == E_FAIL );
+            DXUT_CHECK( IsUnwritten( palette ) );
+            DXUT_CHECK( SUCCEEDED( mesh.GetMeshInfluencePalette( iSkinned, SDKMESH_PALETTE_FLOAT3X4, &palette[0], palette.size() ) ) );
+        }
+    }
+
+    // The textures Tiny loaded are cached against this device
+    DXUTGetGlobalResourceCache().OnDestroyDevice();
+    pDevice->Release();
+}
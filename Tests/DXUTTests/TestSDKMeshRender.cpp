@@ -0,0 +1,318 @@
+//--------------------------------------------------------------------------------------
+// File: TestSDKMeshRender.cpp
+//
+// Renders Tiny through a recording context and checks that CDXUTSDKMesh::Render binds
+// the state each draw needs in fewer calls than the unbatched per-subset path made, that
+// meshes in one geometry pool keep their buffers bound across Render calls sharing a bind
+// cache, that its material binding records keep their views alive, and that the indirect
+// renderer refuses an instance slot that its meshes' streams would replace.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUT.h"
+#include "SDKmesh.h"
+#include "DXUTIndirectDraw.h"
+#include "DXUTRecordingContext.h"
+#include "DXUTTests.h"
+
+namespace
+{
+
+const WCHAR* const TINY_MESH = L"Tiny\\tiny.sdkmesh";
+
+HRESULT CreateWarpDevice( ID3D11Device** ppDevice )
+{
+    return D3D11CreateDevice( nullptr, D3D_DRIVER_TYPE_WARP, nullptr, 0, nullptr, 0, D3D11_SDK_VERSION,
+                              ppDevice, nullptr, nullptr );
+}
+
+// Returns a view's reference count, leaving it unchanged
+ULONG GetRefCount( IUnknown* pObject )
+{
+    pObject->AddRef();
+    return pObject->Release();
+}
+
+//--------------------------------------------------------------------------------------
+// The subsets RenderFrame draws, in order, and the calls the original RenderMesh made for
+// them: both buffers per mesh, then a topology and one view per slot for every subset
+//--------------------------------------------------------------------------------------
+struct EXPECTED_DRAW
+{
+    UINT iMesh;
+    UINT iSubset;
+};
+
+void CollectDraws( const CDXUTSDKMesh& mesh, UINT iFrame, std::vector<EXPECTED_DRAW>& draws, UINT& nUnbatchedStateCalls )
+{
+    const SDKMESH_FRAME* pFrame = mesh.GetFrame( iFrame );
+    if( pFrame->Mesh != INVALID_MESH )
+    {
+        nUnbatchedStateCalls += 2;
+        for( UINT i = 0; i < mesh.GetNumSubsets( pFrame->Mesh ); ++i )
+        {
+            EXPECTED_DRAW draw = { pFrame->Mesh, i };
+            draws.push_back( draw );
+            nUnbatchedStateCalls += 1 + 3;
+        }
+    }
+
+    if( pFrame->ChildFrame != INVALID_FRAME )
+        CollectDraws( mesh, pFrame->ChildFrame, draws, nUnbatchedStateCalls );
+    if( pFrame->SiblingFrame != INVALID_FRAME )
+        CollectDraws( mesh, pFrame->SiblingFrame, draws, nUnbatchedStateCalls );
+}
+
+UINT BufferBinds( const CDXUTRecordingContext& context )
+{
+    return context.nVertexBufferCalls + context.nIndexBufferCalls;
+}
+
+ID3D11ShaderResourceView* BoundView( ID3D11ShaderResourceView* pView )
+{
+    return IsErrorResource( pView ) ? nullptr : pView;
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( SDKMeshRenderBatchesState )
+{
+    ID3D11Device* pDevice = nullptr;
+    DXUT_CHECK( SUCCEEDED( CreateWarpDevice( &pDevice ) ) );
+    if( !pDevice )
+        return;
+
+    {
+        CDXUTSDKMesh mesh;
+        HRESULT hr = mesh.Create( pDevice, TINY_MESH );
+        DXUT_CHECK( SUCCEEDED( hr ) );
+        if( SUCCEEDED( hr ) )
+        {
+            std::vector<EXPECTED_DRAW> expected;
+            UINT nUnbatchedStateCalls = 0;
+            CollectDraws( mesh, 0, expected, nUnbatchedStateCalls );
+
+            CDXUTRecordingContext context( pDevice );
+            mesh.Render( &context, 0, 1, 2 );
+
+            // Same draws, each with the state the unbatched path would have left bound
+            DXUT_CHECK( !expected.empty() );
+            DXUT_CHECK( context.Draws.size() == expected.size() );
+            for( size_t i = 0; i < expected.size() && i < context.Draws.size(); ++i )
+            {
+                const DXUT_RECORDED_DRAW& draw = context.Draws[i];
+                const SDKMESH_SUBSET* pSubset = mesh.GetSubset( expected[i].iMesh, expected[i].iSubset );
+                const SDKMESH_MATERIAL* pMaterial = mesh.GetMaterial( UINT( pSubset->MaterialID ) );
+
+                DXUT_CHECK( draw.IndexCount == UINT( pSubset->IndexCount ) );
+                DXUT_CHECK( draw.Topology == CDXUTSDKMesh::GetPrimitiveType11( SDKMESH_PRIMITIVE_TYPE( pSubset->PrimitiveType ) ) );
+                DXUT_CHECK( draw.pIB == mesh.GetIB11( expected[i].iMesh ) );
+                DXUT_CHECK( draw.pVB[0] == mesh.GetVB11( expected[i].iMesh, 0 ) );
+                DXUT_CHECK( draw.pPSSRVs[0] == BoundView( pMaterial->pDiffuseRV11 ) );
+                DXUT_CHECK( draw.pPSSRVs[1] == BoundView( pMaterial->pNormalRV11 ) );
+                DXUT_CHECK( draw.pPSSRVs[2] == BoundView( pMaterial->pSpecularRV11 ) );
+            }
+
+            UINT nStateCalls = context.GetStateCalls();
+            DXUT_CHECK( nStateCalls < nUnbatchedStateCalls );
+            printf( "  Tiny: %u draws, %u state calls, %u unbatched\n",
+                    unsigned( context.Draws.size() ), nStateCalls, nUnbatchedStateCalls );
+        }
+    }
+
+    // The textures Tiny loaded are cached against this device
+    DXUTGetGlobalResourceCache().OnDestroyDevice();
+    pDevice->Release();
+}
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( SDKMeshBindingsReferenceViews )
+{
+    ID3D11Device* pDevice = nullptr;
+    DXUT_CHECK( SUCCEEDED( CreateWarpDevice( &pDevice ) ) );
+    if( !pDevice )
+        return;
+
+    // A stand-in texture to swap into the first material
+    D3D11_TEXTURE2D_DESC desc = {};
+    desc.Width = desc.Height = 1;
+    desc.MipLevels = desc.ArraySize = 1;
+    desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    desc.SampleDesc.Count = 1;
+    desc.Usage = D3D11_USAGE_DEFAULT;
+    desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+    ID3D11Texture2D* pTexture = nullptr;
+    ID3D11ShaderResourceView* pView = nullptr;
+    DXUT_CHECK( SUCCEEDED( pDevice->CreateTexture2D( &desc, nullptr, &pTexture ) ) );
+    if( pTexture )
+    {
+        DXUT_CHECK( SUCCEEDED( pDevice->CreateShaderResourceView( pTexture, nullptr, &pView ) ) );
+        pTexture->Release();
+    }
+
+    if( pView )
+    {
+        CDXUTSDKMesh mesh;
+        HRESULT hr = mesh.Create( pDevice, TINY_MESH );
+        DXUT_CHECK( SUCCEEDED( hr ) );
+        if( SUCCEEDED( hr ) && mesh.GetNumMaterials() > 0 )
+        {
+            SDKMESH_MATERIAL* pMaterial = mesh.GetMaterial( 0 );
+            ID3D11ShaderResourceView* pOriginal = pMaterial->pDiffuseRV11;
+
+            // The records hold their own reference to a view swapped in
+            ULONG nBefore = GetRefCount( pView );
+            pMaterial->pDiffuseRV11 = pView;
+            mesh.UpdateMaterialBindings();
+            DXUT_CHECK( GetRefCount( pView ) == nBefore + 1 );
+
+            CDXUTRecordingContext context( pDevice );
+            mesh.Render( &context, 0, 1, 2 );
+            bool bSwappedViewBound = false;
+            for( size_t i = 0; i < context.Draws.size(); ++i )
+                bSwappedViewBound |= ( context.Draws[i].pPSSRVs[0] == pView );
+            DXUT_CHECK( bSwappedViewBound );
+
+            // And drop it when the view is swapped back out
+            pMaterial->pDiffuseRV11 = pOriginal;
+            mesh.UpdateMaterialBindings();
+            DXUT_CHECK( GetRefCount( pView ) == nBefore );
+
+            // Destroy releases what the records hold
+            pMaterial->pDiffuseRV11 = pView;
+            mesh.UpdateMaterialBindings();
+            pMaterial->pDiffuseRV11 = pOriginal;
+            mesh.Destroy();
+            DXUT_CHECK( GetRefCount( pView ) == nBefore );
+        }
+
+        pView->Release();
+    }
+
+    // The textures Tiny loaded are cached against this device
+    DXUTGetGlobalResourceCache().OnDestroyDevice();
+    pDevice->Release();
+}
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( SDKMeshPooledMeshesShareBinding )
+{
+    ID3D11Device* pDevice = nullptr;
+    DXUT_CHECK( SUCCEEDED( CreateWarpDevice( &pDevice ) ) );
+    if( !pDevice )
+        return;
+
+    ID3D11DeviceContext* pImmediateContext = nullptr;
+    pDevice->GetImmediateContext( &pImmediateContext );
+
+    CDXUTGeometryPool pool;
+    DXUT_CHECK( SUCCEEDED( pool.OnD3D11CreateDevice( pDevice, pImmediateContext ) ) );
+
+    {
+        CDXUTSDKMesh meshes[2];
+        bool bCreated = true;
+        for( int i = 0; i < 2; ++i )
+        {
+            meshes[i].SetGeometryPool( &pool );
+            bCreated &= SUCCEEDED( meshes[i].Create( pDevice, TINY_MESH ) );
+        }
+        DXUT_CHECK( bCreated );
+        if( bCreated )
+        {
+            // Both copies land in the same pages, at different bases
+            DXUT_CHECK( meshes[0].GetVB11( 0, 0 ) == meshes[1].GetVB11( 0, 0 ) );
+            DXUT_CHECK( meshes[0].GetVertexBufferBase( 0 ) != meshes[1].GetVertexBufferBase( 0 ) );
+
+            // Without a cache each Render binds the buffers again
+            CDXUTRecordingContext context( pDevice );
+            meshes[0].Render( &context, 0, 1, 2 );
+            UINT nBinds = BufferBinds( context );
+            meshes[1].Render( &context, 0, 1, 2 );
+            UINT nUncachedBinds = BufferBinds( context ) - nBinds;
+            DXUT_CHECK( nUncachedBinds > 0 );
+
+            // With the context's cache the second mesh draws from what the first bound
+            DXUT_GEOMETRY_BIND_CACHE bindCache;
+            meshes[0].Render( &context, 0, 1, 2, &bindCache );
+            nBinds = BufferBinds( context );
+            size_t iFirstDraw = context.Draws.size();
+            meshes[1].Render( &context, 0, 1, 2, &bindCache );
+            DXUT_CHECK( BufferBinds( context ) == nBinds );
+            DXUT_CHECK( context.Draws.size() > iFirstDraw );
+            if( context.Draws.size() > iFirstDraw )
+            {
+                const DXUT_RECORDED_DRAW& draw = context.Draws[iFirstDraw];
+                DXUT_CHECK( draw.pVB[0] == meshes[1].GetVB11( 0, 0 ) && draw.pIB == meshes[1].GetIB11( 0 ) );
+                DXUT_CHECK( draw.BaseVertex >= INT( meshes[1].GetVertexBufferBase( 0 ) ) );
+            }
+
+            // Anything else setting the buffers invalidates the cache
+            bindCache.Invalidate();
+            nBinds = BufferBinds( context );
+            meshes[1].Render( &context, 0, 1, 2, &bindCache );
+            DXUT_CHECK( BufferBinds( context ) - nBinds == nUncachedBinds );
+
+            printf( "  Second pooled Tiny: %u buffer binds without a bind cache, 0 with one\n", nUncachedBinds );
+        }
+    }
+
+    pool.OnD3D11DestroyDevice();
+    SAFE_RELEASE( pImmediateContext );
+    DXUTGetGlobalResourceCache().OnDestroyDevice();
+    pDevice->Release();
+}
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( IndirectRendererRejectsOverlappingInstanceSlot )
+{
+    ID3D11Device* pDevice = nullptr;
+    DXUT_CHECK( SUCCEEDED( CreateWarpDevice( &pDevice ) ) );
+    if( !pDevice )
+        return;
+
+    ID3D11DeviceContext* pImmediateContext = nullptr;
+    pDevice->GetImmediateContext( &pImmediateContext );
+
+    {
+        CDXUTSDKMesh mesh;
+        HRESULT hr = mesh.Create( pDevice, TINY_MESH );
+        DXUT_CHECK( SUCCEEDED( hr ) );
+
+        CDXUTIndirectMeshRenderer renderer;
+        UINT iFirstHandle = 0;
+        if( SUCCEEDED( hr ) )
+        {
+            DXUT_CHECK( SUCCEEDED( renderer.OnD3D11CreateDevice( pDevice ) ) );
+            DXUT_CHECK( SUCCEEDED( renderer.AddSDKMesh( &mesh, &iFirstHandle ) ) );
+
+            DXUT_INDIRECT_INSTANCE instances[2] = { { iFirstHandle, 0, 1 }, { iFirstHandle, 1, 1 } };
+
+            // Tiny's one stream is in slot 0, so the instance stream cannot go there
+            CDXUTRecordingContext context( pDevice );
+            DXUT_CHECK( renderer.Render( &context, instances, 2, 0, 0, 1, 2 ) == E_INVALIDARG );
+            DXUT_CHECK( context.Draws.empty() && context.GetStateCalls() == 0 );
+
+            DXUT_CHECK( SUCCEEDED( renderer.Render( pImmediateContext, instances, 2, 1, 0, 1, 2 ) ) );
+            DXUT_GEOMETRY_BIND_CACHE bindCache;
+            DXUT_CHECK( SUCCEEDED( renderer.Render( pImmediateContext, instances, 2, 1, 0, 1, 2, 0, &bindCache ) ) );
+            DXUT_CHECK( bindCache.bValid && bindCache.pIB == mesh.GetIB11( 0 ) );
+            pImmediateContext->ClearState();
+        }
+    }
+
+    SAFE_RELEASE( pImmediateContext );
+    DXUTGetGlobalResourceCache().OnDestroyDevice();
+    pDevice->Release();
+}
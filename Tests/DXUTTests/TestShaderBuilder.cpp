@@ -0,0 +1,261 @@
+//--------------------------------------------------------------------------------------
+// File: TestShaderBuilder.cpp
+//
+// Compiles shaders from a temporary directory with a stand-in compiler that opens its
+// includes through the ID3DInclude it is given, and checks that editing an include
+// rebuilds exactly the shaders that use it, in CDXUTShaderBuilder and in the bytecode
+// cache.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUT.h"
+#include "DXUTShaderCache.h"
+#include "SDKmisc.h"
+#include "DXUTTests.h"
+
+#include <string>
+
+namespace
+{
+
+volatile LONG s_nCompiles = 0;
+
+//--------------------------------------------------------------------------------------
+// Replaces each #include "file" line with the file, opened through pInclude with the
+// includer as the parent, the way D3DCompile does
+//--------------------------------------------------------------------------------------
+HRESULT ExpandIncludes( ID3DInclude* pInclude, const char* pText, size_t bytes, std::string& strOut )
+{
+    static const char s_Include[] = "#include \"";
+
+    std::string strSource( pText, bytes );
+    size_t pos = 0;
+    while( pos < strSource.size() )
+    {
+        size_t end = strSource.find( '\n', pos );
+        end = ( end == std::string::npos ) ? strSource.size() : end + 1;
+        std::string strLine = strSource.substr( pos, end - pos );
+        pos = end;
+
+        if( strLine.compare( 0, sizeof( s_Include ) - 1, s_Include ) != 0 )
+        {
+            strOut += strLine;
+            continue;
+        }
+
+        size_t nameEnd = strLine.find( '"', sizeof( s_Include ) - 1 );
+        std::string strName = strLine.substr( sizeof( s_Include ) - 1, nameEnd - ( sizeof( s_Include ) - 1 ) );
+
+        LPCVOID pData = nullptr;
+        UINT nBytes = 0;
+        HRESULT hr = pInclude->Open( D3D_INCLUDE_LOCAL, strName.c_str(), pText, &pData, &nBytes );
+        if( FAILED( hr ) )
+            return hr;
+
+        hr = ExpandIncludes( pInclude, reinterpret_cast<const char*>( pData ), nBytes, strOut );
+        pInclude->Close( pData );
+        if( FAILED( hr ) )
+            return hr;
+    }
+
+    return S_OK;
+}
+
+HRESULT WINAPI StandInCompile( LPCVOID pSrcData, SIZE_T SrcDataSize, LPCSTR, const D3D_SHADER_MACRO*, ID3DInclude* pInclude,
+                               LPCSTR, LPCSTR, UINT, UINT, ID3DBlob** ppCode, ID3DBlob** ppErrorMsgs )
+{
+    InterlockedIncrement( &s_nCompiles );
+
+    if( ppErrorMsgs )
+        *ppErrorMsgs = nullptr;
+
+    std::string strCode;
+    HRESULT hr = ExpandIncludes( pInclude, reinterpret_cast<const char*>( pSrcData ), SrcDataSize, strCode );
+    if( FAILED( hr ) )
+        return hr;
+
+    hr = D3DCreateBlob( strCode.size() + 1, ppCode );
+    if( FAILED( hr ) )
+        return hr;
+
+    memcpy( ( *ppCode )->GetBufferPointer(), strCode.c_str(), strCode.size() + 1 );
+    return S_OK;
+}
+
+bool CodeContains( ID3DBlob* pCode, const char* str )
+{
+    return pCode && strstr( reinterpret_cast<const char*>( pCode->GetBufferPointer() ), str ) != nullptr;
+}
+
+
+//--------------------------------------------------------------------------------------
+// Scene.hlsl includes common.hlsli, which includes sub\lighting.hlsli, which includes
+// shadow.hlsli from its own directory.  Sky.hlsl includes nothing.  Everything is removed
+// when the test ends.
+//--------------------------------------------------------------------------------------
+class CShaderTestDirectory
+{
+public:
+    CShaderTestDirectory() : m_nWrites( 0 )
+    {
+        WCHAR strTemp[MAX_PATH];
+        GetTempPathW( MAX_PATH, strTemp );
+
+        WCHAR strName[64];
+        swprintf_s( strName, 64, L"DXUTShaderTest%lx\\", GetCurrentProcessId() );
+        m_strDir = std::wstring( strTemp ) + strName;
+
+        CreateDirectoryW( m_strDir.c_str(), nullptr );
+        CreateDirectoryW( ( m_strDir + L"sub" ).c_str(), nullptr );
+        CreateDirectoryW( ( m_strDir + L"cache" ).c_str(), nullptr );
+
+        Write( L"Scene.hlsl", "#include \"common.hlsli\"\nfloat4 main() : SV_Target { return Tint; }\n" );
+        Write( L"common.hlsli", "#include \"sub\\lighting.hlsli\"\nfloat4 Tint;\n" );
+        Write( L"sub\\lighting.hlsli", "#include \"shadow.hlsli\"\nfloat3 Light;\n" );
+        Write( L"sub\\shadow.hlsli", "float Shadow;\n" );
+        Write( L"Sky.hlsl", "float4 main() : SV_Target { return 1; }\n" );
+    }
+
+    ~CShaderTestDirectory()
+    {
+        const WCHAR* s_Files[] = { L"Scene.hlsl", L"common.hlsli", L"sub\\lighting.hlsli", L"sub\\shadow.hlsli", L"Sky.hlsl" };
+        for( size_t i = 0; i < _countof( s_Files ); ++i )
+            DeleteFileW( GetPath( s_Files[i] ).c_str() );
+
+        WIN32_FIND_DATAW fd;
+        HANDLE hFind = FindFirstFileW( GetPath( L"cache\\*.dxsc" ).c_str(), &fd );
+        if( hFind != INVALID_HANDLE_VALUE )
+        {
+            do
+            {
+                DeleteFileW( ( GetPath( L"cache\\" ) + fd.cFileName ).c_str() );
+            } while( FindNextFileW( hFind, &fd ) );
+            FindClose( hFind );
+        }
+
+        RemoveDirectoryW( GetPath( L"cache" ).c_str() );
+        RemoveDirectoryW( GetPath( L"sub" ).c_str() );
+        RemoveDirectoryW( m_strDir.c_str() );
+    }
+
+    std::wstring GetPath( LPCWSTR szName ) const { return m_strDir + szName; }
+
+    // Each write is stamped a minute after the last, so the change is seen whatever the
+    // file system's time resolution
+    void Write( LPCWSTR szName, const char* strText )
+    {
+        HANDLE hFile = CreateFileW( GetPath( szName ).c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr );
+        DXUT_CHECK( hFile != INVALID_HANDLE_VALUE );
+        if( hFile == INVALID_HANDLE_VALUE )
+            return;
+
+        DWORD BytesWritten = 0;
+        WriteFile( hFile, strText, DWORD( strlen( strText ) ), &BytesWritten, nullptr );
+
+        ULARGE_INTEGER time;
+        time.QuadPart = 130000000000000000ULL + ( ++m_nWrites ) * 600000000ULL;
+        FILETIME ft;
+        ft.dwLowDateTime = time.LowPart;
+        ft.dwHighDateTime = time.HighPart;
+        SetFileTime( hFile, nullptr, nullptr, &ft );
+        CloseHandle( hFile );
+    }
+
+private:
+    std::wstring m_strDir;
+    UINT m_nWrites;
+};
+
+};
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( ShaderBuilderRebuildsDependents )
+{
+    CShaderTestDirectory dir;
+    DXUTSetShaderCompiler( StandInCompile, 1 );
+
+    CDXUTShaderBuilder builder;
+    UINT iScene = builder.AddJob( dir.GetPath( L"Scene.hlsl" ).c_str(), nullptr, "main", "ps_5_0" );
+    UINT iSky = builder.AddJob( dir.GetPath( L"Sky.hlsl" ).c_str(), nullptr, "main", "ps_5_0" );
+
+    LONG nCompiles = s_nCompiles;
+    DXUT_CHECK( SUCCEEDED( builder.Build( 2 ) ) );
+    DXUT_CHECK( builder.WasRebuilt( iScene ) && builder.WasRebuilt( iSky ) );
+    DXUT_CHECK( s_nCompiles - nCompiles == 2 );
+
+    // Each include was found relative to the file that included it
+    DXUT_CHECK( CodeContains( builder.GetCode( iScene ), "float Shadow;\nfloat3 Light;\nfloat4 Tint;\n" ) );
+
+    // Nothing changed, nothing compiles
+    DXUT_CHECK( SUCCEEDED( builder.Build( 2 ) ) );
+    DXUT_CHECK( !builder.WasRebuilt( iScene ) && !builder.WasRebuilt( iSky ) );
+    DXUT_CHECK( s_nCompiles - nCompiles == 2 );
+
+    // Touching the deepest include rebuilds the shader that reaches it, and only that one
+    dir.Write( L"sub\\shadow.hlsli", "float Shadow;\nfloat ShadowBias;\n" );
+    DXUT_CHECK( SUCCEEDED( builder.Build( 2 ) ) );
+    DXUT_CHECK( builder.WasRebuilt( iScene ) && !builder.WasRebuilt( iSky ) );
+    DXUT_CHECK( s_nCompiles - nCompiles == 3 );
+    DXUT_CHECK( CodeContains( builder.GetCode( iScene ), "ShadowBias" ) );
+
+    builder.RemoveAllJobs();
+    DXUTSetShaderCompiler( nullptr );
+}
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( ShaderCacheRebuildsOnIncludeEdit )
+{
+    CShaderTestDirectory dir;
+    DXUTSetShaderCompiler( StandInCompile, 1 );
+    DXUT_CHECK( SUCCEEDED( DXUTSetShaderCacheDirectory( dir.GetPath( L"cache" ).c_str() ) ) );
+
+    DXUT_SHADER_CACHE_STATS start;
+    DXUTGetShaderCacheStats( &start );
+    LONG nCompiles = s_nCompiles;
+
+    std::wstring strScene = dir.GetPath( L"Scene.hlsl" );
+    ID3DBlob* pCode = nullptr;
+    std::vector<std::wstring> includes;
+    DXUT_CHECK( SUCCEEDED( DXUTCompileShaderCached( strScene.c_str(), nullptr, "main", "ps_5_0", 0, 0, &pCode, nullptr, &includes ) ) );
+    DXUT_CHECK( s_nCompiles - nCompiles == 1 );
+    DXUT_CHECK( includes.size() == 3 );
+    SAFE_RELEASE( pCode );
+
+    // Served from the cache, with the same include list
+    includes.clear();
+    DXUT_CHECK( SUCCEEDED( DXUTCompileShaderCached( strScene.c_str(), nullptr, "main", "ps_5_0", 0, 0, &pCode, nullptr, &includes ) ) );
+    DXUT_CHECK( s_nCompiles - nCompiles == 1 );
+    DXUT_CHECK( includes.size() == 3 && _wcsicmp( includes[2].c_str(), dir.GetPath( L"sub\\shadow.hlsli" ).c_str() ) == 0 );
+    SAFE_RELEASE( pCode );
+
+    // Editing an include makes the entry stale
+    dir.Write( L"sub\\shadow.hlsli", "float Shadow;\nfloat ShadowBias;\n" );
+    DXUT_CHECK( SUCCEEDED( DXUTCompileShaderCached( strScene.c_str(), nullptr, "main", "ps_5_0", 0, 0, &pCode, nullptr ) ) );
+    DXUT_CHECK( s_nCompiles - nCompiles == 2 );
+    DXUT_CHECK( CodeContains( pCode, "ShadowBias" ) );
+    SAFE_RELEASE( pCode );
+
+    // Another compiler gets its own entry
+    DXUTSetShaderCompiler( StandInCompile, 2 );
+    DXUT_CHECK( SUCCEEDED( DXUTCompileShaderCached( strScene.c_str(), nullptr, "main", "ps_5_0", 0, 0, &pCode, nullptr ) ) );
+    DXUT_CHECK( s_nCompiles - nCompiles == 3 );
+    SAFE_RELEASE( pCode );
+
+    DXUT_SHADER_CACHE_STATS stats;
+    DXUTGetShaderCacheStats( &stats );
+    DXUT_CHECK( stats.Hits - start.Hits == 1 );
+    DXUT_CHECK( stats.Stale - start.Stale == 1 );
+    DXUT_CHECK( stats.Misses - start.Misses == 2 );
+
+    DXUTSetShaderCacheDirectory( nullptr );
+    DXUTSetShaderCompiler( nullptr );
+}
@@ -0,0 +1,307 @@
+//--------------------------------------------------------------------------------------
+// File: TestShaderCache.cpp
+//
+// Runs the shader cache key and entry checks over an in-memory file system, with a
+// stand-in compiler that expands #include lines, and checks when an entry is used, missed
+// or found stale.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUTShaderCacheKey.h"
+#include "DXUTTests.h"
+
+#include <map>
+
+namespace
+{
+
+struct TEST_SHADER_MACRO
+{
+    const char* Name;
+    const char* Definition;
+};
+
+const TEST_SHADER_MACRO s_NoDefines[] = { { nullptr, nullptr } };
+
+//--------------------------------------------------------------------------------------
+// Goes through the cache the way DXUTCompileShaderCached does, keeping files and entries
+// in maps.  The compiler's "bytecode" is its name followed by the source with every
+// #include "file" line replaced by that file, so a stale entry is easy to spot.
+//--------------------------------------------------------------------------------------
+class CShaderCacheHarness
+{
+public:
+    CShaderCacheHarness() :
+        m_strCompiler( "fxc-a" ),
+        m_nCompiles( 0 ),
+        m_nHits( 0 ),
+        m_nStale( 0 ),
+        m_nMisses( 0 )
+    {
+    }
+
+    std::map<std::wstring, std::string> Files;
+    std::map<uint64_t, std::vector<uint8_t>> Entries;
+
+    void SetCompiler( const char* strCompiler ) { m_strCompiler = strCompiler; }
+
+    std::string Compile( const wchar_t* szFileName, const TEST_SHADER_MACRO* pDefines = s_NoDefines,
+                         const char* pEntrypoint = "main", uint32_t Flags1 = 0 )
+    {
+        const std::string& strSource = Files[ szFileName ];
+        uint64_t compilerId = DXUTHashShaderString( DXUT_SHADER_CACHE_HASH_SEED, m_strCompiler.c_str() );
+        uint64_t key = DXUTComputeShaderCacheKey( compilerId, szFileName, strSource.data(), strSource.size(),
+                                                  pDefines, pEntrypoint, "ps_5_0", Flags1, 0 );
+
+        auto entry = Entries.find( key );
+        if( entry != Entries.end() )
+        {
+            auto hashFile = [&]( const std::wstring& strPath, uint64_t& hash ) -> bool
+            {
+                auto it = Files.find( strPath );
+                if( it == Files.end() )
+                    return false;
+                hash = DXUTHashShaderBytes( DXUT_SHADER_CACHE_HASH_SEED, it->second.data(), it->second.size() );
+                return true;
+            };
+
+            const uint8_t* pBytecode = nullptr;
+            uint32_t bytecodeBytes = 0;
+            switch( DXUTCheckShaderCacheEntry( entry->second.data(), entry->second.size(), key, hashFile,
+                                               nullptr, &pBytecode, &bytecodeBytes ) )
+            {
+            case DXUT_SHADER_CACHE_HIT:
+                ++m_nHits;
+                return std::string( reinterpret_cast<const char*>( pBytecode ), bytecodeBytes );
+            case DXUT_SHADER_CACHE_STALE:
+                ++m_nStale;
+                break;
+            default:
+                ++m_nMisses;
+                break;
+            }
+        }
+        else
+        {
+            ++m_nMisses;
+        }
+
+        // A failed compile writes no entry, like the real cache
+        ++m_nCompiles;
+        std::vector<DXUT_SHADER_CACHE_DEPENDENCY> includes;
+        std::string strCode = m_strCompiler + ":";
+        if( !Expand( strSource, includes, strCode ) )
+            return std::string();
+
+        DXUTBuildShaderCacheEntry( key, includes, strCode.data(), strCode.size(), Entries[key] );
+        return strCode;
+    }
+
+    int GetCompiles() const { return m_nCompiles; }
+    int GetHits() const { return m_nHits; }
+    int GetStale() const { return m_nStale; }
+    int GetMisses() const { return m_nMisses; }
+
+private:
+    bool Expand( const std::string& strSource, std::vector<DXUT_SHADER_CACHE_DEPENDENCY>& includes, std::string& strOut )
+    {
+        static const char s_Include[] = "#include \"";
+
+        size_t pos = 0;
+        while( pos < strSource.size() )
+        {
+            size_t end = strSource.find( '\n', pos );
+            end = ( end == std::string::npos ) ? strSource.size() : end + 1;
+            std::string strLine = strSource.substr( pos, end - pos );
+            pos = end;
+
+            if( strLine.compare( 0, sizeof( s_Include ) - 1, s_Include ) != 0 )
+            {
+                strOut += strLine;
+                continue;
+            }
+
+            size_t nameEnd = strLine.find( '"', sizeof( s_Include ) - 1 );
+            std::string strName = strLine.substr( sizeof( s_Include ) - 1, nameEnd - ( sizeof( s_Include ) - 1 ) );
+            std::wstring strPath( strName.begin(), strName.end() );
+
+            auto file = Files.find( strPath );
+            if( file == Files.end() )
+                return false;
+
+            const std::string& strInclude = file->second;
+            DXUT_SHADER_CACHE_DEPENDENCY dependency;
+            dependency.strPath = strPath;
+            dependency.ContentHash = DXUTHashShaderBytes( DXUT_SHADER_CACHE_HASH_SEED, strInclude.data(), strInclude.size() );
+            includes.push_back( dependency );
+
+            if( !Expand( strInclude, includes, strOut ) )
+                return false;
+        }
+        return true;
+    }
+
+    std::string m_strCompiler;
+    int m_nCompiles;
+    int m_nHits;
+    int m_nStale;
+    int m_nMisses;
+};
+
+void AddShaders( CShaderCacheHarness& cache )
+{
+    cache.Files[ L"lighting.hlsli" ] = "float3 Light;\n";
+    cache.Files[ L"common.hlsli" ] = "#include \"lighting.hlsli\"\nfloat4 Tint;\n";
+    cache.Files[ L"Scene.hlsl" ] = "#include \"common.hlsli\"\nfloat4 main() : SV_Target { return Tint; }\n";
+    cache.Files[ L"Sky.hlsl" ] = "float4 main() : SV_Target { return 1; }\n";
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( ShaderCacheHitAndMiss )
+{
+    CShaderCacheHarness cache;
+    AddShaders( cache );
+
+    std::string strCode = cache.Compile( L"Scene.hlsl" );
+    DXUT_CHECK( cache.GetCompiles() == 1 && cache.GetMisses() == 1 );
+    DXUT_CHECK( strCode == "fxc-a:float3 Light;\nfloat4 Tint;\nfloat4 main() : SV_Target { return Tint; }\n" );
+
+    // Same inputs: served from the entry, without the compiler
+    DXUT_CHECK( cache.Compile( L"Scene.hlsl" ) == strCode );
+    DXUT_CHECK( cache.GetCompiles() == 1 && cache.GetHits() == 1 );
+
+    // Every other input to the key is its own entry
+    const TEST_SHADER_MACRO defines[] = { { "SHADOWS", "1" }, { nullptr, nullptr } };
+    const TEST_SHADER_MACRO otherDefines[] = { { "SHADOWS", "0" }, { nullptr, nullptr } };
+    cache.Compile( L"Scene.hlsl", defines );
+    cache.Compile( L"Scene.hlsl", otherDefines );
+    cache.Compile( L"Scene.hlsl", s_NoDefines, "main2" );
+    cache.Compile( L"Scene.hlsl", s_NoDefines, "main", 1 );
+    cache.Compile( L"Sky.hlsl" );
+    DXUT_CHECK( cache.GetCompiles() == 6 && cache.GetMisses() == 6 );
+    DXUT_CHECK( cache.Entries.size() == 6 );
+
+    // And each is then a hit
+    cache.Compile( L"Scene.hlsl", defines );
+    cache.Compile( L"Scene.hlsl", otherDefines );
+    cache.Compile( L"Sky.hlsl" );
+    DXUT_CHECK( cache.GetCompiles() == 6 && cache.GetHits() == 4 );
+
+    // As is an edit to the source itself
+    cache.Files[ L"Sky.hlsl" ] += " ";
+    cache.Compile( L"Sky.hlsl" );
+    DXUT_CHECK( cache.GetCompiles() == 7 && cache.GetMisses() == 7 );
+}
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( ShaderCacheIncludeInvalidation )
+{
+    CShaderCacheHarness cache;
+    AddShaders( cache );
+
+    cache.Compile( L"Scene.hlsl" );
+    cache.Compile( L"Sky.hlsl" );
+    DXUT_CHECK( cache.GetCompiles() == 2 );
+
+    // Editing a nested include makes the entry stale, and the rebuild sees the edit
+    cache.Files[ L"lighting.hlsli" ] = "float3 Light;\nfloat3 Ambient;\n";
+    std::string strCode = cache.Compile( L"Scene.hlsl" );
+    DXUT_CHECK( cache.GetCompiles() == 3 && cache.GetStale() == 1 );
+    DXUT_CHECK( strCode.find( "Ambient" ) != std::string::npos );
+
+    // Shaders that don't include it are untouched, and the rebuilt entry is used again
+    cache.Compile( L"Sky.hlsl" );
+    DXUT_CHECK( cache.Compile( L"Scene.hlsl" ) == strCode );
+    DXUT_CHECK( cache.GetCompiles() == 3 && cache.GetHits() == 2 );
+
+    // An include that can no longer be read is stale too, not a hit
+    cache.Files.erase( L"lighting.hlsli" );
+    DXUT_CHECK( cache.Compile( L"Scene.hlsl" ).empty() );
+    DXUT_CHECK( cache.GetCompiles() == 4 && cache.GetStale() == 2 );
+
+    // Restoring an earlier version of the file matches the rebuilt entry, not the first one
+    cache.Files[ L"lighting.hlsli" ] = "float3 Light;\n";
+    cache.Compile( L"Scene.hlsl" );
+    DXUT_CHECK( cache.GetCompiles() == 5 && cache.GetStale() == 3 );
+}
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( ShaderCacheCompilerIdentity )
+{
+    CShaderCacheHarness cache;
+    AddShaders( cache );
+
+    std::string strCodeA = cache.Compile( L"Scene.hlsl" );
+
+    // Another compiler never gets the first one's bytecode
+    cache.SetCompiler( "fxc-b" );
+    std::string strCodeB = cache.Compile( L"Scene.hlsl" );
+    DXUT_CHECK( cache.GetCompiles() == 2 && cache.GetMisses() == 2 );
+    DXUT_CHECK( strCodeB.compare( 0, 6, "fxc-b:" ) == 0 );
+
+    // Both entries are kept, so switching back is a hit
+    cache.SetCompiler( "fxc-a" );
+    DXUT_CHECK( cache.Compile( L"Scene.hlsl" ) == strCodeA );
+    cache.SetCompiler( "fxc-b" );
+    DXUT_CHECK( cache.Compile( L"Scene.hlsl" ) == strCodeB );
+    DXUT_CHECK( cache.GetCompiles() == 2 && cache.GetHits() == 2 );
+}
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( ShaderCacheRejectsDamagedEntries )
+{
+    const char s_Code[] = "bytecode";
+    std::vector<DXUT_SHADER_CACHE_DEPENDENCY> includes( 1 );
+    includes[0].strPath = L"common.hlsli";
+    includes[0].ContentHash = 42;
+
+    std::vector<uint8_t> entry;
+    DXUTBuildShaderCacheEntry( 7, includes, s_Code, sizeof( s_Code ), entry );
+
+    auto hashFile = []( const std::wstring&, uint64_t& hash ) -> bool { hash = 42; return true; };
+
+    std::vector<std::wstring> found( 1, L"Scene.hlsl" );
+    const uint8_t* pBytecode = nullptr;
+    uint32_t bytecodeBytes = 0;
+    DXUT_CHECK( DXUTCheckShaderCacheEntry( entry.data(), entry.size(), 7, hashFile, &found, &pBytecode, &bytecodeBytes ) == DXUT_SHADER_CACHE_HIT );
+    DXUT_CHECK( bytecodeBytes == sizeof( s_Code ) && memcmp( pBytecode, s_Code, sizeof( s_Code ) ) == 0 );
+    DXUT_CHECK( found.size() == 2 && found[1] == L"common.hlsli" );
+
+    // Another key, every truncation and trailing bytes are all misses
+    DXUT_CHECK( DXUTCheckShaderCacheEntry( entry.data(), entry.size(), 8, hashFile, &found, &pBytecode, &bytecodeBytes ) == DXUT_SHADER_CACHE_MISS );
+
+    int nNotMissed = 0;
+    for( size_t bytes = 0; bytes < entry.size(); ++bytes )
+    {
+        if( DXUTCheckShaderCacheEntry( entry.data(), bytes, 7, hashFile, &found, &pBytecode, &bytecodeBytes ) != DXUT_SHADER_CACHE_MISS )
+            ++nNotMissed;
+    }
+    DXUT_CHECK( nNotMissed == 0 );
+
+    entry.push_back( 0 );
+    DXUT_CHECK( DXUTCheckShaderCacheEntry( entry.data(), entry.size(), 7, hashFile, &found, &pBytecode, &bytecodeBytes ) == DXUT_SHADER_CACHE_MISS );
+    entry.pop_back();
+
+    // An earlier format version is a miss rather than being misread
+    DXUT_SHADER_CACHE_HEADER header;
+    memcpy( &header, entry.data(), sizeof( header ) );
+    header.Version = DXUT_SHADER_CACHE_VERSION - 1;
+    memcpy( entry.data(), &header, sizeof( header ) );
+    DXUT_CHECK( DXUTCheckShaderCacheEntry( entry.data(), entry.size(), 7, hashFile, &found, &pBytecode, &bytecodeBytes ) == DXUT_SHADER_CACHE_MISS );
+
+    // Nothing from the entries that weren't hits was reported
+    DXUT_CHECK( found.size() == 2 && !pBytecode && !bytecodeBytes );
+}
@@ -0,0 +1,337 @@
+//--------------------------------------------------------------------------------------
+// File: TestStreamingPolicy.cpp
+//
+// Drives CDXUTStreamingPolicy with a simulated device that applies downgrades at once and
+// finishes reads a few frames after they are issued, the way CDXUTTextureStreamer does,
+// and checks the budget, the in-flight limit and where each texture settles.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUTStreamingPolicy.h"
+#include "DXUTTests.h"
+
+#include <deque>
+
+namespace
+{
+
+const uint32_t READ_LATENCY_FRAMES = 3;
+
+struct SIMULATED_READ
+{
+    uint32_t Texture;
+    uint32_t TargetMip;
+    uint32_t Generation;
+    uint64_t DoneFrame;
+};
+
+//--------------------------------------------------------------------------------------
+// Square BC1 textures, with the tail starting at the first mip 64 pixels across or less
+//--------------------------------------------------------------------------------------
+class CSimulatedDevice
+{
+public:
+    CSimulatedDevice() :
+        m_nFrame( 0 ),
+        m_nStaleReads( 0 ),
+        m_nMaxInFlight( 0 ),
+        m_bOverCommitted( false )
+    {
+    }
+
+    uint32_t AddTexture( uint32_t nSize )
+    {
+        DXUT_STREAMING_TEXTURE tex = {};
+        tex.Width = nSize;
+        tex.Height = nSize;
+        while( ( nSize >> tex.MipCount ) && tex.MipCount < DXUT_STREAMING_MAX_MIPS )
+        {
+            uint32_t nBlocks = std::max<uint32_t>( ( ( nSize >> tex.MipCount ) + 3 ) / 4, 1 );
+            tex.MipBytes[tex.MipCount] = uint64_t( nBlocks ) * nBlocks * 8;
+            ++tex.MipCount;
+        }
+        while( CDXUTStreamingPolicy::MipSize( tex, tex.TailMip ) > 64 && tex.TailMip + 1 < tex.MipCount )
+            ++tex.TailMip;
+        tex.ResidentMip = tex.TailMip;
+        tex.PendingMip = tex.TailMip;
+
+        m_Textures.push_back( tex );
+        m_Generations.push_back( 0 );
+        return uint32_t( m_Textures.size() - 1 );
+    }
+
+    void RequestSize( uint32_t iTexture, uint32_t nPixels )
+    {
+        DXUT_STREAMING_TEXTURE& tex = m_Textures[iTexture];
+        if( tex.LastRequestFrame != m_nFrame )
+            tex.RequestedPixels = nPixels;
+        else
+            tex.RequestedPixels = std::max<uint32_t>( tex.RequestedPixels, nPixels );
+        tex.LastRequestFrame = m_nFrame;
+    }
+
+    // One CDXUTTextureStreamer::Update: finish reads, schedule, downgrade, issue reads
+    void Update( CDXUTStreamingPolicy& policy )
+    {
+        while( !m_Reads.empty() && m_Reads.front().DoneFrame <= m_nFrame )
+        {
+            SIMULATED_READ read = m_Reads.front();
+            m_Reads.pop_front();
+
+            DXUT_STREAMING_TEXTURE& tex = m_Textures[read.Texture];
+            if( read.Generation != m_Generations[read.Texture] )
+            {
+                ++m_nStaleReads;
+                continue;
+            }
+            tex.ResidentMip = read.TargetMip;
+            tex.PendingMip = read.TargetMip;
+        }
+
+        policy.Schedule( m_Textures, m_nFrame, m_Upgrades, m_Downgrades );
+
+        for( size_t i = 0; i < m_Downgrades.size(); ++i )
+        {
+            DXUT_STREAMING_TEXTURE& tex = m_Textures[m_Downgrades[i].Texture];
+            if( tex.PendingMip < m_Downgrades[i].TargetMip )
+                ++m_Generations[m_Downgrades[i].Texture];
+            tex.ResidentMip = std::max<uint32_t>( tex.ResidentMip, m_Downgrades[i].TargetMip );
+            tex.PendingMip = tex.ResidentMip;
+        }
+
+        for( size_t i = 0; i < m_Upgrades.size(); ++i )
+        {
+            SIMULATED_READ read;
+            read.Texture = m_Upgrades[i].Texture;
+            read.TargetMip = m_Upgrades[i].TargetMip;
+            read.Generation = m_Generations[read.Texture];
+            read.DoneFrame = m_nFrame + READ_LATENCY_FRAMES;
+            m_Reads.push_back( read );
+            m_Textures[read.Texture].PendingMip = read.TargetMip;
+        }
+
+        uint32_t nInFlight = 0;
+        for( size_t i = 0; i < m_Textures.size(); ++i )
+        {
+            if( m_Textures[i].PendingMip < m_Textures[i].ResidentMip )
+                ++nInFlight;
+        }
+        m_nMaxInFlight = std::max<uint32_t>( m_nMaxInFlight, nInFlight );
+        if( GetCommittedBytes() > policy.GetCommittedBytes() )
+            m_bOverCommitted = true;
+
+        ++m_nFrame;
+    }
+
+    // Resident, plus what the reads in flight will add
+    uint64_t GetCommittedBytes() const
+    {
+        uint64_t nBytes = 0;
+        for( size_t i = 0; i < m_Textures.size(); ++i )
+        {
+            const DXUT_STREAMING_TEXTURE& tex = m_Textures[i];
+            nBytes += CDXUTStreamingPolicy::BytesFrom( tex, std::min<uint32_t>( tex.ResidentMip, tex.PendingMip ) );
+        }
+        return nBytes;
+    }
+
+    uint64_t GetResidentBytes() const
+    {
+        uint64_t nBytes = 0;
+        for( size_t i = 0; i < m_Textures.size(); ++i )
+            nBytes += CDXUTStreamingPolicy::BytesFrom( m_Textures[i], m_Textures[i].ResidentMip );
+        return nBytes;
+    }
+
+    uint64_t GetTailBytes() const
+    {
+        uint64_t nBytes = 0;
+        for( size_t i = 0; i < m_Textures.size(); ++i )
+            nBytes += CDXUTStreamingPolicy::BytesFrom( m_Textures[i], m_Textures[i].TailMip );
+        return nBytes;
+    }
+
+    bool IsIdle() const { return m_Reads.empty() && m_Upgrades.empty() && m_Downgrades.empty(); }
+
+    std::vector<DXUT_STREAMING_TEXTURE> m_Textures;
+    uint64_t m_nFrame;
+    uint32_t m_nStaleReads;
+    uint32_t m_nMaxInFlight;
+    bool m_bOverCommitted;     // More resident or in flight than the policy accounted for
+
+private:
+    std::vector<uint32_t> m_Generations;
+    std::deque<SIMULATED_READ> m_Reads;
+    std::vector<DXUT_STREAMING_REQUEST> m_Upgrades;
+    std::vector<DXUT_STREAMING_REQUEST> m_Downgrades;
+};
+
+// Sizes on screen for the textures added by AddTestTextures
+const uint32_t s_TextureSizes[] = { 2048, 2048, 1024, 1024, 512, 4096, 256, 2048 };
+const uint32_t s_RequestedPixels[] = { 1900, 300, 1024, 90, 512, 3000, 64, 700 };
+
+void AddTestTextures( CSimulatedDevice& device )
+{
+    for( size_t i = 0; i < sizeof( s_TextureSizes ) / sizeof( s_TextureSizes[0] ); ++i )
+        device.AddTexture( s_TextureSizes[i] );
+}
+
+void RequestTestSizes( CSimulatedDevice& device )
+{
+    for( size_t i = 0; i < sizeof( s_RequestedPixels ) / sizeof( s_RequestedPixels[0] ); ++i )
+        device.RequestSize( uint32_t( i ), s_RequestedPixels[i] );
+}
+
+// Runs frames with the test sizes requested until nothing moves, checking every frame
+// that what is resident or in flight fits the policy's budget
+bool RunUntilIdle( CSimulatedDevice& device, CDXUTStreamingPolicy& policy )
+{
+    for( int i = 0; i < 1000; ++i )
+    {
+        RequestTestSizes( device );
+        device.Update( policy );
+        DXUT_CHECK( !policy.GetBudget() || device.GetCommittedBytes() <= policy.GetBudget() );
+        if( device.IsIdle() )
+            return true;
+    }
+    return false;
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( StreamingPolicySettlesOnIdealMips )
+{
+    CDXUTStreamingPolicy policy;
+    policy.SetMaxUpgradesInFlight( 2 );
+
+    CSimulatedDevice device;
+    AddTestTextures( device );
+    DXUT_CHECK( RunUntilIdle( device, policy ) );
+
+    for( size_t i = 0; i < device.m_Textures.size(); ++i )
+    {
+        const DXUT_STREAMING_TEXTURE& tex = device.m_Textures[i];
+        DXUT_CHECK( tex.ResidentMip == policy.GetIdealMip( tex, device.m_nFrame ) );
+        DXUT_CHECK( tex.ResidentMip == tex.TailMip || CDXUTStreamingPolicy::MipSize( tex, tex.ResidentMip ) >= tex.RequestedPixels );
+        DXUT_CHECK( tex.ResidentMip == tex.TailMip || CDXUTStreamingPolicy::MipSize( tex, tex.ResidentMip + 1 ) < tex.RequestedPixels );
+    }
+
+    DXUT_CHECK( device.m_nMaxInFlight == 2 );
+    DXUT_CHECK( !device.m_bOverCommitted );
+    DXUT_CHECK( device.GetResidentBytes() == policy.GetIdealBytes() );
+    DXUT_CHECK( policy.GetDesiredBytes() == policy.GetIdealBytes() );
+}
+
+
+//--------------------------------------------------------------------------------------
+// Streams in under a budget from the tails, then cuts the budget in steps
+//--------------------------------------------------------------------------------------
+DXUT_TEST( StreamingPolicyKeepsToBudget )
+{
+    CDXUTStreamingPolicy policy;
+    CSimulatedDevice device;
+    AddTestTextures( device );
+    DXUT_CHECK( RunUntilIdle( device, policy ) );
+    uint64_t nIdealBytes = policy.GetIdealBytes();
+    uint64_t nTailBytes = device.GetTailBytes();
+
+    CSimulatedDevice fresh;
+    AddTestTextures( fresh );
+    policy.SetBudget( nIdealBytes / 2 );
+    DXUT_CHECK( RunUntilIdle( fresh, policy ) );
+    DXUT_CHECK( fresh.GetResidentBytes() == policy.GetDesiredBytes() );
+    DXUT_CHECK( fresh.GetResidentBytes() > nTailBytes );
+    DXUT_CHECK( !fresh.m_bOverCommitted );
+
+    for( int nPercent = 90; nPercent > 0; nPercent -= 20 )
+    {
+        uint64_t nBudget = std::max<uint64_t>( nIdealBytes * uint64_t( nPercent ) / 100, nTailBytes );
+        policy.SetBudget( nBudget );
+        DXUT_CHECK( RunUntilIdle( device, policy ) );
+        DXUT_CHECK( !device.m_bOverCommitted );
+        DXUT_CHECK( device.GetResidentBytes() <= nBudget );
+        DXUT_CHECK( device.GetResidentBytes() == policy.GetDesiredBytes() );
+
+        // The first cut only takes the 4096's top mip, which frees the most bytes for the
+        // least magnification
+        if( nPercent == 90 )
+        {
+            for( size_t i = 0; i < device.m_Textures.size(); ++i )
+            {
+                const DXUT_STREAMING_TEXTURE& tex = device.m_Textures[i];
+                DXUT_CHECK( tex.ResidentMip == policy.GetIdealMip( tex, device.m_nFrame ) + ( i == 5 ? 1 : 0 ) );
+            }
+        }
+
+        // Of the 2048s, the one shown largest never has less detail
+        DXUT_CHECK( device.m_Textures[0].ResidentMip <= device.m_Textures[1].ResidentMip );
+        DXUT_CHECK( device.m_Textures[0].ResidentMip <= device.m_Textures[7].ResidentMip );
+    }
+
+    // Raising the budget again brings everything back
+    policy.SetBudget( 0 );
+    DXUT_CHECK( RunUntilIdle( device, policy ) );
+    DXUT_CHECK( device.GetResidentBytes() == nIdealBytes );
+}
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( StreamingPolicyIdleAndCancelledReads )
+{
+    CDXUTStreamingPolicy policy;
+    policy.SetIdleFrames( 5 );
+
+    CSimulatedDevice device;
+    uint32_t iShown = device.AddTexture( 2048 );
+    uint32_t iHidden = device.AddTexture( 2048 );
+    uint32_t iPinned = device.AddTexture( 2048 );
+    device.m_Textures[iPinned].MinMip = 3;
+
+    for( int i = 0; i < 20; ++i )
+    {
+        device.RequestSize( iShown, 2048 );
+        device.RequestSize( iHidden, 2048 );
+        device.RequestSize( iPinned, 2048 );
+        device.Update( policy );
+    }
+    DXUT_CHECK( device.IsIdle() );
+    DXUT_CHECK( device.m_Textures[iShown].ResidentMip == 0 );
+    DXUT_CHECK( device.m_Textures[iHidden].ResidentMip == 0 );
+    DXUT_CHECK( device.m_Textures[iPinned].ResidentMip == 3 );
+
+    // Not asked for: kept through the idle frames, then back to the tail
+    for( int i = 0; i < 5; ++i )
+    {
+        device.RequestSize( iShown, 2048 );
+        device.Update( policy );
+        DXUT_CHECK( device.m_Textures[iHidden].ResidentMip == 0 );
+    }
+    device.RequestSize( iShown, 2048 );
+    device.Update( policy );
+    DXUT_CHECK( device.m_Textures[iHidden].ResidentMip == device.m_Textures[iHidden].TailMip );
+
+    // Shrinking on screen while the read for it is in flight cancels the read
+    device.RequestSize( iHidden, 2048 );
+    device.Update( policy );
+    DXUT_CHECK( device.m_Textures[iHidden].PendingMip == 0 );
+    device.RequestSize( iHidden, 16 );
+    device.Update( policy );
+    DXUT_CHECK( device.m_Textures[iHidden].PendingMip == device.m_Textures[iHidden].ResidentMip );
+
+    for( uint32_t i = 0; i < READ_LATENCY_FRAMES; ++i )
+    {
+        device.RequestSize( iHidden, 16 );
+        device.Update( policy );
+    }
+    DXUT_CHECK( device.m_nStaleReads == 1 );
+    DXUT_CHECK( device.m_Textures[iHidden].ResidentMip == device.m_Textures[iHidden].TailMip );
+}
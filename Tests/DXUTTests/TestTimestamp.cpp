@@ -0,0 +1,188 @@
+//--------------------------------------------------------------------------------------
+// File: TestTimestamp.cpp
+//
+// Checks that DXUTReadMonotonicTimestamp never goes backwards on a thread that is moved
+// from core to core, and that the clamp behind it is kept per thread.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUTTimestamp.h"
+#include "DXUTTests.h"
+
+#include <stdio.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sched.h>
+#endif
+
+namespace
+{
+
+const int MIGRATION_ROUNDS = 200;
+const int READS_PER_CORE = 64;
+
+//--------------------------------------------------------------------------------------
+// Cores the process may run on, and moving the calling thread to one of them
+//--------------------------------------------------------------------------------------
+std::vector<int> GetAllowedCores()
+{
+    std::vector<int> cores;
+#ifdef _WIN32
+    DWORD_PTR processMask = 0, systemMask = 0;
+    if( GetProcessAffinityMask( GetCurrentProcess(), &processMask, &systemMask ) )
+    {
+        for( int i = 0; i < int( sizeof( DWORD_PTR ) * 8 ); ++i )
+        {
+            if( processMask & ( DWORD_PTR( 1 ) << i ) )
+                cores.push_back( i );
+        }
+    }
+#else
+    cpu_set_t set;
+    CPU_ZERO( &set );
+    if( sched_getaffinity( 0, sizeof( set ), &set ) == 0 )
+    {
+        for( int i = 0; i < CPU_SETSIZE; ++i )
+        {
+            if( CPU_ISSET( i, &set ) )
+                cores.push_back( i );
+        }
+    }
+#endif
+    return cores;
+}
+
+bool MoveToCore( int iCore )
+{
+#ifdef _WIN32
+    return SetThreadAffinityMask( GetCurrentThread(), DWORD_PTR( 1 ) << iCore ) != 0;
+#else
+    cpu_set_t set;
+    CPU_ZERO( &set );
+    CPU_SET( iCore, &set );
+    return sched_setaffinity( 0, sizeof( set ), &set ) == 0;
+#endif
+}
+
+// Lets the thread run anywhere again
+void AllowCores( const std::vector<int>& cores )
+{
+#ifdef _WIN32
+    DWORD_PTR mask = 0;
+    for( size_t i = 0; i < cores.size(); ++i )
+        mask |= DWORD_PTR( 1 ) << cores[i];
+    SetThreadAffinityMask( GetCurrentThread(), mask );
+#else
+    cpu_set_t set;
+    CPU_ZERO( &set );
+    for( size_t i = 0; i < cores.size(); ++i )
+        CPU_SET( cores[i], &set );
+    sched_setaffinity( 0, sizeof( set ), &set );
+#endif
+}
+
+//--------------------------------------------------------------------------------------
+// Walks the thread over every core, in an order that changes each round, reading the
+// timestamp on each.  Returns the number of readings that went backwards.
+//--------------------------------------------------------------------------------------
+int MigrateAndRead( const std::vector<int>& cores, int nSeed, int& nMigrations )
+{
+    int nBackwards = 0;
+    int64_t llLast = DXUTReadMonotonicTimestamp();
+    for( int iRound = 0; iRound < MIGRATION_ROUNDS; ++iRound )
+    {
+        for( size_t i = 0; i < cores.size(); ++i )
+        {
+            int iCore = cores[ ( i * 7 + size_t( iRound ) + size_t( nSeed ) ) % cores.size() ];
+            if( MoveToCore( iCore ) )
+                ++nMigrations;
+
+            for( int iRead = 0; iRead < READS_PER_CORE; ++iRead )
+            {
+                int64_t llNow = DXUTReadMonotonicTimestamp();
+                if( llNow < llLast )
+                    ++nBackwards;
+                llLast = llNow;
+            }
+        }
+    }
+
+    AllowCores( cores );
+    return nBackwards;
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( TimestampClampIsPerThread )
+{
+    // Fresh threads, so the made-up readings don't clamp this thread's real ones
+    int64_t results[6] = {};
+    std::thread a( [&]()
+    {
+        results[0] = DXUTClampTimestamp( 100 );
+        results[1] = DXUTClampTimestamp( 90 );      // Backwards: held at 100
+        results[2] = DXUTClampTimestamp( 120 );
+    } );
+    a.join();
+
+    std::thread b( [&]()
+    {
+        results[3] = DXUTClampTimestamp( 50 );      // Not held back by the other thread
+        results[4] = DXUTClampTimestamp( 49 );
+        results[5] = DXUTClampTimestamp( 51 );
+    } );
+    b.join();
+
+    DXUT_CHECK( results[0] == 100 && results[1] == 100 && results[2] == 120 );
+    DXUT_CHECK( results[3] == 50 && results[4] == 50 && results[5] == 51 );
+
+    DXUT_CHECK( DXUTRawTimestampFrequency() > 0 );
+}
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( TimestampMonotonicAcrossCores )
+{
+    std::vector<int> cores = GetAllowedCores();
+    DXUT_CHECK( !cores.empty() );
+    if( cores.empty() )
+        return;
+
+    // One thread per core, all migrating at once, so the moves land on busy cores too
+    size_t nThreads = std::max<size_t>( cores.size(), 2 );
+    std::vector<int> backwards( nThreads, 0 );
+    std::vector<int> migrations( nThreads, 0 );
+    std::vector<std::thread> threads;
+
+    int64_t llStart = DXUTReadMonotonicTimestamp();
+    for( size_t i = 0; i < nThreads; ++i )
+        threads.push_back( std::thread( [&, i]() { backwards[i] = MigrateAndRead( cores, int( i ), migrations[i] ); } ) );
+    for( size_t i = 0; i < threads.size(); ++i )
+        threads[i].join();
+    double fSeconds = double( DXUTReadMonotonicTimestamp() - llStart ) / double( DXUTRawTimestampFrequency() );
+
+    int nBackwards = 0;
+    int nMigrations = 0;
+    for( size_t i = 0; i < nThreads; ++i )
+    {
+        nBackwards += backwards[i];
+        nMigrations += migrations[i];
+    }
+
+    DXUT_CHECK( nBackwards == 0 );
+    DXUT_CHECK( nMigrations > 0 );
+    printf( "  %u threads over %u cores: %d migrations, %d backward readings, %.1f ms\n",
+            unsigned( nThreads ), unsigned( cores.size() ), nMigrations, nBackwards, fSeconds * 1000.0 );
+}
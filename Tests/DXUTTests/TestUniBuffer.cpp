@@ -0,0 +1,200 @@
+//--------------------------------------------------------------------------------------
+// File: TestUniBuffer.cpp
+//
+// Checks the gap buffer behind CUniBuffer against a plain string, and times typing 32K
+// characters into the middle of an edit box's text with a read of the text after every
+// key, as the edit box does when it renders.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUTGapBuffer.h"
+#include "DXUTTests.h"
+
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+namespace
+{
+
+const int MAX_TEXT_SIZE = 0xFFFF;
+const int TYPING_CHARACTERS = 32 * 1024;
+
+double SecondsSince( std::chrono::high_resolution_clock::time_point start )
+{
+    return std::chrono::duration<double>( std::chrono::high_resolution_clock::now() - start ).count();
+}
+
+std::wstring JoinSpans( const CDXUTGapBuffer& buffer, int nFirst )
+{
+    const wchar_t* pFirst;
+    const wchar_t* pSecond;
+    int nFirstCount, nSecondCount;
+    buffer.GetSpans( nFirst, &pFirst, &nFirstCount, &pSecond, &nSecondCount );
+    return std::wstring( pFirst, nFirstCount ) + std::wstring( pSecond, nSecondCount );
+}
+
+// Checks every way of reading the text.  The contiguous reads may move the gap.
+bool BufferMatches( CDXUTGapBuffer& buffer, const std::wstring& expected )
+{
+    if( buffer.GetTextSize() != int( expected.size() ) )
+        return false;
+    for( int i = 0; i < buffer.GetTextSize(); ++i )
+    {
+        if( buffer[i] != expected[i] )
+            return false;
+    }
+    if( buffer[ buffer.GetTextSize() ] != L'\0' )
+        return false;
+
+    for( int i = 0; i <= buffer.GetTextSize(); i += 3 )
+    {
+        if( JoinSpans( buffer, i ) != expected.substr( i ) )
+            return false;
+    }
+
+    // A range ending at the nul, and one either side of the middle
+    int nMiddle = buffer.GetTextSize() / 2;
+    const wchar_t* pTail = buffer.GetContiguous( nMiddle, buffer.GetTextSize() + 1 - nMiddle );
+    if( wcscmp( pTail, expected.c_str() + nMiddle ) )
+        return false;
+    int nCount = std::min<int>( 4, buffer.GetTextSize() - nMiddle );
+    const wchar_t* pRange = buffer.GetContiguous( nMiddle, nCount );
+    if( expected.compare( nMiddle, nCount, std::wstring( pRange, nCount ) ) )
+        return false;
+
+    return !wcscmp( buffer.GetBuffer(), expected.c_str() );
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( UniBufferEditsMatchString )
+{
+    CDXUTGapBuffer buffer( MAX_TEXT_SIZE );
+    std::wstring expected;
+
+    DXUT_CHECK( buffer.SetText( L"Hello world" ) );
+    expected = L"Hello world";
+    DXUT_CHECK( BufferMatches( buffer, expected ) );
+
+    // Edits in the middle leave the gap inside the text
+    DXUT_CHECK( buffer.InsertString( 5, L", big", 5 ) );
+    expected.insert( 5, L", big" );
+    DXUT_CHECK( buffer.GetGapStart() == 10 );
+    DXUT_CHECK( BufferMatches( buffer, expected ) );
+
+    DXUT_CHECK( buffer.InsertString( 10, L"!", 1 ) );
+    expected.insert( 10, 1, L'!' );
+    DXUT_CHECK( BufferMatches( buffer, expected ) );
+
+    DXUT_CHECK( buffer.RemoveString( 0, 2 ) );
+    expected.erase( 0, 2 );
+    DXUT_CHECK( BufferMatches( buffer, expected ) );
+
+    buffer.At( 3 ) = L'L';
+    expected[3] = L'L';
+    DXUT_CHECK( BufferMatches( buffer, expected ) );
+
+    DXUT_CHECK( buffer.RemoveString( buffer.GetTextSize() - 1, 1 ) );
+    expected.erase( expected.size() - 1 );
+    DXUT_CHECK( BufferMatches( buffer, expected ) );
+
+    DXUT_CHECK( !buffer.RemoveString( 4, 100 ) );
+    DXUT_CHECK( !buffer.InsertString( buffer.GetTextSize() + 1, L"x", 1 ) );
+    DXUT_CHECK( BufferMatches( buffer, expected ) );
+
+    // Growing the buffer with the gap inside the text
+    DXUT_CHECK( buffer.InsertString( 2, L"ab", 2 ) );
+    expected.insert( 2, L"ab" );
+    std::wstring strLong( 1000, L'z' );
+    DXUT_CHECK( buffer.InsertString( 6, strLong.c_str(), int( strLong.size() ) ) );
+    expected.insert( 6, strLong );
+    DXUT_CHECK( BufferMatches( buffer, expected ) );
+
+    // Nothing past the maximum size
+    CDXUTGapBuffer small( 16 );
+    DXUT_CHECK( small.InsertString( 0, L"0123456789abcde", 15 ) );
+    DXUT_CHECK( !small.InsertString( 15, L"f", 1 ) );
+    DXUT_CHECK( BufferMatches( small, L"0123456789abcde" ) );
+
+    buffer.Clear();
+    DXUT_CHECK( buffer.GetTextSize() == 0 );
+    DXUT_CHECK( BufferMatches( buffer, L"" ) );
+}
+
+
+//--------------------------------------------------------------------------------------
+// Types into the middle, jumping back there now and then and deleting every so often,
+// and reads the text after every key through the spans, as CDXUTEditBox::Render does.
+// The same typing with a GetBuffer read per key is timed for comparison.
+//--------------------------------------------------------------------------------------
+DXUT_TEST( UniBufferTyping32K )
+{
+    double fSeconds[2] = {};
+    size_t nChecksums[2] = {};
+    bool bGapStayed = true;
+    for( int iRead = 0; iRead < 2; ++iRead )
+    {
+        CDXUTGapBuffer buffer( MAX_TEXT_SIZE );
+        std::wstring expected;
+
+        int nCaret = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for( int i = 0; i < TYPING_CHARACTERS; ++i )
+        {
+            if( ( i % 64 ) == 0 )
+                nCaret = buffer.GetTextSize() / 2;
+
+            wchar_t wch = ( i % 6 ) ? wchar_t( L'a' + i % 26 ) : L' ';
+            if( !buffer.InsertString( nCaret, &wch, 1 ) )
+                break;
+            if( iRead == 0 )
+                expected.insert( expected.begin() + nCaret, wch );
+            ++nCaret;
+
+            if( ( i % 7 ) == 6 )
+            {
+                --nCaret;
+                buffer.RemoveString( nCaret, 1 );
+                if( iRead == 0 )
+                    expected.erase( nCaret, 1 );
+            }
+
+            int nRead = buffer.GetTextSize() / 3;
+            if( iRead == 0 )
+            {
+                const wchar_t* pFirst;
+                const wchar_t* pSecond;
+                int nFirst, nSecond;
+                buffer.GetSpans( nRead, &pFirst, &nFirst, &pSecond, &nSecond );
+                nChecksums[0] += nFirst ? pFirst[0] : pSecond[0];
+                bGapStayed &= ( buffer.GetGapStart() == nCaret );
+            }
+            else
+            {
+                nChecksums[1] += buffer.GetBuffer()[ nRead ];
+            }
+        }
+        fSeconds[iRead] = SecondsSince( start );
+
+        if( iRead == 0 )
+            DXUT_CHECK( BufferMatches( buffer, expected ) );
+    }
+
+    DXUT_CHECK( nChecksums[0] != 0 );
+    DXUT_CHECK( nChecksums[0] == nChecksums[1] );
+    DXUT_CHECK( bGapStayed );
+
+    printf( "  %d keys, reading the spans: %.2f ms, %.3f us per key and read; reading GetBuffer: %.2f ms\n",
+            TYPING_CHARACTERS, fSeconds[0] * 1000.0, fSeconds[0] * 1000000.0 / TYPING_CHARACTERS, fSeconds[1] * 1000.0 );
+}
@@ -0,0 +1,114 @@
+//--------------------------------------------------------------------------------------
+// File: TestUniBufferShaping.cpp
+//
+// Shapes CUniBuffer text with the gap inside a line and checks that Uniscribe sees the
+// same text as when the gap is at the end, and times shaping a line typed to 32K
+// characters.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUT.h"
+#include "DXUTgui.h"
+#include "DXUTTests.h"
+
+#include <string>
+
+namespace
+{
+
+const int TYPING_CHARACTERS = 32 * 1024;
+
+void InitFont( DXUTFontNode& font )
+{
+    wcscpy_s( font.strFace, L"Arial" );
+    font.nHeight = 16;
+    font.nWeight = FW_NORMAL;
+}
+
+// Every caret position's x, and the word stops either side of it
+std::vector<int> Layout( CUniBuffer& buffer )
+{
+    std::vector<int> layout;
+    for( int i = 0; i <= buffer.GetTextSize(); ++i )
+    {
+        int nX = 0, nPrior = 0, nNext = 0;
+        buffer.CPtoX( i, FALSE, &nX );
+        buffer.GetPriorItemPos( i, &nPrior );
+        buffer.GetNextItemPos( i, &nNext );
+        layout.push_back( nX );
+        layout.push_back( nPrior );
+        layout.push_back( nNext );
+    }
+    return layout;
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( UniBufferShapesAcrossGap )
+{
+    DXUTFontNode font;
+    InitFont( font );
+
+    const WCHAR szText[] = L"The quick brown fox\njumps over\nthe lazy dog";
+
+    // The gap at the end, as SetText leaves it
+    CUniBuffer whole;
+    whole.SetFontNode( &font );
+    DXUT_CHECK( whole.SetText( szText ) );
+    std::vector<int> expected = Layout( whole );
+
+    // The same text typed with the gap left inside the middle line
+    CUniBuffer edited;
+    edited.SetFontNode( &font );
+    std::wstring strText( szText );
+    size_t nSplit = strText.find( L"over" );
+    DXUT_CHECK( edited.SetText( strText.substr( 0, nSplit ).c_str() ) );
+    DXUT_CHECK( edited.InsertString( int( nSplit ), strText.c_str() + nSplit ) );
+    DXUT_CHECK( edited.InsertString( int( nSplit ), L"" ) );     // Moves the gap back to the split
+    DXUT_CHECK( Layout( edited ) == expected );
+    DXUT_CHECK( !wcscmp( edited.GetBuffer(), szText ) );
+
+    // One character changed in the middle is re-shaped without disturbing the rest
+    DXUT_CHECK( edited.ReplaceChar( 4, L'q' ) );
+    DXUT_CHECK( whole.ReplaceChar( 4, L'q' ) );
+    DXUT_CHECK( Layout( edited ) == Layout( whole ) );
+}
+
+
+//--------------------------------------------------------------------------------------
+DXUT_TEST( UniBufferShapingTyped32K )
+{
+    DXUTFontNode font;
+    InitFont( font );
+
+    CUniBuffer buffer;
+    buffer.SetFontNode( &font );
+
+    int nCaret = 0;
+    for( int i = 0; i < TYPING_CHARACTERS; ++i )
+    {
+        if( ( i % 64 ) == 0 )
+            nCaret = buffer.GetTextSize() / 2;
+
+        WCHAR wch = ( i % 6 ) ? WCHAR( L'a' + i % 26 ) : L' ';
+        if( !buffer.InsertChar( nCaret++, wch ) )
+            break;
+    }
+
+    LONGLONG llStart = DXUTGetTimestamp();
+    int nX = 0;
+    DXUT_CHECK( buffer.CPtoX( buffer.GetTextSize(), FALSE, &nX ) );
+    double fShapeSeconds = DXUTTimestampToSeconds( DXUTGetTimestamp() - llStart );
+    DXUT_CHECK( nX > 0 );
+
+    printf( "  Shaping %d characters typed into the middle: %.2f ms\n", buffer.GetTextSize(), fShapeSeconds * 1000.0 );
+}
@@ -0,0 +1,110 @@
+//--------------------------------------------------------------------------------------
+// File: DXUTPack.cpp
+//
+// Packs a media directory into a DXUT archive and lists what went in.
+//
+//   DXUTPack [-c] <source directory> <archive>
+//
+// -c compresses each entry with LZ4 when that saves at least an eighth of its size.
+// Entries are named relative to the source directory, so the directory packed should be
+// the one the application's media names are relative to.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUT.h"
+#include "DXUTarchive.h"
+
+namespace
+{
+
+//--------------------------------------------------------------------------------------
+void PrintUsage()
+{
+    wprintf( L"Usage: DXUTPack [-c] <source directory> <archive>\n"
+             L"  -c  LZ4 compress the entries that shrink by at least an eighth\n" );
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+int __cdecl wmain( _In_ int argc, _In_z_count_(argc) wchar_t* argv[] )
+{
+    DWORD dwFlags = 0;
+    const wchar_t* szSourceDir = nullptr;
+    const wchar_t* szArchive = nullptr;
+
+    for( int i = 1; i < argc; ++i )
+    {
+        if( !_wcsicmp( argv[i], L"-c" ) )
+        {
+            dwFlags |= DXUT_ARCHIVE_COMPRESS;
+        }
+        else if( argv[i][0] == L'-' )
+        {
+            PrintUsage();
+            return 1;
+        }
+        else if( !szSourceDir )
+        {
+            szSourceDir = argv[i];
+        }
+        else if( !szArchive )
+        {
+            szArchive = argv[i];
+        }
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    if( !szSourceDir || !szArchive )
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    LONGLONG llStart = DXUTGetTimestamp();
+    HRESULT hr = DXUTCreateArchive( szArchive, szSourceDir, dwFlags );
+    if( FAILED( hr ) )
+    {
+        wprintf( L"Cannot pack %ls into %ls (%08X)\n", szSourceDir, szArchive, hr );
+        return 1;
+    }
+    double fSeconds = DXUTTimestampToSeconds( DXUTGetTimestamp() - llStart );
+
+    CDXUTArchive archive;
+    hr = archive.Open( szArchive );
+    if( FAILED( hr ) )
+    {
+        wprintf( L"Cannot open %ls after packing (%08X)\n", szArchive, hr );
+        return 1;
+    }
+
+    UINT64 nBytes = 0;
+    UINT64 nStoredBytes = 0;
+    UINT nCompressed = 0;
+    for( UINT i = 0; i < archive.GetNumEntries(); ++i )
+    {
+        const DXUT_ARCHIVE_ENTRY* pEntry = archive.GetEntry( i );
+        wprintf( L"  %ls  %llu -> %llu%ls\n", archive.GetEntryName( pEntry ), pEntry->Bytes, pEntry->StoredBytes,
+                 ( pEntry->Compression == DXUT_ARCHIVE_LZ4 ) ? L" lz4" : L"" );
+        nBytes += pEntry->Bytes;
+        nStoredBytes += pEntry->StoredBytes;
+        if( pEntry->Compression == DXUT_ARCHIVE_LZ4 )
+            ++nCompressed;
+    }
+
+    wprintf( L"%ls: %u entries, %u compressed, %llu -> %llu bytes in %.3f s\n", szArchive, archive.GetNumEntries(),
+             nCompressed, nBytes, nStoredBytes, fSeconds );
+    return 0;
+}
@@ -0,0 +1,178 @@
+//--------------------------------------------------------------------------------------
+// File: SDKMeshOpt.cpp
+//
+// Runs the SDKmesh vertex cache optimizer over a file and reports the cache miss ratios
+// before and after, optionally quantizing the vertex streams first.
+//
+//   SDKMeshOpt [-cache <n>] [-quantize] [-n] <input.sdkmesh> [<output.sdkmesh>]
+//
+// -quantize packs the vertex elements with DXUTQuantizeSDKMeshInPlace; the file keeps its
+// size.  -n only measures; otherwise the converted mesh is written to the output, or back
+// over the input when no output is named.
+//
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//
+// Copyright (c) Microsoft Corporation. All rights reserved.
+//
+// http://go.microsoft.com/fwlink/?LinkId=320437
+//--------------------------------------------------------------------------------------
+#include "DXUT.h"
+#include "SDKmesh.h"
+
+namespace
+{
+
+//--------------------------------------------------------------------------------------
+bool ReadWholeFile( _In_z_ const wchar_t* szFile, _Inout_ std::vector<BYTE>& data )
+{
+    FILE* fp = nullptr;
+    if( _wfopen_s( &fp, szFile, L"rb" ) || !fp )
+        return false;
+
+    bool bOK = false;
+    if( !fseek( fp, 0, SEEK_END ) )
+    {
+        long nBytes = ftell( fp );
+        if( nBytes > 0 && !fseek( fp, 0, SEEK_SET ) )
+        {
+            data.resize( size_t( nBytes ) );
+            bOK = ( fread( data.data(), 1, data.size(), fp ) == data.size() );
+        }
+    }
+
+    fclose( fp );
+    return bOK;
+}
+
+
+//--------------------------------------------------------------------------------------
+bool WriteWholeFile( _In_z_ const wchar_t* szFile, _In_ const std::vector<BYTE>& data )
+{
+    FILE* fp = nullptr;
+    if( _wfopen_s( &fp, szFile, L"wb" ) || !fp )
+        return false;
+
+    bool bOK = ( fwrite( data.data(), 1, data.size(), fp ) == data.size() );
+    if( fclose( fp ) )
+        bOK = false;
+    return bOK;
+}
+
+
+//--------------------------------------------------------------------------------------
+void PrintUsage()
+{
+    wprintf( L"Usage: SDKMeshOpt [-cache <n>] [-quantize] [-n] <input.sdkmesh> [<output.sdkmesh>]\n"
+             L"  -cache <n>  FIFO vertex cache size to optimize and measure for (default %u)\n"
+             L"  -quantize   Quantize the vertex streams before optimizing\n"
+             L"  -n          Report the ratios without writing anything\n",
+             SDKMESH_DEFAULT_VCACHE_SIZE );
+}
+
+};
+
+
+//--------------------------------------------------------------------------------------
+int __cdecl wmain( _In_ int argc, _In_z_count_(argc) wchar_t* argv[] )
+{
+    UINT nCacheSize = SDKMESH_DEFAULT_VCACHE_SIZE;
+    bool bQuantize = false;
+    bool bMeasureOnly = false;
+    const wchar_t* szInput = nullptr;
+    const wchar_t* szOutput = nullptr;
+
+    for( int i = 1; i < argc; ++i )
+    {
+        if( !_wcsicmp( argv[i], L"-cache" ) && i + 1 < argc )
+        {
+            nCacheSize = _wtoi( argv[++i] );
+        }
+        else if( !_wcsicmp( argv[i], L"-quantize" ) )
+        {
+            bQuantize = true;
+        }
+        else if( !_wcsicmp( argv[i], L"-n" ) )
+        {
+            bMeasureOnly = true;
+        }
+        else if( argv[i][0] == L'-' )
+        {
+            PrintUsage();
+            return 1;
+        }
+        else if( !szInput )
+        {
+            szInput = argv[i];
+        }
+        else if( !szOutput )
+        {
+            szOutput = argv[i];
+        }
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    if( !szInput || !nCacheSize )
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    std::vector<BYTE> data;
+    if( !ReadWholeFile( szInput, data ) )
+    {
+        wprintf( L"Cannot read %ls\n", szInput );
+        return 1;
+    }
+
+    HRESULT hr;
+    if( bQuantize )
+    {
+        SDKMESH_QUANTIZE_STATS quantizeStats;
+        hr = DXUTQuantizeSDKMeshInPlace( data.data(), data.size(), &quantizeStats );
+        if( FAILED( hr ) )
+        {
+            wprintf( L"%ls is not a mesh the quantizer accepts (%08X)\n", szInput, hr );
+            return 1;
+        }
+
+        wprintf( L"%ls: %u vertex buffers quantized, %llu -> %llu vertex bytes\n", szInput,
+                 quantizeStats.NumVertexBuffersQuantized, quantizeStats.VertexBytesBefore,
+                 quantizeStats.VertexBytesAfter );
+    }
+
+    SDKMESH_OPTIMIZE_STATS stats;
+    hr = DXUTOptimizeSDKMeshInPlace( data.data(), data.size(), nCacheSize, &stats );
+    if( FAILED( hr ) )
+    {
+        wprintf( L"%ls is not a mesh the optimizer accepts (%08X)\n", szInput, hr );
+        return 1;
+    }
+
+    wprintf( L"%ls: %llu triangles, %llu vertices, cache of %u\n", szInput, stats.NumTriangles,
+             stats.NumReferencedVertices, nCacheSize );
+    wprintf( L"  ACMR %.3f -> %.3f\n", stats.ACMRBefore, stats.ACMRAfter );
+    wprintf( L"  ATVR %.3f -> %.3f\n", stats.ATVRBefore, stats.ATVRAfter );
+    wprintf( L"  %llu -> %llu cache misses, %u vertex buffers reordered, %u index buffers shrunk\n",
+             stats.CacheMissesBefore, stats.CacheMissesAfter, stats.NumVertexBuffersReordered,
+             stats.NumIndexBuffersShrunk );
+
+    if( bMeasureOnly )
+        return 0;
+
+    if( !szOutput )
+        szOutput = szInput;
+    if( !WriteWholeFile( szOutput, data ) )
+    {
+        wprintf( L"Cannot write %ls\n", szOutput );
+        return 1;
+    }
+
+    return 0;
+}